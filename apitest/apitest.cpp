@@ -0,0 +1,343 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the tests of the C++ API of the frontend, see frontend.h,
+// which java2mpl can't reach from its options. Each test parses sources in
+// memory and checks the results against those of a plain parse.
+//
+// usage: apitest [name ...]
+//   name : only run the tests whose names start with one of them
+//////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "frontend.h"
+#include "work_pool.h"
+#include "parse_server.h"
+#include "mem_stats.h"
+#include "ast.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//                             The framework
+//////////////////////////////////////////////////////////////////////////////
+
+typedef void (*TestFunc)();
+
+struct Test {
+  const char *mName;
+  TestFunc    mFunc;
+};
+
+static unsigned gChecks = 0;
+static unsigned gFailed = 0;
+
+static void Check(const char *name, bool ok, const std::string &msg) {
+  gChecks++;
+  if (ok) {
+    std::cout << "  pass " << name << std::endl;
+  } else {
+    std::cout << "  FAIL " << name << ": " << msg << std::endl;
+    gFailed++;
+  }
+}
+
+static ParseResult* Parse(const char *name, const std::string &src,
+                          const ParseOptions &opts = ParseOptions()) {
+  return FrontEnd::Parse(name, src.c_str(), src.size(), opts);
+}
+
+// The package, imports and trees, in the text of java2mpl.
+static std::string ModuleText(ParseResult *res) {
+  ASTModule *module = res->GetModule();
+  std::string text;
+  if (module->mPackage)
+    text += std::string("package ") + module->mPackage->GetName() + "\n";
+  for (unsigned i = 0; i < module->mImports.GetNum(); i++)
+    text += std::string("import ") + module->mImports.ValueAtIndex(i)->GetName() + "\n";
+  std::string trees;
+  res->Dump(trees);
+  return text + trees;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                                 Tests
+//////////////////////////////////////////////////////////////////////////////
+
+// The sub parsers of a parallel parse run on the workers of the pool, and
+// build the package and imports in the modules of the workers. They must
+// end up in the result, and the next parse on the same worker must not see
+// them.
+static void TestPoolPackage() {
+  const char *srcs[2] = {
+    "package a.b;\n"
+    "import java.util.List;\n"
+    "class A { int x; void f() { int y = 1; } }\n"
+    "class B { int y; }\n"
+    "class C { int z; }\n",
+    "package c.d;\n"
+    "import java.util.Map;\n"
+    "import java.io.File;\n"
+    "class D { int x; }\n"
+    "class E { void g() { x = 2; } }\n"
+    "class F { int z; }\n"
+  };
+
+  std::string expected[2];
+  for (unsigned i = 0; i < 2; i++) {
+    ParseResult *res = Parse("pool.java", srcs[i]);
+    expected[i] = ModuleText(res);
+    delete res;
+  }
+
+  WorkPool pool(2);
+  ParseOptions opts;
+  opts.mWorkPool = &pool;
+  for (unsigned round = 0; round < 3; round++) {
+    for (unsigned i = 0; i < 2; i++) {
+      ParseResult *res = Parse("pool.java", srcs[i], opts);
+      std::string name = "pool-package-" + std::to_string(round) + "-" + std::to_string(i);
+      bool ok = res->IsSucc() && res->GetModule()->mPackage;
+      std::string text = ModuleText(res);
+      Check(name.c_str(), ok && text == expected[i],
+            "the result differs from the serial one:\n" + text);
+      delete res;
+    }
+  }
+}
+
+// Parses the lazy bodies of 'node' and its local classes. Returns the number
+// of bodies parsed, or -1 if one fails.
+static int ParseLazyBodies(TreeNode *node) {
+  if (!node->IsClass())
+    return 0;
+  ClassNode *klass = (ClassNode*)node;
+  int num = 0;
+  std::vector<FunctionNode*> funcs;
+  for (unsigned i = 0; i < klass->GetConstructorNum(); i++)
+    funcs.push_back(klass->GetConstructor(i));
+  for (unsigned i = 0; i < klass->GetMethodsNum(); i++)
+    funcs.push_back(klass->GetMethod(i));
+  for (unsigned i = 0; i < funcs.size(); i++) {
+    BlockNode *body = funcs[i]->GetBody();
+    if (!body || !body->IsLazy())
+      continue;
+    if (!funcs[i]->ParseBody())
+      return -1;
+    num++;
+  }
+  for (unsigned i = 0; i < klass->GetInstInitsNum(); i++) {
+    BlockNode *init = klass->GetInstInit(i);
+    if (!init->IsLazy())
+      continue;
+    if (!init->ParseLazy())
+      return -1;
+    num++;
+  }
+  for (unsigned i = 0; i < klass->GetLocalClassesNum(); i++) {
+    int n = ParseLazyBodies(klass->GetLocalClass(i));
+    if (n < 0)
+      return -1;
+    num += n;
+  }
+  return num;
+}
+
+// The bodies skipped by lazy parsing are found by matching the braces of
+// tokens, so the braces in literals and comments don't count. Parsed by
+// ParseBody() or ParseLazy(), they are the same as the eager ones.
+//
+// [NOTE] The lexer can't lex a char literal of a separator, like '{', yet.
+static void TestLazyBodies() {
+  const char *src =
+    "class Lazy {\n"
+    "  String s = \"{\";\n"
+    "  static { char a = 'x'; String z = \"}\"; }\n"
+    "  { String b = \"}}{\"; }\n"
+    "  Lazy() { /* } */ this.s = \"}\"; }\n"
+    "  int f(int x) {\n"
+    "    // }\n"
+    "    char c = 'c';\n"
+    "    if (x > 0) { return x; }\n"
+    "    String t = \"/* { */\";\n"
+    "    return 0;\n"
+    "  }\n"
+    "  void g() throws Exception { char c = '\\''; String u = \"\\\"}\"; }\n"
+    "  class Inner {\n"
+    "    void h() { /* { { */ int y = 1; }\n"
+    "  }\n"
+    "}\n";
+
+  ParseResult *eager = Parse("lazy.java", src);
+  std::string expected = ModuleText(eager);
+  Check("lazy-bodies-eager", eager->IsSucc(), "the source has illegal syntax");
+  delete eager;
+
+  ParseOptions opts;
+  opts.mLazyBodies = true;
+  ParseResult *lazy = Parse("lazy.java", src, opts);
+  int num = 0;
+  for (unsigned i = 0; i < lazy->GetTreesNum() && num >= 0; i++) {
+    int n = ParseLazyBodies(lazy->GetTree(i)->mRootNode);
+    num = n < 0 ? n : num + n;
+  }
+  Check("lazy-bodies-parsed", lazy->IsSucc() && num == 6,
+        std::to_string(num) + " bodies are parsed, 6 expected");
+  std::string text = ModuleText(lazy);
+  Check("lazy-bodies-same", text == expected,
+        "the result differs from the eager one:\n" + text + "\neager:\n" + expected);
+  delete lazy;
+}
+
+// Serves the 'buffer' requests of 'srcs' in dump format. Returns the number
+// of 'ok' responses.
+static unsigned Serve(ParseServer &server, const std::vector<std::string> &srcs) {
+  char in_name[] = "/tmp/apitest_in_XXXXXX";
+  char out_name[] = "/tmp/apitest_out_XXXXXX";
+  int in = mkstemp(in_name);
+  int out = mkstemp(out_name);
+  std::string requests;
+  for (unsigned i = 0; i < srcs.size(); i++)
+    requests += "buffer dump " + std::to_string(srcs[i].size()) + " s.java\n" + srcs[i];
+  if (write(in, requests.data(), requests.size()) != (ssize_t)requests.size())
+    return 0;
+  lseek(in, 0, SEEK_SET);
+  server.Serve(in, out);
+
+  unsigned ok = 0;
+  FILE *fp = fdopen(out, "r");
+  rewind(fp);
+  char status[16];
+  unsigned long size;
+  while (fscanf(fp, "%15s %lu\n", status, &size) == 2) {
+    if (!strcmp(status, "ok"))
+      ok++;
+    fseek(fp, size, SEEK_CUR);
+  }
+  fclose(fp);
+  close(in);
+  unlink(in_name);
+  unlink(out_name);
+  return ok;
+}
+
+// Sources of new identifiers and literals each time. The last one has
+// illegal syntax.
+static void MakeUniqueSources(std::vector<std::string> &srcs, unsigned num) {
+  static unsigned seq = 0;
+  srcs.clear();
+  for (unsigned i = 0; i < num; i++, seq++) {
+    std::string id = std::to_string(seq);
+    std::string src;
+    for (unsigned c = 0; c < 6; c++) {
+      src += "class C" + id + "_" + std::to_string(c) + " {\n";
+      for (unsigned k = 0; k < 8; k++) {
+        std::string f = "f" + id + "_" + std::to_string(c) + "_" + std::to_string(k);
+        src += "  String " + f + " = \"" + f + "\";\n";
+        src += "  int m" + f + "(int a) { return a + " + f + ".length(); }\n";
+      }
+      src += "}\n";
+    }
+    if (i == num - 1)
+      src += "class D" + id + " { int f" + id + " = ; }\n";
+    srcs.push_back(src);
+  }
+}
+
+// The memory of a request is freed after its response, the strings too. The
+// server warms up by the first round, and the later rounds of new strings
+// must not use more.
+static void TestServerMemory() {
+  MemStats::Enable();
+  ParseServer server(2, 4);
+  std::vector<std::string> srcs;
+  MemUsage warm;
+  MemUsage warm_strings;
+  for (unsigned round = 0; round < 3; round++) {
+    MakeUniqueSources(srcs, 4);
+    unsigned ok = Serve(server, srcs);
+    std::string name = "server-memory-" + std::to_string(round);
+    Check((name + "-ok").c_str(), ok == srcs.size() - 1,
+          std::to_string(ok) + " of " + std::to_string(srcs.size()) + " requests are ok");
+
+    MemUsage strings;
+    MemUsage total;
+    MemStats::Get(MS_String, strings);
+    MemStats::GetTotal(total);
+    if (round == 0) {
+      warm = total;
+      warm_strings = strings;
+      continue;
+    }
+    Check((name + "-strings").c_str(), strings.mReserved <= warm_strings.mReserved,
+          std::to_string(strings.mReserved) + " bytes are in the string pools, " +
+          std::to_string(warm_strings.mReserved) + " after the first round");
+    Check((name + "-total").c_str(), total.mReserved <= warm.mReserved,
+          std::to_string(total.mReserved) + " bytes are reserved, " +
+          std::to_string(warm.mReserved) + " after the first round");
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static Test gTests[] = {
+  {"pool-package",   TestPoolPackage},
+  {"lazy-bodies",    TestLazyBodies},
+  {"server-memory",  TestServerMemory},
+};
+
+static bool Selected(const char *name, std::vector<const char*> &filters) {
+  if (filters.empty())
+    return true;
+  for (unsigned i = 0; i < filters.size(); i++) {
+    if (!strncmp(name, filters[i], strlen(filters[i])))
+      return true;
+  }
+  return false;
+}
+
+int main(int argc, char *argv[]) {
+  std::vector<const char*> filters;
+  for (int i = 1; i < argc; i++) {
+    if (!strncmp(argv[i], "--", 2)) {
+      std::cerr << "unknown option " << argv[i] << std::endl;
+      return 1;
+    }
+    filters.push_back(argv[i]);
+  }
+
+  FrontEnd::Init();
+  for (unsigned i = 0; i < sizeof(gTests) / sizeof(Test); i++) {
+    Test *test = &gTests[i];
+    if (!Selected(test->mName, filters))
+      continue;
+    std::cout << test->mName << std::endl;
+    test->mFunc();
+  }
+
+  if (gFailed) {
+    std::cout << "failed " << gFailed << " of " << gChecks << " api checks" << std::endl;
+    return 1;
+  }
+  std::cout << "all " << gChecks << " api checks passed" << std::endl;
+  return 0;
+}
@@ -33,6 +33,7 @@
 #include "keyword_gen.h"
 #include "attr_gen.h"
 #include "token_gen.h"
+#include "rule_opt.h"
 
 class AutoGen {
 private:
@@ -51,15 +52,18 @@ private:
 
   std::vector<BaseGen*> mGenArray;
   SPECParser   *mParser;
+  unsigned      mOptPasses;  // The OptPass of RuleOptimizer to run on the rules.
 
 public:
-  AutoGen(SPECParser *p) : mParser(p) {}
+  AutoGen(SPECParser *p) : mParser(p), mOptPasses(OP_All) {}
   ~AutoGen();
 
   void Init();
   void Run();
   void BackPatch();
   void Gen();
+
+  void SetOptPasses(unsigned p) { mOptPasses = p; }
 };
 
 #endif
@@ -58,6 +58,8 @@ extern FileWriter *gSummaryHFile;    // summary functions
 extern FileWriter *gSummaryCppFile;  // summary functions
 extern unsigned    gRuleTableNum;  // rule table number
 extern std::vector<std::string> gTopRules; // top rule names.
+extern FileWriter *gMatchCppFile;    // compiled rule tables
+extern std::vector<std::string> gMatchFuncs; // compiled function of each rule table.
 
 class BaseGen {
 public:
@@ -54,6 +54,8 @@ private:
   void Gen4Table(const Rule *, const RuleElem*);       // table def in .cpp
   void Gen4TableHeader(const std::string &tablename); // table decl in .h
   void GenDebug(const std::string& tablename);   // Gen debug functions
+  void Gen4Match(const std::string& tablename,     // Gen compiled matching
+                 const RuleElem*, unsigned index);
 
 public:
   RuleGen(const Rule *r, FormattedBuffer *hbuf, FormattedBuffer *cbuf)
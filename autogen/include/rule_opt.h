@@ -0,0 +1,96 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+#ifndef __RULE_OPT_H__
+#define __RULE_OPT_H__
+
+#include <vector>
+#include <set>
+#include <map>
+#include <string>
+
+#include "rule.h"
+
+/////////////////////////////////////////////////////////////////////////
+//                     Rule Optimization                               //
+// The rules of the parser level specs are rewritten before the rule   //
+// tables are generated, so the parser traverses fewer tables.         //
+// See the comments in rule_opt.cpp.                                   //
+/////////////////////////////////////////////////////////////////////////
+
+class BaseGen;
+
+// The passes of RuleOptimizer. They can be run one by one, eg.
+// 'autogen -opt=inline,share', to tell which one changes the parsing.
+enum OptPass {
+  OP_Inline  = 1,
+  OP_Flatten = 2,
+  OP_Factor  = 4,
+  OP_Share   = 8,
+  OP_All     = 15
+};
+
+class RuleOptimizer {
+private:
+  BaseGen           *mGen;       // The new elements are allocated in it.
+  unsigned           mPasses;    // The OptPass to run.
+  std::vector<Rule*> mRules;     // The rules to optimize.
+  std::set<Rule*>    mRuleSet;
+  std::map<Rule*, bool> mNullable;
+  std::map<Rule*, bool> mLeftRecursive;
+  std::map<const RuleElem*, std::string> mKeys;
+
+  bool Optimizable(Rule*);
+  bool SameElem(const RuleElem*, const RuleElem*);
+  bool HasElem(const RuleElem *parent, const RuleElem*, unsigned skip);
+
+  void CollectRefs(const RuleElem*, std::vector<Rule*>&);
+  void CollectLeftRefs(const RuleElem*, std::vector<Rule*>&);
+  bool Reaches(std::vector<Rule*>&, Rule*, bool left);
+  bool LeftReachesEither(const RuleElem*, Rule*, Rule*);
+  bool LeftRecursive(Rule*);
+  bool Nullable(const RuleElem*);
+  void FindNullable();
+
+  bool Inlinable(Rule*);
+  RuleElem* InlineTarget(RuleElem*);
+  void InlineElem(RuleElem*);
+  void Inline();
+
+  void RemapActions(RuleAttr*, std::vector<unsigned> &new_idx);
+  bool UsedByActions(RuleAttr*, unsigned idx);
+  void FlattenElem(Rule*, RuleElem*, RuleAttr*, std::set<RuleElem*>&);
+  void Flatten();
+
+  bool NoTree(const RuleElem*);
+  bool Factorable(const RuleElem*);
+  RuleElem* Residual(RuleElem*, unsigned prefix);
+  void FactorElem(Rule*, RuleElem*, RuleAttr*, std::set<RuleElem*>&);
+  void Factor();
+
+  const std::string& Key(const RuleElem*);
+  void ShareElem(Rule*, RuleElem*, std::map<std::string, std::pair<RuleElem*, Rule*> >&,
+                 std::set<RuleElem*>&);
+  void Share();
+
+public:
+  RuleOptimizer(BaseGen *gen, unsigned passes = OP_All) : mGen(gen), mPasses(passes) {}
+  ~RuleOptimizer() {}
+
+  void AddRules(std::vector<Rule*>&);
+  void Run();
+};
+
+#endif
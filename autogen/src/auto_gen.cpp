@@ -43,7 +43,7 @@
 //      }RuleTableSummary;
 //      extern RuleTableSummary gRuleTableSummarys[];
 //      extern unsigned RuleTableNum;
-//      extern std::vector<unsigned> gFailed[621];
+//      extern thread_local std::unordered_set<unsigned> gFailed[621];
 //
 //    In Cpp file, we need
 //
@@ -60,12 +60,52 @@ FileWriter *gSummaryCppFile;
 unsigned    gRuleTableNum;
 std::vector<std::string> gTopRules;
 
+///////////////////////////////////////////////////////////////////////////////////////
+//                       Compiled rule tables
+// A rule table of tokens only is also generated as a C++ function in gen_match.cpp,
+// see RuleGen::Gen4Match(). The parser calls it instead of interpreting the table.
+// The functions are indexed by RuleTable::mIndex in gMatchFuncs, like below
+//
+//    MatchFunc localMatchFuncs[621] = {NULL, ..., MatchTblClassAttr, ...};
+//    MatchFunc *gMatchFuncs = localMatchFuncs;
+//
+// gen_match.cpp is part of the parser only. recdetect and ladetect don't take it.
+///////////////////////////////////////////////////////////////////////////////////////
+
+FileWriter *gMatchCppFile;
+std::vector<std::string> gMatchFuncs;
+
+static void PrepareMatchCppFile() {
+  gMatchCppFile->WriteOneLine("#include \"parser.h\"", 19);
+}
+
+static void FinishMatchCppFile() {
+  std::string s = "MatchFunc localMatchFuncs[";
+  s += std::to_string(gRuleTableNum);
+  s += "] = {";
+  gMatchCppFile->WriteOneLine(s.c_str(), s.size());
+  for (unsigned i = 0; i < gRuleTableNum; i++) {
+    s = "  ";
+    if (i < gMatchFuncs.size() && !gMatchFuncs[i].empty())
+      s += gMatchFuncs[i];
+    else
+      s += "NULL";
+    if (i < gRuleTableNum - 1)
+      s += ",";
+    gMatchCppFile->WriteOneLine(s.c_str(), s.size());
+  }
+  gMatchCppFile->WriteOneLine("};", 2);
+  s = "MatchFunc *gMatchFuncs = localMatchFuncs;";
+  gMatchCppFile->WriteOneLine(s.c_str(), s.size());
+}
+
 static void WriteSummaryHFile() {
   gSummaryHFile->WriteOneLine("#ifndef __DEBUG_GEN_H__", 23);
   gSummaryHFile->WriteOneLine("#define __DEBUG_GEN_H__", 23);
   gSummaryHFile->WriteOneLine("#include \"ruletable.h\"", 22);
   gSummaryHFile->WriteOneLine("#include \"succ_match.h\"", 23);
   gSummaryHFile->WriteOneLine("#include <vector>", 17);
+  gSummaryHFile->WriteOneLine("#include <unordered_set>", 24);
   gSummaryHFile->WriteOneLine("typedef struct {", 16);
   gSummaryHFile->WriteOneLine("  const RuleTable *mAddr;", 25);
   gSummaryHFile->WriteOneLine("  const char      *mName;", 25);
@@ -75,7 +115,11 @@ static void WriteSummaryHFile() {
   gSummaryHFile->WriteOneLine("extern unsigned RuleTableNum;", 29);
   gSummaryHFile->WriteOneLine("extern const char* GetRuleTableName(const RuleTable*);", 54);
 
-  std::string s = "extern std::vector<unsigned> gFailed[";
+  // gFailed and gSucc are the memo tables of a single parsing. They are
+  // thread_local so that multiple parsers could work at the same time in
+  // different threads. The failed tokens of a table are a set, since a
+  // construct could have many of them.
+  std::string s = "extern thread_local std::unordered_set<unsigned> gFailed[";
   s += std::to_string(gRuleTableNum);
   s += "];";
   gSummaryHFile->WriteOneLine(s.c_str(), s.size());
@@ -84,7 +128,7 @@ static void WriteSummaryHFile() {
   s = "class SuccMatch;";
   gSummaryHFile->WriteOneLine(s.c_str(), s.size());
 
-  s = "extern SuccMatch gSucc[";
+  s = "extern thread_local SuccMatch gSucc[";
   s += std::to_string(gRuleTableNum);
   s += "];";
   gSummaryHFile->WriteOneLine(s.c_str(), s.size());
@@ -125,12 +169,12 @@ static void FinishSummaryCppFile() {
   gSummaryCppFile->WriteOneLine("  return NULL;", 14);
   gSummaryCppFile->WriteOneLine("}", 1);
 
-  std::string s = "std::vector<unsigned> gFailed[";
+  std::string s = "thread_local std::unordered_set<unsigned> gFailed[";
   s += std::to_string(gRuleTableNum);
   s += "];";
   gSummaryCppFile->WriteOneLine(s.c_str(), s.size());
 
-  s = "SuccMatch gSucc[";
+  s = "thread_local SuccMatch gSucc[";
   s += std::to_string(gRuleTableNum);
   s += "];";
   gSummaryCppFile->WriteOneLine(s.c_str(), s.size());
@@ -172,6 +216,10 @@ void AutoGen::Init() {
 
   PrepareSummaryCppFile();
 
+  std::string match_file_name = lang_path_cpp + "gen_match.cpp";
+  gMatchCppFile = new FileWriter(match_file_name);
+  PrepareMatchCppFile();
+
   std::string hFile = lang_path_header + "gen_reserved.h";
   std::string cppFile = lang_path_cpp + "gen_reserved.cpp";
   mReservedGen = new ReservedGen("reserved.spec", hFile.c_str(), cppFile.c_str());
@@ -256,6 +304,8 @@ AutoGen::~AutoGen() {
     delete gSummaryHFile;
   if (gSummaryCppFile)
     delete gSummaryCppFile;
+  if (gMatchCppFile)
+    delete gMatchCppFile;
 }
 
 // When parsing a rule, its elements could be rules in the future rules, or
@@ -292,6 +342,17 @@ void AutoGen::Gen() {
   gTokenTable.mKeywords = mKeywordGen->mKeywords;
   gTokenTable.Prepare();
 
+  // The lexer level rules are left as they are.
+  if (mOptPasses) {
+    RuleOptimizer opt(mStmtGen, mOptPasses);
+    opt.AddRules(mTypeGen->mRules);
+    opt.AddRules(mAttrGen->mRules);
+    opt.AddRules(mBlockGen->mRules);
+    opt.AddRules(mExprGen->mRules);
+    opt.AddRules(mStmtGen->mRules);
+    opt.Run();
+  }
+
   std::vector<BaseGen*>::iterator it = mGenArray.begin();
   for (; it != mGenArray.end(); it++){
     BaseGen *gen = *it;
@@ -300,4 +361,5 @@ void AutoGen::Gen() {
 
   WriteSummaryHFile();
   FinishSummaryCppFile();
+  FinishMatchCppFile();
 }
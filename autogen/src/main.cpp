@@ -20,6 +20,21 @@
 #include "auto_gen.h"
 #include "massert.h"
 
+// The passes of '-opt=inline,flatten,factor,share'.
+static unsigned OptPasses(const char *list) {
+  static const char *names[] = {"inline", "flatten", "factor", "share"};
+  unsigned passes = 0;
+  while (*list) {
+    size_t len = strcspn(list, ",");
+    for (unsigned i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+      if (strlen(names[i]) == len && !strncmp(list, names[i], len))
+        passes |= 1 << i;
+    }
+    list += list[len] ? len + 1 : len;
+  }
+  return passes;
+}
+
 int main(int argc, char *argv[]) {
   // testing parse a def file
   // autogen -p test.spec
@@ -28,6 +43,7 @@ int main(int argc, char *argv[]) {
   SPECParser *parser = new SPECParser();
 
   bool checkParserOnly = false;
+  unsigned opt_passes = OP_All;
   int verbose = 0;
   int fileIndex = 2;
 
@@ -38,6 +54,10 @@ int main(int argc, char *argv[]) {
         verbose = atoi(argv[i]+9);
       } else if (strcmp(argv[i], "-p") == 0) {
         checkParserOnly = true;
+      } else if (strcmp(argv[i], "-no-opt") == 0) {
+        opt_passes = 0;
+      } else if (!strncmp(argv[i], "-opt=", 5)) {
+        opt_passes = OptPasses(argv[i] + 5);
       } else {
         fileIndex = i;
       }
@@ -57,6 +77,7 @@ int main(int argc, char *argv[]) {
   }
 
   AutoGen ag(parser);
+  ag.SetOptPasses(opt_passes);
   ag.Gen();
 
   return 0;
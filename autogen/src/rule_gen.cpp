@@ -12,6 +12,8 @@
 * FIT FOR A PARTICULAR PURPOSE.
 * See the Mulan PSL v2 for more details.
 */
+#include <map>
+
 #include "massert.h"
 #include "rule_gen.h"
 #include "buffer2write.h"
@@ -72,6 +74,9 @@
 
 
 
+// The table name of each sub table generated.
+static std::map<const RuleElem*, std::string> gSubTables;
+
 // Generate the table name for mRule
 std::string RuleGen::GetTblName(const Rule *rule) {
   std::string tn = "Tbl" + rule->mName;
@@ -191,9 +196,22 @@ std::string RuleGen::Gen4RuleElem(const RuleElem *elem) {
     data += GetTblName(elem->mData.mRule);
     break; 
   case ET_Op: {
+    // An element shared by RuleOptimizer has its table generated already,
+    // maybe in another file.
+    std::map<const RuleElem*, std::string>::iterator it = gSubTables.find(elem);
+    if (it != gSubTables.end()) {
+      std::string extern_decl = "extern RuleTable " + it->second + ";";
+      mCppBuffer->NewOneBuffer(extern_decl.size(), true);
+      mCppBuffer->AddStringWholeLine(extern_decl);
+      data += "DT_Subtable, &";
+      data += it->second;
+      break;
+    }
+
     // Each Op will be generated as a new sub table
     mSubTblNum++;
     std::string tbl_name = GetSubTblName();
+    gSubTables[elem] = tbl_name;
     data += "DT_Subtable, &";
     data += tbl_name;
     Gen4Table(NULL, elem);
@@ -252,6 +270,126 @@ void RuleGen::GenDebug(const std::string &rule_table_name) {
   gRuleTableNum++;
 }
 
+static void WriteMatchLine(const std::string &s) {
+  gMatchCppFile->WriteOneLine(s.c_str(), s.size());
+}
+
+// Generate the compiled matching of a rule table of tokens only, into
+// gen_match.cpp. The elements are unrolled, and a Oneof is a switch on the
+// current token. See 'Compiled Rule Tables' in shared/src/parser_engine.cpp.
+// For example,
+//
+//   rule ConstantAttr : ONEOF("public", "static", "final")
+//
+//                                   ==>
+//
+//   extern RuleTable TblConstantAttr;
+//   static bool MatchTblConstantAttr(Parser *p, AppealNode *node) {
+//     unsigned id = p->GetCurTokenId();
+//     switch (id) {
+//     case 70:
+//     case 69:
+//     case 78:
+//       return p->MatchToken(id, node);
+//     default:
+//       return false;
+//     }
+//   }
+//
+// The other rule tables are interpreted, so are all if Parser::mInterpret.
+// Their subtables are entered only if the lookahead passes.
+void RuleGen::Gen4Match(const std::string &rule_table_name, const RuleElem *elem,
+                        unsigned index) {
+  std::vector<unsigned> ids;
+  if (elem->mSubElems.size() == 0) {
+    if (elem->mType != ET_Token)
+      return;
+    ids.push_back(elem->mData.mTokenId);
+  } else {
+    std::vector<RuleElem *>::const_iterator it = elem->mSubElems.begin();
+    for(; it != elem->mSubElems.end(); it++) {
+      if ((*it)->mType != ET_Token)
+        return;
+      ids.push_back((*it)->mData.mTokenId);
+    }
+  }
+
+  RuleOp op = RO_Null;
+  if (elem->mType == ET_Op)
+    op = elem->mData.mOp;
+
+  // A token twice in a Oneof is matched twice by the interpreter, and a
+  // switch can't do it.
+  if (op == RO_Oneof) {
+    for (unsigned i = 0; i < ids.size(); i++)
+      for (unsigned j = i + 1; j < ids.size(); j++)
+        if (ids[i] == ids[j])
+          return;
+  }
+
+  if ((op == RO_Zeroormore || op == RO_Zeroorone) && (ids.size() != 1))
+    return;
+
+  std::string func_name = "Match" + rule_table_name;
+  std::string table_addr = "&" + rule_table_name;
+  WriteMatchLine("extern RuleTable " + rule_table_name + ";");
+  WriteMatchLine("static bool " + func_name + "(Parser *p, AppealNode *node) {");
+
+  switch (op) {
+  case RO_Null:
+    WriteMatchLine("  return p->MatchToken(" + std::to_string(ids[0]) + ", node);");
+    break;
+  case RO_Oneof:
+    WriteMatchLine("  unsigned id = p->GetCurTokenId();");
+    WriteMatchLine("  switch (id) {");
+    for (unsigned i = 0; i < ids.size(); i++)
+      WriteMatchLine("  case " + std::to_string(ids[i]) + ":");
+    WriteMatchLine("    return p->MatchToken(id, node);");
+    WriteMatchLine("  default:");
+    WriteMatchLine("    return false;");
+    WriteMatchLine("  }");
+    break;
+  case RO_Zeroorone:
+    WriteMatchLine("  p->MatchToken(" + std::to_string(ids[0]) + ", node);");
+    WriteMatchLine("  return true;");
+    break;
+  // The matchings are all the tokens matched, and the budget is checked
+  // as the interpreter does.
+  case RO_Zeroormore:
+    WriteMatchLine("  unsigned start = p->GetCurToken();");
+    WriteMatchLine("  unsigned num = 0;");
+    WriteMatchLine("  while (p->MatchToken(" + std::to_string(ids[0]) + ", node)) {");
+    WriteMatchLine("    if (p->OverMatchBudget(num + 1, " + table_addr + ")) {");
+    WriteMatchLine("      num = 0;");
+    WriteMatchLine("      break;");
+    WriteMatchLine("    }");
+    WriteMatchLine("    num++;");
+    WriteMatchLine("  }");
+    WriteMatchLine("  p->SetMatches(start, num);");
+    WriteMatchLine("  return true;");
+    break;
+  // The only matching is the last token. The interpreter checks the budget
+  // of it and the 'zero' matching.
+  case RO_Concatenate:
+    for (unsigned i = 0; i < ids.size(); i++) {
+      WriteMatchLine("  if (!p->MatchToken(" + std::to_string(ids[i]) + ", node) ||");
+      WriteMatchLine("      p->OverMatchBudget(2, " + table_addr + "))");
+      WriteMatchLine("    return false;");
+    }
+    WriteMatchLine("  return true;");
+    break;
+  default:
+    MERROR("unknown RuleOp");
+    break;
+  }
+
+  WriteMatchLine("}");
+
+  if (gMatchFuncs.size() <= index)
+    gMatchFuncs.resize(index + 1);
+  gMatchFuncs[index] = func_name;
+}
+
 // The format of RuleAttr table is like below,
 //   Action TblAdditiveExpression_sub1_action[2] = {
 //           {ACT_BuildBinaryOperation, 3, {1, 2, 3}}, {ACT_XXX, 2, {2, 3}}};
@@ -340,6 +478,7 @@ void RuleGen::Gen4Table(const Rule *rule, const RuleElem *elem){
   Gen4TableHeader(rule_table_name);
   unsigned index = gRuleTableNum;
   GenDebug(rule_table_name);
+  Gen4Match(rule_table_name, elem, index);
 
   std::string rule_table_data_name = rule_table_name + "_data";
   std::string rule_table_data;
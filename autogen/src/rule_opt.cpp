@@ -0,0 +1,655 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+#include <cstring>
+
+#include "rule_opt.h"
+#include "rule_gen.h"
+#include "base_gen.h"
+#include "token_table.h"
+#include "massert.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// Each rule table costs a TraverseRuleTable() with a memo lookup and an
+// AppealNode. The optimizer rewrites the rules of the parser level specs
+// before RuleGen, so the parser has fewer tables to traverse. It does four
+// things in order.
+//
+// 1. Inline. A rule of a single element and no attribute, like
+//      rule MethodName : Identifier
+//    is replaced by its element wherever it's referred to. The table of
+//    the rule is still generated.
+// 2. Flatten. An alternative of a ONEOF which is a ONEOF too, either a sub
+//    element or a rule, is replaced by its alternatives.
+// 3. Factor. The alternatives of a ONEOF starting with the same elements,
+//      ONEOF('(' + A + ')', '(' + B, C)
+//    become a concatenation of the common elements and a ONEOF of the rest,
+//      ONEOF('(' + ONEOF(A + ')', B), C)
+//    so the common elements are matched once.
+// 4. Share. Structurally identical sub elements are replaced by one of
+//    them. RuleGen generates a single sub table for an element.
+//
+// The element indices used by attr.action are kept. An inlined element takes
+// the place of the rule. The indices of the alternatives after a flattened or
+// factored one are shifted, and an alternative used by an action is not
+// changed. The actions of a factored alternative go to the rest of it, so
+// they can't use the common elements. The common elements are separators or
+// operators, which have no AST tree, so the AST is the same.
+//
+// There are a few limits.
+// (1) AppealNode::GetSortedChildIndex() finds a child in the data of the
+//     parent table by its table or token, so no transformation puts the same
+//     element twice in a parent.
+// (2) A left recursive rule keeps its shape, since recdetect builds the
+//     recursion tables out of it. For the same reason a sub element on a left
+//     recursion is not shared.
+// (3) The parser refers to a few tables by name, see gKeptRules.
+// (4) The lexer level specs are not optimized.
+//////////////////////////////////////////////////////////////////////////////
+
+// The parser refers to the tables of these rules by name.
+static const char *gKeptRules[] = {"Block", "ConstructorBody"};
+
+void RuleOptimizer::AddRules(std::vector<Rule*> &rules) {
+  std::vector<Rule*>::iterator it = rules.begin();
+  for (; it != rules.end(); it++) {
+    Rule *rule = *it;
+    if (mRuleSet.find(rule) == mRuleSet.end()) {
+      mRules.push_back(rule);
+      mRuleSet.insert(rule);
+    }
+  }
+}
+
+bool RuleOptimizer::Optimizable(Rule *rule) {
+  if (mRuleSet.find(rule) == mRuleSet.end())
+    return false;
+  for (unsigned i = 0; i < sizeof(gKeptRules) / sizeof(const char*); i++) {
+    if (rule->mName == gKeptRules[i])
+      return false;
+  }
+  return true;
+}
+
+// Two elements are the same if they end up as the same entry of a table.
+bool RuleOptimizer::SameElem(const RuleElem *a, const RuleElem *b) {
+  if (a == b)
+    return true;
+  if (a->mType != b->mType)
+    return false;
+  switch (a->mType) {
+  case ET_Char:   return a->mData.mChar == b->mData.mChar;
+  case ET_String: return strcmp(a->mData.mString, b->mData.mString) == 0;
+  case ET_Rule:   return a->mData.mRule == b->mData.mRule;
+  case ET_Type:   return a->mData.mTypeId == b->mData.mTypeId;
+  case ET_Token:  return a->mData.mTokenId == b->mData.mTokenId;
+  default:        return false;
+  }
+}
+
+// If 'parent' has an element same as 'elem', except the one at 'skip'.
+bool RuleOptimizer::HasElem(const RuleElem *parent, const RuleElem *elem, unsigned skip) {
+  for (unsigned i = 0; i < parent->mSubElems.size(); i++) {
+    if (i != skip && SameElem(parent->mSubElems[i], elem))
+      return true;
+  }
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////
+//                        Rule References
+////////////////////////////////////////////////////////////////////////////
+
+void RuleOptimizer::CollectRefs(const RuleElem *elem, std::vector<Rule*> &refs) {
+  if (elem->mType == ET_Rule) {
+    refs.push_back(elem->mData.mRule);
+    return;
+  }
+  for (unsigned i = 0; i < elem->mSubElems.size(); i++)
+    CollectRefs(elem->mSubElems[i], refs);
+}
+
+// The rules which could match at the beginning of 'elem'.
+void RuleOptimizer::CollectLeftRefs(const RuleElem *elem, std::vector<Rule*> &refs) {
+  if (elem->mType == ET_Rule) {
+    refs.push_back(elem->mData.mRule);
+    return;
+  }
+  if (elem->mType != ET_Op)
+    return;
+
+  for (unsigned i = 0; i < elem->mSubElems.size(); i++) {
+    const RuleElem *sub = elem->mSubElems[i];
+    CollectLeftRefs(sub, refs);
+    if (elem->mData.mOp != RO_Oneof && !Nullable(sub))
+      break;
+  }
+}
+
+// If 'target' is one of 'rules', or is referred to by them directly or
+// indirectly. 'rules' is used as the working list.
+bool RuleOptimizer::Reaches(std::vector<Rule*> &rules, Rule *target, bool left) {
+  std::set<Rule*> visited;
+  while (!rules.empty()) {
+    Rule *rule = rules.back();
+    rules.pop_back();
+    if (rule == target)
+      return true;
+    if (visited.find(rule) != visited.end())
+      continue;
+    visited.insert(rule);
+    if (left)
+      CollectLeftRefs(rule->mElement, rules);
+    else
+      CollectRefs(rule->mElement, rules);
+  }
+  return false;
+}
+
+// If 'elem' is on a left recursion of 'a' or 'b'.
+bool RuleOptimizer::LeftReachesEither(const RuleElem *elem, Rule *a, Rule *b) {
+  std::vector<Rule*> refs;
+  CollectLeftRefs(elem, refs);
+  std::vector<Rule*> refs_b = refs;
+  return Reaches(refs, a, true) || Reaches(refs_b, b, true);
+}
+
+// Inline and flatten don't change if a rule is left recursive, so it's
+// computed once.
+bool RuleOptimizer::LeftRecursive(Rule *rule) {
+  std::map<Rule*, bool>::iterator it = mLeftRecursive.find(rule);
+  if (it != mLeftRecursive.end())
+    return it->second;
+  std::vector<Rule*> refs;
+  CollectLeftRefs(rule->mElement, refs);
+  bool result = Reaches(refs, rule, true);
+  mLeftRecursive[rule] = result;
+  return result;
+}
+
+bool RuleOptimizer::Nullable(const RuleElem *elem) {
+  switch (elem->mType) {
+  case ET_Rule: {
+    std::map<Rule*, bool>::iterator it = mNullable.find(elem->mData.mRule);
+    return it != mNullable.end() && it->second;
+  }
+  case ET_Op:
+    switch (elem->mData.mOp) {
+    case RO_Zeroormore:
+    case RO_Zeroorone:
+      return true;
+    case RO_Oneof:
+      for (unsigned i = 0; i < elem->mSubElems.size(); i++) {
+        if (Nullable(elem->mSubElems[i]))
+          return true;
+      }
+      return false;
+    case RO_Concatenate:
+      for (unsigned i = 0; i < elem->mSubElems.size(); i++) {
+        if (!Nullable(elem->mSubElems[i]))
+          return false;
+      }
+      return true;
+    default:
+      return false;
+    }
+  default:
+    return false;
+  }
+}
+
+// The nullable rules are found by iterating to a fixed point over all the
+// rules reachable, including the lexer level ones.
+void RuleOptimizer::FindNullable() {
+  std::vector<Rule*> all;
+  std::set<Rule*> visited;
+  std::vector<Rule*> working = mRules;
+  while (!working.empty()) {
+    Rule *rule = working.back();
+    working.pop_back();
+    if (visited.find(rule) != visited.end())
+      continue;
+    visited.insert(rule);
+    all.push_back(rule);
+    CollectRefs(rule->mElement, working);
+  }
+
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (unsigned i = 0; i < all.size(); i++) {
+      Rule *rule = all[i];
+      if (!mNullable[rule] && Nullable(rule->mElement)) {
+        mNullable[rule] = true;
+        changed = true;
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////
+//                              Inline
+////////////////////////////////////////////////////////////////////////////
+
+bool RuleOptimizer::Inlinable(Rule *rule) {
+  if (!Optimizable(rule))
+    return false;
+  RuleElem *elem = rule->mElement;
+  if (!rule->mAttr.Empty() || !elem->mAttr.Empty() || elem->mSubElems.size() > 0)
+    return false;
+  switch (elem->mType) {
+  case ET_Char:
+  case ET_String:
+  case ET_Rule:
+  case ET_Type:
+  case ET_Token:
+    break;
+  default:
+    return false;
+  }
+  return !LeftRecursive(rule);
+}
+
+// The element 'elem' ends up with after inlining. A chain of forwarding rules
+// is followed. It can't loop since such rules are left recursive.
+RuleElem* RuleOptimizer::InlineTarget(RuleElem *elem) {
+  while (elem->mType == ET_Rule && Inlinable(elem->mData.mRule))
+    elem = elem->mData.mRule->mElement;
+  return elem;
+}
+
+void RuleOptimizer::InlineElem(RuleElem *elem) {
+  for (unsigned i = 0; i < elem->mSubElems.size(); i++) {
+    RuleElem *sub = elem->mSubElems[i];
+    if (sub->mType == ET_Op) {
+      InlineElem(sub);
+    } else if (sub->mType == ET_Rule) {
+      RuleElem *target = InlineTarget(sub);
+      if (target != sub && !HasElem(elem, target, i)) {
+        elem->mSubElems[i] = target;
+      }
+    }
+  }
+}
+
+void RuleOptimizer::Inline() {
+  for (unsigned i = 0; i < mRules.size(); i++) {
+    Rule *rule = mRules[i];
+    RuleElem *elem = rule->mElement;
+    if (elem->mType == ET_Rule) {
+      RuleElem *target = InlineTarget(elem);
+      if (target != elem) {
+        rule->mElement = target;
+      }
+    } else {
+      InlineElem(elem);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////
+//                              Flatten
+////////////////////////////////////////////////////////////////////////////
+
+bool RuleOptimizer::UsedByActions(RuleAttr *attr, unsigned idx) {
+  std::vector<RuleAction*> *lists[2] = {&attr->mAction, &attr->mValidity};
+  for (unsigned l = 0; l < 2; l++) {
+    for (unsigned i = 0; i < lists[l]->size(); i++) {
+      RuleAction *action = (*lists[l])[i];
+      for (unsigned j = 0; j < action->mArgs.size(); j++) {
+        if (action->mArgs[j] == idx)
+          return true;
+      }
+    }
+  }
+  return false;
+}
+
+// 'new_idx' maps the old element indices, starting from 1, to the new ones.
+void RuleOptimizer::RemapActions(RuleAttr *attr, std::vector<unsigned> &new_idx) {
+  std::vector<RuleAction*> *lists[2] = {&attr->mAction, &attr->mValidity};
+  for (unsigned l = 0; l < 2; l++) {
+    for (unsigned i = 0; i < lists[l]->size(); i++) {
+      RuleAction *action = (*lists[l])[i];
+      for (unsigned j = 0; j < action->mArgs.size(); j++)
+        action->mArgs[j] = new_idx[action->mArgs[j]];
+    }
+  }
+}
+
+// 'attr' has the actions of the table of 'elem'. The sub elements are done
+// first, so nested ONEOFs are flattened in one pass.
+void RuleOptimizer::FlattenElem(Rule *owner, RuleElem *elem, RuleAttr *attr,
+                                std::set<RuleElem*> &visited) {
+  if (visited.find(elem) != visited.end())
+    return;
+  visited.insert(elem);
+
+  for (unsigned i = 0; i < elem->mSubElems.size(); i++) {
+    RuleElem *sub = elem->mSubElems[i];
+    if (sub->mType == ET_Op)
+      FlattenElem(owner, sub, &sub->mAttr, visited);
+  }
+
+  // A property like Single is about the alternatives as they are.
+  if (elem->mType != ET_Op || elem->mData.mOp != RO_Oneof || attr->mProperty.size() > 0)
+    return;
+
+  unsigned i = 0;
+  while (i < elem->mSubElems.size()) {
+    RuleElem *sub = elem->mSubElems[i];
+    std::vector<RuleElem*> alts;
+    if (sub->mType == ET_Op && sub->mData.mOp == RO_Oneof && sub->mAttr.Empty()) {
+      alts = sub->mSubElems;
+    } else if (sub->mType == ET_Rule) {
+      Rule *rule = sub->mData.mRule;
+      RuleElem *rule_elem = rule->mElement;
+      if (Optimizable(rule) && rule->mAttr.Empty() &&
+          rule_elem->mType == ET_Op && rule_elem->mData.mOp == RO_Oneof &&
+          !LeftRecursive(rule) && !LeftRecursive(owner)) {
+        alts = rule_elem->mSubElems;
+        // The sub tables of 'rule' are shared with 'owner', see Share().
+        for (unsigned j = 0; j < alts.size(); j++) {
+          if (alts[j]->mType == ET_Op && LeftReachesEither(alts[j], rule, owner)) {
+            alts.clear();
+            break;
+          }
+        }
+      }
+    }
+
+    bool ok = !alts.empty() && !UsedByActions(attr, i + 1);
+    for (unsigned j = 0; ok && j < alts.size(); j++) {
+      if (HasElem(elem, alts[j], i))
+        ok = false;
+    }
+    if (!ok) {
+      i++;
+      continue;
+    }
+
+    // The spliced alternatives are checked again, they may be ONEOFs too.
+    std::vector<unsigned> new_idx;
+    for (unsigned j = 0; j <= elem->mSubElems.size(); j++)
+      new_idx.push_back(j > i + 1 ? j + alts.size() - 1 : j);
+    elem->mSubElems.erase(elem->mSubElems.begin() + i);
+    elem->mSubElems.insert(elem->mSubElems.begin() + i, alts.begin(), alts.end());
+    RemapActions(attr, new_idx);
+  }
+}
+
+void RuleOptimizer::Flatten() {
+  std::set<RuleElem*> visited;
+  for (unsigned i = 0; i < mRules.size(); i++) {
+    Rule *rule = mRules[i];
+    FlattenElem(rule, rule->mElement, &rule->mAttr, visited);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////
+//                              Factor
+////////////////////////////////////////////////////////////////////////////
+
+// If 'elem' is a separator or operator. They have no AST tree.
+bool RuleOptimizer::NoTree(const RuleElem *elem) {
+  return elem->mType == ET_Token &&
+         elem->mData.mTokenId < gTokenTable.mNumOperators + gTokenTable.mNumSeparators;
+}
+
+bool RuleOptimizer::Factorable(const RuleElem *elem) {
+  return elem->mType == ET_Op && elem->mData.mOp == RO_Concatenate &&
+         elem->mSubElems.size() > 1 && NoTree(elem->mSubElems[0]);
+}
+
+// The alternative 'alt' without the first 'prefix' elements. The actions
+// are moved over.
+RuleElem* RuleOptimizer::Residual(RuleElem *alt, unsigned prefix) {
+  if (alt->mSubElems.size() == prefix + 1 && alt->mAttr.Empty())
+    return alt->mSubElems[prefix];
+
+  RuleElem *rest = mGen->NewRuleElem(RO_Concatenate);
+  rest->mSubElems.assign(alt->mSubElems.begin() + prefix, alt->mSubElems.end());
+  std::vector<RuleAction*> *from[2] = {&alt->mAttr.mAction, &alt->mAttr.mValidity};
+  std::vector<RuleAction*> *to[2] = {&rest->mAttr.mAction, &rest->mAttr.mValidity};
+  for (unsigned l = 0; l < 2; l++) {
+    for (unsigned i = 0; i < from[l]->size(); i++) {
+      RuleAction *action = (*from[l])[i];
+      RuleAction *moved = new RuleAction(action->mName);
+      for (unsigned j = 0; j < action->mArgs.size(); j++)
+        moved->AddArg(action->mArgs[j] - prefix);
+      to[l]->push_back(moved);
+    }
+  }
+  rest->mAttr.mProperty = alt->mAttr.mProperty;
+  return rest;
+}
+
+void RuleOptimizer::FactorElem(Rule *owner, RuleElem *elem, RuleAttr *attr,
+                               std::set<RuleElem*> &visited) {
+  if (visited.find(elem) != visited.end())
+    return;
+  visited.insert(elem);
+
+  for (unsigned i = 0; i < elem->mSubElems.size(); i++) {
+    RuleElem *sub = elem->mSubElems[i];
+    if (sub->mType == ET_Op)
+      FactorElem(owner, sub, &sub->mAttr, visited);
+  }
+
+  if (elem->mType != ET_Op || elem->mData.mOp != RO_Oneof ||
+      attr->mProperty.size() > 0 || LeftRecursive(owner))
+    return;
+
+  for (unsigned i = 0; i < elem->mSubElems.size(); i++) {
+    RuleElem *first = elem->mSubElems[i];
+    if (!Factorable(first))
+      continue;
+
+    // The alternatives starting with the same element as 'first'.
+    std::vector<unsigned> group;
+    unsigned min_size = first->mSubElems.size();
+    for (unsigned j = i; j < elem->mSubElems.size(); j++) {
+      RuleElem *alt = elem->mSubElems[j];
+      if (Factorable(alt) && SameElem(alt->mSubElems[0], first->mSubElems[0])) {
+        group.push_back(j);
+        if (alt->mSubElems.size() < min_size)
+          min_size = alt->mSubElems.size();
+      }
+    }
+    if (group.size() < 2)
+      continue;
+
+    // Each alternative keeps at least one element of its own.
+    unsigned prefix = 1;
+    for (; prefix < min_size - 1; prefix++) {
+      RuleElem *e = first->mSubElems[prefix];
+      bool same = NoTree(e);
+      for (unsigned j = 1; same && j < group.size(); j++)
+        same = SameElem(elem->mSubElems[group[j]]->mSubElems[prefix], e);
+      if (!same)
+        break;
+    }
+
+    bool ok = true;
+    for (unsigned j = 0; ok && j < group.size(); j++) {
+      RuleElem *alt = elem->mSubElems[group[j]];
+      if (UsedByActions(attr, group[j] + 1))
+        ok = false;
+      for (unsigned k = 1; ok && k <= prefix; k++)
+        ok = !UsedByActions(&alt->mAttr, k);
+    }
+    if (!ok)
+      continue;
+
+    RuleElem *rest = mGen->NewRuleElem(RO_Oneof);
+    for (unsigned j = 0; ok && j < group.size(); j++) {
+      RuleElem *residual = Residual(elem->mSubElems[group[j]], prefix);
+      ok = !HasElem(rest, residual, rest->mSubElems.size());
+      rest->mSubElems.push_back(residual);
+    }
+    if (!ok)
+      continue;
+    FactorElem(owner, rest, &rest->mAttr, visited);
+
+    RuleElem *factored = mGen->NewRuleElem(RO_Concatenate);
+    factored->mSubElems.assign(first->mSubElems.begin(), first->mSubElems.begin() + prefix);
+    factored->mSubElems.push_back(rest);
+
+    // The factored alternative takes the place of the first one in the group.
+    std::vector<unsigned> new_idx(1, 0);
+    std::vector<RuleElem*> subs;
+    for (unsigned j = 0, g = 0; j < elem->mSubElems.size(); j++) {
+      if (g < group.size() && group[g] == j) {
+        if (g++ == 0)
+          subs.push_back(factored);
+        new_idx.push_back(0);
+      } else {
+        subs.push_back(elem->mSubElems[j]);
+        new_idx.push_back(subs.size());
+      }
+    }
+    elem->mSubElems = subs;
+    RemapActions(attr, new_idx);
+  }
+}
+
+void RuleOptimizer::Factor() {
+  std::set<RuleElem*> visited;
+  for (unsigned i = 0; i < mRules.size(); i++) {
+    Rule *rule = mRules[i];
+    FactorElem(rule, rule->mElement, &rule->mAttr, visited);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////
+//                              Share
+////////////////////////////////////////////////////////////////////////////
+
+static void AddAttrKey(std::string &key, const RuleAttr &attr) {
+  const std::vector<RuleAction*> *lists[2] = {&attr.mAction, &attr.mValidity};
+  for (unsigned l = 0; l < 2; l++) {
+    key += l ? "|v" : "|a";
+    for (unsigned i = 0; i < lists[l]->size(); i++) {
+      RuleAction *action = (*lists[l])[i];
+      key += action->mName;
+      for (unsigned j = 0; j < action->mArgs.size(); j++)
+        key += "," + std::to_string(action->mArgs[j]);
+      key += ";";
+    }
+  }
+  for (unsigned i = 0; i < attr.mProperty.size(); i++)
+    key += "|p" + attr.mProperty[i];
+}
+
+// The structure of an element as a string. Elements of the same key generate
+// the same table.
+const std::string& RuleOptimizer::Key(const RuleElem *elem) {
+  std::map<const RuleElem*, std::string>::iterator it = mKeys.find(elem);
+  if (it != mKeys.end())
+    return it->second;
+
+  std::string key;
+  switch (elem->mType) {
+  case ET_Char:
+    key = "c";
+    key += elem->mData.mChar;
+    break;
+  case ET_String:
+    key = "s";
+    key += elem->mData.mString;
+    break;
+  case ET_Rule:
+    key = "r" + elem->mData.mRule->mName;
+    break;
+  case ET_Type:
+    key = "y" + std::to_string(elem->mData.mTypeId);
+    break;
+  case ET_Token:
+    key = "t" + std::to_string(elem->mData.mTokenId);
+    break;
+  case ET_Op:
+    key = "o" + std::to_string(elem->mData.mOp) + "(";
+    for (unsigned i = 0; i < elem->mSubElems.size(); i++) {
+      if (i > 0)
+        key += " ";
+      key += Key(elem->mSubElems[i]);
+    }
+    key += ")";
+    AddAttrKey(key, elem->mAttr);
+    break;
+  default:
+    MERROR("unknown ElemType");
+    break;
+  }
+  mKeys[elem] = key;
+  return mKeys[elem];
+}
+
+// 'canon' maps a key to the first element of it and the rule of that element.
+void RuleOptimizer::ShareElem(Rule *owner, RuleElem *elem,
+                              std::map<std::string, std::pair<RuleElem*, Rule*> > &canon,
+                              std::set<RuleElem*> &visited) {
+  if (visited.find(elem) != visited.end())
+    return;
+  visited.insert(elem);
+
+  for (unsigned i = 0; i < elem->mSubElems.size(); i++) {
+    RuleElem *sub = elem->mSubElems[i];
+    if (sub->mType != ET_Op)
+      continue;
+    ShareElem(owner, sub, canon, visited);
+
+    const std::string &key = Key(sub);
+    std::map<std::string, std::pair<RuleElem*, Rule*> >::iterator it = canon.find(key);
+    if (it == canon.end()) {
+      canon[key] = std::make_pair(sub, owner);
+      continue;
+    }
+
+    RuleElem *first = it->second.first;
+    if (first != sub && !HasElem(elem, first, i) &&
+        !LeftReachesEither(sub, owner, it->second.second)) {
+      elem->mSubElems[i] = first;
+    }
+  }
+}
+
+void RuleOptimizer::Share() {
+  std::map<std::string, std::pair<RuleElem*, Rule*> > canon;
+  std::set<RuleElem*> visited;
+  for (unsigned i = 0; i < mRules.size(); i++) {
+    Rule *rule = mRules[i];
+    ShareElem(rule, rule->mElement, canon, visited);
+  }
+}
+
+void RuleOptimizer::Run() {
+  // The optimizations compare tokens, so the rules are patched first. It's
+  // done again by RuleGen, which does nothing on tokens.
+  for (unsigned i = 0; i < mRules.size(); i++) {
+    RuleGen gen(mRules[i], NULL, NULL);
+    gen.PatchToken();
+  }
+
+  FindNullable();
+  if (mPasses & OP_Inline)
+    Inline();
+  if (mPasses & OP_Flatten)
+    Flatten();
+  if (mPasses & OP_Factor)
+    Factor();
+  if (mPasses & OP_Share)
+    Share();
+}
@@ -0,0 +1 @@
+/root/repo/java/keyword.spec
\ No newline at end of file
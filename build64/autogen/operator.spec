@@ -0,0 +1 @@
+/root/repo/java/operator.spec
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/autogen/reserved.spec
\ No newline at end of file
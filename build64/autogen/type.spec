@@ -0,0 +1 @@
+/root/repo/java/type.spec
\ No newline at end of file
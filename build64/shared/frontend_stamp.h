@@ -0,0 +1 @@
+#define FRONTEND_STAMP "a88d4ccc2f22c410"
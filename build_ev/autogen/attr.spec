@@ -0,0 +1 @@
+/root/repo/java/attr.spec
\ No newline at end of file
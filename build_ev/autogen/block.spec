@@ -0,0 +1 @@
+/root/repo/java/block.spec
\ No newline at end of file
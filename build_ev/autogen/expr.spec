@@ -0,0 +1 @@
+/root/repo/java/expr.spec
\ No newline at end of file
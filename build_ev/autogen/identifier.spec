@@ -0,0 +1 @@
+/root/repo/java/identifier.spec
\ No newline at end of file
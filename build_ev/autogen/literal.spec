@@ -0,0 +1 @@
+/root/repo/java/literal.spec
\ No newline at end of file
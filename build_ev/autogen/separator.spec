@@ -0,0 +1 @@
+/root/repo/java/separator.spec
\ No newline at end of file
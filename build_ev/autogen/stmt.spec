@@ -0,0 +1 @@
+/root/repo/java/stmt.spec
\ No newline at end of file
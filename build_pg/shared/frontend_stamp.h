@@ -0,0 +1 @@
+#define FRONTEND_STAMP "432071a28146528a"
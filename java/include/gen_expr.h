@@ -0,0 +1,148 @@
+#ifndef __EXPR_GEN_H__
+#define __EXPR_GEN_H__
+extern RuleTable TblPackageName;
+extern RuleTable TblPackageName_sub1;
+extern RuleTable TblTypeName;
+extern RuleTable TblTypeName_sub1;
+extern RuleTable TblPackageOrTypeName;
+extern RuleTable TblPackageOrTypeName_sub1;
+extern RuleTable TblExpressionName;
+extern RuleTable TblExpressionName_sub1;
+extern RuleTable TblMethodName;
+extern RuleTable TblAmbiguousName;
+extern RuleTable TblAmbiguousName_sub1;
+extern RuleTable TblClass;
+extern RuleTable TblClassLiteral;
+extern RuleTable TblClassLiteral_sub1;
+extern RuleTable TblClassLiteral_sub2;
+extern RuleTable TblClassLiteral_sub3;
+extern RuleTable TblClassLiteral_sub4;
+extern RuleTable TblClassLiteral_sub5;
+extern RuleTable TblClassLiteral_sub6;
+extern RuleTable TblPrimaryNoNewArray_single;
+extern RuleTable TblPrimaryNoNewArray_single_sub1;
+extern RuleTable TblPrimaryNoNewArray_single_sub2;
+extern RuleTable TblPrimaryNoNewArray;
+extern RuleTable TblClassInstanceCreationExpression;
+extern RuleTable TblClassInstanceCreationExpression_sub1;
+extern RuleTable TblUnqualifiedClassInstanceCreationExpression;
+extern RuleTable TblUnqualifiedClassInstanceCreationExpression_sub1;
+extern RuleTable TblClassOrInterfaceTypeToInstantiate;
+extern RuleTable TblClassOrInterfaceTypeToInstantiate_sub1;
+extern RuleTable TblClassOrInterfaceTypeToInstantiate_sub2;
+extern RuleTable TblClassOrInterfaceTypeToInstantiate_sub3;
+extern RuleTable TblTypeArgumentsOrDiamond;
+extern RuleTable TblArgumentList;
+extern RuleTable TblArgumentList_sub1;
+extern RuleTable TblArgumentList_sub2;
+extern RuleTable TblArrayInitializer;
+extern RuleTable TblArrayInitializer_sub1;
+extern RuleTable TblArrayCreationExpression;
+extern RuleTable TblArrayCreationExpression_sub1;
+extern RuleTable TblArrayCreationExpression_sub2;
+extern RuleTable TblArrayCreationExpression_sub3;
+extern RuleTable TblArrayCreationExpression_sub4;
+extern RuleTable TblDimExprs;
+extern RuleTable TblDimExprs_sub1;
+extern RuleTable TblDimExpr;
+extern RuleTable TblArrayAccess;
+extern RuleTable TblArrayAccess_sub1;
+extern RuleTable TblArrayAccess_sub2;
+extern RuleTable TblFieldAccess;
+extern RuleTable TblFieldAccess_sub1;
+extern RuleTable TblFieldAccess_sub2;
+extern RuleTable TblFieldAccess_sub3;
+extern RuleTable TblMethodInvocation;
+extern RuleTable TblMethodInvocation_sub1;
+extern RuleTable TblMethodInvocation_sub2;
+extern RuleTable TblMethodInvocation_sub3;
+extern RuleTable TblMethodInvocation_sub4;
+extern RuleTable TblMethodInvocation_sub5;
+extern RuleTable TblMethodInvocation_sub6;
+extern RuleTable TblMethodInvocation_sub7;
+extern RuleTable TblMethodInvocation_sub8;
+extern RuleTable TblMethodInvocation_sub9;
+extern RuleTable TblMethodInvocation_sub10;
+extern RuleTable TblMethodInvocation_sub11;
+extern RuleTable TblMethodInvocation_sub12;
+extern RuleTable TblMethodReference;
+extern RuleTable TblMethodReference_sub1;
+extern RuleTable TblMethodReference_sub2;
+extern RuleTable TblMethodReference_sub3;
+extern RuleTable TblMethodReference_sub4;
+extern RuleTable TblMethodReference_sub5;
+extern RuleTable TblMethodReference_sub6;
+extern RuleTable TblMethodReference_sub7;
+extern RuleTable TblPostfixExpression;
+extern RuleTable TblPostIncrementExpression;
+extern RuleTable TblPostDecrementExpression;
+extern RuleTable TblUnaryExpression;
+extern RuleTable TblUnaryExpression_sub1;
+extern RuleTable TblUnaryExpression_sub2;
+extern RuleTable TblUnaryExpression_sub3;
+extern RuleTable TblUnaryExpression_sub4;
+extern RuleTable TblUnaryExpression_sub5;
+extern RuleTable TblUnaryExpression_sub6;
+extern RuleTable TblUnaryExpression_sub7;
+extern RuleTable TblUnaryExpression_sub8;
+extern RuleTable TblUnaryExpression_sub9;
+extern RuleTable TblPreIncrementExpression;
+extern RuleTable TblPreDecrementExpression;
+extern RuleTable TblUnaryExpressionNotPlusMinus;
+extern RuleTable TblCastExpression;
+extern RuleTable TblMultiplicativeExpression;
+extern RuleTable TblMultiplicativeExpression_sub1;
+extern RuleTable TblMultiplicativeExpression_sub2;
+extern RuleTable TblMultiplicativeExpression_sub3;
+extern RuleTable TblAdditiveExpression;
+extern RuleTable TblAdditiveExpression_sub1;
+extern RuleTable TblAdditiveExpression_sub2;
+extern RuleTable TblShiftExpression;
+extern RuleTable TblShiftExpression_sub1;
+extern RuleTable TblShiftExpression_sub2;
+extern RuleTable TblShiftExpression_sub3;
+extern RuleTable TblRelationalExpression;
+extern RuleTable TblRelationalExpression_sub1;
+extern RuleTable TblRelationalExpression_sub2;
+extern RuleTable TblRelationalExpression_sub3;
+extern RuleTable TblRelationalExpression_sub4;
+extern RuleTable TblRelationalExpression_sub5;
+extern RuleTable TblEqualityExpression;
+extern RuleTable TblEqualityExpression_sub1;
+extern RuleTable TblEqualityExpression_sub2;
+extern RuleTable TblAndExpression;
+extern RuleTable TblAndExpression_sub1;
+extern RuleTable TblExclusiveOrExpression;
+extern RuleTable TblExclusiveOrExpression_sub1;
+extern RuleTable TblInclusiveOrExpression;
+extern RuleTable TblInclusiveOrExpression_sub1;
+extern RuleTable TblConditionalAndExpression;
+extern RuleTable TblConditionalAndExpression_sub1;
+extern RuleTable TblConditionalOrExpression;
+extern RuleTable TblConditionalOrExpression_sub1;
+extern RuleTable TblConditionalExpression;
+extern RuleTable TblAssignmentExpression;
+extern RuleTable TblAssignment;
+extern RuleTable TblLeftHandSide;
+extern RuleTable TblAssignmentOperator;
+extern RuleTable TblLambdaExpression;
+extern RuleTable TblLambdaParameters;
+extern RuleTable TblLambdaParameters_sub1;
+extern RuleTable TblLambdaParameters_sub2;
+extern RuleTable TblLambdaParameterList;
+extern RuleTable TblLambdaParameterList_sub1;
+extern RuleTable TblLambdaParameterList_sub2;
+extern RuleTable TblLambdaParameterList_sub3;
+extern RuleTable TblLambdaParameterList_sub4;
+extern RuleTable TblLambdaParameterList_sub5;
+extern RuleTable TblLambdaParameterList_sub6;
+extern RuleTable TblLambdaParameter;
+extern RuleTable TblLambdaParameter_sub1;
+extern RuleTable TblLambdaParameterType;
+extern RuleTable TblVariableArityParameter;
+extern RuleTable TblLambdaBody;
+extern RuleTable TblConstantExpression;
+extern RuleTable TblPrimary;
+extern RuleTable TblExpression;
+extern RuleTable TblBinaryExpression;
+#endif
@@ -0,0 +1,5 @@
+#ifndef __KEYWORD_GEN_H__
+#define __KEYWORD_GEN_H__
+extern KeywordTableEntry KeywordTable[51];
+extern unsigned KeywordTableSize;
+#endif
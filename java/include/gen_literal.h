@@ -0,0 +1,100 @@
+#ifndef __LITERAL_GEN_H__
+#define __LITERAL_GEN_H__
+#include "ruletable.h"
+extern RuleTable TblNonZeroDigit;
+extern RuleTable TblUnderscores;
+extern RuleTable TblUnderscores_sub1;
+extern RuleTable TblDigit;
+extern RuleTable TblDigitOrUnderscore;
+extern RuleTable TblDigitsAndUnderscores;
+extern RuleTable TblDigitsAndUnderscores_sub1;
+extern RuleTable TblDigits;
+extern RuleTable TblDigits_sub1;
+extern RuleTable TblDigits_sub2;
+extern RuleTable TblDecimalNumeral;
+extern RuleTable TblDecimalNumeral_sub1;
+extern RuleTable TblDecimalNumeral_sub2;
+extern RuleTable TblDecimalNumeral_sub3;
+extern RuleTable TblHexDigit;
+extern RuleTable TblHexDigitOrUnderscore;
+extern RuleTable TblHexDigitsAndUnderscores;
+extern RuleTable TblHexDigitsAndUnderscores_sub1;
+extern RuleTable TblHexDigits;
+extern RuleTable TblHexDigits_sub1;
+extern RuleTable TblHexDigits_sub2;
+extern RuleTable TblHexNumeral;
+extern RuleTable TblHexNumeral_sub1;
+extern RuleTable TblHexNumeral_sub2;
+extern RuleTable TblOctalDigit;
+extern RuleTable TblOctalDigitOrUnderscore;
+extern RuleTable TblOctalDigitsAndUnderscores;
+extern RuleTable TblOctalDigitsAndUnderscores_sub1;
+extern RuleTable TblOctalDigits;
+extern RuleTable TblOctalDigits_sub1;
+extern RuleTable TblOctalDigits_sub2;
+extern RuleTable TblOctalNumeral;
+extern RuleTable TblOctalNumeral_sub1;
+extern RuleTable TblOctalNumeral_sub2;
+extern RuleTable TblBinDigit;
+extern RuleTable TblBinDigitOrUnderscore;
+extern RuleTable TblBinDigitsAndUnderscores;
+extern RuleTable TblBinDigitsAndUnderscores_sub1;
+extern RuleTable TblBinDigits;
+extern RuleTable TblBinDigits_sub1;
+extern RuleTable TblBinDigits_sub2;
+extern RuleTable TblBinNumeral;
+extern RuleTable TblBinNumeral_sub1;
+extern RuleTable TblBinNumeral_sub2;
+extern RuleTable TblIntegerTypeSuffix;
+extern RuleTable TblDecimalIntegerLiteral;
+extern RuleTable TblDecimalIntegerLiteral_sub1;
+extern RuleTable TblHexIntegerLiteral;
+extern RuleTable TblHexIntegerLiteral_sub1;
+extern RuleTable TblOctalIntegerLiteral;
+extern RuleTable TblOctalIntegerLiteral_sub1;
+extern RuleTable TblBinaryIntegerLiteral;
+extern RuleTable TblBinaryIntegerLiteral_sub1;
+extern RuleTable TblIntegerLiteral;
+extern RuleTable TblSign;
+extern RuleTable TblFloatTypeSuffix;
+extern RuleTable TblExponentIndicator;
+extern RuleTable TblSignedInteger;
+extern RuleTable TblSignedInteger_sub1;
+extern RuleTable TblExponentPart;
+extern RuleTable TblDecFPLiteral;
+extern RuleTable TblDecFPLiteral_sub1;
+extern RuleTable TblDecFPLiteral_sub2;
+extern RuleTable TblDecFPLiteral_sub3;
+extern RuleTable TblDecFPLiteral_sub4;
+extern RuleTable TblDecFPLiteral_sub5;
+extern RuleTable TblDecFPLiteral_sub6;
+extern RuleTable TblDecFPLiteral_sub7;
+extern RuleTable TblDecFPLiteral_sub8;
+extern RuleTable TblDecFPLiteral_sub9;
+extern RuleTable TblDecFPLiteral_sub10;
+extern RuleTable TblDecFPLiteral_sub11;
+extern RuleTable TblBinaryExponentIndicator;
+extern RuleTable TblBinaryExponent;
+extern RuleTable TblHexSignificand;
+extern RuleTable TblHexSignificand_sub1;
+extern RuleTable TblHexSignificand_sub2;
+extern RuleTable TblHexSignificand_sub3;
+extern RuleTable TblHexSignificand_sub4;
+extern RuleTable TblHexSignificand_sub5;
+extern RuleTable TblHexSignificand_sub6;
+extern RuleTable TblHexFPLiteral;
+extern RuleTable TblHexFPLiteral_sub1;
+extern RuleTable TblFPLiteral;
+extern RuleTable TblBooleanLiteral;
+extern RuleTable TblOctalEscape;
+extern RuleTable TblOctalEscape_sub1;
+extern RuleTable TblOctalEscape_sub2;
+extern RuleTable TblEscapeSequence;
+extern RuleTable TblCharacterLiteral;
+extern RuleTable TblCharacterLiteral_sub1;
+extern RuleTable TblStringChar;
+extern RuleTable TblStringLiteral;
+extern RuleTable TblStringLiteral_sub1;
+extern RuleTable TblNullLiteral;
+extern RuleTable TblLiteral;
+#endif
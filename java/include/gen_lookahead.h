@@ -0,0 +1,4 @@
+#ifndef __GEN_LOOKAHEAD_H__
+#define __GEN_LOOKAHEAD_H__
+#include "ruletable.h"
+#endif
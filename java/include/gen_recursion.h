@@ -0,0 +1,4 @@
+#ifndef __GEN_RECUR_H__
+#define __GEN_RECUR_H__
+#include "recursion.h"
+#endif
@@ -0,0 +1,13 @@
+#include "common_header_autogen.h"
+AttrKeyword AttrKeywordTable[ATTR_NA] = {
+  {"abstract", ATTR_abstract},
+  {"const", ATTR_const},
+  {"volatile", ATTR_volatile},
+  {"final", ATTR_final},
+  {"native", ATTR_native},
+  {"private", ATTR_private},
+  {"protected", ATTR_protected},
+  {"public", ATTR_public},
+  {"static", ATTR_static},
+  {"strictfp", ATTR_strictfp}
+};
@@ -0,0 +1,193 @@
+#include "common_header_autogen.h"
+TableData TblNonZeroDigit_data[9] ={{DT_Char, {.mChar='1'}},{DT_Char, {.mChar='2'}},{DT_Char, {.mChar='3'}},{DT_Char, {.mChar='4'}},{DT_Char, {.mChar='5'}},{DT_Char, {.mChar='6'}},{DT_Char, {.mChar='7'}},{DT_Char, {.mChar='8'}},{DT_Char, {.mChar='9'}}};
+RuleTable TblNonZeroDigit ={ET_Oneof, RP_NA, 9, TblNonZeroDigit_data, 0, NULL, 16};
+TableData TblUnderscores_sub1_data[1] ={{DT_Char, {.mChar='_'}}};
+RuleTable TblUnderscores_sub1 ={ET_Zeroormore, RP_NA, 1, TblUnderscores_sub1_data, 0, NULL, 18};
+TableData TblUnderscores_data[2] ={{DT_Char, {.mChar='_'}},{DT_Subtable, &TblUnderscores_sub1}};
+RuleTable TblUnderscores ={ET_Concatenate, RP_NA, 2, TblUnderscores_data, 0, NULL, 17};
+TableData TblDigit_data[2] ={{DT_Char, {.mChar='0'}},{DT_Subtable, &TblNonZeroDigit}};
+RuleTable TblDigit ={ET_Oneof, RP_NA, 2, TblDigit_data, 0, NULL, 19};
+TableData TblDigitOrUnderscore_data[2] ={{DT_Subtable, &TblDigit},{DT_Char, {.mChar='_'}}};
+RuleTable TblDigitOrUnderscore ={ET_Oneof, RP_NA, 2, TblDigitOrUnderscore_data, 0, NULL, 20};
+TableData TblDigitsAndUnderscores_sub1_data[1] ={{DT_Subtable, &TblDigitOrUnderscore}};
+RuleTable TblDigitsAndUnderscores_sub1 ={ET_Zeroormore, RP_NA, 1, TblDigitsAndUnderscores_sub1_data, 0, NULL, 22};
+TableData TblDigitsAndUnderscores_data[2] ={{DT_Subtable, &TblDigitOrUnderscore},{DT_Subtable, &TblDigitsAndUnderscores_sub1}};
+RuleTable TblDigitsAndUnderscores ={ET_Concatenate, RP_NA, 2, TblDigitsAndUnderscores_data, 0, NULL, 21};
+TableData TblDigits_sub2_data[1] ={{DT_Subtable, &TblDigitsAndUnderscores}};
+RuleTable TblDigits_sub2 ={ET_Zeroorone, RP_NA, 1, TblDigits_sub2_data, 0, NULL, 25};
+TableData TblDigits_sub1_data[3] ={{DT_Subtable, &TblDigit},{DT_Subtable, &TblDigits_sub2},{DT_Subtable, &TblDigit}};
+RuleTable TblDigits_sub1 ={ET_Concatenate, RP_NA, 3, TblDigits_sub1_data, 0, NULL, 24};
+TableData TblDigits_data[2] ={{DT_Subtable, &TblDigit},{DT_Subtable, &TblDigits_sub1}};
+RuleTable TblDigits ={ET_Oneof, RP_NA, 2, TblDigits_data, 0, NULL, 23};
+TableData TblDecimalNumeral_sub2_data[1] ={{DT_Subtable, &TblDigits}};
+RuleTable TblDecimalNumeral_sub2 ={ET_Zeroorone, RP_NA, 1, TblDecimalNumeral_sub2_data, 0, NULL, 28};
+TableData TblDecimalNumeral_sub1_data[2] ={{DT_Subtable, &TblNonZeroDigit},{DT_Subtable, &TblDecimalNumeral_sub2}};
+RuleTable TblDecimalNumeral_sub1 ={ET_Concatenate, RP_NA, 2, TblDecimalNumeral_sub1_data, 0, NULL, 27};
+TableData TblDecimalNumeral_sub3_data[3] ={{DT_Subtable, &TblNonZeroDigit},{DT_Subtable, &TblUnderscores},{DT_Subtable, &TblDigits}};
+RuleTable TblDecimalNumeral_sub3 ={ET_Concatenate, RP_NA, 3, TblDecimalNumeral_sub3_data, 0, NULL, 29};
+TableData TblDecimalNumeral_data[3] ={{DT_Char, {.mChar='0'}},{DT_Subtable, &TblDecimalNumeral_sub1},{DT_Subtable, &TblDecimalNumeral_sub3}};
+RuleTable TblDecimalNumeral ={ET_Oneof, RP_NA, 3, TblDecimalNumeral_data, 0, NULL, 26};
+TableData TblHexDigit_data[22] ={{DT_Char, {.mChar='0'}},{DT_Char, {.mChar='1'}},{DT_Char, {.mChar='2'}},{DT_Char, {.mChar='3'}},{DT_Char, {.mChar='4'}},{DT_Char, {.mChar='5'}},{DT_Char, {.mChar='6'}},{DT_Char, {.mChar='7'}},{DT_Char, {.mChar='8'}},{DT_Char, {.mChar='9'}},{DT_Char, {.mChar='a'}},{DT_Char, {.mChar='b'}},{DT_Char, {.mChar='c'}},{DT_Char, {.mChar='d'}},{DT_Char, {.mChar='e'}},{DT_Char, {.mChar='f'}},{DT_Char, {.mChar='A'}},{DT_Char, {.mChar='B'}},{DT_Char, {.mChar='C'}},{DT_Char, {.mChar='D'}},{DT_Char, {.mChar='E'}},{DT_Char, {.mChar='F'}}};
+RuleTable TblHexDigit ={ET_Oneof, RP_NA, 22, TblHexDigit_data, 0, NULL, 30};
+TableData TblHexDigitOrUnderscore_data[2] ={{DT_Subtable, &TblHexDigit},{DT_Char, {.mChar='_'}}};
+RuleTable TblHexDigitOrUnderscore ={ET_Oneof, RP_NA, 2, TblHexDigitOrUnderscore_data, 0, NULL, 31};
+TableData TblHexDigitsAndUnderscores_sub1_data[1] ={{DT_Subtable, &TblHexDigitOrUnderscore}};
+RuleTable TblHexDigitsAndUnderscores_sub1 ={ET_Zeroormore, RP_NA, 1, TblHexDigitsAndUnderscores_sub1_data, 0, NULL, 33};
+TableData TblHexDigitsAndUnderscores_data[2] ={{DT_Subtable, &TblHexDigitOrUnderscore},{DT_Subtable, &TblHexDigitsAndUnderscores_sub1}};
+RuleTable TblHexDigitsAndUnderscores ={ET_Concatenate, RP_NA, 2, TblHexDigitsAndUnderscores_data, 0, NULL, 32};
+TableData TblHexDigits_sub2_data[1] ={{DT_Subtable, &TblHexDigitsAndUnderscores}};
+RuleTable TblHexDigits_sub2 ={ET_Zeroorone, RP_NA, 1, TblHexDigits_sub2_data, 0, NULL, 36};
+TableData TblHexDigits_sub1_data[3] ={{DT_Subtable, &TblHexDigit},{DT_Subtable, &TblHexDigits_sub2},{DT_Subtable, &TblHexDigit}};
+RuleTable TblHexDigits_sub1 ={ET_Concatenate, RP_NA, 3, TblHexDigits_sub1_data, 0, NULL, 35};
+TableData TblHexDigits_data[2] ={{DT_Subtable, &TblHexDigit},{DT_Subtable, &TblHexDigits_sub1}};
+RuleTable TblHexDigits ={ET_Oneof, RP_NA, 2, TblHexDigits_data, 0, NULL, 34};
+TableData TblHexNumeral_sub1_data[2] ={{DT_String, {.mString="0x"}},{DT_Subtable, &TblHexDigits}};
+RuleTable TblHexNumeral_sub1 ={ET_Concatenate, RP_NA, 2, TblHexNumeral_sub1_data, 0, NULL, 38};
+TableData TblHexNumeral_sub2_data[2] ={{DT_String, {.mString="0X"}},{DT_Subtable, &TblHexDigits}};
+RuleTable TblHexNumeral_sub2 ={ET_Concatenate, RP_NA, 2, TblHexNumeral_sub2_data, 0, NULL, 39};
+TableData TblHexNumeral_data[2] ={{DT_Subtable, &TblHexNumeral_sub1},{DT_Subtable, &TblHexNumeral_sub2}};
+RuleTable TblHexNumeral ={ET_Oneof, RP_NA, 2, TblHexNumeral_data, 0, NULL, 37};
+TableData TblOctalDigit_data[8] ={{DT_Char, {.mChar='0'}},{DT_Char, {.mChar='1'}},{DT_Char, {.mChar='2'}},{DT_Char, {.mChar='3'}},{DT_Char, {.mChar='4'}},{DT_Char, {.mChar='5'}},{DT_Char, {.mChar='6'}},{DT_Char, {.mChar='7'}}};
+RuleTable TblOctalDigit ={ET_Oneof, RP_NA, 8, TblOctalDigit_data, 0, NULL, 40};
+TableData TblOctalDigitOrUnderscore_data[2] ={{DT_Subtable, &TblOctalDigit},{DT_Char, {.mChar='_'}}};
+RuleTable TblOctalDigitOrUnderscore ={ET_Oneof, RP_NA, 2, TblOctalDigitOrUnderscore_data, 0, NULL, 41};
+TableData TblOctalDigitsAndUnderscores_sub1_data[1] ={{DT_Subtable, &TblOctalDigitOrUnderscore}};
+RuleTable TblOctalDigitsAndUnderscores_sub1 ={ET_Zeroormore, RP_NA, 1, TblOctalDigitsAndUnderscores_sub1_data, 0, NULL, 43};
+TableData TblOctalDigitsAndUnderscores_data[2] ={{DT_Subtable, &TblOctalDigitOrUnderscore},{DT_Subtable, &TblOctalDigitsAndUnderscores_sub1}};
+RuleTable TblOctalDigitsAndUnderscores ={ET_Concatenate, RP_NA, 2, TblOctalDigitsAndUnderscores_data, 0, NULL, 42};
+TableData TblOctalDigits_sub2_data[1] ={{DT_Subtable, &TblOctalDigitsAndUnderscores}};
+RuleTable TblOctalDigits_sub2 ={ET_Zeroorone, RP_NA, 1, TblOctalDigits_sub2_data, 0, NULL, 46};
+TableData TblOctalDigits_sub1_data[3] ={{DT_Subtable, &TblOctalDigit},{DT_Subtable, &TblOctalDigits_sub2},{DT_Subtable, &TblOctalDigit}};
+RuleTable TblOctalDigits_sub1 ={ET_Concatenate, RP_NA, 3, TblOctalDigits_sub1_data, 0, NULL, 45};
+TableData TblOctalDigits_data[2] ={{DT_Subtable, &TblOctalDigit},{DT_Subtable, &TblOctalDigits_sub1}};
+RuleTable TblOctalDigits ={ET_Oneof, RP_NA, 2, TblOctalDigits_data, 0, NULL, 44};
+TableData TblOctalNumeral_sub1_data[2] ={{DT_Char, {.mChar='0'}},{DT_Subtable, &TblOctalDigits}};
+RuleTable TblOctalNumeral_sub1 ={ET_Concatenate, RP_NA, 2, TblOctalNumeral_sub1_data, 0, NULL, 48};
+TableData TblOctalNumeral_sub2_data[3] ={{DT_Char, {.mChar='0'}},{DT_Subtable, &TblUnderscores},{DT_Subtable, &TblOctalDigits}};
+RuleTable TblOctalNumeral_sub2 ={ET_Concatenate, RP_NA, 3, TblOctalNumeral_sub2_data, 0, NULL, 49};
+TableData TblOctalNumeral_data[2] ={{DT_Subtable, &TblOctalNumeral_sub1},{DT_Subtable, &TblOctalNumeral_sub2}};
+RuleTable TblOctalNumeral ={ET_Oneof, RP_NA, 2, TblOctalNumeral_data, 0, NULL, 47};
+TableData TblBinDigit_data[2] ={{DT_Char, {.mChar='0'}},{DT_Char, {.mChar='1'}}};
+RuleTable TblBinDigit ={ET_Oneof, RP_NA, 2, TblBinDigit_data, 0, NULL, 50};
+TableData TblBinDigitOrUnderscore_data[2] ={{DT_Subtable, &TblBinDigit},{DT_Char, {.mChar='_'}}};
+RuleTable TblBinDigitOrUnderscore ={ET_Oneof, RP_NA, 2, TblBinDigitOrUnderscore_data, 0, NULL, 51};
+TableData TblBinDigitsAndUnderscores_sub1_data[1] ={{DT_Subtable, &TblBinDigitOrUnderscore}};
+RuleTable TblBinDigitsAndUnderscores_sub1 ={ET_Zeroormore, RP_NA, 1, TblBinDigitsAndUnderscores_sub1_data, 0, NULL, 53};
+TableData TblBinDigitsAndUnderscores_data[2] ={{DT_Subtable, &TblBinDigitOrUnderscore},{DT_Subtable, &TblBinDigitsAndUnderscores_sub1}};
+RuleTable TblBinDigitsAndUnderscores ={ET_Concatenate, RP_NA, 2, TblBinDigitsAndUnderscores_data, 0, NULL, 52};
+TableData TblBinDigits_sub2_data[1] ={{DT_Subtable, &TblBinDigitsAndUnderscores}};
+RuleTable TblBinDigits_sub2 ={ET_Zeroorone, RP_NA, 1, TblBinDigits_sub2_data, 0, NULL, 56};
+TableData TblBinDigits_sub1_data[3] ={{DT_Subtable, &TblBinDigit},{DT_Subtable, &TblBinDigits_sub2},{DT_Subtable, &TblBinDigit}};
+RuleTable TblBinDigits_sub1 ={ET_Concatenate, RP_NA, 3, TblBinDigits_sub1_data, 0, NULL, 55};
+TableData TblBinDigits_data[2] ={{DT_Subtable, &TblBinDigit},{DT_Subtable, &TblBinDigits_sub1}};
+RuleTable TblBinDigits ={ET_Oneof, RP_NA, 2, TblBinDigits_data, 0, NULL, 54};
+TableData TblBinNumeral_sub1_data[2] ={{DT_String, {.mString="0b"}},{DT_Subtable, &TblBinDigits}};
+RuleTable TblBinNumeral_sub1 ={ET_Concatenate, RP_NA, 2, TblBinNumeral_sub1_data, 0, NULL, 58};
+TableData TblBinNumeral_sub2_data[2] ={{DT_String, {.mString="0B"}},{DT_Subtable, &TblBinDigits}};
+RuleTable TblBinNumeral_sub2 ={ET_Concatenate, RP_NA, 2, TblBinNumeral_sub2_data, 0, NULL, 59};
+TableData TblBinNumeral_data[2] ={{DT_Subtable, &TblBinNumeral_sub1},{DT_Subtable, &TblBinNumeral_sub2}};
+RuleTable TblBinNumeral ={ET_Oneof, RP_NA, 2, TblBinNumeral_data, 0, NULL, 57};
+TableData TblIntegerTypeSuffix_data[2] ={{DT_Char, {.mChar='L'}},{DT_Char, {.mChar='l'}}};
+RuleTable TblIntegerTypeSuffix ={ET_Oneof, RP_NA, 2, TblIntegerTypeSuffix_data, 0, NULL, 60};
+TableData TblDecimalIntegerLiteral_sub1_data[1] ={{DT_Subtable, &TblIntegerTypeSuffix}};
+RuleTable TblDecimalIntegerLiteral_sub1 ={ET_Zeroorone, RP_NA, 1, TblDecimalIntegerLiteral_sub1_data, 0, NULL, 62};
+TableData TblDecimalIntegerLiteral_data[2] ={{DT_Subtable, &TblDecimalNumeral},{DT_Subtable, &TblDecimalIntegerLiteral_sub1}};
+RuleTable TblDecimalIntegerLiteral ={ET_Concatenate, RP_NA, 2, TblDecimalIntegerLiteral_data, 0, NULL, 61};
+TableData TblHexIntegerLiteral_sub1_data[1] ={{DT_Subtable, &TblIntegerTypeSuffix}};
+RuleTable TblHexIntegerLiteral_sub1 ={ET_Zeroorone, RP_NA, 1, TblHexIntegerLiteral_sub1_data, 0, NULL, 64};
+TableData TblHexIntegerLiteral_data[2] ={{DT_Subtable, &TblHexNumeral},{DT_Subtable, &TblHexIntegerLiteral_sub1}};
+RuleTable TblHexIntegerLiteral ={ET_Concatenate, RP_NA, 2, TblHexIntegerLiteral_data, 0, NULL, 63};
+TableData TblOctalIntegerLiteral_sub1_data[1] ={{DT_Subtable, &TblIntegerTypeSuffix}};
+RuleTable TblOctalIntegerLiteral_sub1 ={ET_Zeroorone, RP_NA, 1, TblOctalIntegerLiteral_sub1_data, 0, NULL, 66};
+TableData TblOctalIntegerLiteral_data[2] ={{DT_Subtable, &TblOctalNumeral},{DT_Subtable, &TblOctalIntegerLiteral_sub1}};
+RuleTable TblOctalIntegerLiteral ={ET_Concatenate, RP_NA, 2, TblOctalIntegerLiteral_data, 0, NULL, 65};
+TableData TblBinaryIntegerLiteral_sub1_data[1] ={{DT_Subtable, &TblIntegerTypeSuffix}};
+RuleTable TblBinaryIntegerLiteral_sub1 ={ET_Zeroorone, RP_NA, 1, TblBinaryIntegerLiteral_sub1_data, 0, NULL, 68};
+TableData TblBinaryIntegerLiteral_data[2] ={{DT_Subtable, &TblBinNumeral},{DT_Subtable, &TblBinaryIntegerLiteral_sub1}};
+RuleTable TblBinaryIntegerLiteral ={ET_Concatenate, RP_NA, 2, TblBinaryIntegerLiteral_data, 0, NULL, 67};
+TableData TblIntegerLiteral_data[4] ={{DT_Subtable, &TblDecimalIntegerLiteral},{DT_Subtable, &TblHexIntegerLiteral},{DT_Subtable, &TblOctalIntegerLiteral},{DT_Subtable, &TblBinaryIntegerLiteral}};
+RuleTable TblIntegerLiteral ={ET_Oneof, RP_NA, 4, TblIntegerLiteral_data, 0, NULL, 69};
+TableData TblSign_data[2] ={{DT_Token, {.mTokenId=37}},{DT_Token, {.mTokenId=36}}};
+RuleTable TblSign ={ET_Oneof, RP_NA, 2, TblSign_data, 0, NULL, 70};
+TableData TblFloatTypeSuffix_data[4] ={{DT_Char, {.mChar='f'}},{DT_Char, {.mChar='F'}},{DT_Char, {.mChar='d'}},{DT_Char, {.mChar='D'}}};
+RuleTable TblFloatTypeSuffix ={ET_Oneof, RP_NA, 4, TblFloatTypeSuffix_data, 0, NULL, 71};
+TableData TblExponentIndicator_data[2] ={{DT_Char, {.mChar='e'}},{DT_Char, {.mChar='E'}}};
+RuleTable TblExponentIndicator ={ET_Oneof, RP_NA, 2, TblExponentIndicator_data, 0, NULL, 72};
+TableData TblSignedInteger_sub1_data[1] ={{DT_Subtable, &TblSign}};
+RuleTable TblSignedInteger_sub1 ={ET_Zeroorone, RP_NA, 1, TblSignedInteger_sub1_data, 0, NULL, 74};
+TableData TblSignedInteger_data[2] ={{DT_Subtable, &TblSignedInteger_sub1},{DT_Subtable, &TblDigits}};
+RuleTable TblSignedInteger ={ET_Concatenate, RP_NA, 2, TblSignedInteger_data, 0, NULL, 73};
+TableData TblExponentPart_data[2] ={{DT_Subtable, &TblExponentIndicator},{DT_Subtable, &TblSignedInteger}};
+RuleTable TblExponentPart ={ET_Concatenate, RP_NA, 2, TblExponentPart_data, 0, NULL, 75};
+TableData TblDecFPLiteral_sub2_data[1] ={{DT_Subtable, &TblDigits}};
+RuleTable TblDecFPLiteral_sub2 ={ET_Zeroorone, RP_NA, 1, TblDecFPLiteral_sub2_data, 0, NULL, 78};
+TableData TblDecFPLiteral_sub3_data[1] ={{DT_Subtable, &TblExponentPart}};
+RuleTable TblDecFPLiteral_sub3 ={ET_Zeroorone, RP_NA, 1, TblDecFPLiteral_sub3_data, 0, NULL, 79};
+TableData TblDecFPLiteral_sub4_data[1] ={{DT_Subtable, &TblFloatTypeSuffix}};
+RuleTable TblDecFPLiteral_sub4 ={ET_Zeroorone, RP_NA, 1, TblDecFPLiteral_sub4_data, 0, NULL, 80};
+TableData TblDecFPLiteral_sub1_data[5] ={{DT_Subtable, &TblDigits},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblDecFPLiteral_sub2},{DT_Subtable, &TblDecFPLiteral_sub3},{DT_Subtable, &TblDecFPLiteral_sub4}};
+RuleTable TblDecFPLiteral_sub1 ={ET_Concatenate, RP_NA, 5, TblDecFPLiteral_sub1_data, 0, NULL, 77};
+TableData TblDecFPLiteral_sub6_data[1] ={{DT_Subtable, &TblExponentPart}};
+RuleTable TblDecFPLiteral_sub6 ={ET_Zeroorone, RP_NA, 1, TblDecFPLiteral_sub6_data, 0, NULL, 82};
+TableData TblDecFPLiteral_sub7_data[1] ={{DT_Subtable, &TblFloatTypeSuffix}};
+RuleTable TblDecFPLiteral_sub7 ={ET_Zeroorone, RP_NA, 1, TblDecFPLiteral_sub7_data, 0, NULL, 83};
+TableData TblDecFPLiteral_sub5_data[4] ={{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblDigits},{DT_Subtable, &TblDecFPLiteral_sub6},{DT_Subtable, &TblDecFPLiteral_sub7}};
+RuleTable TblDecFPLiteral_sub5 ={ET_Concatenate, RP_NA, 4, TblDecFPLiteral_sub5_data, 0, NULL, 81};
+TableData TblDecFPLiteral_sub9_data[1] ={{DT_Subtable, &TblFloatTypeSuffix}};
+RuleTable TblDecFPLiteral_sub9 ={ET_Zeroorone, RP_NA, 1, TblDecFPLiteral_sub9_data, 0, NULL, 85};
+TableData TblDecFPLiteral_sub8_data[3] ={{DT_Subtable, &TblDigits},{DT_Subtable, &TblExponentPart},{DT_Subtable, &TblDecFPLiteral_sub9}};
+RuleTable TblDecFPLiteral_sub8 ={ET_Concatenate, RP_NA, 3, TblDecFPLiteral_sub8_data, 0, NULL, 84};
+TableData TblDecFPLiteral_sub11_data[1] ={{DT_Subtable, &TblExponentPart}};
+RuleTable TblDecFPLiteral_sub11 ={ET_Zeroorone, RP_NA, 1, TblDecFPLiteral_sub11_data, 0, NULL, 87};
+TableData TblDecFPLiteral_sub10_data[2] ={{DT_Subtable, &TblDigits},{DT_Subtable, &TblDecFPLiteral_sub11}};
+RuleTable TblDecFPLiteral_sub10 ={ET_Concatenate, RP_NA, 2, TblDecFPLiteral_sub10_data, 0, NULL, 86};
+TableData TblDecFPLiteral_data[4] ={{DT_Subtable, &TblDecFPLiteral_sub1},{DT_Subtable, &TblDecFPLiteral_sub5},{DT_Subtable, &TblDecFPLiteral_sub8},{DT_Subtable, &TblDecFPLiteral_sub10}};
+RuleTable TblDecFPLiteral ={ET_Oneof, RP_NA, 4, TblDecFPLiteral_data, 0, NULL, 76};
+TableData TblBinaryExponentIndicator_data[2] ={{DT_Char, {.mChar='p'}},{DT_Char, {.mChar='P'}}};
+RuleTable TblBinaryExponentIndicator ={ET_Oneof, RP_NA, 2, TblBinaryExponentIndicator_data, 0, NULL, 88};
+TableData TblBinaryExponent_data[2] ={{DT_Subtable, &TblBinaryExponentIndicator},{DT_Subtable, &TblSignedInteger}};
+RuleTable TblBinaryExponent ={ET_Concatenate, RP_NA, 2, TblBinaryExponent_data, 0, NULL, 89};
+TableData TblHexSignificand_sub2_data[1] ={{DT_Token, {.mTokenId=43}}};
+RuleTable TblHexSignificand_sub2 ={ET_Zeroorone, RP_NA, 1, TblHexSignificand_sub2_data, 0, NULL, 92};
+TableData TblHexSignificand_sub1_data[2] ={{DT_Subtable, &TblHexNumeral},{DT_Subtable, &TblHexSignificand_sub2}};
+RuleTable TblHexSignificand_sub1 ={ET_Concatenate, RP_NA, 2, TblHexSignificand_sub1_data, 0, NULL, 91};
+TableData TblHexSignificand_sub4_data[1] ={{DT_Subtable, &TblHexDigits}};
+RuleTable TblHexSignificand_sub4 ={ET_Zeroorone, RP_NA, 1, TblHexSignificand_sub4_data, 0, NULL, 94};
+TableData TblHexSignificand_sub3_data[4] ={{DT_String, {.mString="0x"}},{DT_Subtable, &TblHexSignificand_sub4},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblHexDigits}};
+RuleTable TblHexSignificand_sub3 ={ET_Concatenate, RP_NA, 4, TblHexSignificand_sub3_data, 0, NULL, 93};
+TableData TblHexSignificand_sub6_data[1] ={{DT_Subtable, &TblHexDigits}};
+RuleTable TblHexSignificand_sub6 ={ET_Zeroorone, RP_NA, 1, TblHexSignificand_sub6_data, 0, NULL, 96};
+TableData TblHexSignificand_sub5_data[4] ={{DT_String, {.mString="0X"}},{DT_Subtable, &TblHexSignificand_sub6},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblHexDigits}};
+RuleTable TblHexSignificand_sub5 ={ET_Concatenate, RP_NA, 4, TblHexSignificand_sub5_data, 0, NULL, 95};
+TableData TblHexSignificand_data[3] ={{DT_Subtable, &TblHexSignificand_sub1},{DT_Subtable, &TblHexSignificand_sub3},{DT_Subtable, &TblHexSignificand_sub5}};
+RuleTable TblHexSignificand ={ET_Oneof, RP_NA, 3, TblHexSignificand_data, 0, NULL, 90};
+TableData TblHexFPLiteral_sub1_data[1] ={{DT_Subtable, &TblFloatTypeSuffix}};
+RuleTable TblHexFPLiteral_sub1 ={ET_Zeroorone, RP_NA, 1, TblHexFPLiteral_sub1_data, 0, NULL, 98};
+TableData TblHexFPLiteral_data[3] ={{DT_Subtable, &TblHexSignificand},{DT_Subtable, &TblBinaryExponent},{DT_Subtable, &TblHexFPLiteral_sub1}};
+RuleTable TblHexFPLiteral ={ET_Concatenate, RP_NA, 3, TblHexFPLiteral_data, 0, NULL, 97};
+TableData TblFPLiteral_data[2] ={{DT_Subtable, &TblDecFPLiteral},{DT_Subtable, &TblHexFPLiteral}};
+RuleTable TblFPLiteral ={ET_Oneof, RP_NA, 2, TblFPLiteral_data, 0, NULL, 99};
+TableData TblBooleanLiteral_data[2] ={{DT_String, {.mString="true"}},{DT_String, {.mString="false"}}};
+RuleTable TblBooleanLiteral ={ET_Oneof, RP_NA, 2, TblBooleanLiteral_data, 0, NULL, 100};
+TableData TblOctalEscape_sub1_data[2] ={{DT_Char, {.mChar='\\'}},{DT_Char, {.mChar='0'}}};
+RuleTable TblOctalEscape_sub1 ={ET_Concatenate, RP_NA, 2, TblOctalEscape_sub1_data, 0, NULL, 102};
+TableData TblOctalEscape_sub2_data[2] ={{DT_Char, {.mChar='\\'}},{DT_Char, {.mChar='1'}}};
+RuleTable TblOctalEscape_sub2 ={ET_Concatenate, RP_NA, 2, TblOctalEscape_sub2_data, 0, NULL, 103};
+TableData TblOctalEscape_data[2] ={{DT_Subtable, &TblOctalEscape_sub1},{DT_Subtable, &TblOctalEscape_sub2}};
+RuleTable TblOctalEscape ={ET_Oneof, RP_NA, 2, TblOctalEscape_data, 0, NULL, 101};
+TableData TblEscapeSequence_data[2] ={{DT_Subtable, &TblESCAPE},{DT_Subtable, &TblOctalEscape}};
+RuleTable TblEscapeSequence ={ET_Oneof, RP_NA, 2, TblEscapeSequence_data, 0, NULL, 104};
+TableData TblCharacterLiteral_sub1_data[3] ={{DT_Subtable, &TblCHAR},{DT_Subtable, &TblDIGIT},{DT_Subtable, &TblEscapeSequence}};
+RuleTable TblCharacterLiteral_sub1 ={ET_Oneof, RP_NA, 3, TblCharacterLiteral_sub1_data, 0, NULL, 106};
+TableData TblCharacterLiteral_data[3] ={{DT_Char, {.mChar='\''}},{DT_Subtable, &TblCharacterLiteral_sub1},{DT_Char, {.mChar='\''}}};
+RuleTable TblCharacterLiteral ={ET_Concatenate, RP_NA, 3, TblCharacterLiteral_data, 0, NULL, 105};
+TableData TblStringChar_data[2] ={{DT_Subtable, &TblASCII},{DT_Subtable, &TblESCAPE}};
+RuleTable TblStringChar ={ET_Oneof, RP_NA, 2, TblStringChar_data, 0, NULL, 107};
+TableData TblStringLiteral_sub1_data[1] ={{DT_Subtable, &TblStringChar}};
+RuleTable TblStringLiteral_sub1 ={ET_Zeroormore, RP_NA, 1, TblStringLiteral_sub1_data, 0, NULL, 109};
+TableData TblStringLiteral_data[3] ={{DT_Char, {.mChar='"'}},{DT_Subtable, &TblStringLiteral_sub1},{DT_Char, {.mChar='"'}}};
+RuleTable TblStringLiteral ={ET_Concatenate, RP_NA, 3, TblStringLiteral_data, 0, NULL, 108};
+TableData TblNullLiteral_data[1] ={{DT_String, {.mString="null"}}};
+RuleTable TblNullLiteral ={ET_Data, RP_NA, 1, TblNullLiteral_data, 0, NULL, 110};
+TableData TblLiteral_data[6] ={{DT_Subtable, &TblIntegerLiteral},{DT_Subtable, &TblFPLiteral},{DT_Subtable, &TblBooleanLiteral},{DT_Subtable, &TblCharacterLiteral},{DT_Subtable, &TblStringLiteral},{DT_Subtable, &TblNullLiteral}};
+RuleTable TblLiteral ={ET_Oneof, RP_NA, 6, TblLiteral_data, 0, NULL, 111};
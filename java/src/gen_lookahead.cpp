@@ -0,0 +1,1516 @@
+#include "gen_lookahead.h"
+#include "common_header_autogen.h"
+LookAhead TblIdentifierLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblLiteralLookAhead[] = {{LA_Literal, NULL}};
+LookAhead TblNumericTypeLookAhead[] = {{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77}};
+LookAhead TblPrimitiveTypeLookAhead[] = {{LA_Token, 41},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68}};
+LookAhead TblPrimitiveType_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77}};
+LookAhead TblPrimitiveType_sub2LookAhead[] = {{LA_Token, 41}};
+LookAhead TblPrimitiveType_sub3LookAhead[] = {{LA_Token, 41},{LA_Token, 68}};
+LookAhead TblWildcardBoundsLookAhead[] = {{LA_Token, 64},{LA_Token, 80}};
+LookAhead TblWildcardBounds_sub1LookAhead[] = {{LA_Token, 64}};
+LookAhead TblWildcardBounds_sub2LookAhead[] = {{LA_Token, 80}};
+LookAhead TblWildcardLookAhead[] = {{LA_Token, 41},{LA_Token, 23}};
+LookAhead TblWildcard_sub1LookAhead[] = {{LA_Token, 64},{LA_Token, 80}};
+LookAhead TblTypeArgumentLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 23}};
+LookAhead TblTypeArgument_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68}};
+LookAhead TblTypeArgument_sub2LookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblTypeArgument_sub3LookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblTypeArgumentListLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 23}};
+LookAhead TblTypeArgumentList_sub1LookAhead[] = {{LA_Token, 44}};
+LookAhead TblTypeArgumentList_sub2LookAhead[] = {{LA_Token, 44}};
+LookAhead TblTypeArgumentsLookAhead[] = {{LA_Token, 31}};
+LookAhead TblClassTypeLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblClassType_sub1LookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblClassType_sub2LookAhead[] = {{LA_Token, 31}};
+LookAhead TblClassType_sub3LookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblInterfaceTypeLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblTypeVariableLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblArrayTypeLookAhead[] = {{LA_Token, 41},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblClassOrInterfaceTypeLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblReferenceTypeLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68}};
+LookAhead TblUnannClassTypeLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblUnannClassType_sub1LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblUnannClassType_sub2LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblUnannClassOrInterfaceTypeLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblUnannInterfaceTypeLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblUnannArrayType_sub1LookAhead[] = {{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68}};
+LookAhead TblUnannArrayType_sub2LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblUnannArrayType_sub3LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblUnannPrimitiveTypeLookAhead[] = {{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68}};
+LookAhead TblUnannTypeLookAhead[] = {{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblClassDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 78},{LA_Token, 59},{LA_Token, 87},{LA_Token, 94}};
+LookAhead TblNormalClassDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 78},{LA_Token, 59},{LA_Token, 87}};
+LookAhead TblNormalClassDeclaration_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 78},{LA_Token, 59}};
+LookAhead TblNormalClassDeclaration_sub2LookAhead[] = {{LA_Token, 31}};
+LookAhead TblNormalClassDeclaration_sub3LookAhead[] = {{LA_Token, 64}};
+LookAhead TblNormalClassDeclaration_sub4LookAhead[] = {{LA_Token, 54}};
+LookAhead TblClassAttrLookAhead[] = {{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 78},{LA_Token, 59}};
+LookAhead TblClassModifierLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 78},{LA_Token, 59}};
+LookAhead TblTypeParametersLookAhead[] = {{LA_Token, 31}};
+LookAhead TblTypeParameterListLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblTypeParameterList_sub1LookAhead[] = {{LA_Token, 44}};
+LookAhead TblTypeParameterList_sub2LookAhead[] = {{LA_Token, 44}};
+LookAhead TblTypeParameterLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblTypeParameter_sub1LookAhead[] = {{LA_Token, 64}};
+LookAhead TblTypeBoundLookAhead[] = {{LA_Token, 64}};
+LookAhead TblTypeBound_sub1LookAhead[] = {{LA_Token, 64}};
+LookAhead TblTypeBound_sub2LookAhead[] = {{LA_Token, 64}};
+LookAhead TblTypeBound_sub3LookAhead[] = {{LA_Token, 30}};
+LookAhead TblAdditionalBoundLookAhead[] = {{LA_Token, 30}};
+LookAhead TblSuperclassLookAhead[] = {{LA_Token, 64}};
+LookAhead TblSuperinterfacesLookAhead[] = {{LA_Token, 54}};
+LookAhead TblInterfaceTypeListLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblInterfaceTypeList_sub1LookAhead[] = {{LA_Token, 44}};
+LookAhead TblInterfaceTypeList_sub2LookAhead[] = {{LA_Token, 44}};
+LookAhead TblClassBodyLookAhead[] = {{LA_Token, 49}};
+LookAhead TblClassBody_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 69},{LA_Token, 78},{LA_Token, 57},{LA_Token, 60},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 61},{LA_Token, 53},{LA_Token, 71},{LA_Token, 59},{LA_Token, 92},{LA_Token, 31},{LA_Token, 87},{LA_Token, 94},{LA_Token, 58},{LA_Token, 45},{LA_Token, 49}};
+LookAhead TblClassBodyDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 69},{LA_Token, 78},{LA_Token, 57},{LA_Token, 60},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 61},{LA_Token, 53},{LA_Token, 71},{LA_Token, 59},{LA_Token, 92},{LA_Token, 31},{LA_Token, 87},{LA_Token, 94},{LA_Token, 58},{LA_Token, 45},{LA_Token, 49}};
+LookAhead TblInstanceInitializerLookAhead[] = {{LA_Token, 49}};
+LookAhead TblStaticInitializerLookAhead[] = {{LA_Token, 69}};
+LookAhead TblClassMemberDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 69},{LA_Token, 78},{LA_Token, 57},{LA_Token, 60},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 61},{LA_Token, 53},{LA_Token, 71},{LA_Token, 59},{LA_Token, 92},{LA_Token, 31},{LA_Token, 87},{LA_Token, 94},{LA_Token, 58},{LA_Token, 45}};
+LookAhead TblFieldDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 69},{LA_Token, 78},{LA_Token, 57},{LA_Token, 60},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblFieldDeclaration_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 69},{LA_Token, 78},{LA_Token, 57},{LA_Token, 60}};
+LookAhead TblMethodDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 78},{LA_Token, 53},{LA_Token, 71},{LA_Token, 59},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 92},{LA_Token, 31}};
+LookAhead TblMethodDeclaration_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 78},{LA_Token, 53},{LA_Token, 71},{LA_Token, 59}};
+LookAhead TblMethodBodyLookAhead[] = {{LA_Token, 49},{LA_Token, 45}};
+LookAhead TblMethodHeaderLookAhead[] = {{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 92},{LA_Token, 31}};
+LookAhead TblMethodHeader_sub1LookAhead[] = {{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 92}};
+LookAhead TblMethodHeader_sub2LookAhead[] = {{LA_Token, 72}};
+LookAhead TblMethodHeader_sub3LookAhead[] = {{LA_Token, 31}};
+LookAhead TblResultLookAhead[] = {{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 92}};
+LookAhead TblMethodDeclaratorLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblMethodDeclarator_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 78}};
+LookAhead TblMethodDeclarator_sub2LookAhead[] = {{LA_Token, 41},{LA_Token, 47}};
+LookAhead TblThrowsLookAhead[] = {{LA_Token, 72}};
+LookAhead TblExceptionTypeListLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblExceptionTypeList_sub1LookAhead[] = {{LA_Token, 44}};
+LookAhead TblExceptionTypeList_sub2LookAhead[] = {{LA_Token, 44}};
+LookAhead TblExceptionTypeLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblMethodAttrLookAhead[] = {{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 78},{LA_Token, 53},{LA_Token, 71},{LA_Token, 59}};
+LookAhead TblMethodModifierLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 78},{LA_Token, 53},{LA_Token, 71},{LA_Token, 59}};
+LookAhead TblFormalParameterListNoReceiverLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblFormalParameterListNoReceiver_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblFormalParameterListLookAhead[] = {{LA_Token, 41},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 78}};
+LookAhead TblFormalParametersLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblFormalParameters_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblFormalParameters_sub2LookAhead[] = {{LA_Token, 44}};
+LookAhead TblFormalParameters_sub3LookAhead[] = {{LA_Token, 44}};
+LookAhead TblFormalParameters_sub4LookAhead[] = {{LA_Token, 41},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblFormalParameterLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblFormalParameter_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 78}};
+LookAhead TblReceiverParameterLookAhead[] = {{LA_Token, 41},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblReceiverParameter_sub1LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblReceiverParameter_sub2LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblLastFormalParameterLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblLastFormalParameter_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblFieldAttrLookAhead[] = {{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 69},{LA_Token, 78},{LA_Token, 57},{LA_Token, 60}};
+LookAhead TblFieldModifierLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 69},{LA_Token, 78},{LA_Token, 57},{LA_Token, 60}};
+LookAhead TblConstructorDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 31},{LA_Identifier, NULL}};
+LookAhead TblConstructorDeclaration_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63}};
+LookAhead TblConstructorAttrLookAhead[] = {{LA_Token, 70},{LA_Token, 56},{LA_Token, 63}};
+LookAhead TblConstructorModifierLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63}};
+LookAhead TblConstructorDeclaratorLookAhead[] = {{LA_Token, 31},{LA_Identifier, NULL}};
+LookAhead TblConstructorBodyLookAhead[] = {{LA_Token, 49}};
+LookAhead TblConstructorBody_sub1LookAhead[] = {{LA_Token, 31},{LA_Token, 88},{LA_Token, 80},{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 51},{LA_Token, 97},{LA_Token, 41}};
+LookAhead TblConstructorBody_sub2LookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 59},{LA_Token, 87},{LA_Token, 94},{LA_Token, 49},{LA_Token, 45},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 22},{LA_Token, 21},{LA_Token, 74},{LA_Token, 75},{LA_Token, 103},{LA_Token, 84},{LA_Token, 62},{LA_Token, 76},{LA_Token, 53},{LA_Token, 79},{LA_Token, 98},{LA_Token, 102},{LA_Token, 82},{LA_Token, 99}};
+LookAhead TblExplicitConstructorInvocationLookAhead[] = {{LA_Token, 31},{LA_Token, 88},{LA_Token, 80},{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 51},{LA_Token, 97},{LA_Token, 41}};
+LookAhead TblExplicitConstructorInvocation_sub1LookAhead[] = {{LA_Token, 31},{LA_Token, 88}};
+LookAhead TblExplicitConstructorInvocation_sub2LookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblExplicitConstructorInvocation_sub3LookAhead[] = {{LA_Token, 31},{LA_Token, 80}};
+LookAhead TblExplicitConstructorInvocation_sub4LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblExplicitConstructorInvocation_sub5LookAhead[] = {{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41}};
+LookAhead TblEnumDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 78},{LA_Token, 59},{LA_Token, 94}};
+LookAhead TblEnumBodyLookAhead[] = {{LA_Token, 49}};
+LookAhead TblEnumBody_sub1LookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblEnumBody_sub2LookAhead[] = {{LA_Token, 44}};
+LookAhead TblEnumBody_sub3LookAhead[] = {{LA_Token, 45}};
+LookAhead TblEnumConstantListLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblEnumConstantList_sub1LookAhead[] = {{LA_Token, 44}};
+LookAhead TblEnumConstantList_sub2LookAhead[] = {{LA_Token, 44}};
+LookAhead TblEnumConstantLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblEnumConstant_sub1LookAhead[] = {{LA_Token, 51}};
+LookAhead TblEnumConstant_sub2LookAhead[] = {{LA_Token, 51}};
+LookAhead TblEnumConstant_sub3LookAhead[] = {{LA_Token, 49}};
+LookAhead TblEnumBodyDeclarationsLookAhead[] = {{LA_Token, 45}};
+LookAhead TblBlockStatementLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 59},{LA_Token, 87},{LA_Token, 94},{LA_Token, 49},{LA_Token, 45},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 22},{LA_Token, 21},{LA_Token, 74},{LA_Token, 75},{LA_Token, 103},{LA_Token, 84},{LA_Token, 62},{LA_Token, 76},{LA_Token, 53},{LA_Token, 79},{LA_Token, 98},{LA_Token, 102},{LA_Token, 82},{LA_Token, 99}};
+LookAhead TblBlockStatementsLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 59},{LA_Token, 87},{LA_Token, 94},{LA_Token, 49},{LA_Token, 45},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 22},{LA_Token, 21},{LA_Token, 74},{LA_Token, 75},{LA_Token, 103},{LA_Token, 84},{LA_Token, 62},{LA_Token, 76},{LA_Token, 53},{LA_Token, 79},{LA_Token, 98},{LA_Token, 102},{LA_Token, 82},{LA_Token, 99}};
+LookAhead TblBlockStatements_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 59},{LA_Token, 87},{LA_Token, 94},{LA_Token, 49},{LA_Token, 45},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 22},{LA_Token, 21},{LA_Token, 74},{LA_Token, 75},{LA_Token, 103},{LA_Token, 84},{LA_Token, 62},{LA_Token, 76},{LA_Token, 53},{LA_Token, 79},{LA_Token, 98},{LA_Token, 102},{LA_Token, 82},{LA_Token, 99}};
+LookAhead TblBlockLookAhead[] = {{LA_Token, 49}};
+LookAhead TblBlock_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 59},{LA_Token, 87},{LA_Token, 94},{LA_Token, 49},{LA_Token, 45},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 22},{LA_Token, 21},{LA_Token, 74},{LA_Token, 75},{LA_Token, 103},{LA_Token, 84},{LA_Token, 62},{LA_Token, 76},{LA_Token, 53},{LA_Token, 79},{LA_Token, 98},{LA_Token, 102},{LA_Token, 82},{LA_Token, 99}};
+LookAhead TblInterfaceDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 59},{LA_Token, 58}};
+LookAhead TblNormalInterfaceDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 59},{LA_Token, 58}};
+LookAhead TblNormalInterfaceDeclaration_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 59}};
+LookAhead TblNormalInterfaceDeclaration_sub2LookAhead[] = {{LA_Token, 64}};
+LookAhead TblInterfaceAttrLookAhead[] = {{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 59}};
+LookAhead TblInterfaceModifierLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 59}};
+LookAhead TblExtendsInterfacesLookAhead[] = {{LA_Token, 64}};
+LookAhead TblInterfaceBodyLookAhead[] = {{LA_Token, 49}};
+LookAhead TblInterfaceBody_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 69},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 61},{LA_Token, 66},{LA_Token, 59},{LA_Token, 92},{LA_Token, 31},{LA_Token, 56},{LA_Token, 63},{LA_Token, 87},{LA_Token, 94},{LA_Token, 58},{LA_Token, 45}};
+LookAhead TblInterfaceMemberDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 69},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 61},{LA_Token, 66},{LA_Token, 59},{LA_Token, 92},{LA_Token, 31},{LA_Token, 56},{LA_Token, 63},{LA_Token, 87},{LA_Token, 94},{LA_Token, 58},{LA_Token, 45}};
+LookAhead TblConstantDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 69},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblConstantDeclaration_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 69},{LA_Token, 78}};
+LookAhead TblConstantAttrLookAhead[] = {{LA_Token, 70},{LA_Token, 69},{LA_Token, 78}};
+LookAhead TblConstantModifierLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 69},{LA_Token, 78}};
+LookAhead TblInterfaceMethodDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 61},{LA_Token, 66},{LA_Token, 69},{LA_Token, 59},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 92},{LA_Token, 31}};
+LookAhead TblInterfaceMethodDeclaration_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 61},{LA_Token, 66},{LA_Token, 69},{LA_Token, 59}};
+LookAhead TblInterfaceMethodAttrLookAhead[] = {{LA_Token, 70},{LA_Token, 61},{LA_Token, 66},{LA_Token, 69},{LA_Token, 59}};
+LookAhead TblInterfaceMethodModifierLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 61},{LA_Token, 66},{LA_Token, 69},{LA_Token, 59}};
+LookAhead TblAnnotationTypeDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 56},{LA_Token, 63},{LA_Token, 61},{LA_Token, 69},{LA_Token, 59}};
+LookAhead TblAnnotationTypeBodyLookAhead[] = {{LA_Token, 49}};
+LookAhead TblAnnotationTypeBody_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 61},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 69},{LA_Token, 78},{LA_Token, 56},{LA_Token, 63},{LA_Token, 59},{LA_Token, 87},{LA_Token, 94},{LA_Token, 58},{LA_Token, 45}};
+LookAhead TblAnnotationTypeMemberDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 61},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 69},{LA_Token, 78},{LA_Token, 56},{LA_Token, 63},{LA_Token, 59},{LA_Token, 87},{LA_Token, 94},{LA_Token, 58},{LA_Token, 45}};
+LookAhead TblAnnotationTypeElementDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 61},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblAnnotationTypeElementDeclaration_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 61}};
+LookAhead TblAnnotationTypeElementDeclaration_sub2LookAhead[] = {{LA_Token, 66}};
+LookAhead TblAnnotationTypeElementAttrLookAhead[] = {{LA_Token, 70},{LA_Token, 61}};
+LookAhead TblAnnotationTypeElementModifierLookAhead[] = {{LA_Token, 41},{LA_Token, 70},{LA_Token, 61}};
+LookAhead TblDefaultValueLookAhead[] = {{LA_Token, 66}};
+LookAhead TblAnnotationLookAhead[] = {{LA_Token, 41}};
+LookAhead TblNormalAnnotationLookAhead[] = {{LA_Token, 41}};
+LookAhead TblNormalAnnotation_sub1LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblMarkerAnnotationLookAhead[] = {{LA_Token, 41}};
+LookAhead TblSingleElementAnnotationLookAhead[] = {{LA_Token, 41}};
+LookAhead TblElementValuePairListLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblElementValuePairList_sub1LookAhead[] = {{LA_Token, 44}};
+LookAhead TblElementValuePairList_sub2LookAhead[] = {{LA_Token, 44}};
+LookAhead TblElementValuePairLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblElementValueLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26},{LA_Token, 49}};
+LookAhead TblElementValue_sub1LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblElementValue_sub2LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblElementValueArrayInitializerLookAhead[] = {{LA_Token, 49}};
+LookAhead TblElementValueArrayInitializer_sub1LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26},{LA_Token, 49}};
+LookAhead TblElementValueListLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26},{LA_Token, 49}};
+LookAhead TblElementValueList_sub1LookAhead[] = {{LA_Token, 44}};
+LookAhead TblElementValueList_sub2LookAhead[] = {{LA_Token, 44}};
+LookAhead TblPackageDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 67}};
+LookAhead TblPackageDeclaration_sub1LookAhead[] = {{LA_Token, 43}};
+LookAhead TblPackageDeclaration_sub2LookAhead[] = {{LA_Token, 43}};
+LookAhead TblImportDeclarationLookAhead[] = {{LA_Token, 73}};
+LookAhead TblSingleTypeImportDeclarationLookAhead[] = {{LA_Token, 73}};
+LookAhead TblTypeImportOnDemandDeclarationLookAhead[] = {{LA_Token, 73}};
+LookAhead TblSingleStaticImportDeclarationLookAhead[] = {{LA_Token, 73}};
+LookAhead TblStaticImportOnDemandDeclarationLookAhead[] = {{LA_Token, 73}};
+LookAhead TblTypeNameLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblTypeName_sub1LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblPackageOrTypeNameLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblPackageOrTypeName_sub1LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblExpressionNameLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblExpressionName_sub1LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblAmbiguousNameLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblAmbiguousName_sub1LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblClassLiteralLookAhead[] = {{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92}};
+LookAhead TblClassLiteral_sub1LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblClassLiteral_sub2LookAhead[] = {{LA_Token, 47}};
+LookAhead TblClassLiteral_sub3LookAhead[] = {{LA_Token, 47}};
+LookAhead TblClassLiteral_sub4LookAhead[] = {{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77}};
+LookAhead TblClassLiteral_sub5LookAhead[] = {{LA_Token, 68}};
+LookAhead TblClassLiteral_sub6LookAhead[] = {{LA_Token, 92}};
+LookAhead TblPrimaryNoNewArray_singleLookAhead[] = {{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41}};
+LookAhead TblPrimaryNoNewArray_single_sub1LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblPrimaryNoNewArray_single_sub2LookAhead[] = {{LA_Token, 51}};
+LookAhead TblPrimaryNoNewArrayLookAhead[] = {{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41}};
+LookAhead TblClassInstanceCreationExpressionLookAhead[] = {{LA_Token, 97},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 80},{LA_Token, 41}};
+LookAhead TblClassInstanceCreationExpression_sub1LookAhead[] = {{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41}};
+LookAhead TblUnqualifiedClassInstanceCreationExpressionLookAhead[] = {{LA_Token, 97}};
+LookAhead TblUnqualifiedClassInstanceCreationExpression_sub1LookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblClassOrInterfaceTypeToInstantiateLookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblClassOrInterfaceTypeToInstantiate_sub1LookAhead[] = {{LA_Token, 43}};
+LookAhead TblClassOrInterfaceTypeToInstantiate_sub2LookAhead[] = {{LA_Token, 43}};
+LookAhead TblClassOrInterfaceTypeToInstantiate_sub3LookAhead[] = {{LA_Token, 31},{LA_String, "<>"}};
+LookAhead TblTypeArgumentsOrDiamondLookAhead[] = {{LA_Token, 31},{LA_String, "<>"}};
+LookAhead TblArgumentListLookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblArgumentList_sub1LookAhead[] = {{LA_Token, 44}};
+LookAhead TblArgumentList_sub2LookAhead[] = {{LA_Token, 44}};
+LookAhead TblArrayInitializerLookAhead[] = {{LA_Token, 49}};
+LookAhead TblArrayInitializer_sub1LookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26},{LA_Token, 49}};
+LookAhead TblArrayCreationExpressionLookAhead[] = {{LA_Token, 97}};
+LookAhead TblArrayCreationExpression_sub1LookAhead[] = {{LA_Token, 97}};
+LookAhead TblArrayCreationExpression_sub2LookAhead[] = {{LA_Token, 97}};
+LookAhead TblArrayCreationExpression_sub3LookAhead[] = {{LA_Token, 97}};
+LookAhead TblArrayCreationExpression_sub4LookAhead[] = {{LA_Token, 97}};
+LookAhead TblDimExprsLookAhead[] = {{LA_Token, 41},{LA_Token, 47}};
+LookAhead TblDimExprs_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 47}};
+LookAhead TblDimExprLookAhead[] = {{LA_Token, 41},{LA_Token, 47}};
+LookAhead TblArrayAccessLookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41}};
+LookAhead TblArrayAccess_sub1LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblArrayAccess_sub2LookAhead[] = {{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41}};
+LookAhead TblFieldAccessLookAhead[] = {{LA_Token, 80},{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 41}};
+LookAhead TblFieldAccess_sub1LookAhead[] = {{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41}};
+LookAhead TblFieldAccess_sub2LookAhead[] = {{LA_Token, 80}};
+LookAhead TblFieldAccess_sub3LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblMethodInvocationLookAhead[] = {{LA_Identifier, NULL},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 41}};
+LookAhead TblMethodInvocation_sub1LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblMethodInvocation_sub2LookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblMethodInvocation_sub3LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblMethodInvocation_sub4LookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblMethodInvocation_sub5LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblMethodInvocation_sub6LookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblMethodInvocation_sub7LookAhead[] = {{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41}};
+LookAhead TblMethodInvocation_sub8LookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblMethodInvocation_sub9LookAhead[] = {{LA_Token, 80}};
+LookAhead TblMethodInvocation_sub10LookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblMethodInvocation_sub11LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblMethodInvocation_sub12LookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblMethodReferenceLookAhead[] = {{LA_Identifier, NULL},{LA_Token, 41},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 80},{LA_Token, 97},{LA_Literal, NULL},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51}};
+LookAhead TblMethodReference_sub1LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblMethodReference_sub2LookAhead[] = {{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41}};
+LookAhead TblMethodReference_sub3LookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68}};
+LookAhead TblMethodReference_sub4LookAhead[] = {{LA_Token, 80}};
+LookAhead TblMethodReference_sub5LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblMethodReference_sub6LookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL}};
+LookAhead TblMethodReference_sub7LookAhead[] = {{LA_Token, 41},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblPostfixExpressionLookAhead[] = {{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41}};
+LookAhead TblPostIncrementExpressionLookAhead[] = {{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41}};
+LookAhead TblPostDecrementExpressionLookAhead[] = {{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41}};
+LookAhead TblUnaryExpressionLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblUnaryExpression_sub1LookAhead[] = {{LA_Token, 37}};
+LookAhead TblUnaryExpression_sub2LookAhead[] = {{LA_Token, 36}};
+LookAhead TblUnaryExpression_sub3LookAhead[] = {{LA_Token, 27}};
+LookAhead TblUnaryExpression_sub4LookAhead[] = {{LA_Token, 26}};
+LookAhead TblUnaryExpression_sub5LookAhead[] = {{LA_Token, 51}};
+LookAhead TblUnaryExpression_sub6LookAhead[] = {{LA_Token, 41},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblUnaryExpression_sub7LookAhead[] = {{LA_Token, 41},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68}};
+LookAhead TblUnaryExpression_sub8LookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68}};
+LookAhead TblUnaryExpression_sub9LookAhead[] = {{LA_Token, 41},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68}};
+LookAhead TblPreIncrementExpressionLookAhead[] = {{LA_Token, 22}};
+LookAhead TblPreDecrementExpressionLookAhead[] = {{LA_Token, 21}};
+LookAhead TblUnaryExpressionNotPlusMinusLookAhead[] = {{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblMultiplicativeExpressionLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblMultiplicativeExpression_sub1LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblMultiplicativeExpression_sub2LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblMultiplicativeExpression_sub3LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblAdditiveExpressionLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblAdditiveExpression_sub1LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblAdditiveExpression_sub2LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblShiftExpressionLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblShiftExpression_sub1LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblShiftExpression_sub2LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblShiftExpression_sub3LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblRelationalExpressionLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblRelationalExpression_sub1LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblRelationalExpression_sub2LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblRelationalExpression_sub3LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblRelationalExpression_sub4LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblRelationalExpression_sub5LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblEqualityExpressionLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblEqualityExpression_sub1LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblEqualityExpression_sub2LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblAndExpressionLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblAndExpression_sub1LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblExclusiveOrExpressionLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblExclusiveOrExpression_sub1LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblInclusiveOrExpressionLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblInclusiveOrExpression_sub1LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblConditionalAndExpressionLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblConditionalAndExpression_sub1LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblConditionalOrExpressionLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblConditionalOrExpression_sub1LookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblConditionalExpressionLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblAssignmentExpressionLookAhead[] = {{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblAssignmentLookAhead[] = {{LA_Identifier, NULL},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 41}};
+LookAhead TblLeftHandSideLookAhead[] = {{LA_Identifier, NULL},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 41}};
+LookAhead TblAssignmentOperatorLookAhead[] = {{LA_Token, 25},{LA_Token, 10},{LA_Token, 9},{LA_Token, 8},{LA_Token, 12},{LA_Token, 11},{LA_Token, 2},{LA_Token, 1},{LA_Token, 0},{LA_Token, 7},{LA_Token, 5},{LA_Token, 6}};
+LookAhead TblLambdaExpressionLookAhead[] = {{LA_Token, 51},{LA_Identifier, NULL}};
+LookAhead TblLambdaParametersLookAhead[] = {{LA_Token, 51},{LA_Identifier, NULL}};
+LookAhead TblLambdaParameters_sub1LookAhead[] = {{LA_Token, 51}};
+LookAhead TblLambdaParameters_sub2LookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 100}};
+LookAhead TblLambdaParameterListLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 100}};
+LookAhead TblLambdaParameterList_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 100}};
+LookAhead TblLambdaParameterList_sub2LookAhead[] = {{LA_Token, 44}};
+LookAhead TblLambdaParameterList_sub3LookAhead[] = {{LA_Token, 44}};
+LookAhead TblLambdaParameterList_sub4LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblLambdaParameterList_sub5LookAhead[] = {{LA_Token, 44}};
+LookAhead TblLambdaParameterList_sub6LookAhead[] = {{LA_Token, 44}};
+LookAhead TblLambdaParameterLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 100}};
+LookAhead TblLambdaParameter_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 100}};
+LookAhead TblLambdaParameterTypeLookAhead[] = {{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 100}};
+LookAhead TblVariableArityParameterLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblLambdaBodyLookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26},{LA_Token, 49}};
+LookAhead TblPrimaryLookAhead[] = {{LA_Literal, NULL},{LA_Identifier, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41}};
+LookAhead TblExpressionLookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblLocalVariableDeclarationStatementLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblLocalVariableDeclarationLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAhead TblVariableModifierLookAhead[] = {{LA_Token, 41},{LA_Token, 78}};
+LookAhead TblVariableDeclaratorListLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblVariableDeclaratorList_sub1LookAhead[] = {{LA_Token, 44}};
+LookAhead TblVariableDeclaratorList_sub2LookAhead[] = {{LA_Token, 44}};
+LookAhead TblVariableDeclaratorLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblVariableDeclarator_sub1LookAhead[] = {{LA_Token, 25}};
+LookAhead TblVariableDeclarator_sub2LookAhead[] = {{LA_Token, 25}};
+LookAhead TblVariableDeclaratorIdLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblDimsLookAhead[] = {{LA_Token, 41},{LA_Token, 47}};
+LookAhead TblDims_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 47}};
+LookAhead TblDimLookAhead[] = {{LA_Token, 41},{LA_Token, 47}};
+LookAhead TblVariableInitializerLookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26},{LA_Token, 49}};
+LookAhead TblVariableInitializerListLookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26},{LA_Token, 49}};
+LookAhead TblVariableInitializerList_sub1LookAhead[] = {{LA_Token, 44}};
+LookAhead TblVariableInitializerList_sub2LookAhead[] = {{LA_Token, 44}};
+LookAhead TblStatementLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 49},{LA_Token, 45},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 22},{LA_Token, 21},{LA_Token, 74},{LA_Token, 75},{LA_Token, 103},{LA_Token, 84},{LA_Token, 62},{LA_Token, 76},{LA_Token, 53},{LA_Token, 79},{LA_Token, 98},{LA_Token, 102},{LA_Token, 82},{LA_Token, 99}};
+LookAhead TblStatementNoShortIfLookAhead[] = {{LA_Token, 49},{LA_Token, 45},{LA_Identifier, NULL},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 74},{LA_Token, 75},{LA_Token, 103},{LA_Token, 84},{LA_Token, 62},{LA_Token, 76},{LA_Token, 53},{LA_Token, 79},{LA_Token, 98},{LA_Token, 102},{LA_Token, 82},{LA_Token, 99}};
+LookAhead TblStatementWithoutTrailingSubstatementLookAhead[] = {{LA_Token, 49},{LA_Token, 45},{LA_Identifier, NULL},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 74},{LA_Token, 75},{LA_Token, 103},{LA_Token, 84},{LA_Token, 62},{LA_Token, 76},{LA_Token, 53},{LA_Token, 79},{LA_Token, 98}};
+LookAhead TblIfThenStatementLookAhead[] = {{LA_Token, 102}};
+LookAhead TblIfThenElseStatementLookAhead[] = {{LA_Token, 102}};
+LookAhead TblIfThenElseStatementNoShortIfLookAhead[] = {{LA_Token, 102}};
+LookAhead TblLabeledStatementLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblLabeledStatementNoShortIfLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblExpressionStatementLookAhead[] = {{LA_Identifier, NULL},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21}};
+LookAhead TblStatementExpressionLookAhead[] = {{LA_Identifier, NULL},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21}};
+LookAhead TblAssertStatementLookAhead[] = {{LA_Token, 74}};
+LookAhead TblAssertStatement_sub1LookAhead[] = {{LA_Token, 74}};
+LookAhead TblAssertStatement_sub2LookAhead[] = {{LA_Token, 74}};
+LookAhead TblSwitchStatementLookAhead[] = {{LA_Token, 75}};
+LookAhead TblSwitchBlockLookAhead[] = {{LA_Token, 49}};
+LookAhead TblSwitchBlock_sub1LookAhead[] = {{LA_Token, 91},{LA_Token, 66}};
+LookAhead TblSwitchBlock_sub2LookAhead[] = {{LA_Token, 91},{LA_Token, 66}};
+LookAhead TblSwitchBlock_sub3LookAhead[] = {{LA_Token, 91},{LA_Token, 66}};
+LookAhead TblSwitchBlock_sub4LookAhead[] = {{LA_Token, 91},{LA_Token, 66}};
+LookAhead TblSwitchBlockStatementGroupLookAhead[] = {{LA_Token, 91},{LA_Token, 66}};
+LookAhead TblSwitchLabelsLookAhead[] = {{LA_Token, 91},{LA_Token, 66}};
+LookAhead TblSwitchLabelLookAhead[] = {{LA_Token, 91},{LA_Token, 66}};
+LookAhead TblSwitchLabel_sub1LookAhead[] = {{LA_Token, 91}};
+LookAhead TblSwitchLabel_sub2LookAhead[] = {{LA_Token, 91}};
+LookAhead TblSwitchLabel_sub3LookAhead[] = {{LA_Token, 66}};
+LookAhead TblWhileStatementLookAhead[] = {{LA_Token, 82}};
+LookAhead TblWhileStatementNoShortIfLookAhead[] = {{LA_Token, 82}};
+LookAhead TblDoStatementLookAhead[] = {{LA_Token, 103}};
+LookAhead TblForStatementLookAhead[] = {{LA_Token, 99}};
+LookAhead TblForStatementNoShortIfLookAhead[] = {{LA_Token, 99}};
+LookAhead TblBasicForStatementLookAhead[] = {{LA_Token, 99}};
+LookAhead TblBasicForStatement_sub1LookAhead[] = {{LA_Identifier, NULL},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 78}};
+LookAhead TblBasicForStatement_sub2LookAhead[] = {{LA_Identifier, NULL},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 80},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 37},{LA_Token, 36},{LA_Token, 27},{LA_Token, 26}};
+LookAhead TblBasicForStatement_sub3LookAhead[] = {{LA_Identifier, NULL},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21}};
+LookAhead TblBasicForStatementNoShortIfLookAhead[] = {{LA_Token, 99}};
+LookAhead TblForInitLookAhead[] = {{LA_Identifier, NULL},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21},{LA_Token, 78}};
+LookAhead TblStatementExpressionListLookAhead[] = {{LA_Identifier, NULL},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97},{LA_Token, 41},{LA_Token, 22},{LA_Token, 21}};
+LookAhead TblStatementExpressionList_sub1LookAhead[] = {{LA_Token, 44}};
+LookAhead TblStatementExpressionList_sub2LookAhead[] = {{LA_Token, 44}};
+LookAhead TblEnhancedForStatementLookAhead[] = {{LA_Token, 99}};
+LookAhead TblEnhancedForStatementNoShortIfLookAhead[] = {{LA_Token, 99}};
+LookAhead TblBreakStatementLookAhead[] = {{LA_Token, 84}};
+LookAhead TblBreakStatement_sub1LookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblContinueStatementLookAhead[] = {{LA_Token, 62}};
+LookAhead TblReturnStatementLookAhead[] = {{LA_Token, 76}};
+LookAhead TblThrowStatementLookAhead[] = {{LA_Token, 79}};
+LookAhead TblSynchronizedStatementLookAhead[] = {{LA_Token, 53}};
+LookAhead TblTryStatementLookAhead[] = {{LA_Token, 98}};
+LookAhead TblTryStatement_sub1LookAhead[] = {{LA_Token, 98}};
+LookAhead TblTryStatement_sub2LookAhead[] = {{LA_Token, 98}};
+LookAhead TblTryStatement_sub3LookAhead[] = {{LA_Token, 83}};
+LookAhead TblCatchesLookAhead[] = {{LA_Token, 83}};
+LookAhead TblCatches_sub1LookAhead[] = {{LA_Token, 83}};
+LookAhead TblCatchClauseLookAhead[] = {{LA_Token, 83}};
+LookAhead TblCatchFormalParameterLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Identifier, NULL}};
+LookAhead TblCatchTypeLookAhead[] = {{LA_Identifier, NULL}};
+LookAhead TblCatchType_sub1LookAhead[] = {{LA_Token, 29}};
+LookAhead TblCatchType_sub2LookAhead[] = {{LA_Token, 29}};
+LookAhead TblFinallyLookAhead[] = {{LA_Token, 65}};
+LookAhead TblTryWithResourcesStatementLookAhead[] = {{LA_Token, 98}};
+LookAhead TblTryWithResourcesStatement_sub1LookAhead[] = {{LA_Token, 65}};
+LookAhead TblResourceSpecificationLookAhead[] = {{LA_Token, 51}};
+LookAhead TblResourceSpecification_sub1LookAhead[] = {{LA_Token, 45}};
+LookAhead TblResourceListLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97}};
+LookAhead TblResourceList_sub1LookAhead[] = {{LA_Token, 45}};
+LookAhead TblResourceList_sub2LookAhead[] = {{LA_Token, 45}};
+LookAhead TblResourceLookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL},{LA_Token, 80},{LA_Literal, NULL},{LA_Token, 92},{LA_Token, 88},{LA_Token, 51},{LA_Token, 97}};
+LookAhead TblResource_sub1LookAhead[] = {{LA_Token, 41},{LA_Token, 78},{LA_Token, 96},{LA_Token, 85},{LA_Token, 101},{LA_Token, 93},{LA_Token, 95},{LA_Token, 86},{LA_Token, 77},{LA_Token, 68},{LA_Identifier, NULL}};
+LookAheadTable localLookAheadTable[] = {
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {1, TblIdentifierLookAhead},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {1, TblLiteralLookAhead},
+  {0, NULL},
+  {0, NULL},
+  {0, NULL},
+  {7, TblNumericTypeLookAhead},
+  {9, TblPrimitiveTypeLookAhead},
+  {8, TblPrimitiveType_sub1LookAhead},
+  {1, TblPrimitiveType_sub2LookAhead},
+  {2, TblPrimitiveType_sub3LookAhead},
+  {0, NULL},
+  {2, TblWildcardBoundsLookAhead},
+  {1, TblWildcardBounds_sub1LookAhead},
+  {1, TblWildcardBounds_sub2LookAhead},
+  {2, TblWildcardLookAhead},
+  {2, TblWildcard_sub1LookAhead},
+  {11, TblTypeArgumentLookAhead},
+  {9, TblTypeArgument_sub1LookAhead},
+  {2, TblTypeArgument_sub2LookAhead},
+  {2, TblTypeArgument_sub3LookAhead},
+  {11, TblTypeArgumentListLookAhead},
+  {1, TblTypeArgumentList_sub1LookAhead},
+  {1, TblTypeArgumentList_sub2LookAhead},
+  {1, TblTypeArgumentsLookAhead},
+  {2, TblClassTypeLookAhead},
+  {2, TblClassType_sub1LookAhead},
+  {1, TblClassType_sub2LookAhead},
+  {2, TblClassType_sub3LookAhead},
+  {2, TblInterfaceTypeLookAhead},
+  {2, TblTypeVariableLookAhead},
+  {10, TblArrayTypeLookAhead},
+  {2, TblClassOrInterfaceTypeLookAhead},
+  {10, TblReferenceTypeLookAhead},
+  {0, NULL},
+  {1, TblUnannClassTypeLookAhead},
+  {1, TblUnannClassType_sub1LookAhead},
+  {1, TblUnannClassType_sub2LookAhead},
+  {1, TblUnannClassOrInterfaceTypeLookAhead},
+  {1, TblUnannInterfaceTypeLookAhead},
+  {0, NULL},
+  {0, NULL},
+  {8, TblUnannArrayType_sub1LookAhead},
+  {1, TblUnannArrayType_sub2LookAhead},
+  {1, TblUnannArrayType_sub3LookAhead},
+  {0, NULL},
+  {8, TblUnannPrimitiveTypeLookAhead},
+  {9, TblUnannTypeLookAhead},
+  {10, TblClassDeclarationLookAhead},
+  {9, TblNormalClassDeclarationLookAhead},
+  {8, TblNormalClassDeclaration_sub1LookAhead},
+  {1, TblNormalClassDeclaration_sub2LookAhead},
+  {1, TblNormalClassDeclaration_sub3LookAhead},
+  {1, TblNormalClassDeclaration_sub4LookAhead},
+  {7, TblClassAttrLookAhead},
+  {8, TblClassModifierLookAhead},
+  {1, TblTypeParametersLookAhead},
+  {2, TblTypeParameterListLookAhead},
+  {1, TblTypeParameterList_sub1LookAhead},
+  {1, TblTypeParameterList_sub2LookAhead},
+  {2, TblTypeParameterLookAhead},
+  {1, TblTypeParameter_sub1LookAhead},
+  {0, NULL},
+  {1, TblTypeBoundLookAhead},
+  {1, TblTypeBound_sub1LookAhead},
+  {1, TblTypeBound_sub2LookAhead},
+  {1, TblTypeBound_sub3LookAhead},
+  {1, TblAdditionalBoundLookAhead},
+  {1, TblSuperclassLookAhead},
+  {1, TblSuperinterfacesLookAhead},
+  {2, TblInterfaceTypeListLookAhead},
+  {1, TblInterfaceTypeList_sub1LookAhead},
+  {1, TblInterfaceTypeList_sub2LookAhead},
+  {1, TblClassBodyLookAhead},
+  {28, TblClassBody_sub1LookAhead},
+  {28, TblClassBodyDeclarationLookAhead},
+  {1, TblInstanceInitializerLookAhead},
+  {1, TblStaticInitializerLookAhead},
+  {27, TblClassMemberDeclarationLookAhead},
+  {17, TblFieldDeclarationLookAhead},
+  {8, TblFieldDeclaration_sub1LookAhead},
+  {21, TblMethodDeclarationLookAhead},
+  {10, TblMethodDeclaration_sub1LookAhead},
+  {2, TblMethodBodyLookAhead},
+  {11, TblMethodHeaderLookAhead},
+  {10, TblMethodHeader_sub1LookAhead},
+  {1, TblMethodHeader_sub2LookAhead},
+  {1, TblMethodHeader_sub3LookAhead},
+  {10, TblResultLookAhead},
+  {1, TblMethodDeclaratorLookAhead},
+  {11, TblMethodDeclarator_sub1LookAhead},
+  {2, TblMethodDeclarator_sub2LookAhead},
+  {1, TblThrowsLookAhead},
+  {2, TblExceptionTypeListLookAhead},
+  {1, TblExceptionTypeList_sub1LookAhead},
+  {1, TblExceptionTypeList_sub2LookAhead},
+  {2, TblExceptionTypeLookAhead},
+  {9, TblMethodAttrLookAhead},
+  {10, TblMethodModifierLookAhead},
+  {11, TblFormalParameterListNoReceiverLookAhead},
+  {11, TblFormalParameterListNoReceiver_sub1LookAhead},
+  {11, TblFormalParameterListLookAhead},
+  {11, TblFormalParametersLookAhead},
+  {11, TblFormalParameters_sub1LookAhead},
+  {1, TblFormalParameters_sub2LookAhead},
+  {1, TblFormalParameters_sub3LookAhead},
+  {10, TblFormalParameters_sub4LookAhead},
+  {11, TblFormalParameterLookAhead},
+  {2, TblFormalParameter_sub1LookAhead},
+  {10, TblReceiverParameterLookAhead},
+  {1, TblReceiverParameter_sub1LookAhead},
+  {1, TblReceiverParameter_sub2LookAhead},
+  {11, TblLastFormalParameterLookAhead},
+  {11, TblLastFormalParameter_sub1LookAhead},
+  {7, TblFieldAttrLookAhead},
+  {8, TblFieldModifierLookAhead},
+  {6, TblConstructorDeclarationLookAhead},
+  {4, TblConstructorDeclaration_sub1LookAhead},
+  {3, TblConstructorAttrLookAhead},
+  {4, TblConstructorModifierLookAhead},
+  {2, TblConstructorDeclaratorLookAhead},
+  {0, NULL},
+  {1, TblConstructorBodyLookAhead},
+  {17, TblConstructorBody_sub1LookAhead},
+  {41, TblConstructorBody_sub2LookAhead},
+  {17, TblExplicitConstructorInvocationLookAhead},
+  {2, TblExplicitConstructorInvocation_sub1LookAhead},
+  {22, TblExplicitConstructorInvocation_sub2LookAhead},
+  {2, TblExplicitConstructorInvocation_sub3LookAhead},
+  {1, TblExplicitConstructorInvocation_sub4LookAhead},
+  {16, TblExplicitConstructorInvocation_sub5LookAhead},
+  {9, TblEnumDeclarationLookAhead},
+  {1, TblEnumBodyLookAhead},
+  {2, TblEnumBody_sub1LookAhead},
+  {1, TblEnumBody_sub2LookAhead},
+  {1, TblEnumBody_sub3LookAhead},
+  {2, TblEnumConstantListLookAhead},
+  {1, TblEnumConstantList_sub1LookAhead},
+  {1, TblEnumConstantList_sub2LookAhead},
+  {2, TblEnumConstantLookAhead},
+  {1, TblEnumConstant_sub1LookAhead},
+  {1, TblEnumConstant_sub2LookAhead},
+  {1, TblEnumConstant_sub3LookAhead},
+  {0, NULL},
+  {1, TblEnumBodyDeclarationsLookAhead},
+  {41, TblBlockStatementLookAhead},
+  {41, TblBlockStatementsLookAhead},
+  {41, TblBlockStatements_sub1LookAhead},
+  {1, TblBlockLookAhead},
+  {41, TblBlock_sub1LookAhead},
+  {8, TblInterfaceDeclarationLookAhead},
+  {8, TblNormalInterfaceDeclarationLookAhead},
+  {7, TblNormalInterfaceDeclaration_sub1LookAhead},
+  {1, TblNormalInterfaceDeclaration_sub2LookAhead},
+  {6, TblInterfaceAttrLookAhead},
+  {7, TblInterfaceModifierLookAhead},
+  {1, TblExtendsInterfacesLookAhead},
+  {1, TblInterfaceBodyLookAhead},
+  {24, TblInterfaceBody_sub1LookAhead},
+  {24, TblInterfaceMemberDeclarationLookAhead},
+  {13, TblConstantDeclarationLookAhead},
+  {4, TblConstantDeclaration_sub1LookAhead},
+  {3, TblConstantAttrLookAhead},
+  {4, TblConstantModifierLookAhead},
+  {17, TblInterfaceMethodDeclarationLookAhead},
+  {6, TblInterfaceMethodDeclaration_sub1LookAhead},
+  {5, TblInterfaceMethodAttrLookAhead},
+  {6, TblInterfaceMethodModifierLookAhead},
+  {7, TblAnnotationTypeDeclarationLookAhead},
+  {1, TblAnnotationTypeBodyLookAhead},
+  {21, TblAnnotationTypeBody_sub1LookAhead},
+  {21, TblAnnotationTypeMemberDeclarationLookAhead},
+  {12, TblAnnotationTypeElementDeclarationLookAhead},
+  {3, TblAnnotationTypeElementDeclaration_sub1LookAhead},
+  {1, TblAnnotationTypeElementDeclaration_sub2LookAhead},
+  {2, TblAnnotationTypeElementAttrLookAhead},
+  {3, TblAnnotationTypeElementModifierLookAhead},
+  {1, TblDefaultValueLookAhead},
+  {1, TblAnnotationLookAhead},
+  {1, TblNormalAnnotationLookAhead},
+  {1, TblNormalAnnotation_sub1LookAhead},
+  {1, TblMarkerAnnotationLookAhead},
+  {1, TblSingleElementAnnotationLookAhead},
+  {1, TblElementValuePairListLookAhead},
+  {1, TblElementValuePairList_sub1LookAhead},
+  {1, TblElementValuePairList_sub2LookAhead},
+  {1, TblElementValuePairLookAhead},
+  {23, TblElementValueLookAhead},
+  {22, TblElementValue_sub1LookAhead},
+  {22, TblElementValue_sub2LookAhead},
+  {1, TblElementValueArrayInitializerLookAhead},
+  {23, TblElementValueArrayInitializer_sub1LookAhead},
+  {23, TblElementValueListLookAhead},
+  {1, TblElementValueList_sub1LookAhead},
+  {1, TblElementValueList_sub2LookAhead},
+  {0, NULL},
+  {2, TblPackageDeclarationLookAhead},
+  {1, TblPackageDeclaration_sub1LookAhead},
+  {1, TblPackageDeclaration_sub2LookAhead},
+  {1, TblImportDeclarationLookAhead},
+  {1, TblSingleTypeImportDeclarationLookAhead},
+  {1, TblTypeImportOnDemandDeclarationLookAhead},
+  {1, TblSingleStaticImportDeclarationLookAhead},
+  {1, TblStaticImportOnDemandDeclarationLookAhead},
+  {0, NULL},
+  {0, NULL},
+  {1, TblTypeNameLookAhead},
+  {1, TblTypeName_sub1LookAhead},
+  {1, TblPackageOrTypeNameLookAhead},
+  {1, TblPackageOrTypeName_sub1LookAhead},
+  {1, TblExpressionNameLookAhead},
+  {1, TblExpressionName_sub1LookAhead},
+  {0, NULL},
+  {1, TblAmbiguousNameLookAhead},
+  {1, TblAmbiguousName_sub1LookAhead},
+  {0, NULL},
+  {10, TblClassLiteralLookAhead},
+  {1, TblClassLiteral_sub1LookAhead},
+  {1, TblClassLiteral_sub2LookAhead},
+  {1, TblClassLiteral_sub3LookAhead},
+  {7, TblClassLiteral_sub4LookAhead},
+  {1, TblClassLiteral_sub5LookAhead},
+  {1, TblClassLiteral_sub6LookAhead},
+  {16, TblPrimaryNoNewArray_singleLookAhead},
+  {1, TblPrimaryNoNewArray_single_sub1LookAhead},
+  {1, TblPrimaryNoNewArray_single_sub2LookAhead},
+  {16, TblPrimaryNoNewArrayLookAhead},
+  {16, TblClassInstanceCreationExpressionLookAhead},
+  {16, TblClassInstanceCreationExpression_sub1LookAhead},
+  {1, TblUnqualifiedClassInstanceCreationExpressionLookAhead},
+  {22, TblUnqualifiedClassInstanceCreationExpression_sub1LookAhead},
+  {2, TblClassOrInterfaceTypeToInstantiateLookAhead},
+  {1, TblClassOrInterfaceTypeToInstantiate_sub1LookAhead},
+  {1, TblClassOrInterfaceTypeToInstantiate_sub2LookAhead},
+  {2, TblClassOrInterfaceTypeToInstantiate_sub3LookAhead},
+  {2, TblTypeArgumentsOrDiamondLookAhead},
+  {22, TblArgumentListLookAhead},
+  {1, TblArgumentList_sub1LookAhead},
+  {1, TblArgumentList_sub2LookAhead},
+  {1, TblArrayInitializerLookAhead},
+  {23, TblArrayInitializer_sub1LookAhead},
+  {1, TblArrayCreationExpressionLookAhead},
+  {1, TblArrayCreationExpression_sub1LookAhead},
+  {1, TblArrayCreationExpression_sub2LookAhead},
+  {1, TblArrayCreationExpression_sub3LookAhead},
+  {1, TblArrayCreationExpression_sub4LookAhead},
+  {2, TblDimExprsLookAhead},
+  {2, TblDimExprs_sub1LookAhead},
+  {2, TblDimExprLookAhead},
+  {16, TblArrayAccessLookAhead},
+  {1, TblArrayAccess_sub1LookAhead},
+  {16, TblArrayAccess_sub2LookAhead},
+  {16, TblFieldAccessLookAhead},
+  {16, TblFieldAccess_sub1LookAhead},
+  {1, TblFieldAccess_sub2LookAhead},
+  {1, TblFieldAccess_sub3LookAhead},
+  {16, TblMethodInvocationLookAhead},
+  {1, TblMethodInvocation_sub1LookAhead},
+  {22, TblMethodInvocation_sub2LookAhead},
+  {1, TblMethodInvocation_sub3LookAhead},
+  {22, TblMethodInvocation_sub4LookAhead},
+  {1, TblMethodInvocation_sub5LookAhead},
+  {22, TblMethodInvocation_sub6LookAhead},
+  {16, TblMethodInvocation_sub7LookAhead},
+  {22, TblMethodInvocation_sub8LookAhead},
+  {1, TblMethodInvocation_sub9LookAhead},
+  {22, TblMethodInvocation_sub10LookAhead},
+  {1, TblMethodInvocation_sub11LookAhead},
+  {22, TblMethodInvocation_sub12LookAhead},
+  {16, TblMethodReferenceLookAhead},
+  {1, TblMethodReference_sub1LookAhead},
+  {16, TblMethodReference_sub2LookAhead},
+  {10, TblMethodReference_sub3LookAhead},
+  {1, TblMethodReference_sub4LookAhead},
+  {1, TblMethodReference_sub5LookAhead},
+  {2, TblMethodReference_sub6LookAhead},
+  {10, TblMethodReference_sub7LookAhead},
+  {16, TblPostfixExpressionLookAhead},
+  {16, TblPostIncrementExpressionLookAhead},
+  {16, TblPostDecrementExpressionLookAhead},
+  {22, TblUnaryExpressionLookAhead},
+  {1, TblUnaryExpression_sub1LookAhead},
+  {1, TblUnaryExpression_sub2LookAhead},
+  {1, TblUnaryExpression_sub3LookAhead},
+  {1, TblUnaryExpression_sub4LookAhead},
+  {1, TblUnaryExpression_sub5LookAhead},
+  {10, TblUnaryExpression_sub6LookAhead},
+  {9, TblUnaryExpression_sub7LookAhead},
+  {10, TblUnaryExpression_sub8LookAhead},
+  {10, TblUnaryExpression_sub9LookAhead},
+  {1, TblPreIncrementExpressionLookAhead},
+  {1, TblPreDecrementExpressionLookAhead},
+  {18, TblUnaryExpressionNotPlusMinusLookAhead},
+  {0, NULL},
+  {22, TblMultiplicativeExpressionLookAhead},
+  {22, TblMultiplicativeExpression_sub1LookAhead},
+  {22, TblMultiplicativeExpression_sub2LookAhead},
+  {22, TblMultiplicativeExpression_sub3LookAhead},
+  {22, TblAdditiveExpressionLookAhead},
+  {22, TblAdditiveExpression_sub1LookAhead},
+  {22, TblAdditiveExpression_sub2LookAhead},
+  {22, TblShiftExpressionLookAhead},
+  {22, TblShiftExpression_sub1LookAhead},
+  {22, TblShiftExpression_sub2LookAhead},
+  {22, TblShiftExpression_sub3LookAhead},
+  {22, TblRelationalExpressionLookAhead},
+  {22, TblRelationalExpression_sub1LookAhead},
+  {22, TblRelationalExpression_sub2LookAhead},
+  {22, TblRelationalExpression_sub3LookAhead},
+  {22, TblRelationalExpression_sub4LookAhead},
+  {22, TblRelationalExpression_sub5LookAhead},
+  {22, TblEqualityExpressionLookAhead},
+  {22, TblEqualityExpression_sub1LookAhead},
+  {22, TblEqualityExpression_sub2LookAhead},
+  {22, TblAndExpressionLookAhead},
+  {22, TblAndExpression_sub1LookAhead},
+  {22, TblExclusiveOrExpressionLookAhead},
+  {22, TblExclusiveOrExpression_sub1LookAhead},
+  {22, TblInclusiveOrExpressionLookAhead},
+  {22, TblInclusiveOrExpression_sub1LookAhead},
+  {22, TblConditionalAndExpressionLookAhead},
+  {22, TblConditionalAndExpression_sub1LookAhead},
+  {22, TblConditionalOrExpressionLookAhead},
+  {22, TblConditionalOrExpression_sub1LookAhead},
+  {22, TblConditionalExpressionLookAhead},
+  {22, TblAssignmentExpressionLookAhead},
+  {16, TblAssignmentLookAhead},
+  {16, TblLeftHandSideLookAhead},
+  {12, TblAssignmentOperatorLookAhead},
+  {2, TblLambdaExpressionLookAhead},
+  {2, TblLambdaParametersLookAhead},
+  {1, TblLambdaParameters_sub1LookAhead},
+  {12, TblLambdaParameters_sub2LookAhead},
+  {12, TblLambdaParameterListLookAhead},
+  {12, TblLambdaParameterList_sub1LookAhead},
+  {1, TblLambdaParameterList_sub2LookAhead},
+  {1, TblLambdaParameterList_sub3LookAhead},
+  {1, TblLambdaParameterList_sub4LookAhead},
+  {1, TblLambdaParameterList_sub5LookAhead},
+  {1, TblLambdaParameterList_sub6LookAhead},
+  {12, TblLambdaParameterLookAhead},
+  {12, TblLambdaParameter_sub1LookAhead},
+  {10, TblLambdaParameterTypeLookAhead},
+  {11, TblVariableArityParameterLookAhead},
+  {23, TblLambdaBodyLookAhead},
+  {0, NULL},
+  {16, TblPrimaryLookAhead},
+  {22, TblExpressionLookAhead},
+  {0, NULL},
+  {11, TblLocalVariableDeclarationStatementLookAhead},
+  {11, TblLocalVariableDeclarationLookAhead},
+  {2, TblVariableModifierLookAhead},
+  {1, TblVariableDeclaratorListLookAhead},
+  {1, TblVariableDeclaratorList_sub1LookAhead},
+  {1, TblVariableDeclaratorList_sub2LookAhead},
+  {1, TblVariableDeclaratorLookAhead},
+  {1, TblVariableDeclarator_sub1LookAhead},
+  {1, TblVariableDeclarator_sub2LookAhead},
+  {1, TblVariableDeclaratorIdLookAhead},
+  {2, TblDimsLookAhead},
+  {2, TblDims_sub1LookAhead},
+  {2, TblDimLookAhead},
+  {23, TblVariableInitializerLookAhead},
+  {23, TblVariableInitializerListLookAhead},
+  {1, TblVariableInitializerList_sub1LookAhead},
+  {1, TblVariableInitializerList_sub2LookAhead},
+  {33, TblStatementLookAhead},
+  {32, TblStatementNoShortIfLookAhead},
+  {29, TblStatementWithoutTrailingSubstatementLookAhead},
+  {1, TblIfThenStatementLookAhead},
+  {1, TblIfThenElseStatementLookAhead},
+  {1, TblIfThenElseStatementNoShortIfLookAhead},
+  {0, NULL},
+  {1, TblLabeledStatementLookAhead},
+  {1, TblLabeledStatementNoShortIfLookAhead},
+  {18, TblExpressionStatementLookAhead},
+  {18, TblStatementExpressionLookAhead},
+  {1, TblAssertStatementLookAhead},
+  {1, TblAssertStatement_sub1LookAhead},
+  {1, TblAssertStatement_sub2LookAhead},
+  {1, TblSwitchStatementLookAhead},
+  {1, TblSwitchBlockLookAhead},
+  {2, TblSwitchBlock_sub1LookAhead},
+  {2, TblSwitchBlock_sub2LookAhead},
+  {2, TblSwitchBlock_sub3LookAhead},
+  {2, TblSwitchBlock_sub4LookAhead},
+  {2, TblSwitchBlockStatementGroupLookAhead},
+  {2, TblSwitchLabelsLookAhead},
+  {2, TblSwitchLabelLookAhead},
+  {1, TblSwitchLabel_sub1LookAhead},
+  {1, TblSwitchLabel_sub2LookAhead},
+  {1, TblSwitchLabel_sub3LookAhead},
+  {0, NULL},
+  {1, TblWhileStatementLookAhead},
+  {1, TblWhileStatementNoShortIfLookAhead},
+  {1, TblDoStatementLookAhead},
+  {1, TblForStatementLookAhead},
+  {1, TblForStatementNoShortIfLookAhead},
+  {1, TblBasicForStatementLookAhead},
+  {19, TblBasicForStatement_sub1LookAhead},
+  {22, TblBasicForStatement_sub2LookAhead},
+  {18, TblBasicForStatement_sub3LookAhead},
+  {1, TblBasicForStatementNoShortIfLookAhead},
+  {19, TblForInitLookAhead},
+  {0, NULL},
+  {18, TblStatementExpressionListLookAhead},
+  {1, TblStatementExpressionList_sub1LookAhead},
+  {1, TblStatementExpressionList_sub2LookAhead},
+  {1, TblEnhancedForStatementLookAhead},
+  {1, TblEnhancedForStatementNoShortIfLookAhead},
+  {1, TblBreakStatementLookAhead},
+  {1, TblBreakStatement_sub1LookAhead},
+  {1, TblContinueStatementLookAhead},
+  {1, TblReturnStatementLookAhead},
+  {1, TblThrowStatementLookAhead},
+  {1, TblSynchronizedStatementLookAhead},
+  {1, TblTryStatementLookAhead},
+  {1, TblTryStatement_sub1LookAhead},
+  {1, TblTryStatement_sub2LookAhead},
+  {1, TblTryStatement_sub3LookAhead},
+  {1, TblCatchesLookAhead},
+  {1, TblCatches_sub1LookAhead},
+  {1, TblCatchClauseLookAhead},
+  {3, TblCatchFormalParameterLookAhead},
+  {1, TblCatchTypeLookAhead},
+  {1, TblCatchType_sub1LookAhead},
+  {1, TblCatchType_sub2LookAhead},
+  {1, TblFinallyLookAhead},
+  {1, TblTryWithResourcesStatementLookAhead},
+  {1, TblTryWithResourcesStatement_sub1LookAhead},
+  {1, TblResourceSpecificationLookAhead},
+  {1, TblResourceSpecification_sub1LookAhead},
+  {17, TblResourceListLookAhead},
+  {1, TblResourceList_sub1LookAhead},
+  {1, TblResourceList_sub2LookAhead},
+  {17, TblResourceLookAhead},
+  {11, TblResource_sub1LookAhead},
+  {0, NULL},
+};
+LookAheadTable *gLookAheadTable = localLookAheadTable;
+bool localSingleMatch[] = {
+  false, // TblCHAR
+  false, // TblDIGIT
+  false, // TblASCII
+  false, // TblESCAPE
+  true, // TblESCAPE_sub1
+  true, // TblESCAPE_sub2
+  true, // TblESCAPE_sub3
+  true, // TblESCAPE_sub4
+  true, // TblESCAPE_sub5
+  true, // TblESCAPE_sub6
+  true, // TblESCAPE_sub7
+  true, // TblESCAPE_sub8
+  false, // TblJavaChar
+  false, // TblCharOrDigit
+  true, // TblIdentifier
+  false, // TblIdentifier_sub1
+  false, // TblNonZeroDigit
+  false, // TblUnderscores
+  false, // TblUnderscores_sub1
+  false, // TblDigit
+  false, // TblDigitOrUnderscore
+  false, // TblDigitsAndUnderscores
+  false, // TblDigitsAndUnderscores_sub1
+  false, // TblDigits
+  false, // TblDigits_sub1
+  false, // TblDigits_sub2
+  false, // TblDecimalNumeral
+  false, // TblDecimalNumeral_sub1
+  false, // TblDecimalNumeral_sub2
+  false, // TblDecimalNumeral_sub3
+  false, // TblHexDigit
+  false, // TblHexDigitOrUnderscore
+  false, // TblHexDigitsAndUnderscores
+  false, // TblHexDigitsAndUnderscores_sub1
+  false, // TblHexDigits
+  false, // TblHexDigits_sub1
+  false, // TblHexDigits_sub2
+  false, // TblHexNumeral
+  false, // TblHexNumeral_sub1
+  false, // TblHexNumeral_sub2
+  false, // TblOctalDigit
+  false, // TblOctalDigitOrUnderscore
+  false, // TblOctalDigitsAndUnderscores
+  false, // TblOctalDigitsAndUnderscores_sub1
+  false, // TblOctalDigits
+  false, // TblOctalDigits_sub1
+  false, // TblOctalDigits_sub2
+  false, // TblOctalNumeral
+  false, // TblOctalNumeral_sub1
+  false, // TblOctalNumeral_sub2
+  false, // TblBinDigit
+  false, // TblBinDigitOrUnderscore
+  false, // TblBinDigitsAndUnderscores
+  false, // TblBinDigitsAndUnderscores_sub1
+  false, // TblBinDigits
+  false, // TblBinDigits_sub1
+  false, // TblBinDigits_sub2
+  false, // TblBinNumeral
+  false, // TblBinNumeral_sub1
+  false, // TblBinNumeral_sub2
+  false, // TblIntegerTypeSuffix
+  false, // TblDecimalIntegerLiteral
+  false, // TblDecimalIntegerLiteral_sub1
+  false, // TblHexIntegerLiteral
+  false, // TblHexIntegerLiteral_sub1
+  false, // TblOctalIntegerLiteral
+  false, // TblOctalIntegerLiteral_sub1
+  false, // TblBinaryIntegerLiteral
+  false, // TblBinaryIntegerLiteral_sub1
+  false, // TblIntegerLiteral
+  true, // TblSign
+  false, // TblFloatTypeSuffix
+  false, // TblExponentIndicator
+  false, // TblSignedInteger
+  false, // TblSignedInteger_sub1
+  false, // TblExponentPart
+  false, // TblDecFPLiteral
+  false, // TblDecFPLiteral_sub1
+  false, // TblDecFPLiteral_sub2
+  false, // TblDecFPLiteral_sub3
+  false, // TblDecFPLiteral_sub4
+  false, // TblDecFPLiteral_sub5
+  false, // TblDecFPLiteral_sub6
+  false, // TblDecFPLiteral_sub7
+  false, // TblDecFPLiteral_sub8
+  false, // TblDecFPLiteral_sub9
+  false, // TblDecFPLiteral_sub10
+  false, // TblDecFPLiteral_sub11
+  false, // TblBinaryExponentIndicator
+  false, // TblBinaryExponent
+  false, // TblHexSignificand
+  false, // TblHexSignificand_sub1
+  false, // TblHexSignificand_sub2
+  false, // TblHexSignificand_sub3
+  false, // TblHexSignificand_sub4
+  false, // TblHexSignificand_sub5
+  false, // TblHexSignificand_sub6
+  false, // TblHexFPLiteral
+  false, // TblHexFPLiteral_sub1
+  false, // TblFPLiteral
+  false, // TblBooleanLiteral
+  false, // TblOctalEscape
+  true, // TblOctalEscape_sub1
+  true, // TblOctalEscape_sub2
+  false, // TblEscapeSequence
+  false, // TblCharacterLiteral
+  false, // TblCharacterLiteral_sub1
+  false, // TblStringChar
+  false, // TblStringLiteral
+  false, // TblStringLiteral_sub1
+  true, // TblNullLiteral
+  true, // TblLiteral
+  true, // TblBoolType
+  true, // TblIntType
+  true, // TblFPType
+  true, // TblNumericType
+  false, // TblPrimitiveType
+  false, // TblPrimitiveType_sub1
+  false, // TblPrimitiveType_sub2
+  false, // TblPrimitiveType_sub3
+  true, // TblNullType
+  false, // TblWildcardBounds
+  false, // TblWildcardBounds_sub1
+  false, // TblWildcardBounds_sub2
+  false, // TblWildcard
+  false, // TblWildcard_sub1
+  false, // TblTypeArgument
+  false, // TblTypeArgument_sub1
+  false, // TblTypeArgument_sub2
+  false, // TblTypeArgument_sub3
+  false, // TblTypeArgumentList
+  false, // TblTypeArgumentList_sub1
+  false, // TblTypeArgumentList_sub2
+  false, // TblTypeArguments
+  false, // TblClassType
+  false, // TblClassType_sub1
+  false, // TblClassType_sub2
+  false, // TblClassType_sub3
+  false, // TblInterfaceType
+  false, // TblTypeVariable
+  false, // TblArrayType
+  false, // TblClassOrInterfaceType
+  false, // TblReferenceType
+  false, // TblTYPE
+  false, // TblUnannClassType
+  false, // TblUnannClassType_sub1
+  false, // TblUnannClassType_sub2
+  false, // TblUnannClassOrInterfaceType
+  false, // TblUnannInterfaceType
+  true, // TblUnannTypeVariable
+  false, // TblUnannArrayType
+  false, // TblUnannArrayType_sub1
+  false, // TblUnannArrayType_sub2
+  false, // TblUnannArrayType_sub3
+  false, // TblUnannReferenceType
+  true, // TblUnannPrimitiveType
+  false, // TblUnannType
+  false, // TblClassDeclaration
+  false, // TblNormalClassDeclaration
+  false, // TblNormalClassDeclaration_sub1
+  false, // TblNormalClassDeclaration_sub2
+  false, // TblNormalClassDeclaration_sub3
+  false, // TblNormalClassDeclaration_sub4
+  true, // TblClassAttr
+  false, // TblClassModifier
+  false, // TblTypeParameters
+  false, // TblTypeParameterList
+  false, // TblTypeParameterList_sub1
+  false, // TblTypeParameterList_sub2
+  false, // TblTypeParameter
+  false, // TblTypeParameter_sub1
+  false, // TblTypeParameterModifier
+  false, // TblTypeBound
+  false, // TblTypeBound_sub1
+  false, // TblTypeBound_sub2
+  false, // TblTypeBound_sub3
+  false, // TblAdditionalBound
+  false, // TblSuperclass
+  false, // TblSuperinterfaces
+  false, // TblInterfaceTypeList
+  false, // TblInterfaceTypeList_sub1
+  false, // TblInterfaceTypeList_sub2
+  true, // TblClassBody
+  false, // TblClassBody_sub1
+  false, // TblClassBodyDeclaration
+  true, // TblInstanceInitializer
+  true, // TblStaticInitializer
+  false, // TblClassMemberDeclaration
+  false, // TblFieldDeclaration
+  false, // TblFieldDeclaration_sub1
+  false, // TblMethodDeclaration
+  false, // TblMethodDeclaration_sub1
+  true, // TblMethodBody
+  false, // TblMethodHeader
+  false, // TblMethodHeader_sub1
+  false, // TblMethodHeader_sub2
+  false, // TblMethodHeader_sub3
+  false, // TblResult
+  false, // TblMethodDeclarator
+  false, // TblMethodDeclarator_sub1
+  false, // TblMethodDeclarator_sub2
+  false, // TblThrows
+  false, // TblExceptionTypeList
+  false, // TblExceptionTypeList_sub1
+  false, // TblExceptionTypeList_sub2
+  false, // TblExceptionType
+  true, // TblMethodAttr
+  false, // TblMethodModifier
+  false, // TblFormalParameterListNoReceiver
+  false, // TblFormalParameterListNoReceiver_sub1
+  false, // TblFormalParameterList
+  false, // TblFormalParameters
+  false, // TblFormalParameters_sub1
+  false, // TblFormalParameters_sub2
+  false, // TblFormalParameters_sub3
+  false, // TblFormalParameters_sub4
+  false, // TblFormalParameter
+  false, // TblFormalParameter_sub1
+  false, // TblReceiverParameter
+  true, // TblReceiverParameter_sub1
+  true, // TblReceiverParameter_sub2
+  false, // TblLastFormalParameter
+  false, // TblLastFormalParameter_sub1
+  true, // TblFieldAttr
+  false, // TblFieldModifier
+  false, // TblConstructorDeclaration
+  false, // TblConstructorDeclaration_sub1
+  true, // TblConstructorAttr
+  false, // TblConstructorModifier
+  false, // TblConstructorDeclarator
+  true, // TblSimpleTypeName
+  false, // TblConstructorBody
+  false, // TblConstructorBody_sub1
+  true, // TblConstructorBody_sub2
+  false, // TblExplicitConstructorInvocation
+  false, // TblExplicitConstructorInvocation_sub1
+  false, // TblExplicitConstructorInvocation_sub2
+  false, // TblExplicitConstructorInvocation_sub3
+  false, // TblExplicitConstructorInvocation_sub4
+  false, // TblExplicitConstructorInvocation_sub5
+  false, // TblEnumDeclaration
+  false, // TblEnumBody
+  false, // TblEnumBody_sub1
+  true, // TblEnumBody_sub2
+  true, // TblEnumBody_sub3
+  false, // TblEnumConstantList
+  false, // TblEnumConstantList_sub1
+  false, // TblEnumConstantList_sub2
+  false, // TblEnumConstant
+  false, // TblEnumConstant_sub1
+  false, // TblEnumConstant_sub2
+  false, // TblEnumConstant_sub3
+  false, // TblEnumConstantModifier
+  false, // TblEnumBodyDeclarations
+  false, // TblBlockStatement
+  false, // TblBlockStatements
+  false, // TblBlockStatements_sub1
+  true, // TblBlock
+  true, // TblBlock_sub1
+  false, // TblInterfaceDeclaration
+  false, // TblNormalInterfaceDeclaration
+  false, // TblNormalInterfaceDeclaration_sub1
+  false, // TblNormalInterfaceDeclaration_sub2
+  true, // TblInterfaceAttr
+  false, // TblInterfaceModifier
+  false, // TblExtendsInterfaces
+  true, // TblInterfaceBody
+  true, // TblInterfaceBody_sub1
+  false, // TblInterfaceMemberDeclaration
+  false, // TblConstantDeclaration
+  false, // TblConstantDeclaration_sub1
+  true, // TblConstantAttr
+  false, // TblConstantModifier
+  false, // TblInterfaceMethodDeclaration
+  false, // TblInterfaceMethodDeclaration_sub1
+  true, // TblInterfaceMethodAttr
+  false, // TblInterfaceMethodModifier
+  false, // TblAnnotationTypeDeclaration
+  true, // TblAnnotationTypeBody
+  true, // TblAnnotationTypeBody_sub1
+  false, // TblAnnotationTypeMemberDeclaration
+  false, // TblAnnotationTypeElementDeclaration
+  false, // TblAnnotationTypeElementDeclaration_sub1
+  false, // TblAnnotationTypeElementDeclaration_sub2
+  true, // TblAnnotationTypeElementAttr
+  false, // TblAnnotationTypeElementModifier
+  false, // TblDefaultValue
+  false, // TblAnnotation
+  false, // TblNormalAnnotation
+  false, // TblNormalAnnotation_sub1
+  false, // TblMarkerAnnotation
+  false, // TblSingleElementAnnotation
+  false, // TblElementValuePairList
+  false, // TblElementValuePairList_sub1
+  false, // TblElementValuePairList_sub2
+  false, // TblElementValuePair
+  false, // TblElementValue
+  false, // TblElementValue_sub1
+  false, // TblElementValue_sub2
+  false, // TblElementValueArrayInitializer
+  false, // TblElementValueArrayInitializer_sub1
+  false, // TblElementValueList
+  false, // TblElementValueList_sub1
+  false, // TblElementValueList_sub2
+  false, // TblPackageModifier
+  false, // TblPackageDeclaration
+  true, // TblPackageDeclaration_sub1
+  true, // TblPackageDeclaration_sub2
+  false, // TblImportDeclaration
+  false, // TblSingleTypeImportDeclaration
+  false, // TblTypeImportOnDemandDeclaration
+  false, // TblSingleStaticImportDeclaration
+  false, // TblStaticImportOnDemandDeclaration
+  false, // TblPackageName
+  false, // TblPackageName_sub1
+  false, // TblTypeName
+  false, // TblTypeName_sub1
+  false, // TblPackageOrTypeName
+  false, // TblPackageOrTypeName_sub1
+  false, // TblExpressionName
+  false, // TblExpressionName_sub1
+  true, // TblMethodName
+  false, // TblAmbiguousName
+  false, // TblAmbiguousName_sub1
+  true, // TblClass
+  false, // TblClassLiteral
+  false, // TblClassLiteral_sub1
+  true, // TblClassLiteral_sub2
+  true, // TblClassLiteral_sub3
+  true, // TblClassLiteral_sub4
+  true, // TblClassLiteral_sub5
+  true, // TblClassLiteral_sub6
+  false, // TblPrimaryNoNewArray_single
+  false, // TblPrimaryNoNewArray_single_sub1
+  false, // TblPrimaryNoNewArray_single_sub2
+  false, // TblPrimaryNoNewArray
+  false, // TblClassInstanceCreationExpression
+  false, // TblClassInstanceCreationExpression_sub1
+  false, // TblUnqualifiedClassInstanceCreationExpression
+  false, // TblUnqualifiedClassInstanceCreationExpression_sub1
+  false, // TblClassOrInterfaceTypeToInstantiate
+  false, // TblClassOrInterfaceTypeToInstantiate_sub1
+  false, // TblClassOrInterfaceTypeToInstantiate_sub2
+  false, // TblClassOrInterfaceTypeToInstantiate_sub3
+  false, // TblTypeArgumentsOrDiamond
+  false, // TblArgumentList
+  false, // TblArgumentList_sub1
+  false, // TblArgumentList_sub2
+  false, // TblArrayInitializer
+  false, // TblArrayInitializer_sub1
+  false, // TblArrayCreationExpression
+  false, // TblArrayCreationExpression_sub1
+  false, // TblArrayCreationExpression_sub2
+  false, // TblArrayCreationExpression_sub3
+  false, // TblArrayCreationExpression_sub4
+  false, // TblDimExprs
+  false, // TblDimExprs_sub1
+  false, // TblDimExpr
+  false, // TblArrayAccess
+  false, // TblArrayAccess_sub1
+  false, // TblArrayAccess_sub2
+  false, // TblFieldAccess
+  false, // TblFieldAccess_sub1
+  true, // TblFieldAccess_sub2
+  false, // TblFieldAccess_sub3
+  false, // TblMethodInvocation
+  false, // TblMethodInvocation_sub1
+  false, // TblMethodInvocation_sub2
+  false, // TblMethodInvocation_sub3
+  false, // TblMethodInvocation_sub4
+  false, // TblMethodInvocation_sub5
+  false, // TblMethodInvocation_sub6
+  false, // TblMethodInvocation_sub7
+  false, // TblMethodInvocation_sub8
+  false, // TblMethodInvocation_sub9
+  false, // TblMethodInvocation_sub10
+  false, // TblMethodInvocation_sub11
+  false, // TblMethodInvocation_sub12
+  false, // TblMethodReference
+  false, // TblMethodReference_sub1
+  false, // TblMethodReference_sub2
+  false, // TblMethodReference_sub3
+  false, // TblMethodReference_sub4
+  false, // TblMethodReference_sub5
+  false, // TblMethodReference_sub6
+  false, // TblMethodReference_sub7
+  false, // TblPostfixExpression
+  false, // TblPostIncrementExpression
+  false, // TblPostDecrementExpression
+  false, // TblUnaryExpression
+  false, // TblUnaryExpression_sub1
+  false, // TblUnaryExpression_sub2
+  false, // TblUnaryExpression_sub3
+  false, // TblUnaryExpression_sub4
+  false, // TblUnaryExpression_sub5
+  false, // TblUnaryExpression_sub6
+  false, // TblUnaryExpression_sub7
+  false, // TblUnaryExpression_sub8
+  false, // TblUnaryExpression_sub9
+  false, // TblPreIncrementExpression
+  false, // TblPreDecrementExpression
+  false, // TblUnaryExpressionNotPlusMinus
+  false, // TblCastExpression
+  false, // TblMultiplicativeExpression
+  false, // TblMultiplicativeExpression_sub1
+  false, // TblMultiplicativeExpression_sub2
+  false, // TblMultiplicativeExpression_sub3
+  false, // TblAdditiveExpression
+  false, // TblAdditiveExpression_sub1
+  false, // TblAdditiveExpression_sub2
+  false, // TblShiftExpression
+  false, // TblShiftExpression_sub1
+  false, // TblShiftExpression_sub2
+  false, // TblShiftExpression_sub3
+  false, // TblRelationalExpression
+  false, // TblRelationalExpression_sub1
+  false, // TblRelationalExpression_sub2
+  false, // TblRelationalExpression_sub3
+  false, // TblRelationalExpression_sub4
+  false, // TblRelationalExpression_sub5
+  false, // TblEqualityExpression
+  false, // TblEqualityExpression_sub1
+  false, // TblEqualityExpression_sub2
+  false, // TblAndExpression
+  false, // TblAndExpression_sub1
+  false, // TblExclusiveOrExpression
+  false, // TblExclusiveOrExpression_sub1
+  false, // TblInclusiveOrExpression
+  false, // TblInclusiveOrExpression_sub1
+  false, // TblConditionalAndExpression
+  false, // TblConditionalAndExpression_sub1
+  false, // TblConditionalOrExpression
+  false, // TblConditionalOrExpression_sub1
+  false, // TblConditionalExpression
+  false, // TblAssignmentExpression
+  false, // TblAssignment
+  false, // TblLeftHandSide
+  true, // TblAssignmentOperator
+  false, // TblLambdaExpression
+  false, // TblLambdaParameters
+  false, // TblLambdaParameters_sub1
+  false, // TblLambdaParameters_sub2
+  false, // TblLambdaParameterList
+  false, // TblLambdaParameterList_sub1
+  false, // TblLambdaParameterList_sub2
+  false, // TblLambdaParameterList_sub3
+  false, // TblLambdaParameterList_sub4
+  false, // TblLambdaParameterList_sub5
+  true, // TblLambdaParameterList_sub6
+  false, // TblLambdaParameter
+  false, // TblLambdaParameter_sub1
+  false, // TblLambdaParameterType
+  false, // TblVariableArityParameter
+  false, // TblLambdaBody
+  false, // TblConstantExpression
+  false, // TblPrimary
+  false, // TblExpression
+  false, // TblBinaryExpression
+  false, // TblLocalVariableDeclarationStatement
+  false, // TblLocalVariableDeclaration
+  false, // TblVariableModifier
+  false, // TblVariableDeclaratorList
+  false, // TblVariableDeclaratorList_sub1
+  false, // TblVariableDeclaratorList_sub2
+  false, // TblVariableDeclarator
+  false, // TblVariableDeclarator_sub1
+  false, // TblVariableDeclarator_sub2
+  false, // TblVariableDeclaratorId
+  false, // TblDims
+  false, // TblDims_sub1
+  false, // TblDim
+  false, // TblVariableInitializer
+  false, // TblVariableInitializerList
+  false, // TblVariableInitializerList_sub1
+  false, // TblVariableInitializerList_sub2
+  false, // TblStatement
+  false, // TblStatementNoShortIf
+  false, // TblStatementWithoutTrailingSubstatement
+  false, // TblIfThenStatement
+  false, // TblIfThenElseStatement
+  false, // TblIfThenElseStatementNoShortIf
+  true, // TblEmptyStatement
+  false, // TblLabeledStatement
+  false, // TblLabeledStatementNoShortIf
+  false, // TblExpressionStatement
+  false, // TblStatementExpression
+  false, // TblAssertStatement
+  false, // TblAssertStatement_sub1
+  false, // TblAssertStatement_sub2
+  false, // TblSwitchStatement
+  true, // TblSwitchBlock
+  true, // TblSwitchBlock_sub1
+  false, // TblSwitchBlock_sub2
+  false, // TblSwitchBlock_sub3
+  false, // TblSwitchBlock_sub4
+  false, // TblSwitchBlockStatementGroup
+  false, // TblSwitchLabels
+  false, // TblSwitchLabel
+  false, // TblSwitchLabel_sub1
+  true, // TblSwitchLabel_sub2
+  true, // TblSwitchLabel_sub3
+  true, // TblEnumConstantName
+  false, // TblWhileStatement
+  false, // TblWhileStatementNoShortIf
+  false, // TblDoStatement
+  false, // TblForStatement
+  false, // TblForStatementNoShortIf
+  false, // TblBasicForStatement
+  false, // TblBasicForStatement_sub1
+  false, // TblBasicForStatement_sub2
+  false, // TblBasicForStatement_sub3
+  false, // TblBasicForStatementNoShortIf
+  false, // TblForInit
+  false, // TblForUpdate
+  false, // TblStatementExpressionList
+  false, // TblStatementExpressionList_sub1
+  false, // TblStatementExpressionList_sub2
+  false, // TblEnhancedForStatement
+  false, // TblEnhancedForStatementNoShortIf
+  true, // TblBreakStatement
+  true, // TblBreakStatement_sub1
+  true, // TblContinueStatement
+  false, // TblReturnStatement
+  false, // TblThrowStatement
+  false, // TblSynchronizedStatement
+  false, // TblTryStatement
+  false, // TblTryStatement_sub1
+  false, // TblTryStatement_sub2
+  false, // TblTryStatement_sub3
+  false, // TblCatches
+  false, // TblCatches_sub1
+  false, // TblCatchClause
+  false, // TblCatchFormalParameter
+  false, // TblCatchType
+  false, // TblCatchType_sub1
+  false, // TblCatchType_sub2
+  true, // TblFinally
+  false, // TblTryWithResourcesStatement
+  false, // TblTryWithResourcesStatement_sub1
+  false, // TblResourceSpecification
+  true, // TblResourceSpecification_sub1
+  false, // TblResourceList
+  false, // TblResourceList_sub1
+  false, // TblResourceList_sub2
+  false, // TblResource
+  false, // TblResource_sub1
+  false, // TblVariableAccess
+};
+bool *gSingleMatch = localSingleMatch;
@@ -0,0 +1,815 @@
+#include "parser.h"
+extern RuleTable TblSign;
+static bool MatchTblSign(Parser *p, AppealNode *node) {
+  unsigned id = p->GetCurTokenId();
+  switch (id) {
+  case 37:
+  case 36:
+    return p->MatchToken(id, node);
+  default:
+    return false;
+  }
+}
+extern RuleTable TblHexSignificand_sub2;
+static bool MatchTblHexSignificand_sub2(Parser *p, AppealNode *node) {
+  p->MatchToken(43, node);
+  return true;
+}
+extern RuleTable TblBoolType;
+static bool MatchTblBoolType(Parser *p, AppealNode *node) {
+  return p->MatchToken(68, node);
+}
+extern RuleTable TblIntType;
+static bool MatchTblIntType(Parser *p, AppealNode *node) {
+  unsigned id = p->GetCurTokenId();
+  switch (id) {
+  case 96:
+  case 85:
+  case 101:
+  case 93:
+  case 95:
+    return p->MatchToken(id, node);
+  default:
+    return false;
+  }
+}
+extern RuleTable TblFPType;
+static bool MatchTblFPType(Parser *p, AppealNode *node) {
+  unsigned id = p->GetCurTokenId();
+  switch (id) {
+  case 86:
+  case 77:
+    return p->MatchToken(id, node);
+  default:
+    return false;
+  }
+}
+extern RuleTable TblNumericType;
+static bool MatchTblNumericType(Parser *p, AppealNode *node) {
+  unsigned id = p->GetCurTokenId();
+  switch (id) {
+  case 96:
+  case 85:
+  case 101:
+  case 93:
+  case 95:
+  case 86:
+  case 77:
+    return p->MatchToken(id, node);
+  default:
+    return false;
+  }
+}
+extern RuleTable TblUnannPrimitiveType;
+static bool MatchTblUnannPrimitiveType(Parser *p, AppealNode *node) {
+  unsigned id = p->GetCurTokenId();
+  switch (id) {
+  case 96:
+  case 85:
+  case 101:
+  case 93:
+  case 95:
+  case 86:
+  case 77:
+  case 68:
+    return p->MatchToken(id, node);
+  default:
+    return false;
+  }
+}
+extern RuleTable TblClassAttr;
+static bool MatchTblClassAttr(Parser *p, AppealNode *node) {
+  unsigned id = p->GetCurTokenId();
+  switch (id) {
+  case 70:
+  case 56:
+  case 63:
+  case 61:
+  case 69:
+  case 78:
+  case 59:
+    return p->MatchToken(id, node);
+  default:
+    return false;
+  }
+}
+extern RuleTable TblMethodAttr;
+static bool MatchTblMethodAttr(Parser *p, AppealNode *node) {
+  unsigned id = p->GetCurTokenId();
+  switch (id) {
+  case 70:
+  case 56:
+  case 63:
+  case 61:
+  case 69:
+  case 78:
+  case 53:
+  case 71:
+  case 59:
+    return p->MatchToken(id, node);
+  default:
+    return false;
+  }
+}
+extern RuleTable TblFieldAttr;
+static bool MatchTblFieldAttr(Parser *p, AppealNode *node) {
+  unsigned id = p->GetCurTokenId();
+  switch (id) {
+  case 70:
+  case 56:
+  case 63:
+  case 69:
+  case 78:
+  case 57:
+  case 60:
+    return p->MatchToken(id, node);
+  default:
+    return false;
+  }
+}
+extern RuleTable TblConstructorAttr;
+static bool MatchTblConstructorAttr(Parser *p, AppealNode *node) {
+  unsigned id = p->GetCurTokenId();
+  switch (id) {
+  case 70:
+  case 56:
+  case 63:
+    return p->MatchToken(id, node);
+  default:
+    return false;
+  }
+}
+extern RuleTable TblEnumBody_sub2;
+static bool MatchTblEnumBody_sub2(Parser *p, AppealNode *node) {
+  p->MatchToken(44, node);
+  return true;
+}
+extern RuleTable TblInterfaceAttr;
+static bool MatchTblInterfaceAttr(Parser *p, AppealNode *node) {
+  unsigned id = p->GetCurTokenId();
+  switch (id) {
+  case 70:
+  case 56:
+  case 63:
+  case 61:
+  case 69:
+  case 59:
+    return p->MatchToken(id, node);
+  default:
+    return false;
+  }
+}
+extern RuleTable TblConstantAttr;
+static bool MatchTblConstantAttr(Parser *p, AppealNode *node) {
+  unsigned id = p->GetCurTokenId();
+  switch (id) {
+  case 70:
+  case 69:
+  case 78:
+    return p->MatchToken(id, node);
+  default:
+    return false;
+  }
+}
+extern RuleTable TblInterfaceMethodAttr;
+static bool MatchTblInterfaceMethodAttr(Parser *p, AppealNode *node) {
+  unsigned id = p->GetCurTokenId();
+  switch (id) {
+  case 70:
+  case 61:
+  case 66:
+  case 69:
+  case 59:
+    return p->MatchToken(id, node);
+  default:
+    return false;
+  }
+}
+extern RuleTable TblAnnotationTypeElementAttr;
+static bool MatchTblAnnotationTypeElementAttr(Parser *p, AppealNode *node) {
+  unsigned id = p->GetCurTokenId();
+  switch (id) {
+  case 70:
+  case 61:
+    return p->MatchToken(id, node);
+  default:
+    return false;
+  }
+}
+extern RuleTable TblClass;
+static bool MatchTblClass(Parser *p, AppealNode *node) {
+  return p->MatchToken(87, node);
+}
+extern RuleTable TblClassLiteral_sub3;
+static bool MatchTblClassLiteral_sub3(Parser *p, AppealNode *node) {
+  if (!p->MatchToken(47, node) ||
+      p->OverMatchBudget(2, &TblClassLiteral_sub3))
+    return false;
+  if (!p->MatchToken(46, node) ||
+      p->OverMatchBudget(2, &TblClassLiteral_sub3))
+    return false;
+  return true;
+}
+extern RuleTable TblClassLiteral_sub6;
+static bool MatchTblClassLiteral_sub6(Parser *p, AppealNode *node) {
+  if (!p->MatchToken(92, node) ||
+      p->OverMatchBudget(2, &TblClassLiteral_sub6))
+    return false;
+  if (!p->MatchToken(43, node) ||
+      p->OverMatchBudget(2, &TblClassLiteral_sub6))
+    return false;
+  if (!p->MatchToken(87, node) ||
+      p->OverMatchBudget(2, &TblClassLiteral_sub6))
+    return false;
+  return true;
+}
+extern RuleTable TblAssignmentOperator;
+static bool MatchTblAssignmentOperator(Parser *p, AppealNode *node) {
+  unsigned id = p->GetCurTokenId();
+  switch (id) {
+  case 25:
+  case 10:
+  case 9:
+  case 8:
+  case 12:
+  case 11:
+  case 2:
+  case 1:
+  case 0:
+  case 7:
+  case 5:
+  case 6:
+    return p->MatchToken(id, node);
+  default:
+    return false;
+  }
+}
+extern RuleTable TblEmptyStatement;
+static bool MatchTblEmptyStatement(Parser *p, AppealNode *node) {
+  return p->MatchToken(45, node);
+}
+extern RuleTable TblSwitchLabel_sub3;
+static bool MatchTblSwitchLabel_sub3(Parser *p, AppealNode *node) {
+  if (!p->MatchToken(66, node) ||
+      p->OverMatchBudget(2, &TblSwitchLabel_sub3))
+    return false;
+  if (!p->MatchToken(24, node) ||
+      p->OverMatchBudget(2, &TblSwitchLabel_sub3))
+    return false;
+  return true;
+}
+extern RuleTable TblResourceSpecification_sub1;
+static bool MatchTblResourceSpecification_sub1(Parser *p, AppealNode *node) {
+  p->MatchToken(45, node);
+  return true;
+}
+MatchFunc localMatchFuncs[547] = {
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblSign,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblHexSignificand_sub2,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblBoolType,
+  MatchTblIntType,
+  MatchTblFPType,
+  MatchTblNumericType,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblUnannPrimitiveType,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblClassAttr,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblMethodAttr,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblFieldAttr,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblConstructorAttr,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblEnumBody_sub2,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblInterfaceAttr,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblConstantAttr,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblInterfaceMethodAttr,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblAnnotationTypeElementAttr,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblClass,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblClassLiteral_sub3,
+  NULL,
+  NULL,
+  MatchTblClassLiteral_sub6,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblAssignmentOperator,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblEmptyStatement,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblSwitchLabel_sub3,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MatchTblResourceSpecification_sub1,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL
+};
+MatchFunc *gMatchFuncs = localMatchFuncs;
@@ -0,0 +1,280 @@
+#include "gen_recursion.h"
+#include "common_header_autogen.h"
+// TblPackageOrTypeName
+unsigned TblPackageOrTypeName_path_0[3]= {2,1,0};
+unsigned *TblPackageOrTypeName_path_list[1]={TblPackageOrTypeName_path_0};
+LeftRecursion TblPackageOrTypeName_rec = {&TblPackageOrTypeName, 1, TblPackageOrTypeName_path_list};
+// TblPrimary
+unsigned TblPrimary_path_0[6]= {5,0,0,5,1,0};
+unsigned TblPrimary_path_1[5]= {4,0,1,0,0};
+unsigned TblPrimary_path_2[5]= {4,0,3,3,0};
+unsigned TblPrimary_path_3[5]= {4,0,4,1,0};
+unsigned *TblPrimary_path_list[4]={TblPrimary_path_0,TblPrimary_path_1,TblPrimary_path_2,TblPrimary_path_3};
+LeftRecursion TblPrimary_rec = {&TblPrimary, 4, TblPrimary_path_list};
+// TblAmbiguousName
+unsigned TblAmbiguousName_path_0[3]= {2,1,0};
+unsigned *TblAmbiguousName_path_list[1]={TblAmbiguousName_path_0};
+LeftRecursion TblAmbiguousName_rec = {&TblAmbiguousName, 1, TblAmbiguousName_path_list};
+// TblPrimaryNoNewArray
+unsigned TblPrimaryNoNewArray_path_0[4]= {3,2,1,0};
+unsigned *TblPrimaryNoNewArray_path_list[1]={TblPrimaryNoNewArray_path_0};
+LeftRecursion TblPrimaryNoNewArray_rec = {&TblPrimaryNoNewArray, 1, TblPrimaryNoNewArray_path_list};
+// TblClassOrInterfaceType
+unsigned TblClassOrInterfaceType_path_0[4]= {3,0,1,0};
+unsigned *TblClassOrInterfaceType_path_list[1]={TblClassOrInterfaceType_path_0};
+LeftRecursion TblClassOrInterfaceType_rec = {&TblClassOrInterfaceType, 1, TblClassOrInterfaceType_path_list};
+// TblPostfixExpression
+unsigned TblPostfixExpression_path_0[3]= {2,2,0};
+unsigned TblPostfixExpression_path_1[3]= {2,3,0};
+unsigned *TblPostfixExpression_path_list[2]={TblPostfixExpression_path_0,TblPostfixExpression_path_1};
+LeftRecursion TblPostfixExpression_rec = {&TblPostfixExpression, 2, TblPostfixExpression_path_list};
+// TblMultiplicativeExpression
+unsigned TblMultiplicativeExpression_path_0[3]= {2,1,0};
+unsigned TblMultiplicativeExpression_path_1[3]= {2,2,0};
+unsigned TblMultiplicativeExpression_path_2[3]= {2,3,0};
+unsigned *TblMultiplicativeExpression_path_list[3]={TblMultiplicativeExpression_path_0,TblMultiplicativeExpression_path_1,TblMultiplicativeExpression_path_2};
+LeftRecursion TblMultiplicativeExpression_rec = {&TblMultiplicativeExpression, 3, TblMultiplicativeExpression_path_list};
+// TblAdditiveExpression
+unsigned TblAdditiveExpression_path_0[3]= {2,1,0};
+unsigned TblAdditiveExpression_path_1[3]= {2,2,0};
+unsigned *TblAdditiveExpression_path_list[2]={TblAdditiveExpression_path_0,TblAdditiveExpression_path_1};
+LeftRecursion TblAdditiveExpression_rec = {&TblAdditiveExpression, 2, TblAdditiveExpression_path_list};
+// TblShiftExpression
+unsigned TblShiftExpression_path_0[3]= {2,1,0};
+unsigned TblShiftExpression_path_1[3]= {2,2,0};
+unsigned TblShiftExpression_path_2[3]= {2,3,0};
+unsigned *TblShiftExpression_path_list[3]={TblShiftExpression_path_0,TblShiftExpression_path_1,TblShiftExpression_path_2};
+LeftRecursion TblShiftExpression_rec = {&TblShiftExpression, 3, TblShiftExpression_path_list};
+// TblRelationalExpression
+unsigned TblRelationalExpression_path_0[3]= {2,1,0};
+unsigned TblRelationalExpression_path_1[3]= {2,2,0};
+unsigned TblRelationalExpression_path_2[3]= {2,3,0};
+unsigned TblRelationalExpression_path_3[3]= {2,4,0};
+unsigned TblRelationalExpression_path_4[3]= {2,5,0};
+unsigned *TblRelationalExpression_path_list[5]={TblRelationalExpression_path_0,TblRelationalExpression_path_1,TblRelationalExpression_path_2,TblRelationalExpression_path_3,TblRelationalExpression_path_4};
+LeftRecursion TblRelationalExpression_rec = {&TblRelationalExpression, 5, TblRelationalExpression_path_list};
+// TblEqualityExpression
+unsigned TblEqualityExpression_path_0[3]= {2,1,0};
+unsigned TblEqualityExpression_path_1[3]= {2,2,0};
+unsigned *TblEqualityExpression_path_list[2]={TblEqualityExpression_path_0,TblEqualityExpression_path_1};
+LeftRecursion TblEqualityExpression_rec = {&TblEqualityExpression, 2, TblEqualityExpression_path_list};
+// TblAndExpression
+unsigned TblAndExpression_path_0[3]= {2,1,0};
+unsigned *TblAndExpression_path_list[1]={TblAndExpression_path_0};
+LeftRecursion TblAndExpression_rec = {&TblAndExpression, 1, TblAndExpression_path_list};
+// TblExclusiveOrExpression
+unsigned TblExclusiveOrExpression_path_0[3]= {2,1,0};
+unsigned *TblExclusiveOrExpression_path_list[1]={TblExclusiveOrExpression_path_0};
+LeftRecursion TblExclusiveOrExpression_rec = {&TblExclusiveOrExpression, 1, TblExclusiveOrExpression_path_list};
+// TblInclusiveOrExpression
+unsigned TblInclusiveOrExpression_path_0[3]= {2,1,0};
+unsigned *TblInclusiveOrExpression_path_list[1]={TblInclusiveOrExpression_path_0};
+LeftRecursion TblInclusiveOrExpression_rec = {&TblInclusiveOrExpression, 1, TblInclusiveOrExpression_path_list};
+// TblConditionalAndExpression
+unsigned TblConditionalAndExpression_path_0[3]= {2,1,0};
+unsigned *TblConditionalAndExpression_path_list[1]={TblConditionalAndExpression_path_0};
+LeftRecursion TblConditionalAndExpression_rec = {&TblConditionalAndExpression, 1, TblConditionalAndExpression_path_list};
+// TblConditionalOrExpression
+unsigned TblConditionalOrExpression_path_0[3]= {2,1,0};
+unsigned *TblConditionalOrExpression_path_list[1]={TblConditionalOrExpression_path_0};
+LeftRecursion TblConditionalOrExpression_rec = {&TblConditionalOrExpression, 1, TblConditionalOrExpression_path_list};
+// TblUnannClassOrInterfaceType
+unsigned TblUnannClassOrInterfaceType_path_0[4]= {3,0,1,0};
+unsigned *TblUnannClassOrInterfaceType_path_list[1]={TblUnannClassOrInterfaceType_path_0};
+LeftRecursion TblUnannClassOrInterfaceType_rec = {&TblUnannClassOrInterfaceType, 1, TblUnannClassOrInterfaceType_path_list};
+// Total recursions
+unsigned gLeftRecursionsNum=17;
+LeftRecursion* TotalRecursions[17] = {&TblPackageOrTypeName_rec, &TblPrimary_rec, &TblAmbiguousName_rec, &TblPrimaryNoNewArray_rec, &TblClassOrInterfaceType_rec, &TblPostfixExpression_rec, &TblMultiplicativeExpression_rec, &TblAdditiveExpression_rec, &TblShiftExpression_rec, &TblRelationalExpression_rec, &TblEqualityExpression_rec, &TblAndExpression_rec, &TblExclusiveOrExpression_rec, &TblInclusiveOrExpression_rec, &TblConditionalAndExpression_rec, &TblConditionalOrExpression_rec, &TblUnannClassOrInterfaceType_rec};
+LeftRecursion **gLeftRecursions = TotalRecursions;
+///////////////////////////////////////////////////////////////
+//                       RecursionGroup                      //
+///////////////////////////////////////////////////////////////
+unsigned gRecursionGroupsNum = 16;
+unsigned group_sizes[16] = {1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1};
+unsigned *gRecursionGroupSizes = group_sizes;
+LeftRecursion *RecursionGroup_0[1] = {&TblPackageOrTypeName_rec};
+LeftRecursion *RecursionGroup_1[2] = {&TblPrimary_rec,&TblPrimaryNoNewArray_rec};
+LeftRecursion *RecursionGroup_2[1] = {&TblAmbiguousName_rec};
+LeftRecursion *RecursionGroup_3[1] = {&TblClassOrInterfaceType_rec};
+LeftRecursion *RecursionGroup_4[1] = {&TblPostfixExpression_rec};
+LeftRecursion *RecursionGroup_5[1] = {&TblMultiplicativeExpression_rec};
+LeftRecursion *RecursionGroup_6[1] = {&TblAdditiveExpression_rec};
+LeftRecursion *RecursionGroup_7[1] = {&TblShiftExpression_rec};
+LeftRecursion *RecursionGroup_8[1] = {&TblRelationalExpression_rec};
+LeftRecursion *RecursionGroup_9[1] = {&TblEqualityExpression_rec};
+LeftRecursion *RecursionGroup_10[1] = {&TblAndExpression_rec};
+LeftRecursion *RecursionGroup_11[1] = {&TblExclusiveOrExpression_rec};
+LeftRecursion *RecursionGroup_12[1] = {&TblInclusiveOrExpression_rec};
+LeftRecursion *RecursionGroup_13[1] = {&TblConditionalAndExpression_rec};
+LeftRecursion *RecursionGroup_14[1] = {&TblConditionalOrExpression_rec};
+LeftRecursion *RecursionGroup_15[1] = {&TblUnannClassOrInterfaceType_rec};
+LeftRecursion **recursion_groups[16] = {RecursionGroup_0,RecursionGroup_1,RecursionGroup_2,RecursionGroup_3,RecursionGroup_4,RecursionGroup_5,RecursionGroup_6,RecursionGroup_7,RecursionGroup_8,RecursionGroup_9,RecursionGroup_10,RecursionGroup_11,RecursionGroup_12,RecursionGroup_13,RecursionGroup_14,RecursionGroup_15};
+LeftRecursion ***gRecursionGroups = recursion_groups;
+///////////////////////////////////////////////////////////////
+//                       Ruel2Recursion                      //
+///////////////////////////////////////////////////////////////
+// Rule2Recursion mapping
+LeftRecursion *TblPackageOrTypeName_sub1_r2r_data[1] = {&TblPackageOrTypeName_rec};
+Rule2Recursion TblPackageOrTypeName_sub1_r2r = {&TblPackageOrTypeName_sub1, 1, TblPackageOrTypeName_sub1_r2r_data};
+LeftRecursion *TblPackageOrTypeName_r2r_data[1] = {&TblPackageOrTypeName_rec};
+Rule2Recursion TblPackageOrTypeName_r2r = {&TblPackageOrTypeName, 1, TblPackageOrTypeName_r2r_data};
+LeftRecursion *TblPrimaryNoNewArray_r2r_data[2] = {&TblPrimary_rec,&TblPrimaryNoNewArray_rec};
+Rule2Recursion TblPrimaryNoNewArray_r2r = {&TblPrimaryNoNewArray, 2, TblPrimaryNoNewArray_r2r_data};
+LeftRecursion *TblPrimaryNoNewArray_single_r2r_data[1] = {&TblPrimary_rec};
+Rule2Recursion TblPrimaryNoNewArray_single_r2r = {&TblPrimaryNoNewArray_single, 1, TblPrimaryNoNewArray_single_r2r_data};
+LeftRecursion *TblClassInstanceCreationExpression_r2r_data[1] = {&TblPrimary_rec};
+Rule2Recursion TblClassInstanceCreationExpression_r2r = {&TblClassInstanceCreationExpression, 1, TblClassInstanceCreationExpression_r2r_data};
+LeftRecursion *TblClassInstanceCreationExpression_sub1_r2r_data[1] = {&TblPrimary_rec};
+Rule2Recursion TblClassInstanceCreationExpression_sub1_r2r = {&TblClassInstanceCreationExpression_sub1, 1, TblClassInstanceCreationExpression_sub1_r2r_data};
+LeftRecursion *TblPrimary_r2r_data[1] = {&TblPrimary_rec};
+Rule2Recursion TblPrimary_r2r = {&TblPrimary, 1, TblPrimary_r2r_data};
+LeftRecursion *TblFieldAccess_r2r_data[1] = {&TblPrimary_rec};
+Rule2Recursion TblFieldAccess_r2r = {&TblFieldAccess, 1, TblFieldAccess_r2r_data};
+LeftRecursion *TblFieldAccess_sub1_r2r_data[1] = {&TblPrimary_rec};
+Rule2Recursion TblFieldAccess_sub1_r2r = {&TblFieldAccess_sub1, 1, TblFieldAccess_sub1_r2r_data};
+LeftRecursion *TblAmbiguousName_sub1_r2r_data[1] = {&TblAmbiguousName_rec};
+Rule2Recursion TblAmbiguousName_sub1_r2r = {&TblAmbiguousName_sub1, 1, TblAmbiguousName_sub1_r2r_data};
+LeftRecursion *TblAmbiguousName_r2r_data[1] = {&TblAmbiguousName_rec};
+Rule2Recursion TblAmbiguousName_r2r = {&TblAmbiguousName, 1, TblAmbiguousName_r2r_data};
+LeftRecursion *TblArrayAccess_r2r_data[1] = {&TblPrimaryNoNewArray_rec};
+Rule2Recursion TblArrayAccess_r2r = {&TblArrayAccess, 1, TblArrayAccess_r2r_data};
+LeftRecursion *TblArrayAccess_sub2_r2r_data[1] = {&TblPrimaryNoNewArray_rec};
+Rule2Recursion TblArrayAccess_sub2_r2r = {&TblArrayAccess_sub2, 1, TblArrayAccess_sub2_r2r_data};
+LeftRecursion *TblMethodInvocation_r2r_data[1] = {&TblPrimary_rec};
+Rule2Recursion TblMethodInvocation_r2r = {&TblMethodInvocation, 1, TblMethodInvocation_r2r_data};
+LeftRecursion *TblMethodInvocation_sub7_r2r_data[1] = {&TblPrimary_rec};
+Rule2Recursion TblMethodInvocation_sub7_r2r = {&TblMethodInvocation_sub7, 1, TblMethodInvocation_sub7_r2r_data};
+LeftRecursion *TblMethodReference_r2r_data[1] = {&TblPrimary_rec};
+Rule2Recursion TblMethodReference_r2r = {&TblMethodReference, 1, TblMethodReference_r2r_data};
+LeftRecursion *TblMethodReference_sub2_r2r_data[1] = {&TblPrimary_rec};
+Rule2Recursion TblMethodReference_sub2_r2r = {&TblMethodReference_sub2, 1, TblMethodReference_sub2_r2r_data};
+LeftRecursion *TblClassType_r2r_data[1] = {&TblClassOrInterfaceType_rec};
+Rule2Recursion TblClassType_r2r = {&TblClassType, 1, TblClassType_r2r_data};
+LeftRecursion *TblClassType_sub3_r2r_data[1] = {&TblClassOrInterfaceType_rec};
+Rule2Recursion TblClassType_sub3_r2r = {&TblClassType_sub3, 1, TblClassType_sub3_r2r_data};
+LeftRecursion *TblClassOrInterfaceType_r2r_data[1] = {&TblClassOrInterfaceType_rec};
+Rule2Recursion TblClassOrInterfaceType_r2r = {&TblClassOrInterfaceType, 1, TblClassOrInterfaceType_r2r_data};
+LeftRecursion *TblPostIncrementExpression_r2r_data[1] = {&TblPostfixExpression_rec};
+Rule2Recursion TblPostIncrementExpression_r2r = {&TblPostIncrementExpression, 1, TblPostIncrementExpression_r2r_data};
+LeftRecursion *TblPostfixExpression_r2r_data[1] = {&TblPostfixExpression_rec};
+Rule2Recursion TblPostfixExpression_r2r = {&TblPostfixExpression, 1, TblPostfixExpression_r2r_data};
+LeftRecursion *TblPostDecrementExpression_r2r_data[1] = {&TblPostfixExpression_rec};
+Rule2Recursion TblPostDecrementExpression_r2r = {&TblPostDecrementExpression, 1, TblPostDecrementExpression_r2r_data};
+LeftRecursion *TblMultiplicativeExpression_sub1_r2r_data[1] = {&TblMultiplicativeExpression_rec};
+Rule2Recursion TblMultiplicativeExpression_sub1_r2r = {&TblMultiplicativeExpression_sub1, 1, TblMultiplicativeExpression_sub1_r2r_data};
+LeftRecursion *TblMultiplicativeExpression_r2r_data[1] = {&TblMultiplicativeExpression_rec};
+Rule2Recursion TblMultiplicativeExpression_r2r = {&TblMultiplicativeExpression, 1, TblMultiplicativeExpression_r2r_data};
+LeftRecursion *TblMultiplicativeExpression_sub2_r2r_data[1] = {&TblMultiplicativeExpression_rec};
+Rule2Recursion TblMultiplicativeExpression_sub2_r2r = {&TblMultiplicativeExpression_sub2, 1, TblMultiplicativeExpression_sub2_r2r_data};
+LeftRecursion *TblMultiplicativeExpression_sub3_r2r_data[1] = {&TblMultiplicativeExpression_rec};
+Rule2Recursion TblMultiplicativeExpression_sub3_r2r = {&TblMultiplicativeExpression_sub3, 1, TblMultiplicativeExpression_sub3_r2r_data};
+LeftRecursion *TblAdditiveExpression_sub1_r2r_data[1] = {&TblAdditiveExpression_rec};
+Rule2Recursion TblAdditiveExpression_sub1_r2r = {&TblAdditiveExpression_sub1, 1, TblAdditiveExpression_sub1_r2r_data};
+LeftRecursion *TblAdditiveExpression_r2r_data[1] = {&TblAdditiveExpression_rec};
+Rule2Recursion TblAdditiveExpression_r2r = {&TblAdditiveExpression, 1, TblAdditiveExpression_r2r_data};
+LeftRecursion *TblAdditiveExpression_sub2_r2r_data[1] = {&TblAdditiveExpression_rec};
+Rule2Recursion TblAdditiveExpression_sub2_r2r = {&TblAdditiveExpression_sub2, 1, TblAdditiveExpression_sub2_r2r_data};
+LeftRecursion *TblShiftExpression_sub1_r2r_data[1] = {&TblShiftExpression_rec};
+Rule2Recursion TblShiftExpression_sub1_r2r = {&TblShiftExpression_sub1, 1, TblShiftExpression_sub1_r2r_data};
+LeftRecursion *TblShiftExpression_r2r_data[1] = {&TblShiftExpression_rec};
+Rule2Recursion TblShiftExpression_r2r = {&TblShiftExpression, 1, TblShiftExpression_r2r_data};
+LeftRecursion *TblShiftExpression_sub2_r2r_data[1] = {&TblShiftExpression_rec};
+Rule2Recursion TblShiftExpression_sub2_r2r = {&TblShiftExpression_sub2, 1, TblShiftExpression_sub2_r2r_data};
+LeftRecursion *TblShiftExpression_sub3_r2r_data[1] = {&TblShiftExpression_rec};
+Rule2Recursion TblShiftExpression_sub3_r2r = {&TblShiftExpression_sub3, 1, TblShiftExpression_sub3_r2r_data};
+LeftRecursion *TblRelationalExpression_sub1_r2r_data[1] = {&TblRelationalExpression_rec};
+Rule2Recursion TblRelationalExpression_sub1_r2r = {&TblRelationalExpression_sub1, 1, TblRelationalExpression_sub1_r2r_data};
+LeftRecursion *TblRelationalExpression_r2r_data[1] = {&TblRelationalExpression_rec};
+Rule2Recursion TblRelationalExpression_r2r = {&TblRelationalExpression, 1, TblRelationalExpression_r2r_data};
+LeftRecursion *TblRelationalExpression_sub2_r2r_data[1] = {&TblRelationalExpression_rec};
+Rule2Recursion TblRelationalExpression_sub2_r2r = {&TblRelationalExpression_sub2, 1, TblRelationalExpression_sub2_r2r_data};
+LeftRecursion *TblRelationalExpression_sub3_r2r_data[1] = {&TblRelationalExpression_rec};
+Rule2Recursion TblRelationalExpression_sub3_r2r = {&TblRelationalExpression_sub3, 1, TblRelationalExpression_sub3_r2r_data};
+LeftRecursion *TblRelationalExpression_sub4_r2r_data[1] = {&TblRelationalExpression_rec};
+Rule2Recursion TblRelationalExpression_sub4_r2r = {&TblRelationalExpression_sub4, 1, TblRelationalExpression_sub4_r2r_data};
+LeftRecursion *TblRelationalExpression_sub5_r2r_data[1] = {&TblRelationalExpression_rec};
+Rule2Recursion TblRelationalExpression_sub5_r2r = {&TblRelationalExpression_sub5, 1, TblRelationalExpression_sub5_r2r_data};
+LeftRecursion *TblEqualityExpression_sub1_r2r_data[1] = {&TblEqualityExpression_rec};
+Rule2Recursion TblEqualityExpression_sub1_r2r = {&TblEqualityExpression_sub1, 1, TblEqualityExpression_sub1_r2r_data};
+LeftRecursion *TblEqualityExpression_r2r_data[1] = {&TblEqualityExpression_rec};
+Rule2Recursion TblEqualityExpression_r2r = {&TblEqualityExpression, 1, TblEqualityExpression_r2r_data};
+LeftRecursion *TblEqualityExpression_sub2_r2r_data[1] = {&TblEqualityExpression_rec};
+Rule2Recursion TblEqualityExpression_sub2_r2r = {&TblEqualityExpression_sub2, 1, TblEqualityExpression_sub2_r2r_data};
+LeftRecursion *TblAndExpression_sub1_r2r_data[1] = {&TblAndExpression_rec};
+Rule2Recursion TblAndExpression_sub1_r2r = {&TblAndExpression_sub1, 1, TblAndExpression_sub1_r2r_data};
+LeftRecursion *TblAndExpression_r2r_data[1] = {&TblAndExpression_rec};
+Rule2Recursion TblAndExpression_r2r = {&TblAndExpression, 1, TblAndExpression_r2r_data};
+LeftRecursion *TblExclusiveOrExpression_sub1_r2r_data[1] = {&TblExclusiveOrExpression_rec};
+Rule2Recursion TblExclusiveOrExpression_sub1_r2r = {&TblExclusiveOrExpression_sub1, 1, TblExclusiveOrExpression_sub1_r2r_data};
+LeftRecursion *TblExclusiveOrExpression_r2r_data[1] = {&TblExclusiveOrExpression_rec};
+Rule2Recursion TblExclusiveOrExpression_r2r = {&TblExclusiveOrExpression, 1, TblExclusiveOrExpression_r2r_data};
+LeftRecursion *TblInclusiveOrExpression_sub1_r2r_data[1] = {&TblInclusiveOrExpression_rec};
+Rule2Recursion TblInclusiveOrExpression_sub1_r2r = {&TblInclusiveOrExpression_sub1, 1, TblInclusiveOrExpression_sub1_r2r_data};
+LeftRecursion *TblInclusiveOrExpression_r2r_data[1] = {&TblInclusiveOrExpression_rec};
+Rule2Recursion TblInclusiveOrExpression_r2r = {&TblInclusiveOrExpression, 1, TblInclusiveOrExpression_r2r_data};
+LeftRecursion *TblConditionalAndExpression_sub1_r2r_data[1] = {&TblConditionalAndExpression_rec};
+Rule2Recursion TblConditionalAndExpression_sub1_r2r = {&TblConditionalAndExpression_sub1, 1, TblConditionalAndExpression_sub1_r2r_data};
+LeftRecursion *TblConditionalAndExpression_r2r_data[1] = {&TblConditionalAndExpression_rec};
+Rule2Recursion TblConditionalAndExpression_r2r = {&TblConditionalAndExpression, 1, TblConditionalAndExpression_r2r_data};
+LeftRecursion *TblConditionalOrExpression_sub1_r2r_data[1] = {&TblConditionalOrExpression_rec};
+Rule2Recursion TblConditionalOrExpression_sub1_r2r = {&TblConditionalOrExpression_sub1, 1, TblConditionalOrExpression_sub1_r2r_data};
+LeftRecursion *TblConditionalOrExpression_r2r_data[1] = {&TblConditionalOrExpression_rec};
+Rule2Recursion TblConditionalOrExpression_r2r = {&TblConditionalOrExpression, 1, TblConditionalOrExpression_r2r_data};
+LeftRecursion *TblUnannClassType_r2r_data[1] = {&TblUnannClassOrInterfaceType_rec};
+Rule2Recursion TblUnannClassType_r2r = {&TblUnannClassType, 1, TblUnannClassType_r2r_data};
+LeftRecursion *TblUnannClassType_sub2_r2r_data[1] = {&TblUnannClassOrInterfaceType_rec};
+Rule2Recursion TblUnannClassType_sub2_r2r = {&TblUnannClassType_sub2, 1, TblUnannClassType_sub2_r2r_data};
+LeftRecursion *TblUnannClassOrInterfaceType_r2r_data[1] = {&TblUnannClassOrInterfaceType_rec};
+Rule2Recursion TblUnannClassOrInterfaceType_r2r = {&TblUnannClassOrInterfaceType, 1, TblUnannClassOrInterfaceType_r2r_data};
+LeftRecursion *TblInterfaceType_r2r_data[1] = {&TblClassOrInterfaceType_rec};
+Rule2Recursion TblInterfaceType_r2r = {&TblInterfaceType, 1, TblInterfaceType_r2r_data};
+LeftRecursion *TblUnannInterfaceType_r2r_data[1] = {&TblUnannClassOrInterfaceType_rec};
+Rule2Recursion TblUnannInterfaceType_r2r = {&TblUnannInterfaceType, 1, TblUnannInterfaceType_r2r_data};
+Rule2Recursion *arrayRule2Recursion[58] = {&TblPackageOrTypeName_sub1_r2r, &TblPackageOrTypeName_r2r, &TblPrimaryNoNewArray_r2r, &TblPrimaryNoNewArray_single_r2r, &TblClassInstanceCreationExpression_r2r, &TblClassInstanceCreationExpression_sub1_r2r, &TblPrimary_r2r, &TblFieldAccess_r2r, &TblFieldAccess_sub1_r2r, &TblAmbiguousName_sub1_r2r, &TblAmbiguousName_r2r, &TblArrayAccess_r2r, &TblArrayAccess_sub2_r2r, &TblMethodInvocation_r2r, &TblMethodInvocation_sub7_r2r, &TblMethodReference_r2r, &TblMethodReference_sub2_r2r, &TblClassType_r2r, &TblClassType_sub3_r2r, &TblClassOrInterfaceType_r2r, &TblPostIncrementExpression_r2r, &TblPostfixExpression_r2r, &TblPostDecrementExpression_r2r, &TblMultiplicativeExpression_sub1_r2r, &TblMultiplicativeExpression_r2r, &TblMultiplicativeExpression_sub2_r2r, &TblMultiplicativeExpression_sub3_r2r, &TblAdditiveExpression_sub1_r2r, &TblAdditiveExpression_r2r, &TblAdditiveExpression_sub2_r2r, &TblShiftExpression_sub1_r2r, &TblShiftExpression_r2r, &TblShiftExpression_sub2_r2r, &TblShiftExpression_sub3_r2r, &TblRelationalExpression_sub1_r2r, &TblRelationalExpression_r2r, &TblRelationalExpression_sub2_r2r, &TblRelationalExpression_sub3_r2r, &TblRelationalExpression_sub4_r2r, &TblRelationalExpression_sub5_r2r, &TblEqualityExpression_sub1_r2r, &TblEqualityExpression_r2r, &TblEqualityExpression_sub2_r2r, &TblAndExpression_sub1_r2r, &TblAndExpression_r2r, &TblExclusiveOrExpression_sub1_r2r, &TblExclusiveOrExpression_r2r, &TblInclusiveOrExpression_sub1_r2r, &TblInclusiveOrExpression_r2r, &TblConditionalAndExpression_sub1_r2r, &TblConditionalAndExpression_r2r, &TblConditionalOrExpression_sub1_r2r, &TblConditionalOrExpression_r2r, &TblUnannClassType_r2r, &TblUnannClassType_sub2_r2r, &TblUnannClassOrInterfaceType_r2r, &TblInterfaceType_r2r, &TblUnannInterfaceType_r2r};
+unsigned gRule2RecursionNum = 58;
+Rule2Recursion **gRule2Recursion = arrayRule2Recursion;
+///////////////////////////////////////////////////////////////
+//                       Ruel2Group                      //
+///////////////////////////////////////////////////////////////
+// Rule2Group mapping
+unsigned gRule2GroupNum = 58;
+int rule2group[547] = {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, 3, 3, -1, -1, 3, -1, -1, 15, -1, 15, 15, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 2, 2, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, 1, 1, 1, -1, -1, 1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, 1, -1, 1, -1, -1, -1, -1, -1, 4, 4, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, 5, 5, 5, 6, 6, 6, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
+int *gRule2Group = rule2group;
+///////////////////////////////////////////////////////////////
+//                       Group2Rule                      //
+///////////////////////////////////////////////////////////////
+RuleTable* RuleTableArray_0[] = {&TblPackageOrTypeName_sub1, &TblPackageOrTypeName, };
+RuleTable* RuleTableArray_1[] = {&TblPrimaryNoNewArray, &TblPrimaryNoNewArray_single, &TblClassInstanceCreationExpression, &TblClassInstanceCreationExpression_sub1, &TblPrimary, &TblFieldAccess, &TblFieldAccess_sub1, &TblMethodInvocation, &TblMethodInvocation_sub7, &TblMethodReference, &TblMethodReference_sub2, &TblArrayAccess, &TblArrayAccess_sub2, };
+RuleTable* RuleTableArray_2[] = {&TblAmbiguousName_sub1, &TblAmbiguousName, };
+RuleTable* RuleTableArray_3[] = {&TblClassType, &TblClassType_sub3, &TblClassOrInterfaceType, &TblInterfaceType, };
+RuleTable* RuleTableArray_4[] = {&TblPostIncrementExpression, &TblPostfixExpression, &TblPostDecrementExpression, };
+RuleTable* RuleTableArray_5[] = {&TblMultiplicativeExpression_sub1, &TblMultiplicativeExpression, &TblMultiplicativeExpression_sub2, &TblMultiplicativeExpression_sub3, };
+RuleTable* RuleTableArray_6[] = {&TblAdditiveExpression_sub1, &TblAdditiveExpression, &TblAdditiveExpression_sub2, };
+RuleTable* RuleTableArray_7[] = {&TblShiftExpression_sub1, &TblShiftExpression, &TblShiftExpression_sub2, &TblShiftExpression_sub3, };
+RuleTable* RuleTableArray_8[] = {&TblRelationalExpression_sub1, &TblRelationalExpression, &TblRelationalExpression_sub2, &TblRelationalExpression_sub3, &TblRelationalExpression_sub4, &TblRelationalExpression_sub5, };
+RuleTable* RuleTableArray_9[] = {&TblEqualityExpression_sub1, &TblEqualityExpression, &TblEqualityExpression_sub2, };
+RuleTable* RuleTableArray_10[] = {&TblAndExpression_sub1, &TblAndExpression, };
+RuleTable* RuleTableArray_11[] = {&TblExclusiveOrExpression_sub1, &TblExclusiveOrExpression, };
+RuleTable* RuleTableArray_12[] = {&TblInclusiveOrExpression_sub1, &TblInclusiveOrExpression, };
+RuleTable* RuleTableArray_13[] = {&TblConditionalAndExpression_sub1, &TblConditionalAndExpression, };
+RuleTable* RuleTableArray_14[] = {&TblConditionalOrExpression_sub1, &TblConditionalOrExpression, };
+RuleTable* RuleTableArray_15[] = {&TblUnannClassType, &TblUnannClassType_sub2, &TblUnannClassOrInterfaceType, &TblUnannInterfaceType, };
+Group2Rule ggroup2rule[16] = {
+{2, RuleTableArray_0},
+{13, RuleTableArray_1},
+{2, RuleTableArray_2},
+{4, RuleTableArray_3},
+{3, RuleTableArray_4},
+{4, RuleTableArray_5},
+{3, RuleTableArray_6},
+{4, RuleTableArray_7},
+{6, RuleTableArray_8},
+{3, RuleTableArray_9},
+{2, RuleTableArray_10},
+{2, RuleTableArray_11},
+{2, RuleTableArray_12},
+{2, RuleTableArray_13},
+{2, RuleTableArray_14},
+{4, RuleTableArray_15},
+};
+Group2Rule *gGroup2Rule = ggroup2rule;
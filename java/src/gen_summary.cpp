@@ -0,0 +1,564 @@
+#include "gen_summary.h"
+#include "common_header_autogen.h"
+RuleTableSummary gRuleTableSummarys[] = {
+{&TblCHAR, "TblCHAR", 0},
+{&TblDIGIT, "TblDIGIT", 1},
+{&TblASCII, "TblASCII", 2},
+{&TblESCAPE, "TblESCAPE", 3},
+{&TblESCAPE_sub1, "TblESCAPE_sub1", 4},
+{&TblESCAPE_sub2, "TblESCAPE_sub2", 5},
+{&TblESCAPE_sub3, "TblESCAPE_sub3", 6},
+{&TblESCAPE_sub4, "TblESCAPE_sub4", 7},
+{&TblESCAPE_sub5, "TblESCAPE_sub5", 8},
+{&TblESCAPE_sub6, "TblESCAPE_sub6", 9},
+{&TblESCAPE_sub7, "TblESCAPE_sub7", 10},
+{&TblESCAPE_sub8, "TblESCAPE_sub8", 11},
+{&TblJavaChar, "TblJavaChar", 12},
+{&TblCharOrDigit, "TblCharOrDigit", 13},
+{&TblIdentifier, "TblIdentifier", 14},
+{&TblIdentifier_sub1, "TblIdentifier_sub1", 15},
+{&TblNonZeroDigit, "TblNonZeroDigit", 16},
+{&TblUnderscores, "TblUnderscores", 17},
+{&TblUnderscores_sub1, "TblUnderscores_sub1", 18},
+{&TblDigit, "TblDigit", 19},
+{&TblDigitOrUnderscore, "TblDigitOrUnderscore", 20},
+{&TblDigitsAndUnderscores, "TblDigitsAndUnderscores", 21},
+{&TblDigitsAndUnderscores_sub1, "TblDigitsAndUnderscores_sub1", 22},
+{&TblDigits, "TblDigits", 23},
+{&TblDigits_sub1, "TblDigits_sub1", 24},
+{&TblDigits_sub2, "TblDigits_sub2", 25},
+{&TblDecimalNumeral, "TblDecimalNumeral", 26},
+{&TblDecimalNumeral_sub1, "TblDecimalNumeral_sub1", 27},
+{&TblDecimalNumeral_sub2, "TblDecimalNumeral_sub2", 28},
+{&TblDecimalNumeral_sub3, "TblDecimalNumeral_sub3", 29},
+{&TblHexDigit, "TblHexDigit", 30},
+{&TblHexDigitOrUnderscore, "TblHexDigitOrUnderscore", 31},
+{&TblHexDigitsAndUnderscores, "TblHexDigitsAndUnderscores", 32},
+{&TblHexDigitsAndUnderscores_sub1, "TblHexDigitsAndUnderscores_sub1", 33},
+{&TblHexDigits, "TblHexDigits", 34},
+{&TblHexDigits_sub1, "TblHexDigits_sub1", 35},
+{&TblHexDigits_sub2, "TblHexDigits_sub2", 36},
+{&TblHexNumeral, "TblHexNumeral", 37},
+{&TblHexNumeral_sub1, "TblHexNumeral_sub1", 38},
+{&TblHexNumeral_sub2, "TblHexNumeral_sub2", 39},
+{&TblOctalDigit, "TblOctalDigit", 40},
+{&TblOctalDigitOrUnderscore, "TblOctalDigitOrUnderscore", 41},
+{&TblOctalDigitsAndUnderscores, "TblOctalDigitsAndUnderscores", 42},
+{&TblOctalDigitsAndUnderscores_sub1, "TblOctalDigitsAndUnderscores_sub1", 43},
+{&TblOctalDigits, "TblOctalDigits", 44},
+{&TblOctalDigits_sub1, "TblOctalDigits_sub1", 45},
+{&TblOctalDigits_sub2, "TblOctalDigits_sub2", 46},
+{&TblOctalNumeral, "TblOctalNumeral", 47},
+{&TblOctalNumeral_sub1, "TblOctalNumeral_sub1", 48},
+{&TblOctalNumeral_sub2, "TblOctalNumeral_sub2", 49},
+{&TblBinDigit, "TblBinDigit", 50},
+{&TblBinDigitOrUnderscore, "TblBinDigitOrUnderscore", 51},
+{&TblBinDigitsAndUnderscores, "TblBinDigitsAndUnderscores", 52},
+{&TblBinDigitsAndUnderscores_sub1, "TblBinDigitsAndUnderscores_sub1", 53},
+{&TblBinDigits, "TblBinDigits", 54},
+{&TblBinDigits_sub1, "TblBinDigits_sub1", 55},
+{&TblBinDigits_sub2, "TblBinDigits_sub2", 56},
+{&TblBinNumeral, "TblBinNumeral", 57},
+{&TblBinNumeral_sub1, "TblBinNumeral_sub1", 58},
+{&TblBinNumeral_sub2, "TblBinNumeral_sub2", 59},
+{&TblIntegerTypeSuffix, "TblIntegerTypeSuffix", 60},
+{&TblDecimalIntegerLiteral, "TblDecimalIntegerLiteral", 61},
+{&TblDecimalIntegerLiteral_sub1, "TblDecimalIntegerLiteral_sub1", 62},
+{&TblHexIntegerLiteral, "TblHexIntegerLiteral", 63},
+{&TblHexIntegerLiteral_sub1, "TblHexIntegerLiteral_sub1", 64},
+{&TblOctalIntegerLiteral, "TblOctalIntegerLiteral", 65},
+{&TblOctalIntegerLiteral_sub1, "TblOctalIntegerLiteral_sub1", 66},
+{&TblBinaryIntegerLiteral, "TblBinaryIntegerLiteral", 67},
+{&TblBinaryIntegerLiteral_sub1, "TblBinaryIntegerLiteral_sub1", 68},
+{&TblIntegerLiteral, "TblIntegerLiteral", 69},
+{&TblSign, "TblSign", 70},
+{&TblFloatTypeSuffix, "TblFloatTypeSuffix", 71},
+{&TblExponentIndicator, "TblExponentIndicator", 72},
+{&TblSignedInteger, "TblSignedInteger", 73},
+{&TblSignedInteger_sub1, "TblSignedInteger_sub1", 74},
+{&TblExponentPart, "TblExponentPart", 75},
+{&TblDecFPLiteral, "TblDecFPLiteral", 76},
+{&TblDecFPLiteral_sub1, "TblDecFPLiteral_sub1", 77},
+{&TblDecFPLiteral_sub2, "TblDecFPLiteral_sub2", 78},
+{&TblDecFPLiteral_sub3, "TblDecFPLiteral_sub3", 79},
+{&TblDecFPLiteral_sub4, "TblDecFPLiteral_sub4", 80},
+{&TblDecFPLiteral_sub5, "TblDecFPLiteral_sub5", 81},
+{&TblDecFPLiteral_sub6, "TblDecFPLiteral_sub6", 82},
+{&TblDecFPLiteral_sub7, "TblDecFPLiteral_sub7", 83},
+{&TblDecFPLiteral_sub8, "TblDecFPLiteral_sub8", 84},
+{&TblDecFPLiteral_sub9, "TblDecFPLiteral_sub9", 85},
+{&TblDecFPLiteral_sub10, "TblDecFPLiteral_sub10", 86},
+{&TblDecFPLiteral_sub11, "TblDecFPLiteral_sub11", 87},
+{&TblBinaryExponentIndicator, "TblBinaryExponentIndicator", 88},
+{&TblBinaryExponent, "TblBinaryExponent", 89},
+{&TblHexSignificand, "TblHexSignificand", 90},
+{&TblHexSignificand_sub1, "TblHexSignificand_sub1", 91},
+{&TblHexSignificand_sub2, "TblHexSignificand_sub2", 92},
+{&TblHexSignificand_sub3, "TblHexSignificand_sub3", 93},
+{&TblHexSignificand_sub4, "TblHexSignificand_sub4", 94},
+{&TblHexSignificand_sub5, "TblHexSignificand_sub5", 95},
+{&TblHexSignificand_sub6, "TblHexSignificand_sub6", 96},
+{&TblHexFPLiteral, "TblHexFPLiteral", 97},
+{&TblHexFPLiteral_sub1, "TblHexFPLiteral_sub1", 98},
+{&TblFPLiteral, "TblFPLiteral", 99},
+{&TblBooleanLiteral, "TblBooleanLiteral", 100},
+{&TblOctalEscape, "TblOctalEscape", 101},
+{&TblOctalEscape_sub1, "TblOctalEscape_sub1", 102},
+{&TblOctalEscape_sub2, "TblOctalEscape_sub2", 103},
+{&TblEscapeSequence, "TblEscapeSequence", 104},
+{&TblCharacterLiteral, "TblCharacterLiteral", 105},
+{&TblCharacterLiteral_sub1, "TblCharacterLiteral_sub1", 106},
+{&TblStringChar, "TblStringChar", 107},
+{&TblStringLiteral, "TblStringLiteral", 108},
+{&TblStringLiteral_sub1, "TblStringLiteral_sub1", 109},
+{&TblNullLiteral, "TblNullLiteral", 110},
+{&TblLiteral, "TblLiteral", 111},
+{&TblBoolType, "TblBoolType", 112},
+{&TblIntType, "TblIntType", 113},
+{&TblFPType, "TblFPType", 114},
+{&TblNumericType, "TblNumericType", 115},
+{&TblPrimitiveType, "TblPrimitiveType", 116},
+{&TblPrimitiveType_sub1, "TblPrimitiveType_sub1", 117},
+{&TblPrimitiveType_sub2, "TblPrimitiveType_sub2", 118},
+{&TblPrimitiveType_sub3, "TblPrimitiveType_sub3", 119},
+{&TblNullType, "TblNullType", 120},
+{&TblWildcardBounds, "TblWildcardBounds", 121},
+{&TblWildcardBounds_sub1, "TblWildcardBounds_sub1", 122},
+{&TblWildcardBounds_sub2, "TblWildcardBounds_sub2", 123},
+{&TblWildcard, "TblWildcard", 124},
+{&TblWildcard_sub1, "TblWildcard_sub1", 125},
+{&TblTypeArgument, "TblTypeArgument", 126},
+{&TblTypeArgument_sub1, "TblTypeArgument_sub1", 127},
+{&TblTypeArgument_sub2, "TblTypeArgument_sub2", 128},
+{&TblTypeArgument_sub3, "TblTypeArgument_sub3", 129},
+{&TblTypeArgumentList, "TblTypeArgumentList", 130},
+{&TblTypeArgumentList_sub1, "TblTypeArgumentList_sub1", 131},
+{&TblTypeArgumentList_sub2, "TblTypeArgumentList_sub2", 132},
+{&TblTypeArguments, "TblTypeArguments", 133},
+{&TblClassType, "TblClassType", 134},
+{&TblClassType_sub1, "TblClassType_sub1", 135},
+{&TblClassType_sub2, "TblClassType_sub2", 136},
+{&TblClassType_sub3, "TblClassType_sub3", 137},
+{&TblInterfaceType, "TblInterfaceType", 138},
+{&TblTypeVariable, "TblTypeVariable", 139},
+{&TblArrayType, "TblArrayType", 140},
+{&TblClassOrInterfaceType, "TblClassOrInterfaceType", 141},
+{&TblReferenceType, "TblReferenceType", 142},
+{&TblTYPE, "TblTYPE", 143},
+{&TblUnannClassType, "TblUnannClassType", 144},
+{&TblUnannClassType_sub1, "TblUnannClassType_sub1", 145},
+{&TblUnannClassType_sub2, "TblUnannClassType_sub2", 146},
+{&TblUnannClassOrInterfaceType, "TblUnannClassOrInterfaceType", 147},
+{&TblUnannInterfaceType, "TblUnannInterfaceType", 148},
+{&TblUnannTypeVariable, "TblUnannTypeVariable", 149},
+{&TblUnannArrayType, "TblUnannArrayType", 150},
+{&TblUnannArrayType_sub1, "TblUnannArrayType_sub1", 151},
+{&TblUnannArrayType_sub2, "TblUnannArrayType_sub2", 152},
+{&TblUnannArrayType_sub3, "TblUnannArrayType_sub3", 153},
+{&TblUnannReferenceType, "TblUnannReferenceType", 154},
+{&TblUnannPrimitiveType, "TblUnannPrimitiveType", 155},
+{&TblUnannType, "TblUnannType", 156},
+{&TblClassDeclaration, "TblClassDeclaration", 157},
+{&TblNormalClassDeclaration, "TblNormalClassDeclaration", 158},
+{&TblNormalClassDeclaration_sub1, "TblNormalClassDeclaration_sub1", 159},
+{&TblNormalClassDeclaration_sub2, "TblNormalClassDeclaration_sub2", 160},
+{&TblNormalClassDeclaration_sub3, "TblNormalClassDeclaration_sub3", 161},
+{&TblNormalClassDeclaration_sub4, "TblNormalClassDeclaration_sub4", 162},
+{&TblClassAttr, "TblClassAttr", 163},
+{&TblClassModifier, "TblClassModifier", 164},
+{&TblTypeParameters, "TblTypeParameters", 165},
+{&TblTypeParameterList, "TblTypeParameterList", 166},
+{&TblTypeParameterList_sub1, "TblTypeParameterList_sub1", 167},
+{&TblTypeParameterList_sub2, "TblTypeParameterList_sub2", 168},
+{&TblTypeParameter, "TblTypeParameter", 169},
+{&TblTypeParameter_sub1, "TblTypeParameter_sub1", 170},
+{&TblTypeParameterModifier, "TblTypeParameterModifier", 171},
+{&TblTypeBound, "TblTypeBound", 172},
+{&TblTypeBound_sub1, "TblTypeBound_sub1", 173},
+{&TblTypeBound_sub2, "TblTypeBound_sub2", 174},
+{&TblTypeBound_sub3, "TblTypeBound_sub3", 175},
+{&TblAdditionalBound, "TblAdditionalBound", 176},
+{&TblSuperclass, "TblSuperclass", 177},
+{&TblSuperinterfaces, "TblSuperinterfaces", 178},
+{&TblInterfaceTypeList, "TblInterfaceTypeList", 179},
+{&TblInterfaceTypeList_sub1, "TblInterfaceTypeList_sub1", 180},
+{&TblInterfaceTypeList_sub2, "TblInterfaceTypeList_sub2", 181},
+{&TblClassBody, "TblClassBody", 182},
+{&TblClassBody_sub1, "TblClassBody_sub1", 183},
+{&TblClassBodyDeclaration, "TblClassBodyDeclaration", 184},
+{&TblInstanceInitializer, "TblInstanceInitializer", 185},
+{&TblStaticInitializer, "TblStaticInitializer", 186},
+{&TblClassMemberDeclaration, "TblClassMemberDeclaration", 187},
+{&TblFieldDeclaration, "TblFieldDeclaration", 188},
+{&TblFieldDeclaration_sub1, "TblFieldDeclaration_sub1", 189},
+{&TblMethodDeclaration, "TblMethodDeclaration", 190},
+{&TblMethodDeclaration_sub1, "TblMethodDeclaration_sub1", 191},
+{&TblMethodBody, "TblMethodBody", 192},
+{&TblMethodHeader, "TblMethodHeader", 193},
+{&TblMethodHeader_sub1, "TblMethodHeader_sub1", 194},
+{&TblMethodHeader_sub2, "TblMethodHeader_sub2", 195},
+{&TblMethodHeader_sub3, "TblMethodHeader_sub3", 196},
+{&TblResult, "TblResult", 197},
+{&TblMethodDeclarator, "TblMethodDeclarator", 198},
+{&TblMethodDeclarator_sub1, "TblMethodDeclarator_sub1", 199},
+{&TblMethodDeclarator_sub2, "TblMethodDeclarator_sub2", 200},
+{&TblThrows, "TblThrows", 201},
+{&TblExceptionTypeList, "TblExceptionTypeList", 202},
+{&TblExceptionTypeList_sub1, "TblExceptionTypeList_sub1", 203},
+{&TblExceptionTypeList_sub2, "TblExceptionTypeList_sub2", 204},
+{&TblExceptionType, "TblExceptionType", 205},
+{&TblMethodAttr, "TblMethodAttr", 206},
+{&TblMethodModifier, "TblMethodModifier", 207},
+{&TblFormalParameterListNoReceiver, "TblFormalParameterListNoReceiver", 208},
+{&TblFormalParameterListNoReceiver_sub1, "TblFormalParameterListNoReceiver_sub1", 209},
+{&TblFormalParameterList, "TblFormalParameterList", 210},
+{&TblFormalParameters, "TblFormalParameters", 211},
+{&TblFormalParameters_sub1, "TblFormalParameters_sub1", 212},
+{&TblFormalParameters_sub2, "TblFormalParameters_sub2", 213},
+{&TblFormalParameters_sub3, "TblFormalParameters_sub3", 214},
+{&TblFormalParameters_sub4, "TblFormalParameters_sub4", 215},
+{&TblFormalParameter, "TblFormalParameter", 216},
+{&TblFormalParameter_sub1, "TblFormalParameter_sub1", 217},
+{&TblReceiverParameter, "TblReceiverParameter", 218},
+{&TblReceiverParameter_sub1, "TblReceiverParameter_sub1", 219},
+{&TblReceiverParameter_sub2, "TblReceiverParameter_sub2", 220},
+{&TblLastFormalParameter, "TblLastFormalParameter", 221},
+{&TblLastFormalParameter_sub1, "TblLastFormalParameter_sub1", 222},
+{&TblFieldAttr, "TblFieldAttr", 223},
+{&TblFieldModifier, "TblFieldModifier", 224},
+{&TblConstructorDeclaration, "TblConstructorDeclaration", 225},
+{&TblConstructorDeclaration_sub1, "TblConstructorDeclaration_sub1", 226},
+{&TblConstructorAttr, "TblConstructorAttr", 227},
+{&TblConstructorModifier, "TblConstructorModifier", 228},
+{&TblConstructorDeclarator, "TblConstructorDeclarator", 229},
+{&TblSimpleTypeName, "TblSimpleTypeName", 230},
+{&TblConstructorBody, "TblConstructorBody", 231},
+{&TblConstructorBody_sub1, "TblConstructorBody_sub1", 232},
+{&TblConstructorBody_sub2, "TblConstructorBody_sub2", 233},
+{&TblExplicitConstructorInvocation, "TblExplicitConstructorInvocation", 234},
+{&TblExplicitConstructorInvocation_sub1, "TblExplicitConstructorInvocation_sub1", 235},
+{&TblExplicitConstructorInvocation_sub2, "TblExplicitConstructorInvocation_sub2", 236},
+{&TblExplicitConstructorInvocation_sub3, "TblExplicitConstructorInvocation_sub3", 237},
+{&TblExplicitConstructorInvocation_sub4, "TblExplicitConstructorInvocation_sub4", 238},
+{&TblExplicitConstructorInvocation_sub5, "TblExplicitConstructorInvocation_sub5", 239},
+{&TblEnumDeclaration, "TblEnumDeclaration", 240},
+{&TblEnumBody, "TblEnumBody", 241},
+{&TblEnumBody_sub1, "TblEnumBody_sub1", 242},
+{&TblEnumBody_sub2, "TblEnumBody_sub2", 243},
+{&TblEnumBody_sub3, "TblEnumBody_sub3", 244},
+{&TblEnumConstantList, "TblEnumConstantList", 245},
+{&TblEnumConstantList_sub1, "TblEnumConstantList_sub1", 246},
+{&TblEnumConstantList_sub2, "TblEnumConstantList_sub2", 247},
+{&TblEnumConstant, "TblEnumConstant", 248},
+{&TblEnumConstant_sub1, "TblEnumConstant_sub1", 249},
+{&TblEnumConstant_sub2, "TblEnumConstant_sub2", 250},
+{&TblEnumConstant_sub3, "TblEnumConstant_sub3", 251},
+{&TblEnumConstantModifier, "TblEnumConstantModifier", 252},
+{&TblEnumBodyDeclarations, "TblEnumBodyDeclarations", 253},
+{&TblBlockStatement, "TblBlockStatement", 254},
+{&TblBlockStatements, "TblBlockStatements", 255},
+{&TblBlockStatements_sub1, "TblBlockStatements_sub1", 256},
+{&TblBlock, "TblBlock", 257},
+{&TblBlock_sub1, "TblBlock_sub1", 258},
+{&TblInterfaceDeclaration, "TblInterfaceDeclaration", 259},
+{&TblNormalInterfaceDeclaration, "TblNormalInterfaceDeclaration", 260},
+{&TblNormalInterfaceDeclaration_sub1, "TblNormalInterfaceDeclaration_sub1", 261},
+{&TblNormalInterfaceDeclaration_sub2, "TblNormalInterfaceDeclaration_sub2", 262},
+{&TblInterfaceAttr, "TblInterfaceAttr", 263},
+{&TblInterfaceModifier, "TblInterfaceModifier", 264},
+{&TblExtendsInterfaces, "TblExtendsInterfaces", 265},
+{&TblInterfaceBody, "TblInterfaceBody", 266},
+{&TblInterfaceBody_sub1, "TblInterfaceBody_sub1", 267},
+{&TblInterfaceMemberDeclaration, "TblInterfaceMemberDeclaration", 268},
+{&TblConstantDeclaration, "TblConstantDeclaration", 269},
+{&TblConstantDeclaration_sub1, "TblConstantDeclaration_sub1", 270},
+{&TblConstantAttr, "TblConstantAttr", 271},
+{&TblConstantModifier, "TblConstantModifier", 272},
+{&TblInterfaceMethodDeclaration, "TblInterfaceMethodDeclaration", 273},
+{&TblInterfaceMethodDeclaration_sub1, "TblInterfaceMethodDeclaration_sub1", 274},
+{&TblInterfaceMethodAttr, "TblInterfaceMethodAttr", 275},
+{&TblInterfaceMethodModifier, "TblInterfaceMethodModifier", 276},
+{&TblAnnotationTypeDeclaration, "TblAnnotationTypeDeclaration", 277},
+{&TblAnnotationTypeBody, "TblAnnotationTypeBody", 278},
+{&TblAnnotationTypeBody_sub1, "TblAnnotationTypeBody_sub1", 279},
+{&TblAnnotationTypeMemberDeclaration, "TblAnnotationTypeMemberDeclaration", 280},
+{&TblAnnotationTypeElementDeclaration, "TblAnnotationTypeElementDeclaration", 281},
+{&TblAnnotationTypeElementDeclaration_sub1, "TblAnnotationTypeElementDeclaration_sub1", 282},
+{&TblAnnotationTypeElementDeclaration_sub2, "TblAnnotationTypeElementDeclaration_sub2", 283},
+{&TblAnnotationTypeElementAttr, "TblAnnotationTypeElementAttr", 284},
+{&TblAnnotationTypeElementModifier, "TblAnnotationTypeElementModifier", 285},
+{&TblDefaultValue, "TblDefaultValue", 286},
+{&TblAnnotation, "TblAnnotation", 287},
+{&TblNormalAnnotation, "TblNormalAnnotation", 288},
+{&TblNormalAnnotation_sub1, "TblNormalAnnotation_sub1", 289},
+{&TblMarkerAnnotation, "TblMarkerAnnotation", 290},
+{&TblSingleElementAnnotation, "TblSingleElementAnnotation", 291},
+{&TblElementValuePairList, "TblElementValuePairList", 292},
+{&TblElementValuePairList_sub1, "TblElementValuePairList_sub1", 293},
+{&TblElementValuePairList_sub2, "TblElementValuePairList_sub2", 294},
+{&TblElementValuePair, "TblElementValuePair", 295},
+{&TblElementValue, "TblElementValue", 296},
+{&TblElementValue_sub1, "TblElementValue_sub1", 297},
+{&TblElementValue_sub2, "TblElementValue_sub2", 298},
+{&TblElementValueArrayInitializer, "TblElementValueArrayInitializer", 299},
+{&TblElementValueArrayInitializer_sub1, "TblElementValueArrayInitializer_sub1", 300},
+{&TblElementValueList, "TblElementValueList", 301},
+{&TblElementValueList_sub1, "TblElementValueList_sub1", 302},
+{&TblElementValueList_sub2, "TblElementValueList_sub2", 303},
+{&TblPackageModifier, "TblPackageModifier", 304},
+{&TblPackageDeclaration, "TblPackageDeclaration", 305},
+{&TblPackageDeclaration_sub1, "TblPackageDeclaration_sub1", 306},
+{&TblPackageDeclaration_sub2, "TblPackageDeclaration_sub2", 307},
+{&TblImportDeclaration, "TblImportDeclaration", 308},
+{&TblSingleTypeImportDeclaration, "TblSingleTypeImportDeclaration", 309},
+{&TblTypeImportOnDemandDeclaration, "TblTypeImportOnDemandDeclaration", 310},
+{&TblSingleStaticImportDeclaration, "TblSingleStaticImportDeclaration", 311},
+{&TblStaticImportOnDemandDeclaration, "TblStaticImportOnDemandDeclaration", 312},
+{&TblPackageName, "TblPackageName", 313},
+{&TblPackageName_sub1, "TblPackageName_sub1", 314},
+{&TblTypeName, "TblTypeName", 315},
+{&TblTypeName_sub1, "TblTypeName_sub1", 316},
+{&TblPackageOrTypeName, "TblPackageOrTypeName", 317},
+{&TblPackageOrTypeName_sub1, "TblPackageOrTypeName_sub1", 318},
+{&TblExpressionName, "TblExpressionName", 319},
+{&TblExpressionName_sub1, "TblExpressionName_sub1", 320},
+{&TblMethodName, "TblMethodName", 321},
+{&TblAmbiguousName, "TblAmbiguousName", 322},
+{&TblAmbiguousName_sub1, "TblAmbiguousName_sub1", 323},
+{&TblClass, "TblClass", 324},
+{&TblClassLiteral, "TblClassLiteral", 325},
+{&TblClassLiteral_sub1, "TblClassLiteral_sub1", 326},
+{&TblClassLiteral_sub2, "TblClassLiteral_sub2", 327},
+{&TblClassLiteral_sub3, "TblClassLiteral_sub3", 328},
+{&TblClassLiteral_sub4, "TblClassLiteral_sub4", 329},
+{&TblClassLiteral_sub5, "TblClassLiteral_sub5", 330},
+{&TblClassLiteral_sub6, "TblClassLiteral_sub6", 331},
+{&TblPrimaryNoNewArray_single, "TblPrimaryNoNewArray_single", 332},
+{&TblPrimaryNoNewArray_single_sub1, "TblPrimaryNoNewArray_single_sub1", 333},
+{&TblPrimaryNoNewArray_single_sub2, "TblPrimaryNoNewArray_single_sub2", 334},
+{&TblPrimaryNoNewArray, "TblPrimaryNoNewArray", 335},
+{&TblClassInstanceCreationExpression, "TblClassInstanceCreationExpression", 336},
+{&TblClassInstanceCreationExpression_sub1, "TblClassInstanceCreationExpression_sub1", 337},
+{&TblUnqualifiedClassInstanceCreationExpression, "TblUnqualifiedClassInstanceCreationExpression", 338},
+{&TblUnqualifiedClassInstanceCreationExpression_sub1, "TblUnqualifiedClassInstanceCreationExpression_sub1", 339},
+{&TblClassOrInterfaceTypeToInstantiate, "TblClassOrInterfaceTypeToInstantiate", 340},
+{&TblClassOrInterfaceTypeToInstantiate_sub1, "TblClassOrInterfaceTypeToInstantiate_sub1", 341},
+{&TblClassOrInterfaceTypeToInstantiate_sub2, "TblClassOrInterfaceTypeToInstantiate_sub2", 342},
+{&TblClassOrInterfaceTypeToInstantiate_sub3, "TblClassOrInterfaceTypeToInstantiate_sub3", 343},
+{&TblTypeArgumentsOrDiamond, "TblTypeArgumentsOrDiamond", 344},
+{&TblArgumentList, "TblArgumentList", 345},
+{&TblArgumentList_sub1, "TblArgumentList_sub1", 346},
+{&TblArgumentList_sub2, "TblArgumentList_sub2", 347},
+{&TblArrayInitializer, "TblArrayInitializer", 348},
+{&TblArrayInitializer_sub1, "TblArrayInitializer_sub1", 349},
+{&TblArrayCreationExpression, "TblArrayCreationExpression", 350},
+{&TblArrayCreationExpression_sub1, "TblArrayCreationExpression_sub1", 351},
+{&TblArrayCreationExpression_sub2, "TblArrayCreationExpression_sub2", 352},
+{&TblArrayCreationExpression_sub3, "TblArrayCreationExpression_sub3", 353},
+{&TblArrayCreationExpression_sub4, "TblArrayCreationExpression_sub4", 354},
+{&TblDimExprs, "TblDimExprs", 355},
+{&TblDimExprs_sub1, "TblDimExprs_sub1", 356},
+{&TblDimExpr, "TblDimExpr", 357},
+{&TblArrayAccess, "TblArrayAccess", 358},
+{&TblArrayAccess_sub1, "TblArrayAccess_sub1", 359},
+{&TblArrayAccess_sub2, "TblArrayAccess_sub2", 360},
+{&TblFieldAccess, "TblFieldAccess", 361},
+{&TblFieldAccess_sub1, "TblFieldAccess_sub1", 362},
+{&TblFieldAccess_sub2, "TblFieldAccess_sub2", 363},
+{&TblFieldAccess_sub3, "TblFieldAccess_sub3", 364},
+{&TblMethodInvocation, "TblMethodInvocation", 365},
+{&TblMethodInvocation_sub1, "TblMethodInvocation_sub1", 366},
+{&TblMethodInvocation_sub2, "TblMethodInvocation_sub2", 367},
+{&TblMethodInvocation_sub3, "TblMethodInvocation_sub3", 368},
+{&TblMethodInvocation_sub4, "TblMethodInvocation_sub4", 369},
+{&TblMethodInvocation_sub5, "TblMethodInvocation_sub5", 370},
+{&TblMethodInvocation_sub6, "TblMethodInvocation_sub6", 371},
+{&TblMethodInvocation_sub7, "TblMethodInvocation_sub7", 372},
+{&TblMethodInvocation_sub8, "TblMethodInvocation_sub8", 373},
+{&TblMethodInvocation_sub9, "TblMethodInvocation_sub9", 374},
+{&TblMethodInvocation_sub10, "TblMethodInvocation_sub10", 375},
+{&TblMethodInvocation_sub11, "TblMethodInvocation_sub11", 376},
+{&TblMethodInvocation_sub12, "TblMethodInvocation_sub12", 377},
+{&TblMethodReference, "TblMethodReference", 378},
+{&TblMethodReference_sub1, "TblMethodReference_sub1", 379},
+{&TblMethodReference_sub2, "TblMethodReference_sub2", 380},
+{&TblMethodReference_sub3, "TblMethodReference_sub3", 381},
+{&TblMethodReference_sub4, "TblMethodReference_sub4", 382},
+{&TblMethodReference_sub5, "TblMethodReference_sub5", 383},
+{&TblMethodReference_sub6, "TblMethodReference_sub6", 384},
+{&TblMethodReference_sub7, "TblMethodReference_sub7", 385},
+{&TblPostfixExpression, "TblPostfixExpression", 386},
+{&TblPostIncrementExpression, "TblPostIncrementExpression", 387},
+{&TblPostDecrementExpression, "TblPostDecrementExpression", 388},
+{&TblUnaryExpression, "TblUnaryExpression", 389},
+{&TblUnaryExpression_sub1, "TblUnaryExpression_sub1", 390},
+{&TblUnaryExpression_sub2, "TblUnaryExpression_sub2", 391},
+{&TblUnaryExpression_sub3, "TblUnaryExpression_sub3", 392},
+{&TblUnaryExpression_sub4, "TblUnaryExpression_sub4", 393},
+{&TblUnaryExpression_sub5, "TblUnaryExpression_sub5", 394},
+{&TblUnaryExpression_sub6, "TblUnaryExpression_sub6", 395},
+{&TblUnaryExpression_sub7, "TblUnaryExpression_sub7", 396},
+{&TblUnaryExpression_sub8, "TblUnaryExpression_sub8", 397},
+{&TblUnaryExpression_sub9, "TblUnaryExpression_sub9", 398},
+{&TblPreIncrementExpression, "TblPreIncrementExpression", 399},
+{&TblPreDecrementExpression, "TblPreDecrementExpression", 400},
+{&TblUnaryExpressionNotPlusMinus, "TblUnaryExpressionNotPlusMinus", 401},
+{&TblCastExpression, "TblCastExpression", 402},
+{&TblMultiplicativeExpression, "TblMultiplicativeExpression", 403},
+{&TblMultiplicativeExpression_sub1, "TblMultiplicativeExpression_sub1", 404},
+{&TblMultiplicativeExpression_sub2, "TblMultiplicativeExpression_sub2", 405},
+{&TblMultiplicativeExpression_sub3, "TblMultiplicativeExpression_sub3", 406},
+{&TblAdditiveExpression, "TblAdditiveExpression", 407},
+{&TblAdditiveExpression_sub1, "TblAdditiveExpression_sub1", 408},
+{&TblAdditiveExpression_sub2, "TblAdditiveExpression_sub2", 409},
+{&TblShiftExpression, "TblShiftExpression", 410},
+{&TblShiftExpression_sub1, "TblShiftExpression_sub1", 411},
+{&TblShiftExpression_sub2, "TblShiftExpression_sub2", 412},
+{&TblShiftExpression_sub3, "TblShiftExpression_sub3", 413},
+{&TblRelationalExpression, "TblRelationalExpression", 414},
+{&TblRelationalExpression_sub1, "TblRelationalExpression_sub1", 415},
+{&TblRelationalExpression_sub2, "TblRelationalExpression_sub2", 416},
+{&TblRelationalExpression_sub3, "TblRelationalExpression_sub3", 417},
+{&TblRelationalExpression_sub4, "TblRelationalExpression_sub4", 418},
+{&TblRelationalExpression_sub5, "TblRelationalExpression_sub5", 419},
+{&TblEqualityExpression, "TblEqualityExpression", 420},
+{&TblEqualityExpression_sub1, "TblEqualityExpression_sub1", 421},
+{&TblEqualityExpression_sub2, "TblEqualityExpression_sub2", 422},
+{&TblAndExpression, "TblAndExpression", 423},
+{&TblAndExpression_sub1, "TblAndExpression_sub1", 424},
+{&TblExclusiveOrExpression, "TblExclusiveOrExpression", 425},
+{&TblExclusiveOrExpression_sub1, "TblExclusiveOrExpression_sub1", 426},
+{&TblInclusiveOrExpression, "TblInclusiveOrExpression", 427},
+{&TblInclusiveOrExpression_sub1, "TblInclusiveOrExpression_sub1", 428},
+{&TblConditionalAndExpression, "TblConditionalAndExpression", 429},
+{&TblConditionalAndExpression_sub1, "TblConditionalAndExpression_sub1", 430},
+{&TblConditionalOrExpression, "TblConditionalOrExpression", 431},
+{&TblConditionalOrExpression_sub1, "TblConditionalOrExpression_sub1", 432},
+{&TblConditionalExpression, "TblConditionalExpression", 433},
+{&TblAssignmentExpression, "TblAssignmentExpression", 434},
+{&TblAssignment, "TblAssignment", 435},
+{&TblLeftHandSide, "TblLeftHandSide", 436},
+{&TblAssignmentOperator, "TblAssignmentOperator", 437},
+{&TblLambdaExpression, "TblLambdaExpression", 438},
+{&TblLambdaParameters, "TblLambdaParameters", 439},
+{&TblLambdaParameters_sub1, "TblLambdaParameters_sub1", 440},
+{&TblLambdaParameters_sub2, "TblLambdaParameters_sub2", 441},
+{&TblLambdaParameterList, "TblLambdaParameterList", 442},
+{&TblLambdaParameterList_sub1, "TblLambdaParameterList_sub1", 443},
+{&TblLambdaParameterList_sub2, "TblLambdaParameterList_sub2", 444},
+{&TblLambdaParameterList_sub3, "TblLambdaParameterList_sub3", 445},
+{&TblLambdaParameterList_sub4, "TblLambdaParameterList_sub4", 446},
+{&TblLambdaParameterList_sub5, "TblLambdaParameterList_sub5", 447},
+{&TblLambdaParameterList_sub6, "TblLambdaParameterList_sub6", 448},
+{&TblLambdaParameter, "TblLambdaParameter", 449},
+{&TblLambdaParameter_sub1, "TblLambdaParameter_sub1", 450},
+{&TblLambdaParameterType, "TblLambdaParameterType", 451},
+{&TblVariableArityParameter, "TblVariableArityParameter", 452},
+{&TblLambdaBody, "TblLambdaBody", 453},
+{&TblConstantExpression, "TblConstantExpression", 454},
+{&TblPrimary, "TblPrimary", 455},
+{&TblExpression, "TblExpression", 456},
+{&TblBinaryExpression, "TblBinaryExpression", 457},
+{&TblLocalVariableDeclarationStatement, "TblLocalVariableDeclarationStatement", 458},
+{&TblLocalVariableDeclaration, "TblLocalVariableDeclaration", 459},
+{&TblVariableModifier, "TblVariableModifier", 460},
+{&TblVariableDeclaratorList, "TblVariableDeclaratorList", 461},
+{&TblVariableDeclaratorList_sub1, "TblVariableDeclaratorList_sub1", 462},
+{&TblVariableDeclaratorList_sub2, "TblVariableDeclaratorList_sub2", 463},
+{&TblVariableDeclarator, "TblVariableDeclarator", 464},
+{&TblVariableDeclarator_sub1, "TblVariableDeclarator_sub1", 465},
+{&TblVariableDeclarator_sub2, "TblVariableDeclarator_sub2", 466},
+{&TblVariableDeclaratorId, "TblVariableDeclaratorId", 467},
+{&TblDims, "TblDims", 468},
+{&TblDims_sub1, "TblDims_sub1", 469},
+{&TblDim, "TblDim", 470},
+{&TblVariableInitializer, "TblVariableInitializer", 471},
+{&TblVariableInitializerList, "TblVariableInitializerList", 472},
+{&TblVariableInitializerList_sub1, "TblVariableInitializerList_sub1", 473},
+{&TblVariableInitializerList_sub2, "TblVariableInitializerList_sub2", 474},
+{&TblStatement, "TblStatement", 475},
+{&TblStatementNoShortIf, "TblStatementNoShortIf", 476},
+{&TblStatementWithoutTrailingSubstatement, "TblStatementWithoutTrailingSubstatement", 477},
+{&TblIfThenStatement, "TblIfThenStatement", 478},
+{&TblIfThenElseStatement, "TblIfThenElseStatement", 479},
+{&TblIfThenElseStatementNoShortIf, "TblIfThenElseStatementNoShortIf", 480},
+{&TblEmptyStatement, "TblEmptyStatement", 481},
+{&TblLabeledStatement, "TblLabeledStatement", 482},
+{&TblLabeledStatementNoShortIf, "TblLabeledStatementNoShortIf", 483},
+{&TblExpressionStatement, "TblExpressionStatement", 484},
+{&TblStatementExpression, "TblStatementExpression", 485},
+{&TblAssertStatement, "TblAssertStatement", 486},
+{&TblAssertStatement_sub1, "TblAssertStatement_sub1", 487},
+{&TblAssertStatement_sub2, "TblAssertStatement_sub2", 488},
+{&TblSwitchStatement, "TblSwitchStatement", 489},
+{&TblSwitchBlock, "TblSwitchBlock", 490},
+{&TblSwitchBlock_sub1, "TblSwitchBlock_sub1", 491},
+{&TblSwitchBlock_sub2, "TblSwitchBlock_sub2", 492},
+{&TblSwitchBlock_sub3, "TblSwitchBlock_sub3", 493},
+{&TblSwitchBlock_sub4, "TblSwitchBlock_sub4", 494},
+{&TblSwitchBlockStatementGroup, "TblSwitchBlockStatementGroup", 495},
+{&TblSwitchLabels, "TblSwitchLabels", 496},
+{&TblSwitchLabel, "TblSwitchLabel", 497},
+{&TblSwitchLabel_sub1, "TblSwitchLabel_sub1", 498},
+{&TblSwitchLabel_sub2, "TblSwitchLabel_sub2", 499},
+{&TblSwitchLabel_sub3, "TblSwitchLabel_sub3", 500},
+{&TblEnumConstantName, "TblEnumConstantName", 501},
+{&TblWhileStatement, "TblWhileStatement", 502},
+{&TblWhileStatementNoShortIf, "TblWhileStatementNoShortIf", 503},
+{&TblDoStatement, "TblDoStatement", 504},
+{&TblForStatement, "TblForStatement", 505},
+{&TblForStatementNoShortIf, "TblForStatementNoShortIf", 506},
+{&TblBasicForStatement, "TblBasicForStatement", 507},
+{&TblBasicForStatement_sub1, "TblBasicForStatement_sub1", 508},
+{&TblBasicForStatement_sub2, "TblBasicForStatement_sub2", 509},
+{&TblBasicForStatement_sub3, "TblBasicForStatement_sub3", 510},
+{&TblBasicForStatementNoShortIf, "TblBasicForStatementNoShortIf", 511},
+{&TblForInit, "TblForInit", 512},
+{&TblForUpdate, "TblForUpdate", 513},
+{&TblStatementExpressionList, "TblStatementExpressionList", 514},
+{&TblStatementExpressionList_sub1, "TblStatementExpressionList_sub1", 515},
+{&TblStatementExpressionList_sub2, "TblStatementExpressionList_sub2", 516},
+{&TblEnhancedForStatement, "TblEnhancedForStatement", 517},
+{&TblEnhancedForStatementNoShortIf, "TblEnhancedForStatementNoShortIf", 518},
+{&TblBreakStatement, "TblBreakStatement", 519},
+{&TblBreakStatement_sub1, "TblBreakStatement_sub1", 520},
+{&TblContinueStatement, "TblContinueStatement", 521},
+{&TblReturnStatement, "TblReturnStatement", 522},
+{&TblThrowStatement, "TblThrowStatement", 523},
+{&TblSynchronizedStatement, "TblSynchronizedStatement", 524},
+{&TblTryStatement, "TblTryStatement", 525},
+{&TblTryStatement_sub1, "TblTryStatement_sub1", 526},
+{&TblTryStatement_sub2, "TblTryStatement_sub2", 527},
+{&TblTryStatement_sub3, "TblTryStatement_sub3", 528},
+{&TblCatches, "TblCatches", 529},
+{&TblCatches_sub1, "TblCatches_sub1", 530},
+{&TblCatchClause, "TblCatchClause", 531},
+{&TblCatchFormalParameter, "TblCatchFormalParameter", 532},
+{&TblCatchType, "TblCatchType", 533},
+{&TblCatchType_sub1, "TblCatchType_sub1", 534},
+{&TblCatchType_sub2, "TblCatchType_sub2", 535},
+{&TblFinally, "TblFinally", 536},
+{&TblTryWithResourcesStatement, "TblTryWithResourcesStatement", 537},
+{&TblTryWithResourcesStatement_sub1, "TblTryWithResourcesStatement_sub1", 538},
+{&TblResourceSpecification, "TblResourceSpecification", 539},
+{&TblResourceSpecification_sub1, "TblResourceSpecification_sub1", 540},
+{&TblResourceList, "TblResourceList", 541},
+{&TblResourceList_sub1, "TblResourceList_sub1", 542},
+{&TblResourceList_sub2, "TblResourceList_sub2", 543},
+{&TblResource, "TblResource", 544},
+{&TblResource_sub1, "TblResource_sub1", 545},
+{&TblVariableAccess, "TblVariableAccess", 546},
+};
+unsigned RuleTableNum = 547;
+const char* GetRuleTableName(const RuleTable* addr) {
+  for (unsigned i = 0; i < RuleTableNum; i++) {
+    RuleTableSummary summary = gRuleTableSummarys[i];
+    if (summary.mAddr == addr)
+      return summary.mName;
+  }
+  return NULL;
+}
+thread_local std::unordered_set<unsigned> gFailed[547];
+thread_local SuccMatch gSucc[547];
+unsigned gTopRulesNum = 4;
+RuleTable* gTopRules[4] = {&TblClassDeclaration,&TblInterfaceDeclaration,&TblPackageDeclaration,&TblImportDeclaration};
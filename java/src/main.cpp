@@ -13,73 +13,721 @@
 * See the Mulan PSL v2 for more details.
 */
 #include "parser.h"
+#include "parse_observer.h"
+#include "rule_profiler.h"
+#include "timeline.h"
+#include "mem_stats.h"
 #include "token.h"
 #include "common_header_autogen.h"
 #include "ruletable_util.h"
 #include "gen_summary.h"
 #include "vfy_java.h"
+#include "thread_out.h"
+#include "work_pool.h"
+#include "parse_cache.h"
+#include "ast_binary.h"
+#include "parse_server.h"
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <algorithm>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 static void help() {
   std::cout << "java2mpl sourcefile [options]:\n" << std::endl;
+  std::cout << "java2mpl - [options] : parse the source from stdin as it arrives\n" << std::endl;
+  std::cout << "java2mpl --batch [--jobs=N] file|dir|@listfile ... [options]:\n" << std::endl;
+  std::cout << "java2mpl --read-ast file.mast [--raw] : dump the module of a binary AST file," << std::endl;
+  std::cout << "                       or its records with --raw\n" << std::endl;
+  std::cout << "java2mpl --server [--socket=PATH] [--jobs=N] [--queue=N] [--budget-*=N] : serve parse requests" << std::endl;
+  std::cout << "                       on stdin/stdout, or on the Unix domain socket PATH." << std::endl;
+  std::cout << "                       At most N requests are queued, default is 64." << std::endl;
+  std::cout << "                       See shared/include/parse_server.h for the protocol\n" << std::endl;
   std::cout << "   --help            : print this help" << std::endl;
+  std::cout << "   --batch           : Parse multiple files in parallel. Directories are searched" << std::endl;
+  std::cout << "                       for .java files, @listfile contains one path per line" << std::endl;
+  std::cout << "   --jobs=N          : Number of worker threads. In batch mode, files are parsed" << std::endl;
+  std::cout << "                       in parallel, default is the number of hardware threads." << std::endl;
+  std::cout << "                       Otherwise, top level constructs of the file are parsed in" << std::endl;
+  std::cout << "                       parallel if N > 1, default is 1." << std::endl;
+  std::cout << "   --parallel-lex    : Lex the file in parallel as well. It works with --jobs=N" << std::endl;
+  std::cout << "                       in single file mode" << std::endl;
+  std::cout << "   --lex-thread      : Lex in a separate thread, overlapping with parsing." << std::endl;
+  std::cout << "                       It's ignored with --trace-lexer" << std::endl;
+  std::cout << "   --validate        : Only tell if the file is legal, without building the AST" << std::endl;
+  std::cout << "   --lazy-bodies     : Skip the statements of method bodies and initializers. They" << std::endl;
+  std::cout << "                       are parsed when asked for by FunctionNode::ParseBody()" << std::endl;
+  std::cout << "   --cache-dir=DIR   : Cache parsing results in DIR. A file whose content and grammar" << std::endl;
+  std::cout << "                       are unchanged is not parsed again. It's ignored with --trace-*" << std::endl;
+  std::cout << "                       and with --validate or --lazy-bodies" << std::endl;
+  std::cout << "   --cache-size=MB   : Size limit of the cache directory, default is 256" << std::endl;
+  std::cout << "   --emit-ast=FILE   : Write the AST in binary format to FILE" << std::endl;
+  std::cout << "   --reparse=FILE    : Parse sourcefile, then reparse it incrementally as if it" << std::endl;
+  std::cout << "                       were edited to the content of FILE" << std::endl;
+  std::cout << "   --timeline[=FILE] : Time the phases of parsing. The spans are written to FILE" << std::endl;
+  std::cout << "                       in Chrome trace event format, for chrome://tracing or Perfetto" << std::endl;
+  std::cout << "   --mem-stats       : Report the memory of the pools per subsystem at the end" << std::endl;
+  std::cout << "   --budget-nodes=N  : A top level construct creating more than N AppealNodes is" << std::endl;
+  std::cout << "                       reported as illegal, with the rule and token where it stops" << std::endl;
+  std::cout << "   --budget-waves=N  : The same for the waves of left recursion traversals" << std::endl;
+  std::cout << "   --budget-matches=N: The same for the matchings of a rule at a token. It's at" << std::endl;
+  std::cout << "                       most 256, which is always checked" << std::endl;
+  std::cout << "   --budget-ms=N     : The same for the wall time of a top level construct. The" << std::endl;
+  std::cout << "                       others bound the time roughly, only this one strictly." << std::endl;
+  std::cout << "                       The cache is ignored with any budget" << std::endl;
+  std::cout << "   --interpret       : Interpret all the rule tables, none of the compiled ones." << std::endl;
+  std::cout << "                       Nor is the lookahead of a subtable checked before it" << std::endl;
+  std::cout << "   --all-matches     : Keep all the matchings of every rule table, ignoring the" << std::endl;
+  std::cout << "                       single match flags of ladetect" << std::endl;
+  std::cout << "   --profile-rules[=FILE] : Report the cost of each rule table. The full data is" << std::endl;
+  std::cout << "                       written to FILE, in JSON if it ends with .json, or CSV." << std::endl;
+  std::cout << "                       It's ignored with --trace-*" << std::endl;
   std::cout << "   --trace-lexer     : Trace lexing" << std::endl;
   std::cout << "   --trace-table     : Trace rule table when entering and exiting" << std::endl;
   std::cout << "   --trace-left-rec  : Trace left recursion parsing" << std::endl;
   std::cout << "   --trace-appeal    : Trace appeal process" << std::endl;
   std::cout << "   --trace-failed    : Trace failed tokens of table" << std::endl;
   std::cout << "   --trace-timing    : Trace parsing time" << std::endl;
-  std::cout << "   --trace-stack     : Trace visited-token stack of table" << std::endl;
+  std::cout << "   --trace-stack     : Trace the lookups of succ/failed tokens of table" << std::endl;
   std::cout << "   --trace-sortout   : Trace SortOut" << std::endl;
   std::cout << "   --trace-ast-build : Trace AST Builder" << std::endl;
   std::cout << "   --trace-patch-was-succ : Trace Patching of WasSucc nodes" << std::endl;
   std::cout << "   --trace-warning   : Print Warning" << std::endl;
+  std::cout << "   --trace-table, -left-rec, -appeal, -failed, -stack, -sortout and -patch-was-succ" << std::endl;
+  std::cout << "   need the parser built with 'make PARSE_EVENTS=1'. So does --profile-rules" << std::endl;
+}
+
+// The trace options which are copied to every parser.
+struct TraceOptions {
+  bool mLexer;
+  bool mTable;
+  bool mLeftRec;
+  bool mAppeal;
+  bool mVisited;
+  bool mFailed;
+  bool mTiming;
+  bool mSortOut;
+  bool mAstBuild;
+  bool mPatchWasSucc;
+  bool mWarning;
+};
+
+static TraceOptions gTraceOpts;
+static bool gLexThread = false;
+static bool gParallelLex = false;
+static bool gLazyBodies = false;
+static bool gValidate = false;
+static bool gInterpret = false;
+static const char *gCacheDir = NULL;
+static unsigned long long gCacheSize = 256;  // in MB
+static ParseCache *gCache = NULL;
+static const char *gEmitAst = NULL;
+static const char *gReparse = NULL;
+static bool gProfileRules = false;
+static const char *gProfileFile = NULL;
+static RuleProfiler *gProfiler = NULL;
+static bool gTimelineOn = false;
+static bool gMemStats = false;
+static const char *gTimelineFile = NULL;
+static ParseBudget gBudget;
+
+// Returns false if 'opt' is not a budget option.
+static bool ParseBudgetOption(const char *opt) {
+  if (!strncmp(opt, "--budget-nodes=", 15)) {
+    gBudget.mAppealNodes = strtoul(opt + 15, NULL, 10);
+  } else if (!strncmp(opt, "--budget-waves=", 15)) {
+    gBudget.mWaves = strtoul(opt + 15, NULL, 10);
+  } else if (!strncmp(opt, "--budget-matches=", 17)) {
+    gBudget.mMatches = strtoul(opt + 17, NULL, 10);
+  } else if (!strncmp(opt, "--budget-ms=", 12)) {
+    gBudget.mMillis = strtoul(opt + 12, NULL, 10);
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// The profiler counts the events of parser, which are compiled only with
+// PARSE_EVENTS. It would report nothing without them.
+static void CheckProfileRules() {
+#ifndef PARSE_EVENTS
+  std::cerr << "--profile-rules needs the parser built with 'make PARSE_EVENTS=1'" << std::endl;
+  exit(-1);
+#endif
+}
+
+// Parse the options shared by single file mode and batch mode.
+// Returns false if 'opt' is unknown.
+static bool ParseCommonOption(const char *opt) {
+  if (!strncmp(opt, "--trace-lexer", 13) && (strlen(opt) == 13)) {
+    gTraceOpts.mLexer = true;
+  } else if (!strncmp(opt, "--trace-table", 13) && (strlen(opt) == 13)) {
+    gTraceOpts.mTable = true;
+  } else if (!strncmp(opt, "--trace-left-rec", 16) && (strlen(opt) == 16)) {
+    gTraceOpts.mLeftRec = true;
+  } else if (!strncmp(opt, "--trace-appeal", 14) && (strlen(opt) == 14)) {
+    gTraceOpts.mAppeal = true;
+  } else if (!strncmp(opt, "--trace-stack", 13) && (strlen(opt) == 13)) {
+    gTraceOpts.mVisited = true;
+  } else if (!strncmp(opt, "--trace-failed", 14) && (strlen(opt) == 14)) {
+    gTraceOpts.mFailed = true;
+  } else if (!strncmp(opt, "--trace-timing", 14) && (strlen(opt) == 14)) {
+    gTraceOpts.mTiming = true;
+  } else if (!strncmp(opt, "--trace-sortout", 15) && (strlen(opt) == 15)) {
+    gTraceOpts.mSortOut = true;
+  } else if (!strncmp(opt, "--trace-ast-build", 17) && (strlen(opt) == 17)) {
+    gTraceOpts.mAstBuild = true;
+  } else if (!strncmp(opt, "--trace-patch-was-succ", 22) && (strlen(opt) == 22)) {
+    gTraceOpts.mPatchWasSucc = true;
+  } else if (!strncmp(opt, "--trace-warning", 15) && (strlen(opt) == 15)) {
+    gTraceOpts.mWarning = true;
+  } else if (!strncmp(opt, "--lex-thread", 12) && (strlen(opt) == 12)) {
+    gLexThread = true;
+  } else if (!strncmp(opt, "--parallel-lex", 14) && (strlen(opt) == 14)) {
+    gParallelLex = true;
+  } else if (!strncmp(opt, "--lazy-bodies", 13) && (strlen(opt) == 13)) {
+    gLazyBodies = true;
+  } else if (!strncmp(opt, "--validate", 10) && (strlen(opt) == 10)) {
+    gValidate = true;
+  } else if (!strncmp(opt, "--interpret", 11) && (strlen(opt) == 11)) {
+    gInterpret = true;
+  } else if (!strncmp(opt, "--all-matches", 13) && (strlen(opt) == 13)) {
+    // All the parsers share the flags, so they are cleared for all.
+    static bool *no_single_match = new bool[RuleTableNum]();
+    gSingleMatch = no_single_match;
+  } else if (!strncmp(opt, "--cache-dir=", 12) && (strlen(opt) > 12)) {
+    gCacheDir = opt + 12;
+  } else if (!strncmp(opt, "--cache-size=", 13)) {
+    gCacheSize = strtoull(opt + 13, NULL, 10);
+  } else if (!strncmp(opt, "--mem-stats", 11) && (strlen(opt) == 11)) {
+    gMemStats = true;
+  } else if (!strncmp(opt, "--timeline", 10) && (strlen(opt) == 10)) {
+    gTimelineOn = true;
+  } else if (!strncmp(opt, "--timeline=", 11) && (strlen(opt) > 11)) {
+    gTimelineOn = true;
+    gTimelineFile = opt + 11;
+  } else if (!strncmp(opt, "--profile-rules", 15) && (strlen(opt) == 15)) {
+    CheckProfileRules();
+    gProfileRules = true;
+  } else if (!strncmp(opt, "--profile-rules=", 16) && (strlen(opt) > 16)) {
+    CheckProfileRules();
+    gProfileRules = true;
+    gProfileFile = opt + 16;
+  } else if (!ParseBudgetOption(opt)) {
+    return false;
+  }
+  return true;
+}
+
+// The budgets go along with the trace options to every parser.
+static void SetTraceOptions(Parser *parser) {
+  if (gTraceOpts.mLexer)
+    parser->SetLexerTrace();
+  parser->mTraceTiming = gTraceOpts.mTiming;
+  parser->mTraceAstBuild = gTraceOpts.mAstBuild;
+  parser->mTraceWarning = gTraceOpts.mWarning;
+  parser->SetBudget(gBudget);
+  if (gInterpret)
+    parser->SetInterpret();
+
+  if (gTraceOpts.mTable || gTraceOpts.mLeftRec || gTraceOpts.mAppeal ||
+      gTraceOpts.mFailed || gTraceOpts.mVisited || gTraceOpts.mSortOut ||
+      gTraceOpts.mPatchWasSucc) {
+#ifndef PARSE_EVENTS
+    static std::atomic<bool> warned(false);
+    if (!warned.exchange(true))
+      std::cerr << "Warning: the parser is built without PARSE_EVENTS, "
+                << "there is nothing to trace." << std::endl;
+#endif
+    ParseTracer *tracer = new ParseTracer();
+    tracer->mTable = gTraceOpts.mTable;
+    tracer->mLeftRec = gTraceOpts.mLeftRec;
+    tracer->mAppeal = gTraceOpts.mAppeal;
+    tracer->mFailed = gTraceOpts.mFailed;
+    tracer->mVisited = gTraceOpts.mVisited;
+    tracer->mSortOut = gTraceOpts.mSortOut;
+    tracer->mPatchWasSucc = gTraceOpts.mPatchWasSucc;
+    parser->SetObserver(tracer);
+  } else if (gProfiler) {
+    parser->SetObserver(new RuleProfiler(gProfiler));
+  }
+}
+
+// Any tracing makes the output depend on the options, not only the file.
+static bool HasTraceOption() {
+  return gTraceOpts.mLexer || gTraceOpts.mTable || gTraceOpts.mLeftRec ||
+         gTraceOpts.mAppeal || gTraceOpts.mVisited || gTraceOpts.mFailed ||
+         gTraceOpts.mTiming || gTraceOpts.mSortOut || gTraceOpts.mAstBuild ||
+         gTraceOpts.mPatchWasSucc || gTraceOpts.mWarning;
+}
+
+static void CreateCache() {
+  if (gCacheDir && !HasTraceOption() && !gLazyBodies && !gValidate && !gProfileRules &&
+      !gTimelineOn && !gBudget.IsSet())
+    gCache = new ParseCache(gCacheDir, gCacheSize * 1024 * 1024);
+}
+
+static void DestroyCache() {
+  if (gCache) {
+    gCache->Report();
+    delete gCache;
+    gCache = NULL;
+  }
+}
+
+// The profiler which all parsers report to.
+static void CreateProfiler() {
+  if (!gProfileRules || HasTraceOption())
+    return;
+  gProfiler = new RuleProfiler();
+}
+
+static void DestroyProfiler() {
+  if (!gProfiler)
+    return;
+  gProfiler->Report(std::cout, 40);
+  if (gProfileFile) {
+    std::ofstream f(gProfileFile);
+    size_t len = strlen(gProfileFile);
+    if (!f.is_open())
+      std::cerr << "cannot write rule profile to " << gProfileFile << std::endl;
+    else if (len > 5 && !strcmp(gProfileFile + len - 5, ".json"))
+      gProfiler->WriteJSON(f);
+    else
+      gProfiler->WriteCSV(f);
+  }
+  delete gProfiler;
+  gProfiler = NULL;
+}
+
+static void StartTimeline() {
+  if (gTimelineOn)
+    gTimeline.Enable();
+  if (gMemStats)
+    MemStats::Enable();
+}
+
+// Called after all the parsing threads are done.
+static void FinishTimeline() {
+  if (gMemStats)
+    MemStats::Report(std::cout);
+  if (!gTimelineOn)
+    return;
+  gTimeline.Summary(std::cout);
+  if (gTimelineFile) {
+    std::ofstream f(gTimelineFile);
+    if (f.is_open())
+      gTimeline.WriteChromeTrace(f);
+    else
+      std::cerr << "cannot write timeline to " << gTimelineFile << std::endl;
+  }
+}
+
+static bool ReadFileContent(const char *name, std::string &content) {
+  std::ifstream f(name, std::ios::in | std::ios::binary);
+  if (!f.is_open())
+    return false;
+  content.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+  return true;
+}
+
+// Report or verify what 'parser' has parsed, and delete it. The binary AST
+// of --emit-ast is the module as parsed, before the verifier changes it. It's
+// also given in 'ast' if not NULL.
+static bool FinishFile(const char *name, Parser *parser, bool ok, std::string *ast = NULL) {
+  if (gValidate) {
+    if (ok)
+      std::cout << name << ": PASS" << std::endl;
+    else
+      std::cout << name << ": FAIL at token " << parser->GetFurthestToken()
+                << " '" << parser->GetFurthestTokenName() << "'" << std::endl;
+    delete parser;
+    return ok;
+  }
+
+  if (gEmitAst) {
+    std::string buf;
+    ASTBinWriter writer;
+    if (!writer.Write(&gModule, buf) || !ASTBinWriter::WriteBuffer(buf, gEmitAst))
+      std::cerr << "cannot write binary AST to " << gEmitAst << std::endl;
+    else if (ast)
+      ast->swap(buf);
+  }
+
+  {
+    TimeSpan span("Verify");
+    VerifierJava vfy_java;
+    vfy_java.Do();
+  }
+
+  delete parser;
+  return ok;
+}
+
+// Parse one file and verify it. Returns true if there is no syntax error.
+// If 'pool' is not NULL, the top level constructs are parsed in parallel.
+// 'ast' gets the binary AST of --emit-ast.
+static bool ParseFileNoCache(const char *name, WorkPool *pool, std::string *ast = NULL) {
+  TimeSpan span("File", name);
+  gModule.Clear();
+  Parser *parser = new Parser(name);
+  SetTraceOptions(parser);
+  parser->SetWorkPool(pool);
+  if (gParallelLex)
+    parser->SetParallelLex();
+  if (gLazyBodies)
+    parser->SetLazyBodies();
+  // The trace of lexer thread won't go along with the output of parser.
+  if (gLexThread && !gTraceOpts.mLexer)
+    parser->StartLexThread();
+  if (gValidate)
+    parser->SetValidateOnly();
+  parser->InitRecursion();
+  bool ok = parser->Parse();
+  return FinishFile(name, parser, ok, ast);
+}
+
+// Parse the source from stdin in push mode, a chunk at a time as it comes.
+static bool ParseStdin() {
+  const char *name = "-";
+  TimeSpan span("File", name);
+  gModule.Clear();
+  Parser *parser = new Parser(name, std::string());
+  SetTraceOptions(parser);
+  if (gValidate)
+    parser->SetValidateOnly();
+  parser->InitRecursion();
+  parser->StartStream(NULL);
+
+  char buf[4096];
+  ssize_t n;
+  while ((n = read(0, buf, sizeof(buf))) > 0) {
+    if (!parser->FeedStream(buf, n))
+      break;
+  }
+  bool ok = parser->FinishStream();
+  return FinishFile(name, parser, ok);
+}
+
+// Parse 'name', then reparse it incrementally with the content of 'edited'.
+// Only the top level constructs, or the members of a class, touched by the
+// difference are parsed again.
+static bool ReparseFile(const char *name, const char *edited) {
+  std::string content;
+  std::string new_content;
+  if (!ReadFileContent(name, content) || !ReadFileContent(edited, new_content)) {
+    std::cerr << "cannot read " << name << " or " << edited << std::endl;
+    return false;
+  }
+
+  TimeSpan span("File", name);
+  gModule.Clear();
+  Parser *parser = new Parser(name);
+  SetTraceOptions(parser);
+  parser->InitRecursion();
+  parser->ParseIncremental(content);
+  bool ok = parser->ParseIncremental(new_content);
+  std::cout << "Reparsed " << parser->GetReparsedNum() << " constructs, "
+            << parser->GetReparsedMembers() << " members, "
+            << parser->GetReparsedTokens() << " tokens, relexed "
+            << parser->GetRelexedLines() << " lines." << std::endl;
+  gModule.Dump();
+
+  {
+    TimeSpan span("Verify");
+    VerifierJava vfy_java;
+    vfy_java.Do();
+  }
+
+  delete parser;
+  return ok;
+}
+
+// The cached entry holds whatever parser and verifier printed, and the
+// binary AST if --emit-ast asked for it. A hit replays them without lexing
+// or parsing the file. An entry without the AST is a miss for --emit-ast.
+static bool ParseFile(const char *name, WorkPool *pool = NULL) {
+  std::string content;
+  if (!gCache || !ReadFileContent(name, content))
+    return ParseFileNoCache(name, pool);
+
+  std::string key = ParseCache::MakeKey(content);
+  PCEntry entry;
+  if (gCache->Lookup(key, entry)) {
+    const std::string *output = entry.GetSection(PCS_Output);
+    const std::string *ast = entry.GetSection(PCS_AST);
+    if (output && (ast || !gEmitAst)) {
+      std::cout << *output;
+      if (gEmitAst && !ASTBinWriter::WriteBuffer(*ast, gEmitAst))
+        std::cerr << "cannot write binary AST to " << gEmitAst << std::endl;
+      return entry.mFlags & PC_Succ;
+    }
+  }
+
+  std::string output;
+  std::string ast;
+  bool ok;
+  {
+    OutCapture capture(&output);
+    ok = ParseFileNoCache(name, pool, &ast);
+  }
+  std::cout << output;
+
+  entry.mFlags = ok ? PC_Succ : 0;
+  entry.mSections.clear();
+  entry.AddSection(PCS_Output, output);
+  // The AST is kept only for --emit-ast, the only one reading it.
+  if (!ast.empty())
+    entry.AddSection(PCS_AST, ast);
+  gCache->Store(key, entry);
+  return ok;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                              Batch Mode
+//
+// Each input file is a task of the work-stealing pool. The output of a file
+// is captured in its own buffer and printed in the order of the inputs after
+// all files are done, so the result doesn't depend on the scheduling.
+//////////////////////////////////////////////////////////////////////////////
+
+struct BatchFile {
+  std::string mName;
+  std::string mOutput;
+  bool        mOpened;
+  bool        mSucc;
+};
+
+static bool HasJavaSuffix(const std::string &name) {
+  return name.size() > 5 && name.compare(name.size() - 5, 5, ".java") == 0;
+}
+
+// Collect all .java files under 'dir'. Entries are sorted to make the
+// order stable across file systems.
+static void CollectDir(const std::string &dir, std::vector<std::string> &files) {
+  DIR *d = opendir(dir.c_str());
+  if (!d)
+    return;
+  std::vector<std::string> entries;
+  struct dirent *ent;
+  while ((ent = readdir(d))) {
+    if (!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, ".."))
+      continue;
+    entries.push_back(dir + "/" + ent->d_name);
+  }
+  closedir(d);
+  std::sort(entries.begin(), entries.end());
+
+  for (unsigned i = 0; i < entries.size(); i++) {
+    struct stat st;
+    if (stat(entries[i].c_str(), &st))
+      continue;
+    if (S_ISDIR(st.st_mode))
+      CollectDir(entries[i], files);
+    else if (HasJavaSuffix(entries[i]))
+      files.push_back(entries[i]);
+  }
+}
+
+static void CollectInput(const char *arg, std::vector<std::string> &files) {
+  if (arg[0] == '@') {
+    std::ifstream list(arg + 1);
+    if (!list.is_open()) {
+      std::cerr << "cannot open list file " << arg + 1 << std::endl;
+      exit(-1);
+    }
+    std::string line;
+    while (std::getline(list, line)) {
+      if (!line.empty())
+        CollectInput(line.c_str(), files);
+    }
+    return;
+  }
+
+  struct stat st;
+  if (!stat(arg, &st) && S_ISDIR(st.st_mode))
+    CollectDir(arg, files);
+  else
+    files.push_back(arg);
+}
+
+static int BatchMain(int argc, char *argv[]) {
+  unsigned jobs = 0;
+  std::vector<std::string> names;
+
+  for (unsigned i = 2; i < argc; i++) {
+    if (!strncmp(argv[i], "--jobs=", 7)) {
+      jobs = atoi(argv[i] + 7);
+    } else if (!strncmp(argv[i], "--", 2)) {
+      if (!ParseCommonOption(argv[i])) {
+        std::cerr << "unknown option " << argv[i] << std::endl;
+        exit(-1);
+      }
+    } else {
+      CollectInput(argv[i], names);
+    }
+  }
+
+  std::vector<BatchFile> files(names.size());
+  for (unsigned i = 0; i < names.size(); i++) {
+    files[i].mName = names[i];
+    files[i].mOpened = false;
+    files[i].mSucc = false;
+  }
+
+  CreateCache();
+  CreateProfiler();
+  StartTimeline();
+  {
+    WorkPool pool(jobs);
+    for (unsigned i = 0; i < files.size(); i++) {
+      BatchFile *f = &files[i];
+      pool.Submit([f]() {
+        // Lexer exits the process if a file cannot be opened. Check it here
+        // so that one bad path doesn't kill the whole batch.
+        FILE *fp = fopen(f->mName.c_str(), "r");
+        if (!fp)
+          return;
+        fclose(fp);
+        f->mOpened = true;
+        OutCapture capture(&f->mOutput);
+        f->mSucc = ParseFile(f->mName.c_str());
+      });
+    }
+    pool.Wait();
+  }
+
+  unsigned succ = 0;
+  for (unsigned i = 0; i < files.size(); i++) {
+    std::cout << files[i].mOutput;
+    if (files[i].mSucc)
+      succ++;
+  }
+
+  std::cout << "================ Batch Summary ================" << std::endl;
+  for (unsigned i = 0; i < files.size(); i++) {
+    const char *status = files[i].mSucc ? "OK  " : (files[i].mOpened ? "FAIL" : "MISS");
+    std::cout << status << " " << files[i].mName << std::endl;
+  }
+  std::cout << "Total: " << files.size() << "  OK: " << succ
+            << "  Failed: " << files.size() - succ << std::endl;
+  DestroyCache();
+  DestroyProfiler();
+  FinishTimeline();
+
+  return succ == files.size() ? 0 : 1;
+}
+
+static int ServerMain(int argc, char *argv[]) {
+  unsigned jobs = 0;
+  unsigned queue = 64;
+  const char *socket_path = NULL;
+
+  for (unsigned i = 2; i < argc; i++) {
+    if (!strncmp(argv[i], "--jobs=", 7)) {
+      jobs = atoi(argv[i] + 7);
+    } else if (!strncmp(argv[i], "--queue=", 8)) {
+      queue = atoi(argv[i] + 8);
+    } else if (!strncmp(argv[i], "--socket=", 9) && strlen(argv[i]) > 9) {
+      socket_path = argv[i] + 9;
+    } else if (!ParseBudgetOption(argv[i])) {
+      std::cerr << "unknown option " << argv[i] << std::endl;
+      exit(-1);
+    }
+  }
+
+  ParseServer server(jobs, queue);
+  server.SetBudget(gBudget);
+  if (!socket_path) {
+    server.Serve(0, 1);
+    return 0;
+  }
+  if (!server.ServeSocket(socket_path)) {
+    std::cerr << "cannot listen on " << socket_path << std::endl;
+    return 1;
+  }
+  return 0;
 }
 
 int main (int argc, char *argv[]) {
-  if (!strncmp(argv[1], "--help", 6) && (strlen(argv[1]) == 6)) {
+  if (argc < 2 || (!strncmp(argv[1], "--help", 6) && (strlen(argv[1]) == 6))) {
     help();
     exit(-1);
   }
 
-  Parser *parser = new Parser(argv[1]);
+  if (!strncmp(argv[1], "--batch", 7) && (strlen(argv[1]) == 7))
+    return BatchMain(argc, argv);
+
+  if (!strncmp(argv[1], "--server", 8) && (strlen(argv[1]) == 8))
+    return ServerMain(argc, argv);
+
+  if (!strncmp(argv[1], "--read-ast", 10) && (strlen(argv[1]) == 10)) {
+    ASTBinReader reader;
+    if (argc < 3 || !reader.Open(argv[2])) {
+      std::cerr << "cannot read binary AST " << (argc < 3 ? "" : argv[2]) << std::endl;
+      exit(-1);
+    }
+    if (argc > 3 && !strcmp(argv[3], "--raw")) {
+      reader.Dump();
+      return 0;
+    }
+    if (!reader.Load(&gModule)) {
+      std::cerr << "cannot load binary AST " << argv[2] << std::endl;
+      exit(-1);
+    }
+    gModule.Dump();
+    VerifierJava vfy_java;
+    vfy_java.Do();
+    return 0;
+  }
 
   // Parse the argument
+  unsigned jobs = 1;
   for (unsigned i = 2; i < argc; i++) {
-    if (!strncmp(argv[i], "--trace-lexer", 13) && (strlen(argv[i]) == 13)) {
-      parser->SetLexerTrace();
-    } else if (!strncmp(argv[i], "--trace-table", 13) && (strlen(argv[i]) == 13)) {
-      parser->mTraceTable = true;
-    } else if (!strncmp(argv[i], "--trace-left-rec", 16) && (strlen(argv[i]) == 16)) {
-      parser->mTraceLeftRec = true;
-    } else if (!strncmp(argv[i], "--trace-appeal", 14) && (strlen(argv[i]) == 14)) {
-      parser->mTraceAppeal = true;
-    } else if (!strncmp(argv[i], "--trace-stack", 13) && (strlen(argv[i]) == 13)) {
-      parser->mTraceVisited = true;
-    } else if (!strncmp(argv[i], "--trace-failed", 14) && (strlen(argv[i]) == 14)) {
-      parser->mTraceFailed = true;
-    } else if (!strncmp(argv[i], "--trace-timing", 14) && (strlen(argv[i]) == 14)) {
-      parser->mTraceTiming = true;
-    } else if (!strncmp(argv[i], "--trace-sortout", 15) && (strlen(argv[i]) == 15)) {
-      parser->mTraceSortOut = true;
-    } else if (!strncmp(argv[i], "--trace-ast-build", 17) && (strlen(argv[i]) == 17)) {
-      parser->mTraceAstBuild = true;
-    } else if (!strncmp(argv[i], "--trace-patch-was-succ", 22) && (strlen(argv[i]) == 22)) {
-      parser->mTracePatchWasSucc = true;
-    } else if (!strncmp(argv[i], "--trace-warning", 15) && (strlen(argv[i]) == 15)) {
-      parser->mTraceWarning = true;
-    } else {
+    if (!strncmp(argv[i], "--jobs=", 7)) {
+      jobs = atoi(argv[i] + 7);
+    } else if (!strncmp(argv[i], "--emit-ast=", 11)) {
+      gEmitAst = argv[i] + 11;
+    } else if (!strncmp(argv[i], "--reparse=", 10)) {
+      gReparse = argv[i] + 10;
+    } else if (!ParseCommonOption(argv[i])) {
       std::cerr << "unknown option " << argv[i] << std::endl;
       exit(-1);
     }
   }
 
-  parser->InitRecursion();
-  parser->Parse();
+  WorkPool *pool = NULL;
+  if (jobs > 1)
+    pool = new WorkPool(jobs);
 
-  VerifierJava vfy_java;
-  vfy_java.Do();
+  CreateProfiler();
+  StartTimeline();
+  if (gReparse) {
+    bool ok = ReparseFile(argv[1], gReparse);
+    DestroyProfiler();
+    FinishTimeline();
+    delete pool;
+    return ok ? 0 : 1;
+  }
 
-  delete parser;
+  if (!strcmp(argv[1], "-")) {
+    bool ok = ParseStdin();
+    DestroyProfiler();
+    FinishTimeline();
+    delete pool;
+    return ok ? 0 : 1;
+  }
 
-  return 0;
+  CreateCache();
+  bool ok = ParseFile(argv[1], pool);
+  DestroyCache();
+  DestroyProfiler();
+  FinishTimeline();
+
+  delete pool;
+
+  return ok ? 0 : 1;
 }
@@ -0,0 +1,4 @@
+package a.b;
+import java.util.List;
+import java.io.*;
+class Pkg { List<String> l; int f(int x) { return x > 0 ? x : -x; } }
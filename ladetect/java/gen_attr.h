@@ -0,0 +1,4 @@
+#ifndef __ATTR_GEN_H__
+#define __ATTR_GEN_H__
+extern AttrKeyword AttrKeywordTable[ATTR_NA];
+#endif
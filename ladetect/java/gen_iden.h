@@ -0,0 +1,8 @@
+#ifndef __IDEN_GEN_H__
+#define __IDEN_GEN_H__
+#include "ruletable.h"
+extern RuleTable TblJavaChar;
+extern RuleTable TblCharOrDigit;
+extern RuleTable TblIdentifier;
+extern RuleTable TblIdentifier_sub1;
+#endif
@@ -0,0 +1,41 @@
+#include "ruletable.h"
+OprTableEntry OprTable[] = {
+  {">>>=", OPR_ZextAssign},
+  {">>=", OPR_ShrAssign},
+  {"<<=", OPR_ShlAssign},
+  {">>>", OPR_Zext},
+  {"->", OPR_Arrow},
+  {"^=", OPR_BxorAssign},
+  {"|=", OPR_BorAssign},
+  {"&=", OPR_BandAssign},
+  {"%=", OPR_ModAssign},
+  {"/=", OPR_DivAssign},
+  {"*=", OPR_MulAssign},
+  {"-=", OPR_SubAssign},
+  {"+=", OPR_AddAssign},
+  {"||", OPR_Lor},
+  {"&&", OPR_Land},
+  {">>", OPR_Shr},
+  {"<<", OPR_Shl},
+  {"<=", OPR_LE},
+  {">=", OPR_GE},
+  {"!=", OPR_NE},
+  {"==", OPR_EQ},
+  {"--", OPR_Dec},
+  {"++", OPR_Inc},
+  {"?", OPR_Cond},
+  {":", OPR_Select},
+  {"=", OPR_Assign},
+  {"!", OPR_Not},
+  {"~", OPR_Bcomp},
+  {"^", OPR_Bxor},
+  {"|", OPR_Bor},
+  {"&", OPR_Band},
+  {"<", OPR_LT},
+  {">", OPR_GT},
+  {"%", OPR_Mod},
+  {"/", OPR_Div},
+  {"*", OPR_Mul},
+  {"-", OPR_Sub},
+  {"+", OPR_Add}
+};
@@ -0,0 +1,4 @@
+#ifndef __OPERATOR_GEN_H__
+#define __OPERATOR_GEN_H__
+extern OprTableEntry OprTable[OPR_NA];
+#endif
@@ -0,0 +1,20 @@
+#ifndef __DEBUG_GEN_H__
+#define __DEBUG_GEN_H__
+#include "ruletable.h"
+#include "succ_match.h"
+#include <vector>
+#include <unordered_set>
+typedef struct {
+  const RuleTable *mAddr;
+  const char      *mName;
+  unsigned         mIndex;
+}RuleTableSummary;
+extern RuleTableSummary gRuleTableSummarys[];
+extern unsigned RuleTableNum;
+extern const char* GetRuleTableName(const RuleTable*);
+extern thread_local std::unordered_set<unsigned> gFailed[547];
+class SuccMatch;
+extern thread_local SuccMatch gSucc[547];
+extern unsigned gTopRulesNum;
+extern RuleTable* gTopRules[4];
+#endif
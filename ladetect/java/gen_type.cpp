@@ -0,0 +1,129 @@
+#include "common_header_autogen.h"
+TypeKeyword TypeKeywordTable[TY_NA] = {
+  {"boolean", TY_Boolean},
+  {"byte", TY_Byte},
+  {"short", TY_Short},
+  {"int", TY_Int},
+  {"long", TY_Long},
+  {"char", TY_Char},
+  {"float", TY_Float},
+  {"double", TY_Double},
+  {"void", TY_Void},
+  {"null", TY_Null}
+};
+TableData TblBoolType_data[1] ={{DT_Token, {.mTokenId=68}}};
+RuleTable TblBoolType ={ET_Data, RP_NA, 1, TblBoolType_data, 0, NULL, 112};
+TableData TblIntType_data[5] ={{DT_Token, {.mTokenId=96}},{DT_Token, {.mTokenId=85}},{DT_Token, {.mTokenId=101}},{DT_Token, {.mTokenId=93}},{DT_Token, {.mTokenId=95}}};
+RuleTable TblIntType ={ET_Oneof, RP_NA, 5, TblIntType_data, 0, NULL, 113};
+TableData TblFPType_data[2] ={{DT_Token, {.mTokenId=86}},{DT_Token, {.mTokenId=77}}};
+RuleTable TblFPType ={ET_Oneof, RP_NA, 2, TblFPType_data, 0, NULL, 114};
+TableData TblNumericType_data[7] ={{DT_Token, {.mTokenId=96}},{DT_Token, {.mTokenId=85}},{DT_Token, {.mTokenId=101}},{DT_Token, {.mTokenId=93}},{DT_Token, {.mTokenId=95}},{DT_Token, {.mTokenId=86}},{DT_Token, {.mTokenId=77}}};
+RuleTable TblNumericType ={ET_Oneof, RP_NA, 7, TblNumericType_data, 0, NULL, 115};
+TableData TblPrimitiveType_sub2_data[1] ={{DT_Subtable, &TblAnnotation}};
+RuleTable TblPrimitiveType_sub2 ={ET_Zeroormore, RP_NA, 1, TblPrimitiveType_sub2_data, 0, NULL, 118};
+TableData TblPrimitiveType_sub1_data[2] ={{DT_Subtable, &TblPrimitiveType_sub2},{DT_Subtable, &TblNumericType}};
+RuleTable TblPrimitiveType_sub1 ={ET_Concatenate, RP_NA, 2, TblPrimitiveType_sub1_data, 0, NULL, 117};
+extern RuleTable TblPrimitiveType_sub2;
+TableData TblPrimitiveType_sub3_data[2] ={{DT_Subtable, &TblPrimitiveType_sub2},{DT_Token, {.mTokenId=68}}};
+RuleTable TblPrimitiveType_sub3 ={ET_Concatenate, RP_NA, 2, TblPrimitiveType_sub3_data, 0, NULL, 119};
+TableData TblPrimitiveType_data[2] ={{DT_Subtable, &TblPrimitiveType_sub1},{DT_Subtable, &TblPrimitiveType_sub3}};
+RuleTable TblPrimitiveType ={ET_Oneof, RP_NA, 2, TblPrimitiveType_data, 0, NULL, 116};
+TableData TblNullType_data[1] ={{DT_Type, {.mTypeId=TY_Null}}};
+RuleTable TblNullType ={ET_Data, RP_NA, 1, TblNullType_data, 0, NULL, 120};
+TableData TblWildcardBounds_sub1_data[2] ={{DT_Token, {.mTokenId=64}},{DT_Subtable, &TblReferenceType}};
+RuleTable TblWildcardBounds_sub1 ={ET_Concatenate, RP_NA, 2, TblWildcardBounds_sub1_data, 0, NULL, 122};
+TableData TblWildcardBounds_sub2_data[2] ={{DT_Token, {.mTokenId=80}},{DT_Subtable, &TblReferenceType}};
+RuleTable TblWildcardBounds_sub2 ={ET_Concatenate, RP_NA, 2, TblWildcardBounds_sub2_data, 0, NULL, 123};
+TableData TblWildcardBounds_data[2] ={{DT_Subtable, &TblWildcardBounds_sub1},{DT_Subtable, &TblWildcardBounds_sub2}};
+RuleTable TblWildcardBounds ={ET_Oneof, RP_NA, 2, TblWildcardBounds_data, 0, NULL, 121};
+extern RuleTable TblPrimitiveType_sub2;
+TableData TblWildcard_sub1_data[1] ={{DT_Subtable, &TblWildcardBounds}};
+RuleTable TblWildcard_sub1 ={ET_Zeroorone, RP_NA, 1, TblWildcard_sub1_data, 0, NULL, 125};
+TableData TblWildcard_data[3] ={{DT_Subtable, &TblPrimitiveType_sub2},{DT_Token, {.mTokenId=23}},{DT_Subtable, &TblWildcard_sub1}};
+RuleTable TblWildcard ={ET_Concatenate, RP_NA, 3, TblWildcard_data, 0, NULL, 124};
+TableData TblTypeArgument_sub1_data[2] ={{DT_Subtable, &TblPrimitiveType},{DT_Subtable, &TblDims}};
+RuleTable TblTypeArgument_sub1 ={ET_Concatenate, RP_NA, 2, TblTypeArgument_sub1_data, 0, NULL, 127};
+TableData TblTypeArgument_sub2_data[2] ={{DT_Subtable, &TblClassOrInterfaceType},{DT_Subtable, &TblDims}};
+RuleTable TblTypeArgument_sub2 ={ET_Concatenate, RP_NA, 2, TblTypeArgument_sub2_data, 0, NULL, 128};
+TableData TblTypeArgument_sub3_data[2] ={{DT_Subtable, &TblTypeVariable},{DT_Subtable, &TblDims}};
+RuleTable TblTypeArgument_sub3 ={ET_Concatenate, RP_NA, 2, TblTypeArgument_sub3_data, 0, NULL, 129};
+TableData TblTypeArgument_data[6] ={{DT_Subtable, &TblClassOrInterfaceType},{DT_Subtable, &TblTypeVariable},{DT_Subtable, &TblTypeArgument_sub1},{DT_Subtable, &TblTypeArgument_sub2},{DT_Subtable, &TblTypeArgument_sub3},{DT_Subtable, &TblWildcard}};
+RuleTable TblTypeArgument ={ET_Oneof, RP_NA, 6, TblTypeArgument_data, 0, NULL, 126};
+TableData TblTypeArgumentList_sub2_data[2] ={{DT_Token, {.mTokenId=44}},{DT_Subtable, &TblTypeArgument}};
+RuleTable TblTypeArgumentList_sub2 ={ET_Concatenate, RP_NA, 2, TblTypeArgumentList_sub2_data, 0, NULL, 132};
+TableData TblTypeArgumentList_sub1_data[1] ={{DT_Subtable, &TblTypeArgumentList_sub2}};
+RuleTable TblTypeArgumentList_sub1 ={ET_Zeroormore, RP_NA, 1, TblTypeArgumentList_sub1_data, 0, NULL, 131};
+TableData TblTypeArgumentList_data[2] ={{DT_Subtable, &TblTypeArgument},{DT_Subtable, &TblTypeArgumentList_sub1}};
+RuleTable TblTypeArgumentList ={ET_Concatenate, RP_NA, 2, TblTypeArgumentList_data, 0, NULL, 130};
+TableData TblTypeArguments_data[3] ={{DT_Token, {.mTokenId=31}},{DT_Subtable, &TblTypeArgumentList},{DT_Token, {.mTokenId=32}}};
+RuleTable TblTypeArguments ={ET_Concatenate, RP_NA, 3, TblTypeArguments_data, 0, NULL, 133};
+extern RuleTable TblPrimitiveType_sub2;
+TableData TblClassType_sub2_data[1] ={{DT_Subtable, &TblTypeArguments}};
+RuleTable TblClassType_sub2 ={ET_Zeroorone, RP_NA, 1, TblClassType_sub2_data, 0, NULL, 136};
+TableData TblClassType_sub1_data[3] ={{DT_Subtable, &TblPrimitiveType_sub2},{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblClassType_sub2}};
+RuleTable TblClassType_sub1 ={ET_Concatenate, RP_NA, 3, TblClassType_sub1_data, 0, NULL, 135};
+extern RuleTable TblPrimitiveType_sub2;
+extern RuleTable TblClassType_sub2;
+TableData TblClassType_sub3_data[5] ={{DT_Subtable, &TblClassOrInterfaceType},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblPrimitiveType_sub2},{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblClassType_sub2}};
+RuleTable TblClassType_sub3 ={ET_Concatenate, RP_NA, 5, TblClassType_sub3_data, 0, NULL, 137};
+TableData TblClassType_data[2] ={{DT_Subtable, &TblClassType_sub1},{DT_Subtable, &TblClassType_sub3}};
+RuleTable TblClassType ={ET_Oneof, RP_NA, 2, TblClassType_data, 0, NULL, 134};
+TableData TblInterfaceType_data[1] ={{DT_Subtable, &TblClassType}};
+RuleTable TblInterfaceType ={ET_Data, RP_NA, 1, TblInterfaceType_data, 0, NULL, 138};
+extern RuleTable TblPrimitiveType_sub2;
+TableData TblTypeVariable_data[2] ={{DT_Subtable, &TblPrimitiveType_sub2},{DT_Subtable, &TblIdentifier}};
+RuleTable TblTypeVariable ={ET_Concatenate, RP_NA, 2, TblTypeVariable_data, 0, NULL, 139};
+extern RuleTable TblTypeArgument_sub1;
+extern RuleTable TblTypeArgument_sub2;
+extern RuleTable TblTypeArgument_sub3;
+TableData TblArrayType_data[3] ={{DT_Subtable, &TblTypeArgument_sub1},{DT_Subtable, &TblTypeArgument_sub2},{DT_Subtable, &TblTypeArgument_sub3}};
+RuleTable TblArrayType ={ET_Oneof, RP_NA, 3, TblArrayType_data, 0, NULL, 140};
+TableData TblClassOrInterfaceType_data[2] ={{DT_Subtable, &TblClassType},{DT_Subtable, &TblInterfaceType}};
+RuleTable TblClassOrInterfaceType ={ET_Oneof, RP_NA, 2, TblClassOrInterfaceType_data, 0, NULL, 141};
+extern RuleTable TblTypeArgument_sub1;
+extern RuleTable TblTypeArgument_sub2;
+extern RuleTable TblTypeArgument_sub3;
+TableData TblReferenceType_data[5] ={{DT_Subtable, &TblClassOrInterfaceType},{DT_Subtable, &TblTypeVariable},{DT_Subtable, &TblTypeArgument_sub1},{DT_Subtable, &TblTypeArgument_sub2},{DT_Subtable, &TblTypeArgument_sub3}};
+RuleTable TblReferenceType ={ET_Oneof, RP_NA, 5, TblReferenceType_data, 0, NULL, 142};
+extern RuleTable TblPrimitiveType_sub1;
+extern RuleTable TblPrimitiveType_sub3;
+extern RuleTable TblTypeArgument_sub1;
+extern RuleTable TblTypeArgument_sub2;
+extern RuleTable TblTypeArgument_sub3;
+TableData TblTYPE_data[8] ={{DT_Subtable, &TblPrimitiveType_sub1},{DT_Subtable, &TblPrimitiveType_sub3},{DT_Subtable, &TblClassOrInterfaceType},{DT_Subtable, &TblTypeVariable},{DT_Subtable, &TblTypeArgument_sub1},{DT_Subtable, &TblTypeArgument_sub2},{DT_Subtable, &TblTypeArgument_sub3},{DT_Type, {.mTypeId=TY_Null}}};
+RuleTable TblTYPE ={ET_Oneof, RP_NA, 8, TblTYPE_data, 0, NULL, 143};
+extern RuleTable TblClassType_sub2;
+TableData TblUnannClassType_sub1_data[2] ={{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblClassType_sub2}};
+RuleTable TblUnannClassType_sub1 ={ET_Concatenate, RP_NA, 2, TblUnannClassType_sub1_data, 0, NULL, 145};
+extern RuleTable TblPrimitiveType_sub2;
+extern RuleTable TblClassType_sub2;
+TableData TblUnannClassType_sub2_data[5] ={{DT_Subtable, &TblUnannClassOrInterfaceType},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblPrimitiveType_sub2},{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblClassType_sub2}};
+RuleTable TblUnannClassType_sub2 ={ET_Concatenate, RP_NA, 5, TblUnannClassType_sub2_data, 0, NULL, 146};
+TableData TblUnannClassType_data[2] ={{DT_Subtable, &TblUnannClassType_sub1},{DT_Subtable, &TblUnannClassType_sub2}};
+RuleTable TblUnannClassType ={ET_Oneof, RP_NA, 2, TblUnannClassType_data, 0, NULL, 144};
+TableData TblUnannClassOrInterfaceType_data[2] ={{DT_Subtable, &TblUnannClassType},{DT_Subtable, &TblUnannInterfaceType}};
+RuleTable TblUnannClassOrInterfaceType ={ET_Oneof, RP_NA, 2, TblUnannClassOrInterfaceType_data, 0, NULL, 147};
+TableData TblUnannInterfaceType_data[1] ={{DT_Subtable, &TblUnannClassType}};
+RuleTable TblUnannInterfaceType ={ET_Data, RP_NA, 1, TblUnannInterfaceType_data, 0, NULL, 148};
+TableData TblUnannTypeVariable_data[1] ={{DT_Subtable, &TblIdentifier}};
+RuleTable TblUnannTypeVariable ={ET_Data, RP_NA, 1, TblUnannTypeVariable_data, 0, NULL, 149};
+TableData TblUnannArrayType_sub1_data[2] ={{DT_Subtable, &TblUnannPrimitiveType},{DT_Subtable, &TblDims}};
+RuleTable TblUnannArrayType_sub1 ={ET_Concatenate, RP_NA, 2, TblUnannArrayType_sub1_data, 0, NULL, 151};
+TableData TblUnannArrayType_sub2_data[2] ={{DT_Subtable, &TblUnannClassOrInterfaceType},{DT_Subtable, &TblDims}};
+RuleTable TblUnannArrayType_sub2 ={ET_Concatenate, RP_NA, 2, TblUnannArrayType_sub2_data, 0, NULL, 152};
+TableData TblUnannArrayType_sub3_data[2] ={{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblDims}};
+RuleTable TblUnannArrayType_sub3 ={ET_Concatenate, RP_NA, 2, TblUnannArrayType_sub3_data, 0, NULL, 153};
+TableData TblUnannArrayType_data[3] ={{DT_Subtable, &TblUnannArrayType_sub1},{DT_Subtable, &TblUnannArrayType_sub2},{DT_Subtable, &TblUnannArrayType_sub3}};
+RuleTable TblUnannArrayType ={ET_Oneof, RP_NA, 3, TblUnannArrayType_data, 0, NULL, 150};
+extern RuleTable TblUnannArrayType_sub1;
+extern RuleTable TblUnannArrayType_sub2;
+extern RuleTable TblUnannArrayType_sub3;
+TableData TblUnannReferenceType_data[5] ={{DT_Subtable, &TblUnannClassOrInterfaceType},{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblUnannArrayType_sub1},{DT_Subtable, &TblUnannArrayType_sub2},{DT_Subtable, &TblUnannArrayType_sub3}};
+RuleTable TblUnannReferenceType ={ET_Oneof, RP_NA, 5, TblUnannReferenceType_data, 0, NULL, 154};
+TableData TblUnannPrimitiveType_data[8] ={{DT_Token, {.mTokenId=96}},{DT_Token, {.mTokenId=85}},{DT_Token, {.mTokenId=101}},{DT_Token, {.mTokenId=93}},{DT_Token, {.mTokenId=95}},{DT_Token, {.mTokenId=86}},{DT_Token, {.mTokenId=77}},{DT_Token, {.mTokenId=68}}};
+RuleTable TblUnannPrimitiveType ={ET_Oneof, RP_NA, 8, TblUnannPrimitiveType_data, 0, NULL, 155};
+extern RuleTable TblUnannArrayType_sub1;
+extern RuleTable TblUnannArrayType_sub2;
+extern RuleTable TblUnannArrayType_sub3;
+TableData TblUnannType_data[13] ={{DT_Token, {.mTokenId=96}},{DT_Token, {.mTokenId=85}},{DT_Token, {.mTokenId=101}},{DT_Token, {.mTokenId=93}},{DT_Token, {.mTokenId=95}},{DT_Token, {.mTokenId=86}},{DT_Token, {.mTokenId=77}},{DT_Token, {.mTokenId=68}},{DT_Subtable, &TblUnannClassOrInterfaceType},{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblUnannArrayType_sub1},{DT_Subtable, &TblUnannArrayType_sub2},{DT_Subtable, &TblUnannArrayType_sub3}};
+RuleTable TblUnannType ={ET_Oneof, RP_NA, 13, TblUnannType_data, 0, NULL, 156};
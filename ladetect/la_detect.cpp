@@ -13,11 +13,14 @@
 * See the Mulan PSL v2 for more details.
 */
 
+#include <cstring>
+
 #include "common_header_autogen.h"
 #include "ruletable_util.h"
 #include "gen_summary.h"
 #include "la_detect.h"
 #include "container.h"
+#include "gen_token.h"
 
 MemPool gMemPool;
 
@@ -464,6 +467,350 @@ void LADetector::PatchPending(Pending *pending) {
   }
 }
 
+////////////////////////////////////////////////////////////////////////////////////
+//                           Single Match Detection
+// The traversal keeps all the matchings of a rule table, since the parent may need
+// a shorter one to go on. A table is single match if only its longest matching can
+// be part of a successful parsing, and the parser keeps only that one. There are
+// two cases.
+//
+// 1. The table never has two matchings at the same token. It's true for a token,
+//    Identifier and Literal. A Oneof is so if its children are so and never match
+//    zero tokens, and their lookaheads don't overlap or it's RP_Single. A
+//    Concatenate is so if each child is so, except a ZEROORxxx child whose element
+//    is so, and whose lookaheads don't overlap with those of the rest children.
+//    The rest can't be all maybe zero. Eg.
+//      rule Block : '{' + ZEROORMORE(BlockStatement) + '}'
+//    The ZEROORMORE stops only before a '}', which can't start a BlockStatement.
+//    All tables are assumed so at first, and those breaking the conditions are
+//    dropped until nothing changes.
+// 2. A ZEROORxxx table whose element is (1), and which is used only by the
+//    Concatenates like above. The 'zero' and shorter matchings leave the rest
+//    children at a lookahead of the element, so they fail anyway.
+// 3. A table which is balanced in a pair of brackets, and which is used only by
+//    the Concatenates where the closing bracket follows it. Eg.
+//      rule Arguments : '(' + ZEROORONE(ArgumentList) + ')'
+//    Any matching of ArgumentList is balanced in '(' and ')', so a shorter one
+//    can't be followed by a ')' which is inside the longest one. A Concatenate
+//    child like this is also fine in (1).
+//
+// A table without lookahead, which is not reachable from the top tables, is never
+// single match.
+////////////////////////////////////////////////////////////////////////////////////
+
+bool LADetector::EntryCanBeZero(TableData *data) {
+  if (data->mType == DT_Subtable)
+    return mCanBeZero[data->mData.mEntry->mIndex];
+  return false;
+}
+
+bool LADetector::EntrySingleMatch(TableData *data) {
+  if (data->mType == DT_Subtable)
+    return mSingleMatch[data->mData.mEntry->mIndex];
+  return true;
+}
+
+// Returns false if the lookaheads are unknown.
+bool LADetector::GetEntryLookAheads(TableData *data, std::vector<LookAhead> &las) {
+  if (data->mType == DT_Token) {
+    LookAhead la;
+    la.mType = LA_Token;
+    la.mData.mTokenId = data->mData.mTokenId;
+    las.push_back(la);
+    return true;
+  }
+  if (data->mType != DT_Subtable)
+    return false;
+
+  RuleLookAhead *rule_la = GetRuleLookAhead(data->mData.mEntry);
+  if (!rule_la)
+    return false;
+  for (unsigned i = 0; i < rule_la->mLookAheads.GetNum(); i++)
+    las.push_back(rule_la->mLookAheads.ValueAtIndex(i));
+  return true;
+}
+
+// The lookaheads of the children after 'idx'. Returns false if they are unknown
+// or all the rest children may match zero tokens.
+bool LADetector::GetRestLookAheads(RuleTable *rule_table, unsigned idx,
+                                   std::vector<LookAhead> &las) {
+  for (unsigned i = idx + 1; i < rule_table->mNum; i++) {
+    TableData *data = rule_table->mData + i;
+    if (!GetEntryLookAheads(data, las))
+      return false;
+    if (!EntryCanBeZero(data))
+      return true;
+  }
+  return false;
+}
+
+// Char and String are not checked by the parser, so they overlap with anything.
+bool LADetector::Disjoint(std::vector<LookAhead> &a, std::vector<LookAhead> &b) {
+  for (unsigned i = 0; i < a.size(); i++) {
+    if (a[i].mType == LA_Char || a[i].mType == LA_String)
+      return false;
+    for (unsigned j = 0; j < b.size(); j++) {
+      if (b[j].mType == LA_Char || b[j].mType == LA_String)
+        return false;
+      if (LookAheadEqual(a[i], b[j]))
+        return false;
+    }
+  }
+  return true;
+}
+
+// If the ZEROORxxx 'zero' at 'idx' of Concatenate 'parent' can stop only after
+// its longest matching.
+bool LADetector::GreedyInConcatenate(RuleTable *zero, RuleTable *parent, unsigned idx) {
+  TableData *elem = zero->mData;
+  if (!EntrySingleMatch(elem) || EntryCanBeZero(elem))
+    return false;
+
+  std::vector<LookAhead> elem_las;
+  std::vector<LookAhead> rest_las;
+  if (!GetEntryLookAheads(elem, elem_las) || !GetRestLookAheads(parent, idx, rest_las))
+    return false;
+  return Disjoint(elem_las, rest_las);
+}
+
+bool LADetector::CheckSingleMatch(RuleTable *rule_table) {
+  if (rule_table == &TblIdentifier || rule_table == &TblLiteral)
+    return true;
+
+  switch(rule_table->mType) {
+  case ET_Data:
+    return EntrySingleMatch(rule_table->mData);
+  case ET_Oneof: {
+    std::vector<std::vector<LookAhead> > las(rule_table->mNum);
+    for (unsigned i = 0; i < rule_table->mNum; i++) {
+      TableData *data = rule_table->mData + i;
+      if (!EntrySingleMatch(data) || EntryCanBeZero(data))
+        return false;
+      if (!GetEntryLookAheads(data, las[i]))
+        return false;
+    }
+    if (rule_table->mProperties & RP_Single)
+      return true;
+    for (unsigned i = 0; i < rule_table->mNum; i++) {
+      for (unsigned j = i + 1; j < rule_table->mNum; j++) {
+        if (!Disjoint(las[i], las[j]))
+          return false;
+      }
+    }
+    return true;
+  }
+  case ET_Concatenate:
+    for (unsigned i = 0; i < rule_table->mNum; i++) {
+      TableData *data = rule_table->mData + i;
+      if (Delimited(rule_table, i))
+        continue;
+      if (data->mType == DT_Subtable) {
+        RuleTable *child = data->mData.mEntry;
+        if (child->mType == ET_Zeroormore || child->mType == ET_Zeroorone) {
+          if (!GreedyInConcatenate(child, rule_table, i))
+            return false;
+          continue;
+        }
+      }
+      if (!EntrySingleMatch(data) || EntryCanBeZero(data))
+        return false;
+    }
+    return true;
+  default:
+    return false;
+  }
+}
+
+// The brackets whose pairs are checked in case 3.
+static SepId gBrackets[][2] = {{SEP_Lparen, SEP_Rparen},
+                               {SEP_Lbrace, SEP_Rbrace},
+                               {SEP_Lbrack, SEP_Rbrack}};
+#define BRACKET_NUM (sizeof(gBrackets) / sizeof(gBrackets[0]))
+
+// Returns the separator of a token, char or string, or SEP_NA.
+static SepId EntrySeparator(TableData *data) {
+  const char *text = NULL;
+  char c[2] = {0, 0};
+  if (data->mType == DT_Token) {
+    Token *token = &gSystemTokens[data->mData.mTokenId];
+    return token->IsSeparator() ? token->mData.mSepId : SEP_NA;
+  } else if (data->mType == DT_Char) {
+    c[0] = data->mData.mChar;
+    text = c;
+  } else if (data->mType == DT_String) {
+    text = data->mData.mString;
+  }
+
+  if (text) {
+    for (unsigned i = 0; i < SEP_NA; i++) {
+      if (!strcmp(SepTable[i].mText, text))
+        return SepTable[i].mId;
+    }
+  }
+  return SEP_NA;
+}
+
+bool LADetector::EntryBalanced(TableData *data, unsigned bracket) {
+  if (data->mType == DT_Subtable)
+    return mBalanced[bracket][data->mData.mEntry->mIndex];
+  SepId sep = EntrySeparator(data);
+  return sep != gBrackets[bracket][0] && sep != gBrackets[bracket][1];
+}
+
+// Every matching of a balanced table has as many opening brackets as closing
+// ones, and never more closing ones at any point.
+bool LADetector::CheckBalanced(RuleTable *rule_table, unsigned bracket) {
+  if (rule_table == &TblIdentifier || rule_table == &TblLiteral)
+    return true;
+
+  if (rule_table->mType == ET_Concatenate) {
+    unsigned depth = 0;
+    for (unsigned i = 0; i < rule_table->mNum; i++) {
+      TableData *data = rule_table->mData + i;
+      SepId sep = EntrySeparator(data);
+      if (sep == gBrackets[bracket][0]) {
+        depth++;
+      } else if (sep == gBrackets[bracket][1]) {
+        if (depth == 0)
+          return false;
+        depth--;
+      } else if (!EntryBalanced(data, bracket)) {
+        return false;
+      }
+    }
+    return depth == 0;
+  }
+
+  for (unsigned i = 0; i < rule_table->mNum; i++) {
+    if (!EntryBalanced(rule_table->mData + i, bracket))
+      return false;
+  }
+  return true;
+}
+
+// If the child at 'idx' of Concatenate 'parent' is followed by a closing bracket,
+// in which it's balanced.
+bool LADetector::Delimited(RuleTable *parent, unsigned idx) {
+  if (idx + 1 >= parent->mNum)
+    return false;
+  SepId sep = EntrySeparator(parent->mData + idx + 1);
+  for (unsigned i = 0; i < BRACKET_NUM; i++) {
+    if (sep == gBrackets[i][1])
+      return EntryBalanced(parent->mData + idx, i);
+  }
+  return false;
+}
+
+// Case 2 and 3.
+bool LADetector::CheckUses(RuleTable *rule_table) {
+  if (rule_table == &TblIdentifier || rule_table == &TblLiteral)
+    return false;
+  for (unsigned i = 0; i < gTopRulesNum; i++) {
+    if (gTopRules[i] == rule_table)
+      return false;
+  }
+
+  bool zero = rule_table->mType == ET_Zeroormore || rule_table->mType == ET_Zeroorone;
+  bool used = false;
+  for (unsigned i = 0; i < RuleTableNum; i++) {
+    RuleTable *parent = (RuleTable*)gRuleTableSummarys[i].mAddr;
+    for (unsigned j = 0; j < parent->mNum; j++) {
+      TableData *data = parent->mData + j;
+      if (data->mType != DT_Subtable || data->mData.mEntry != rule_table)
+        continue;
+      if (parent->mType != ET_Concatenate)
+        return false;
+      if (!Delimited(parent, j) &&
+          !(zero && GreedyInConcatenate(rule_table, parent, j)))
+        return false;
+      used = true;
+    }
+  }
+  return used;
+}
+
+void LADetector::DetectSingleMatch() {
+  // The tables maybe matching zero tokens, starting from none.
+  mCanBeZero.assign(RuleTableNum, false);
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (unsigned i = 0; i < RuleTableNum; i++) {
+      RuleTable *rule_table = (RuleTable*)gRuleTableSummarys[i].mAddr;
+      if (mCanBeZero[i])
+        continue;
+      bool zero = false;
+      switch(rule_table->mType) {
+      case ET_Zeroormore:
+      case ET_Zeroorone:
+        zero = true;
+        break;
+      case ET_Oneof:
+        for (unsigned j = 0; j < rule_table->mNum; j++)
+          zero = zero || EntryCanBeZero(rule_table->mData + j);
+        break;
+      case ET_Concatenate:
+        zero = true;
+        for (unsigned j = 0; j < rule_table->mNum; j++)
+          zero = zero && EntryCanBeZero(rule_table->mData + j);
+        break;
+      case ET_Data:
+        zero = EntryCanBeZero(rule_table->mData);
+        break;
+      default:
+        break;
+      }
+      if (zero) {
+        mCanBeZero[i] = true;
+        changed = true;
+      }
+    }
+  }
+
+  // The balanced tables, starting from all.
+  mBalanced.assign(BRACKET_NUM, std::vector<bool>(RuleTableNum, true));
+  for (unsigned b = 0; b < BRACKET_NUM; b++) {
+    changed = true;
+    while (changed) {
+      changed = false;
+      for (unsigned i = 0; i < RuleTableNum; i++) {
+        RuleTable *rule_table = (RuleTable*)gRuleTableSummarys[i].mAddr;
+        if (mBalanced[b][i] && !CheckBalanced(rule_table, b)) {
+          mBalanced[b][i] = false;
+          changed = true;
+        }
+      }
+    }
+  }
+
+  // Case 1, starting from all.
+  mSingleMatch.assign(RuleTableNum, true);
+  changed = true;
+  while (changed) {
+    changed = false;
+    for (unsigned i = 0; i < RuleTableNum; i++) {
+      RuleTable *rule_table = (RuleTable*)gRuleTableSummarys[i].mAddr;
+      if (mSingleMatch[i] && !CheckSingleMatch(rule_table)) {
+        mSingleMatch[i] = false;
+        changed = true;
+      }
+    }
+  }
+
+  // Case 2 and 3 depend on case 1 only, so they are done after. A table used
+  // by a ZEROORMORE is never in them, so a single match element is always (1).
+  std::vector<bool> greedy(RuleTableNum, false);
+  for (unsigned i = 0; i < RuleTableNum; i++) {
+    RuleTable *rule_table = (RuleTable*)gRuleTableSummarys[i].mAddr;
+    if (!mSingleMatch[i])
+      greedy[i] = CheckUses(rule_table);
+  }
+  for (unsigned i = 0; i < RuleTableNum; i++) {
+    if (greedy[i])
+      mSingleMatch[i] = true;
+  }
+}
+
 // The reason I have a Release() is to make sure the destructors of RuleLookAheads
 // and Pendings are invoked ahead of destructor of gMemPool.
 void LADetector::Release() {
@@ -591,6 +938,19 @@ void LADetector::WriteCppFile() {
   mCppFile->WriteOneLine(global.c_str(), global.size());
   global = "LookAheadTable *gLookAheadTable = localLookAheadTable;";
   mCppFile->WriteOneLine(global.c_str(), global.size());
+
+  // Step 3. Write the single match flags of all rules.
+  global = "bool localSingleMatch[] = {";
+  mCppFile->WriteOneLine(global.c_str(), global.size());
+  for (unsigned i = 0; i < RuleTableNum; i++) {
+    std::string s = mSingleMatch[i] ? "  true, // " : "  false, // ";
+    s += gRuleTableSummarys[i].mName;
+    mCppFile->WriteOneLine(s.c_str(), s.size());
+  }
+  global = "};";
+  mCppFile->WriteOneLine(global.c_str(), global.size());
+  global = "bool *gSingleMatch = localSingleMatch;";
+  mCppFile->WriteOneLine(global.c_str(), global.size());
 }
 
 // Write the recursion to java/gen_recursion.h and java/gen_recursion.cpp
@@ -614,6 +974,7 @@ int main(int argc, char *argv[]) {
   gMemPool.SetBlockSize(4096);
   LADetector dtc;
   dtc.Detect();
+  dtc.DetectSingleMatch();
   dtc.Write();
   dtc.Release();
   return 0;
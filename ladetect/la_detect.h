@@ -23,6 +23,8 @@
 #ifndef __LA_DETECT_H__
 #define __LA_DETECT_H__
 
+#include <vector>
+
 #include "container.h"
 #include "ruletable.h"
 #include "write2file.h"
@@ -115,6 +117,24 @@ public:
   RuleLookAhead* GetRuleLookAhead(RuleTable*);
   RuleLookAhead* CreateRuleLookAhead(RuleTable*);
 
+  // Single match detection, indexed by RuleTable::mIndex.
+  std::vector<bool> mCanBeZero;
+  std::vector<bool> mSingleMatch;
+  std::vector<std::vector<bool> > mBalanced;  // [bracket][table]
+
+  bool EntryCanBeZero(TableData*);
+  bool EntrySingleMatch(TableData*);
+  bool GetEntryLookAheads(TableData*, std::vector<LookAhead>&);
+  bool GetRestLookAheads(RuleTable*, unsigned, std::vector<LookAhead>&);
+  bool Disjoint(std::vector<LookAhead>&, std::vector<LookAhead>&);
+  bool GreedyInConcatenate(RuleTable *zero, RuleTable *parent, unsigned idx);
+  bool EntryBalanced(TableData*, unsigned bracket);
+  bool CheckBalanced(RuleTable*, unsigned bracket);
+  bool Delimited(RuleTable *parent, unsigned idx);
+  bool CheckSingleMatch(RuleTable*);
+  bool CheckUses(RuleTable*);
+  void DetectSingleMatch();
+
 private:
   Write2File *mCppFile;
   Write2File *mHeaderFile;
@@ -0,0 +1,470 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the microbenchmarks of the hot primitives of shared,
+// each measured alone without lexing or parsing a real file.
+//
+// Each benchmark does a number of operations between Start() and Stop() of
+// the timer. Setup outside of them is not measured. The best of the runs is
+// reported in ns/op, along with the malloc/calloc/realloc calls per op, which
+// include those of operator new.
+//
+// usage: microbench [--runs=N] [--scale=N] [name ...]
+//   --runs=N  : runs of each benchmark, the fastest is reported. Default 5
+//   --scale=N : multiplies the operations of each benchmark. Default 1
+//   name      : only run the benchmarks whose names start with one of them
+//////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <cstring>
+#include <cstdlib>
+
+#include "lexer.h"
+#include "token.h"
+#include "stringpool.h"
+#include "container.h"
+#include "succ_match.h"
+#include "mempool.h"
+#include "ruletable_util.h"
+#include "common_header_autogen.h"
+
+//////////////////////////////////////////////////////////////////////////////
+//                        Counting the allocations
+//
+// The allocators of glibc are wrapped. operator new of libstdc++ goes through
+// malloc, so it's counted too.
+//////////////////////////////////////////////////////////////////////////////
+
+extern "C" {
+extern void *__libc_malloc(size_t);
+extern void *__libc_calloc(size_t, size_t);
+extern void *__libc_realloc(void*, size_t);
+}
+
+static unsigned long long gAllocs = 0;
+
+extern "C" void* malloc(size_t size) {
+  gAllocs++;
+  return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t num, size_t size) {
+  gAllocs++;
+  return __libc_calloc(num, size);
+}
+
+extern "C" void* realloc(void *addr, size_t size) {
+  gAllocs++;
+  return __libc_realloc(addr, size);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                             The framework
+//////////////////////////////////////////////////////////////////////////////
+
+class BenchTimer {
+private:
+  std::chrono::steady_clock::time_point mStart;
+  unsigned long long mAllocsAtStart;
+public:
+  unsigned long long mNs;
+  unsigned long long mAllocs;
+  unsigned long long mOps;   // set by the benchmark if it's not the asked number.
+
+  BenchTimer() : mNs(0), mAllocs(0), mOps(0) {}
+
+  void Start() {
+    mAllocsAtStart = gAllocs;
+    mStart = std::chrono::steady_clock::now();
+  }
+  void Stop() {
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    mAllocs += gAllocs - mAllocsAtStart;
+    mNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - mStart).count();
+  }
+};
+
+typedef void (*BenchFunc)(BenchTimer&, unsigned);
+
+struct Bench {
+  const char *mName;
+  BenchFunc   mFunc;
+  unsigned    mOps;     // operations of a run, before --scale.
+};
+
+// Keeps the results alive so that the work isn't optimized away.
+static volatile unsigned long long gSink = 0;
+
+//////////////////////////////////////////////////////////////////////////////
+//                                 Lexer
+//
+// The source is a mix of tokens of one kind, or all kinds, ten per line.
+// One op is one token, white spaces included.
+//////////////////////////////////////////////////////////////////////////////
+
+static const char *gIdentifiers[] = {"a", "count", "mValue", "buffer_size", "HashMap", "i"};
+static const char *gKeywords[] = {"public", "class", "int", "return", "static", "while"};
+static const char *gOperators[] = {"+", "==", "<<=", "&&", "++", "!="};
+static const char *gSeparators[] = {"(", ")", "{", "}", ";", ","};
+static const char *gLiterals[] = {"0", "12345", "3.14f", "'c'", "\"hello\"", "true"};
+
+static std::string MakeSource(const char **words, unsigned num, unsigned tokens) {
+  std::string src;
+  for (unsigned i = 0; i < tokens; i++) {
+    src += words[(i * 7 + i / num) % num];
+    src += (i % 10 == 9) ? "\n" : " ";
+  }
+  src += "\n";
+  return src;
+}
+
+static void LexSource(BenchTimer &t, const std::string &src) {
+  Lexer *lexer = new Lexer();
+  t.Start();
+  lexer->PrepareForBuffer(src.c_str(), src.size());
+  unsigned long long tokens = 0;
+  while (true) {
+    while (!lexer->EndOfLine() && !lexer->EndOfFile()) {
+      Token *token = lexer->LexToken();
+      if (!token)
+        break;
+      tokens++;
+    }
+    if (lexer->EndOfFile())
+      break;
+    lexer->ReadALine();
+  }
+  t.Stop();
+  t.mOps = tokens;
+  delete lexer;
+}
+
+static void BenchLexIdentifier(BenchTimer &t, unsigned ops) {
+  LexSource(t, MakeSource(gIdentifiers, 6, ops / 2));
+}
+
+static void BenchLexKeyword(BenchTimer &t, unsigned ops) {
+  LexSource(t, MakeSource(gKeywords, 6, ops / 2));
+}
+
+static void BenchLexOperator(BenchTimer &t, unsigned ops) {
+  LexSource(t, MakeSource(gOperators, 6, ops / 2));
+}
+
+static void BenchLexSeparator(BenchTimer &t, unsigned ops) {
+  LexSource(t, MakeSource(gSeparators, 6, ops / 2));
+}
+
+static void BenchLexLiteral(BenchTimer &t, unsigned ops) {
+  LexSource(t, MakeSource(gLiterals, 6, ops / 2));
+}
+
+static void BenchLexMixed(BenchTimer &t, unsigned ops) {
+  const char *words[] = {"public", "int", "count", "=", "0", ";", "if", "(", "a",
+                         "<=", "12345", ")", "{", "return", "\"hello\"", "}", "//x\n"};
+  LexSource(t, MakeSource(words, 17, ops / 2));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                              StringPool
+//////////////////////////////////////////////////////////////////////////////
+
+static void BenchStringPoolHit(BenchTimer &t, unsigned ops) {
+  std::vector<std::string> names;
+  for (unsigned i = 0; i < 1024; i++)
+    names.push_back("hit_" + std::to_string(i));
+  for (unsigned i = 0; i < names.size(); i++)
+    gStringPool.FindString(names[i]);
+
+  t.Start();
+  for (unsigned i = 0; i < ops; i++)
+    gSink += (unsigned long long)gStringPool.FindString(names[i & 1023]);
+  t.Stop();
+}
+
+// The same with four threads, as the parsers of --jobs=4 do. One op is one
+// lookup of any thread.
+static void BenchStringPoolHitThreads(BenchTimer &t, unsigned ops) {
+  std::vector<std::string> names;
+  for (unsigned i = 0; i < 1024; i++)
+    names.push_back("hit_" + std::to_string(i));
+  for (unsigned i = 0; i < names.size(); i++)
+    gStringPool.FindString(names[i]);
+
+  std::vector<std::thread> threads;
+  unsigned long long sums[4] = {0, 0, 0, 0};
+  t.Start();
+  for (unsigned n = 0; n < 4; n++) {
+    threads.push_back(std::thread([&names, &sums, ops, n]() {
+      for (unsigned i = n; i < ops; i += 4)
+        sums[n] += (unsigned long long)gStringPool.FindString(names[i & 1023]);
+    }));
+  }
+  for (unsigned n = 0; n < 4; n++)
+    threads[n].join();
+  t.Stop();
+  gSink += sums[0] + sums[1] + sums[2] + sums[3];
+}
+
+// The strings are unique across runs, so every lookup is a miss.
+static void BenchStringPoolMiss(BenchTimer &t, unsigned ops) {
+  static unsigned run = 0;
+  std::vector<std::string> names;
+  for (unsigned i = 0; i < ops; i++)
+    names.push_back("miss_" + std::to_string(run) + "_" + std::to_string(i));
+  run++;
+
+  t.Start();
+  for (unsigned i = 0; i < ops; i++)
+    gSink += (unsigned long long)gStringPool.FindString(names[i]);
+  t.Stop();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                         SmallVector, Guamian
+//////////////////////////////////////////////////////////////////////////////
+
+static void BenchSmallVectorPush(BenchTimer &t, unsigned ops) {
+  SmallVector<unsigned> vec;
+  t.Start();
+  for (unsigned i = 0; i < ops; i++)
+    vec.PushBack(i);
+  t.Stop();
+  gSink += vec.GetNum();
+}
+
+static void BenchSmallVectorIndex(BenchTimer &t, unsigned ops) {
+  SmallVector<unsigned> vec;
+  for (unsigned i = 0; i < 4096; i++)
+    vec.PushBack(i);
+  t.Start();
+  unsigned long long sum = 0;
+  for (unsigned i = 0; i < ops; i++)
+    sum += vec.ValueAtIndex((i * 2654435761u) & 4095);
+  t.Stop();
+  gSink += sum;
+}
+
+// 64 keys, like the rules visited at a few start tokens.
+static void BenchGuamianInsert(BenchTimer &t, unsigned ops) {
+  Guamian<unsigned, unsigned, unsigned> guamian;
+  t.Start();
+  for (unsigned i = 0; i < ops; i++)
+    guamian.AddElem(i & 63, i);
+  t.Stop();
+}
+
+static void BenchGuamianFind(BenchTimer &t, unsigned ops) {
+  Guamian<unsigned, unsigned, unsigned> guamian;
+  for (unsigned i = 0; i < 64 * 8; i++)
+    guamian.AddElem(i & 63, i);
+  t.Start();
+  unsigned long long found = 0;
+  for (unsigned i = 0; i < ops; i++)
+    found += guamian.FindElem(i & 63, i & 511);
+  t.Stop();
+  gSink += found;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                               SuccMatch
+//
+// Each start token has four matchings, as a rule matching a few lengths.
+//////////////////////////////////////////////////////////////////////////////
+
+static void BenchSuccMatchAdd(BenchTimer &t, unsigned ops) {
+  SuccMatch *succ = new SuccMatch();
+  t.Start();
+  for (unsigned i = 0; i < ops; i++) {
+    if ((i & 3) == 0)
+      succ->AddStartToken(i / 4);
+    succ->AddMatch(i / 4 + (i & 3) + 1);
+  }
+  t.Stop();
+  delete succ;
+}
+
+static void BenchSuccMatchQuery(BenchTimer &t, unsigned ops) {
+  SuccMatch *succ = new SuccMatch();
+  for (unsigned i = 0; i < 1024 * 4; i++) {
+    if ((i & 3) == 0)
+      succ->AddStartToken(i / 4);
+    succ->AddMatch(i / 4 + (i & 3) + 1);
+  }
+  t.Start();
+  unsigned long long found = 0;
+  for (unsigned i = 0; i < ops; i++) {
+    unsigned token = (i * 2654435761u) & 1023;
+    found += succ->FindMatch(token, token + (i & 3) + 1);
+  }
+  t.Stop();
+  gSink += found;
+  delete succ;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                                MemPool
+//////////////////////////////////////////////////////////////////////////////
+
+static void BenchMemPoolAlloc(BenchTimer &t, unsigned ops) {
+  static const unsigned sizes[] = {16, 24, 48, 120};
+  MemPool *pool = new MemPool();
+  t.Start();
+  for (unsigned i = 0; i < ops; i++)
+    gSink += (unsigned long long)pool->Alloc(sizes[i & 3]);
+  t.Stop();
+  delete pool;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                  FindSeparator, FindOperator, FindKeyword
+//
+// The inputs are all the entries of the tables, each followed by more text
+// as it is in a line.
+//////////////////////////////////////////////////////////////////////////////
+
+static void MakeInputs(std::vector<std::string> &inputs, const char *text) {
+  inputs.push_back(std::string(text) + " x = y;");
+}
+
+static void BenchFindSeparator(BenchTimer &t, unsigned ops) {
+  std::vector<std::string> inputs;
+  for (unsigned i = 0; i < SEP_NA; i++)
+    MakeInputs(inputs, SepTable[i].mText);
+  t.Start();
+  for (unsigned i = 0; i < ops; i++) {
+    unsigned len = 0;
+    gSink += FindSeparator(inputs[i % inputs.size()].c_str(), 0, len) + len;
+  }
+  t.Stop();
+}
+
+static void BenchFindOperator(BenchTimer &t, unsigned ops) {
+  std::vector<std::string> inputs;
+  for (unsigned i = 0; i < OPR_NA; i++)
+    MakeInputs(inputs, OprTable[i].mText);
+  t.Start();
+  for (unsigned i = 0; i < ops; i++) {
+    unsigned len = 0;
+    gSink += FindOperator(inputs[i % inputs.size()].c_str(), 0, len) + len;
+  }
+  t.Stop();
+}
+
+static void BenchFindKeyword(BenchTimer &t, unsigned ops) {
+  std::vector<std::string> inputs;
+  for (unsigned i = 0; i < KeywordTableSize; i++)
+    MakeInputs(inputs, KeywordTable[i].mText);
+  t.Start();
+  for (unsigned i = 0; i < ops; i++) {
+    unsigned len = 0;
+    gSink += (unsigned long long)FindKeyword(inputs[i % inputs.size()].c_str(), 0, len) + len;
+  }
+  t.Stop();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static Bench gBenches[] = {
+  {"lex-identifier",     BenchLexIdentifier,    200000},
+  {"lex-keyword",        BenchLexKeyword,       200000},
+  {"lex-operator",       BenchLexOperator,      200000},
+  {"lex-separator",      BenchLexSeparator,     200000},
+  {"lex-literal",        BenchLexLiteral,       200000},
+  {"lex-mixed",          BenchLexMixed,         200000},
+  {"stringpool-hit",     BenchStringPoolHit,   1000000},
+  {"stringpool-hit-4t",  BenchStringPoolHitThreads, 1000000},
+  {"stringpool-miss",    BenchStringPoolMiss,   200000},
+  {"smallvector-push",   BenchSmallVectorPush, 1000000},
+  {"smallvector-index",  BenchSmallVectorIndex,1000000},
+  {"guamian-insert",     BenchGuamianInsert,    200000},
+  {"guamian-find",       BenchGuamianFind,      200000},
+  {"succmatch-add",      BenchSuccMatchAdd,     200000},
+  {"succmatch-query",    BenchSuccMatchQuery,   200000},
+  {"mempool-alloc",      BenchMemPoolAlloc,    1000000},
+  {"find-separator",     BenchFindSeparator,   1000000},
+  {"find-operator",      BenchFindOperator,    1000000},
+  {"find-keyword",       BenchFindKeyword,     1000000},
+};
+
+static bool Selected(const char *name, std::vector<const char*> &filters) {
+  if (filters.empty())
+    return true;
+  for (unsigned i = 0; i < filters.size(); i++) {
+    if (!strncmp(name, filters[i], strlen(filters[i])))
+      return true;
+  }
+  return false;
+}
+
+int main(int argc, char *argv[]) {
+  unsigned runs = 5;
+  unsigned scale = 1;
+  std::vector<const char*> filters;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strncmp(argv[i], "--runs=", 7)) {
+      runs = atoi(argv[i] + 7);
+    } else if (!strncmp(argv[i], "--scale=", 8)) {
+      scale = atoi(argv[i] + 8);
+    } else if (!strncmp(argv[i], "--", 2)) {
+      std::cerr << "unknown option " << argv[i] << std::endl;
+      return 1;
+    } else {
+      filters.push_back(argv[i]);
+    }
+  }
+  if (!runs)
+    runs = 1;
+  if (!scale)
+    scale = 1;
+
+  std::cout << std::left << std::setw(20) << "Benchmark" << std::right
+            << std::setw(12) << "Ops" << std::setw(12) << "ns/op"
+            << std::setw(12) << "allocs/op" << std::endl;
+  std::cout << std::fixed;
+
+  for (unsigned i = 0; i < sizeof(gBenches) / sizeof(Bench); i++) {
+    Bench *bench = &gBenches[i];
+    if (!Selected(bench->mName, filters))
+      continue;
+
+    unsigned ops = bench->mOps * scale;
+    double best_ns = 0;
+    double allocs = 0;
+    unsigned long long done = 0;
+    for (unsigned r = 0; r < runs; r++) {
+      BenchTimer timer;
+      bench->mFunc(timer, ops);
+      done = timer.mOps ? timer.mOps : ops;
+      double ns = (double)timer.mNs / done;
+      if (r == 0 || ns < best_ns)
+        best_ns = ns;
+      allocs = (double)timer.mAllocs / done;
+    }
+
+    std::cout << std::left << std::setw(20) << bench->mName << std::right
+              << std::setw(12) << done
+              << std::setw(12) << std::setprecision(1) << best_ns
+              << std::setw(12) << std::setprecision(3) << allocs << std::endl;
+  }
+  return 0;
+}
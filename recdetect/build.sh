@@ -33,6 +33,8 @@ rm $1/gen_recursion.h
 rm $1/gen_recursion.cpp
 rm $1/gen_lookahead.h
 rm $1/gen_lookahead.cpp
+# The compiled rule tables call the parser.
+rm $1/gen_match.cpp
 
 mkdir -p ../build64/recdetect
 mkdir -p ../build64/recdetect/$1
@@ -0,0 +1,372 @@
+#include "common_header_autogen.h"
+TableData TblClassDeclaration_data[2] ={{DT_Subtable, &TblNormalClassDeclaration},{DT_Subtable, &TblEnumDeclaration}};
+RuleTable TblClassDeclaration ={ET_Oneof, RP_Single|RP_Top, 2, TblClassDeclaration_data, 0, NULL, 157};
+Action TblNormalClassDeclaration_action[5] = {{ACT_BuildClass,1,{3}},{ACT_AddModifier,1,{1}},{ACT_AddClassBody,1,{7}},{ACT_AddSuperClass,1,{5}},{ACT_AddSuperInterface,1,{6}}};
+TableData TblNormalClassDeclaration_sub1_data[1] ={{DT_Subtable, &TblClassModifier}};
+RuleTable TblNormalClassDeclaration_sub1 ={ET_Zeroormore, RP_NA, 1, TblNormalClassDeclaration_sub1_data, 0, NULL, 159};
+TableData TblNormalClassDeclaration_sub2_data[1] ={{DT_Subtable, &TblTypeParameters}};
+RuleTable TblNormalClassDeclaration_sub2 ={ET_Zeroorone, RP_NA, 1, TblNormalClassDeclaration_sub2_data, 0, NULL, 160};
+TableData TblNormalClassDeclaration_sub3_data[1] ={{DT_Subtable, &TblSuperclass}};
+RuleTable TblNormalClassDeclaration_sub3 ={ET_Zeroorone, RP_NA, 1, TblNormalClassDeclaration_sub3_data, 0, NULL, 161};
+TableData TblNormalClassDeclaration_sub4_data[1] ={{DT_Subtable, &TblSuperinterfaces}};
+RuleTable TblNormalClassDeclaration_sub4 ={ET_Zeroorone, RP_NA, 1, TblNormalClassDeclaration_sub4_data, 0, NULL, 162};
+TableData TblNormalClassDeclaration_data[7] ={{DT_Subtable, &TblNormalClassDeclaration_sub1},{DT_Token, {.mTokenId=87}},{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblNormalClassDeclaration_sub2},{DT_Subtable, &TblNormalClassDeclaration_sub3},{DT_Subtable, &TblNormalClassDeclaration_sub4},{DT_Subtable, &TblClassBody}};
+RuleTable TblNormalClassDeclaration ={ET_Concatenate, RP_NA, 7, TblNormalClassDeclaration_data, 5, TblNormalClassDeclaration_action, 158};
+TableData TblClassAttr_data[7] ={{DT_Token, {.mTokenId=70}},{DT_Token, {.mTokenId=56}},{DT_Token, {.mTokenId=63}},{DT_Token, {.mTokenId=61}},{DT_Token, {.mTokenId=69}},{DT_Token, {.mTokenId=78}},{DT_Token, {.mTokenId=59}}};
+RuleTable TblClassAttr ={ET_Oneof, RP_Single, 7, TblClassAttr_data, 0, NULL, 163};
+TableData TblClassModifier_data[2] ={{DT_Subtable, &TblAnnotation},{DT_Subtable, &TblClassAttr}};
+RuleTable TblClassModifier ={ET_Oneof, RP_Single, 2, TblClassModifier_data, 0, NULL, 164};
+TableData TblTypeParameters_data[3] ={{DT_Token, {.mTokenId=31}},{DT_Subtable, &TblTypeParameterList},{DT_Token, {.mTokenId=32}}};
+RuleTable TblTypeParameters ={ET_Concatenate, RP_NA, 3, TblTypeParameters_data, 0, NULL, 165};
+TableData TblTypeParameterList_sub2_data[2] ={{DT_Token, {.mTokenId=44}},{DT_Subtable, &TblTypeParameter}};
+RuleTable TblTypeParameterList_sub2 ={ET_Concatenate, RP_NA, 2, TblTypeParameterList_sub2_data, 0, NULL, 168};
+TableData TblTypeParameterList_sub1_data[1] ={{DT_Subtable, &TblTypeParameterList_sub2}};
+RuleTable TblTypeParameterList_sub1 ={ET_Zeroormore, RP_NA, 1, TblTypeParameterList_sub1_data, 0, NULL, 167};
+TableData TblTypeParameterList_data[2] ={{DT_Subtable, &TblTypeParameter},{DT_Subtable, &TblTypeParameterList_sub1}};
+RuleTable TblTypeParameterList ={ET_Concatenate, RP_NA, 2, TblTypeParameterList_data, 0, NULL, 166};
+extern RuleTable TblPrimitiveType_sub2;
+TableData TblTypeParameter_sub1_data[1] ={{DT_Subtable, &TblTypeBound}};
+RuleTable TblTypeParameter_sub1 ={ET_Zeroorone, RP_NA, 1, TblTypeParameter_sub1_data, 0, NULL, 170};
+TableData TblTypeParameter_data[3] ={{DT_Subtable, &TblPrimitiveType_sub2},{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblTypeParameter_sub1}};
+RuleTable TblTypeParameter ={ET_Concatenate, RP_NA, 3, TblTypeParameter_data, 0, NULL, 169};
+TableData TblTypeParameterModifier_data[1] ={{DT_Subtable, &TblAnnotation}};
+RuleTable TblTypeParameterModifier ={ET_Data, RP_NA, 1, TblTypeParameterModifier_data, 0, NULL, 171};
+TableData TblTypeBound_sub1_data[2] ={{DT_Token, {.mTokenId=64}},{DT_Subtable, &TblTypeVariable}};
+RuleTable TblTypeBound_sub1 ={ET_Concatenate, RP_NA, 2, TblTypeBound_sub1_data, 0, NULL, 173};
+TableData TblTypeBound_sub3_data[1] ={{DT_Subtable, &TblAdditionalBound}};
+RuleTable TblTypeBound_sub3 ={ET_Zeroormore, RP_NA, 1, TblTypeBound_sub3_data, 0, NULL, 175};
+TableData TblTypeBound_sub2_data[3] ={{DT_Token, {.mTokenId=64}},{DT_Subtable, &TblClassOrInterfaceType},{DT_Subtable, &TblTypeBound_sub3}};
+RuleTable TblTypeBound_sub2 ={ET_Concatenate, RP_NA, 3, TblTypeBound_sub2_data, 0, NULL, 174};
+TableData TblTypeBound_data[2] ={{DT_Subtable, &TblTypeBound_sub1},{DT_Subtable, &TblTypeBound_sub2}};
+RuleTable TblTypeBound ={ET_Oneof, RP_NA, 2, TblTypeBound_data, 0, NULL, 172};
+TableData TblAdditionalBound_data[2] ={{DT_Token, {.mTokenId=30}},{DT_Subtable, &TblInterfaceType}};
+RuleTable TblAdditionalBound ={ET_Concatenate, RP_NA, 2, TblAdditionalBound_data, 0, NULL, 176};
+TableData TblSuperclass_data[2] ={{DT_Token, {.mTokenId=64}},{DT_Subtable, &TblClassType}};
+RuleTable TblSuperclass ={ET_Concatenate, RP_NA, 2, TblSuperclass_data, 0, NULL, 177};
+TableData TblSuperinterfaces_data[2] ={{DT_Token, {.mTokenId=54}},{DT_Subtable, &TblInterfaceTypeList}};
+RuleTable TblSuperinterfaces ={ET_Concatenate, RP_NA, 2, TblSuperinterfaces_data, 0, NULL, 178};
+TableData TblInterfaceTypeList_sub2_data[2] ={{DT_Token, {.mTokenId=44}},{DT_Subtable, &TblInterfaceType}};
+RuleTable TblInterfaceTypeList_sub2 ={ET_Concatenate, RP_NA, 2, TblInterfaceTypeList_sub2_data, 0, NULL, 181};
+TableData TblInterfaceTypeList_sub1_data[1] ={{DT_Subtable, &TblInterfaceTypeList_sub2}};
+RuleTable TblInterfaceTypeList_sub1 ={ET_Zeroormore, RP_NA, 1, TblInterfaceTypeList_sub1_data, 0, NULL, 180};
+TableData TblInterfaceTypeList_data[2] ={{DT_Subtable, &TblInterfaceType},{DT_Subtable, &TblInterfaceTypeList_sub1}};
+RuleTable TblInterfaceTypeList ={ET_Concatenate, RP_NA, 2, TblInterfaceTypeList_data, 0, NULL, 179};
+Action TblClassBody_action[1] = {{ACT_BuildBlock,1,{2}}};
+TableData TblClassBody_sub1_data[1] ={{DT_Subtable, &TblClassBodyDeclaration}};
+RuleTable TblClassBody_sub1 ={ET_Zeroormore, RP_NA, 1, TblClassBody_sub1_data, 0, NULL, 183};
+TableData TblClassBody_data[3] ={{DT_Token, {.mTokenId=49}},{DT_Subtable, &TblClassBody_sub1},{DT_Token, {.mTokenId=48}}};
+RuleTable TblClassBody ={ET_Concatenate, RP_NA, 3, TblClassBody_data, 1, TblClassBody_action, 182};
+TableData TblClassBodyDeclaration_data[4] ={{DT_Subtable, &TblClassMemberDeclaration},{DT_Subtable, &TblInstanceInitializer},{DT_Subtable, &TblStaticInitializer},{DT_Subtable, &TblConstructorDeclaration}};
+RuleTable TblClassBodyDeclaration ={ET_Oneof, RP_Single, 4, TblClassBodyDeclaration_data, 0, NULL, 184};
+Action TblInstanceInitializer_action[1] = {{ACT_BuildInstInit,1,{1}}};
+TableData TblInstanceInitializer_data[1] ={{DT_Subtable, &TblBlock}};
+RuleTable TblInstanceInitializer ={ET_Data, RP_NA, 1, TblInstanceInitializer_data, 1, TblInstanceInitializer_action, 185};
+Action TblStaticInitializer_action[2] = {{ACT_BuildInstInit,1,{2}},{ACT_AddModifierTo,2,{2,1}}};
+TableData TblStaticInitializer_data[2] ={{DT_Token, {.mTokenId=69}},{DT_Subtable, &TblBlock}};
+RuleTable TblStaticInitializer ={ET_Concatenate, RP_NA, 2, TblStaticInitializer_data, 2, TblStaticInitializer_action, 186};
+TableData TblClassMemberDeclaration_data[5] ={{DT_Subtable, &TblFieldDeclaration},{DT_Subtable, &TblMethodDeclaration},{DT_Subtable, &TblClassDeclaration},{DT_Subtable, &TblInterfaceDeclaration},{DT_Token, {.mTokenId=45}}};
+RuleTable TblClassMemberDeclaration ={ET_Oneof, RP_Single, 5, TblClassMemberDeclaration_data, 0, NULL, 187};
+Action TblFieldDeclaration_action[2] = {{ACT_BuildDecl,2,{2,3}},{ACT_AddModifier,1,{1}}};
+TableData TblFieldDeclaration_sub1_data[1] ={{DT_Subtable, &TblFieldModifier}};
+RuleTable TblFieldDeclaration_sub1 ={ET_Zeroormore, RP_NA, 1, TblFieldDeclaration_sub1_data, 0, NULL, 189};
+TableData TblFieldDeclaration_data[4] ={{DT_Subtable, &TblFieldDeclaration_sub1},{DT_Subtable, &TblUnannType},{DT_Subtable, &TblVariableDeclaratorList},{DT_Token, {.mTokenId=45}}};
+RuleTable TblFieldDeclaration ={ET_Concatenate, RP_NA, 4, TblFieldDeclaration_data, 2, TblFieldDeclaration_action, 188};
+Action TblMethodDeclaration_action[2] = {{ACT_AddModifierTo,2,{2,1}},{ACT_AddFunctionBodyTo,2,{2,3}}};
+TableData TblMethodDeclaration_sub1_data[1] ={{DT_Subtable, &TblMethodModifier}};
+RuleTable TblMethodDeclaration_sub1 ={ET_Zeroormore, RP_NA, 1, TblMethodDeclaration_sub1_data, 0, NULL, 191};
+TableData TblMethodDeclaration_data[3] ={{DT_Subtable, &TblMethodDeclaration_sub1},{DT_Subtable, &TblMethodHeader},{DT_Subtable, &TblMethodBody}};
+RuleTable TblMethodDeclaration ={ET_Concatenate, RP_NA, 3, TblMethodDeclaration_data, 2, TblMethodDeclaration_action, 190};
+TableData TblMethodBody_data[2] ={{DT_Subtable, &TblBlock},{DT_Token, {.mTokenId=45}}};
+RuleTable TblMethodBody ={ET_Oneof, RP_Single, 2, TblMethodBody_data, 0, NULL, 192};
+Action TblMethodHeader_sub1_action[2] = {{ACT_AddTypeTo,2,{2,1}},{ACT_AddThrowsTo,2,{2,3}}};
+TableData TblMethodHeader_sub2_data[1] ={{DT_Subtable, &TblThrows}};
+RuleTable TblMethodHeader_sub2 ={ET_Zeroorone, RP_NA, 1, TblMethodHeader_sub2_data, 0, NULL, 195};
+TableData TblMethodHeader_sub1_data[3] ={{DT_Subtable, &TblResult},{DT_Subtable, &TblMethodDeclarator},{DT_Subtable, &TblMethodHeader_sub2}};
+RuleTable TblMethodHeader_sub1 ={ET_Concatenate, RP_NA, 3, TblMethodHeader_sub1_data, 2, TblMethodHeader_sub1_action, 194};
+Action TblMethodHeader_sub3_action[1] = {{ACT_AddThrowsTo,2,{4,5}}};
+extern RuleTable TblPrimitiveType_sub2;
+extern RuleTable TblMethodHeader_sub2;
+TableData TblMethodHeader_sub3_data[5] ={{DT_Subtable, &TblTypeParameters},{DT_Subtable, &TblPrimitiveType_sub2},{DT_Subtable, &TblResult},{DT_Subtable, &TblMethodDeclarator},{DT_Subtable, &TblMethodHeader_sub2}};
+RuleTable TblMethodHeader_sub3 ={ET_Concatenate, RP_NA, 5, TblMethodHeader_sub3_data, 1, TblMethodHeader_sub3_action, 196};
+TableData TblMethodHeader_data[2] ={{DT_Subtable, &TblMethodHeader_sub1},{DT_Subtable, &TblMethodHeader_sub3}};
+RuleTable TblMethodHeader ={ET_Oneof, RP_Single, 2, TblMethodHeader_data, 0, NULL, 193};
+TableData TblResult_data[2] ={{DT_Subtable, &TblUnannType},{DT_Token, {.mTokenId=92}}};
+RuleTable TblResult ={ET_Oneof, RP_Single, 2, TblResult_data, 0, NULL, 197};
+Action TblMethodDeclarator_action[3] = {{ACT_BuildFunction,1,{1}},{ACT_AddParams,1,{3}},{ACT_AddDims,1,{5}}};
+TableData TblMethodDeclarator_sub1_data[1] ={{DT_Subtable, &TblFormalParameterList}};
+RuleTable TblMethodDeclarator_sub1 ={ET_Zeroorone, RP_NA, 1, TblMethodDeclarator_sub1_data, 0, NULL, 199};
+TableData TblMethodDeclarator_sub2_data[1] ={{DT_Subtable, &TblDims}};
+RuleTable TblMethodDeclarator_sub2 ={ET_Zeroorone, RP_NA, 1, TblMethodDeclarator_sub2_data, 0, NULL, 200};
+TableData TblMethodDeclarator_data[5] ={{DT_Subtable, &TblIdentifier},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblMethodDeclarator_sub1},{DT_Token, {.mTokenId=50}},{DT_Subtable, &TblMethodDeclarator_sub2}};
+RuleTable TblMethodDeclarator ={ET_Concatenate, RP_NA, 5, TblMethodDeclarator_data, 3, TblMethodDeclarator_action, 198};
+Action TblThrows_action[1] = {{ACT_BuildThrows,1,{2}}};
+TableData TblThrows_data[2] ={{DT_Token, {.mTokenId=72}},{DT_Subtable, &TblExceptionTypeList}};
+RuleTable TblThrows ={ET_Concatenate, RP_NA, 2, TblThrows_data, 1, TblThrows_action, 201};
+TableData TblExceptionTypeList_sub2_data[2] ={{DT_Token, {.mTokenId=44}},{DT_Subtable, &TblExceptionType}};
+RuleTable TblExceptionTypeList_sub2 ={ET_Concatenate, RP_NA, 2, TblExceptionTypeList_sub2_data, 0, NULL, 204};
+TableData TblExceptionTypeList_sub1_data[1] ={{DT_Subtable, &TblExceptionTypeList_sub2}};
+RuleTable TblExceptionTypeList_sub1 ={ET_Zeroormore, RP_NA, 1, TblExceptionTypeList_sub1_data, 0, NULL, 203};
+TableData TblExceptionTypeList_data[2] ={{DT_Subtable, &TblExceptionType},{DT_Subtable, &TblExceptionTypeList_sub1}};
+RuleTable TblExceptionTypeList ={ET_Concatenate, RP_NA, 2, TblExceptionTypeList_data, 0, NULL, 202};
+TableData TblExceptionType_data[2] ={{DT_Subtable, &TblClassType},{DT_Subtable, &TblTypeVariable}};
+RuleTable TblExceptionType ={ET_Oneof, RP_NA, 2, TblExceptionType_data, 0, NULL, 205};
+TableData TblMethodAttr_data[9] ={{DT_Token, {.mTokenId=70}},{DT_Token, {.mTokenId=56}},{DT_Token, {.mTokenId=63}},{DT_Token, {.mTokenId=61}},{DT_Token, {.mTokenId=69}},{DT_Token, {.mTokenId=78}},{DT_Token, {.mTokenId=53}},{DT_Token, {.mTokenId=71}},{DT_Token, {.mTokenId=59}}};
+RuleTable TblMethodAttr ={ET_Oneof, RP_Single, 9, TblMethodAttr_data, 0, NULL, 206};
+TableData TblMethodModifier_data[2] ={{DT_Subtable, &TblAnnotation},{DT_Subtable, &TblMethodAttr}};
+RuleTable TblMethodModifier ={ET_Oneof, RP_Single, 2, TblMethodModifier_data, 0, NULL, 207};
+Action TblFormalParameterListNoReceiver_sub1_action[1] = {{ACT_BuildVarList,2,{1,3}}};
+TableData TblFormalParameterListNoReceiver_sub1_data[3] ={{DT_Subtable, &TblFormalParameters},{DT_Token, {.mTokenId=44}},{DT_Subtable, &TblLastFormalParameter}};
+RuleTable TblFormalParameterListNoReceiver_sub1 ={ET_Concatenate, RP_NA, 3, TblFormalParameterListNoReceiver_sub1_data, 1, TblFormalParameterListNoReceiver_sub1_action, 209};
+TableData TblFormalParameterListNoReceiver_data[2] ={{DT_Subtable, &TblFormalParameterListNoReceiver_sub1},{DT_Subtable, &TblLastFormalParameter}};
+RuleTable TblFormalParameterListNoReceiver ={ET_Oneof, RP_NA, 2, TblFormalParameterListNoReceiver_data, 0, NULL, 208};
+TableData TblFormalParameterList_data[2] ={{DT_Subtable, &TblReceiverParameter},{DT_Subtable, &TblFormalParameterListNoReceiver}};
+RuleTable TblFormalParameterList ={ET_Oneof, RP_Single, 2, TblFormalParameterList_data, 0, NULL, 210};
+Action TblFormalParameters_sub1_action[1] = {{ACT_BuildVarList,2,{1,2}}};
+TableData TblFormalParameters_sub3_data[2] ={{DT_Token, {.mTokenId=44}},{DT_Subtable, &TblFormalParameter}};
+RuleTable TblFormalParameters_sub3 ={ET_Concatenate, RP_NA, 2, TblFormalParameters_sub3_data, 0, NULL, 214};
+TableData TblFormalParameters_sub2_data[1] ={{DT_Subtable, &TblFormalParameters_sub3}};
+RuleTable TblFormalParameters_sub2 ={ET_Zeroormore, RP_NA, 1, TblFormalParameters_sub2_data, 0, NULL, 213};
+TableData TblFormalParameters_sub1_data[2] ={{DT_Subtable, &TblFormalParameter},{DT_Subtable, &TblFormalParameters_sub2}};
+RuleTable TblFormalParameters_sub1 ={ET_Concatenate, RP_NA, 2, TblFormalParameters_sub1_data, 1, TblFormalParameters_sub1_action, 212};
+extern RuleTable TblFormalParameters_sub2;
+TableData TblFormalParameters_sub4_data[2] ={{DT_Subtable, &TblReceiverParameter},{DT_Subtable, &TblFormalParameters_sub2}};
+RuleTable TblFormalParameters_sub4 ={ET_Concatenate, RP_NA, 2, TblFormalParameters_sub4_data, 0, NULL, 215};
+TableData TblFormalParameters_data[2] ={{DT_Subtable, &TblFormalParameters_sub1},{DT_Subtable, &TblFormalParameters_sub4}};
+RuleTable TblFormalParameters ={ET_Oneof, RP_Single, 2, TblFormalParameters_data, 0, NULL, 211};
+Action TblFormalParameter_action[2] = {{ACT_BuildDecl,2,{2,3}},{ACT_AddModifier,1,{1}}};
+TableData TblFormalParameter_sub1_data[1] ={{DT_Subtable, &TblVariableModifier}};
+RuleTable TblFormalParameter_sub1 ={ET_Zeroormore, RP_NA, 1, TblFormalParameter_sub1_data, 0, NULL, 217};
+TableData TblFormalParameter_data[3] ={{DT_Subtable, &TblFormalParameter_sub1},{DT_Subtable, &TblUnannType},{DT_Subtable, &TblVariableDeclaratorId}};
+RuleTable TblFormalParameter ={ET_Concatenate, RP_NA, 3, TblFormalParameter_data, 2, TblFormalParameter_action, 216};
+extern RuleTable TblPrimitiveType_sub2;
+TableData TblReceiverParameter_sub2_data[2] ={{DT_Subtable, &TblIdentifier},{DT_Token, {.mTokenId=43}}};
+RuleTable TblReceiverParameter_sub2 ={ET_Concatenate, RP_NA, 2, TblReceiverParameter_sub2_data, 0, NULL, 220};
+TableData TblReceiverParameter_sub1_data[1] ={{DT_Subtable, &TblReceiverParameter_sub2}};
+RuleTable TblReceiverParameter_sub1 ={ET_Zeroorone, RP_NA, 1, TblReceiverParameter_sub1_data, 0, NULL, 219};
+TableData TblReceiverParameter_data[4] ={{DT_Subtable, &TblPrimitiveType_sub2},{DT_Subtable, &TblUnannType},{DT_Subtable, &TblReceiverParameter_sub1},{DT_Token, {.mTokenId=88}}};
+RuleTable TblReceiverParameter ={ET_Concatenate, RP_NA, 4, TblReceiverParameter_data, 0, NULL, 218};
+extern RuleTable TblFormalParameter_sub1;
+extern RuleTable TblPrimitiveType_sub2;
+TableData TblLastFormalParameter_sub1_data[5] ={{DT_Subtable, &TblFormalParameter_sub1},{DT_Subtable, &TblUnannType},{DT_Subtable, &TblPrimitiveType_sub2},{DT_Token, {.mTokenId=38}},{DT_Subtable, &TblVariableDeclaratorId}};
+RuleTable TblLastFormalParameter_sub1 ={ET_Concatenate, RP_NA, 5, TblLastFormalParameter_sub1_data, 0, NULL, 222};
+TableData TblLastFormalParameter_data[2] ={{DT_Subtable, &TblLastFormalParameter_sub1},{DT_Subtable, &TblFormalParameter}};
+RuleTable TblLastFormalParameter ={ET_Oneof, RP_Single, 2, TblLastFormalParameter_data, 0, NULL, 221};
+TableData TblFieldAttr_data[7] ={{DT_Token, {.mTokenId=70}},{DT_Token, {.mTokenId=56}},{DT_Token, {.mTokenId=63}},{DT_Token, {.mTokenId=69}},{DT_Token, {.mTokenId=78}},{DT_Token, {.mTokenId=57}},{DT_Token, {.mTokenId=60}}};
+RuleTable TblFieldAttr ={ET_Oneof, RP_Single, 7, TblFieldAttr_data, 0, NULL, 223};
+TableData TblFieldModifier_data[2] ={{DT_Subtable, &TblAnnotation},{DT_Subtable, &TblFieldAttr}};
+RuleTable TblFieldModifier ={ET_Oneof, RP_Single, 2, TblFieldModifier_data, 0, NULL, 224};
+Action TblConstructorDeclaration_action[1] = {{ACT_AddFunctionBodyTo,2,{2,4}}};
+TableData TblConstructorDeclaration_sub1_data[1] ={{DT_Subtable, &TblConstructorModifier}};
+RuleTable TblConstructorDeclaration_sub1 ={ET_Zeroormore, RP_NA, 1, TblConstructorDeclaration_sub1_data, 0, NULL, 226};
+extern RuleTable TblMethodHeader_sub2;
+TableData TblConstructorDeclaration_data[4] ={{DT_Subtable, &TblConstructorDeclaration_sub1},{DT_Subtable, &TblConstructorDeclarator},{DT_Subtable, &TblMethodHeader_sub2},{DT_Subtable, &TblConstructorBody}};
+RuleTable TblConstructorDeclaration ={ET_Concatenate, RP_NA, 4, TblConstructorDeclaration_data, 1, TblConstructorDeclaration_action, 225};
+TableData TblConstructorAttr_data[3] ={{DT_Token, {.mTokenId=70}},{DT_Token, {.mTokenId=56}},{DT_Token, {.mTokenId=63}}};
+RuleTable TblConstructorAttr ={ET_Oneof, RP_Single, 3, TblConstructorAttr_data, 0, NULL, 227};
+TableData TblConstructorModifier_data[2] ={{DT_Subtable, &TblAnnotation},{DT_Subtable, &TblConstructorAttr}};
+RuleTable TblConstructorModifier ={ET_Oneof, RP_Single, 2, TblConstructorModifier_data, 0, NULL, 228};
+Action TblConstructorDeclarator_action[1] = {{ACT_BuildConstructor,1,{2}}};
+extern RuleTable TblNormalClassDeclaration_sub2;
+extern RuleTable TblMethodDeclarator_sub1;
+TableData TblConstructorDeclarator_data[5] ={{DT_Subtable, &TblNormalClassDeclaration_sub2},{DT_Subtable, &TblIdentifier},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblMethodDeclarator_sub1},{DT_Token, {.mTokenId=50}}};
+RuleTable TblConstructorDeclarator ={ET_Concatenate, RP_NA, 5, TblConstructorDeclarator_data, 1, TblConstructorDeclarator_action, 229};
+TableData TblSimpleTypeName_data[1] ={{DT_Subtable, &TblIdentifier}};
+RuleTable TblSimpleTypeName ={ET_Data, RP_NA, 1, TblSimpleTypeName_data, 0, NULL, 230};
+Action TblConstructorBody_action[1] = {{ACT_BuildBlock,1,{3}}};
+TableData TblConstructorBody_sub1_data[1] ={{DT_Subtable, &TblExplicitConstructorInvocation}};
+RuleTable TblConstructorBody_sub1 ={ET_Zeroorone, RP_NA, 1, TblConstructorBody_sub1_data, 0, NULL, 232};
+TableData TblConstructorBody_sub2_data[1] ={{DT_Subtable, &TblBlockStatements}};
+RuleTable TblConstructorBody_sub2 ={ET_Zeroorone, RP_NA, 1, TblConstructorBody_sub2_data, 0, NULL, 233};
+TableData TblConstructorBody_data[4] ={{DT_Token, {.mTokenId=49}},{DT_Subtable, &TblConstructorBody_sub1},{DT_Subtable, &TblConstructorBody_sub2},{DT_Token, {.mTokenId=48}}};
+RuleTable TblConstructorBody ={ET_Concatenate, RP_NA, 4, TblConstructorBody_data, 1, TblConstructorBody_action, 231};
+extern RuleTable TblClassType_sub2;
+TableData TblExplicitConstructorInvocation_sub2_data[1] ={{DT_Subtable, &TblArgumentList}};
+RuleTable TblExplicitConstructorInvocation_sub2 ={ET_Zeroorone, RP_NA, 1, TblExplicitConstructorInvocation_sub2_data, 0, NULL, 236};
+TableData TblExplicitConstructorInvocation_sub1_data[6] ={{DT_Subtable, &TblClassType_sub2},{DT_Token, {.mTokenId=88}},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblExplicitConstructorInvocation_sub2},{DT_Token, {.mTokenId=50}},{DT_Token, {.mTokenId=45}}};
+RuleTable TblExplicitConstructorInvocation_sub1 ={ET_Concatenate, RP_NA, 6, TblExplicitConstructorInvocation_sub1_data, 0, NULL, 235};
+extern RuleTable TblClassType_sub2;
+extern RuleTable TblExplicitConstructorInvocation_sub2;
+TableData TblExplicitConstructorInvocation_sub3_data[6] ={{DT_Subtable, &TblClassType_sub2},{DT_Token, {.mTokenId=80}},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblExplicitConstructorInvocation_sub2},{DT_Token, {.mTokenId=50}},{DT_Token, {.mTokenId=45}}};
+RuleTable TblExplicitConstructorInvocation_sub3 ={ET_Concatenate, RP_NA, 6, TblExplicitConstructorInvocation_sub3_data, 0, NULL, 237};
+extern RuleTable TblClassType_sub2;
+extern RuleTable TblExplicitConstructorInvocation_sub2;
+TableData TblExplicitConstructorInvocation_sub4_data[8] ={{DT_Subtable, &TblExpressionName},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblClassType_sub2},{DT_Token, {.mTokenId=80}},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblExplicitConstructorInvocation_sub2},{DT_Token, {.mTokenId=50}},{DT_Token, {.mTokenId=45}}};
+RuleTable TblExplicitConstructorInvocation_sub4 ={ET_Concatenate, RP_NA, 8, TblExplicitConstructorInvocation_sub4_data, 0, NULL, 238};
+extern RuleTable TblClassType_sub2;
+extern RuleTable TblExplicitConstructorInvocation_sub2;
+TableData TblExplicitConstructorInvocation_sub5_data[8] ={{DT_Subtable, &TblPrimary},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblClassType_sub2},{DT_Token, {.mTokenId=80}},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblExplicitConstructorInvocation_sub2},{DT_Token, {.mTokenId=50}},{DT_Token, {.mTokenId=45}}};
+RuleTable TblExplicitConstructorInvocation_sub5 ={ET_Concatenate, RP_NA, 8, TblExplicitConstructorInvocation_sub5_data, 0, NULL, 239};
+TableData TblExplicitConstructorInvocation_data[4] ={{DT_Subtable, &TblExplicitConstructorInvocation_sub1},{DT_Subtable, &TblExplicitConstructorInvocation_sub3},{DT_Subtable, &TblExplicitConstructorInvocation_sub4},{DT_Subtable, &TblExplicitConstructorInvocation_sub5}};
+RuleTable TblExplicitConstructorInvocation ={ET_Oneof, RP_Single, 4, TblExplicitConstructorInvocation_data, 0, NULL, 234};
+Action TblEnumDeclaration_action[5] = {{ACT_BuildClass,1,{3}},{ACT_SetClassIsJavaEnum,0,{}},{ACT_AddModifier,1,{1}},{ACT_AddSuperInterface,1,{4}},{ACT_AddClassBody,1,{5}}};
+extern RuleTable TblNormalClassDeclaration_sub1;
+extern RuleTable TblNormalClassDeclaration_sub4;
+TableData TblEnumDeclaration_data[5] ={{DT_Subtable, &TblNormalClassDeclaration_sub1},{DT_Token, {.mTokenId=94}},{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblNormalClassDeclaration_sub4},{DT_Subtable, &TblEnumBody}};
+RuleTable TblEnumDeclaration ={ET_Concatenate, RP_NA, 5, TblEnumDeclaration_data, 5, TblEnumDeclaration_action, 240};
+Action TblEnumBody_action[2] = {{ACT_BuildBlock,1,{2}},{ACT_AddToBlock,1,{4}}};
+TableData TblEnumBody_sub1_data[1] ={{DT_Subtable, &TblEnumConstantList}};
+RuleTable TblEnumBody_sub1 ={ET_Zeroorone, RP_NA, 1, TblEnumBody_sub1_data, 0, NULL, 242};
+TableData TblEnumBody_sub2_data[1] ={{DT_Token, {.mTokenId=44}}};
+RuleTable TblEnumBody_sub2 ={ET_Zeroorone, RP_NA, 1, TblEnumBody_sub2_data, 0, NULL, 243};
+TableData TblEnumBody_sub3_data[1] ={{DT_Subtable, &TblEnumBodyDeclarations}};
+RuleTable TblEnumBody_sub3 ={ET_Zeroorone, RP_NA, 1, TblEnumBody_sub3_data, 0, NULL, 244};
+TableData TblEnumBody_data[5] ={{DT_Token, {.mTokenId=49}},{DT_Subtable, &TblEnumBody_sub1},{DT_Subtable, &TblEnumBody_sub2},{DT_Subtable, &TblEnumBody_sub3},{DT_Token, {.mTokenId=48}}};
+RuleTable TblEnumBody ={ET_Concatenate, RP_NA, 5, TblEnumBody_data, 2, TblEnumBody_action, 241};
+TableData TblEnumConstantList_sub2_data[2] ={{DT_Token, {.mTokenId=44}},{DT_Subtable, &TblEnumConstant}};
+RuleTable TblEnumConstantList_sub2 ={ET_Concatenate, RP_NA, 2, TblEnumConstantList_sub2_data, 0, NULL, 247};
+TableData TblEnumConstantList_sub1_data[1] ={{DT_Subtable, &TblEnumConstantList_sub2}};
+RuleTable TblEnumConstantList_sub1 ={ET_Zeroormore, RP_NA, 1, TblEnumConstantList_sub1_data, 0, NULL, 246};
+TableData TblEnumConstantList_data[2] ={{DT_Subtable, &TblEnumConstant},{DT_Subtable, &TblEnumConstantList_sub1}};
+RuleTable TblEnumConstantList ={ET_Concatenate, RP_NA, 2, TblEnumConstantList_data, 0, NULL, 245};
+Action TblEnumConstant_action[2] = {{ACT_AddInitTo,2,{2,3}},{ACT_AddInitTo,2,{2,4}}};
+extern RuleTable TblPrimitiveType_sub2;
+extern RuleTable TblExplicitConstructorInvocation_sub2;
+TableData TblEnumConstant_sub2_data[3] ={{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblExplicitConstructorInvocation_sub2},{DT_Token, {.mTokenId=50}}};
+RuleTable TblEnumConstant_sub2 ={ET_Concatenate, RP_NA, 3, TblEnumConstant_sub2_data, 0, NULL, 250};
+TableData TblEnumConstant_sub1_data[1] ={{DT_Subtable, &TblEnumConstant_sub2}};
+RuleTable TblEnumConstant_sub1 ={ET_Zeroorone, RP_NA, 1, TblEnumConstant_sub1_data, 0, NULL, 249};
+TableData TblEnumConstant_sub3_data[1] ={{DT_Subtable, &TblClassBody}};
+RuleTable TblEnumConstant_sub3 ={ET_Zeroorone, RP_NA, 1, TblEnumConstant_sub3_data, 0, NULL, 251};
+TableData TblEnumConstant_data[4] ={{DT_Subtable, &TblPrimitiveType_sub2},{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblEnumConstant_sub1},{DT_Subtable, &TblEnumConstant_sub3}};
+RuleTable TblEnumConstant ={ET_Concatenate, RP_NA, 4, TblEnumConstant_data, 2, TblEnumConstant_action, 248};
+TableData TblEnumConstantModifier_data[1] ={{DT_Subtable, &TblAnnotation}};
+RuleTable TblEnumConstantModifier ={ET_Data, RP_NA, 1, TblEnumConstantModifier_data, 0, NULL, 252};
+extern RuleTable TblClassBody_sub1;
+TableData TblEnumBodyDeclarations_data[2] ={{DT_Token, {.mTokenId=45}},{DT_Subtable, &TblClassBody_sub1}};
+RuleTable TblEnumBodyDeclarations ={ET_Concatenate, RP_NA, 2, TblEnumBodyDeclarations_data, 0, NULL, 253};
+TableData TblBlockStatement_data[3] ={{DT_Subtable, &TblLocalVariableDeclarationStatement},{DT_Subtable, &TblClassDeclaration},{DT_Subtable, &TblStatement}};
+RuleTable TblBlockStatement ={ET_Oneof, RP_Single, 3, TblBlockStatement_data, 0, NULL, 254};
+TableData TblBlockStatements_sub1_data[1] ={{DT_Subtable, &TblBlockStatement}};
+RuleTable TblBlockStatements_sub1 ={ET_Zeroormore, RP_NA, 1, TblBlockStatements_sub1_data, 0, NULL, 256};
+TableData TblBlockStatements_data[2] ={{DT_Subtable, &TblBlockStatement},{DT_Subtable, &TblBlockStatements_sub1}};
+RuleTable TblBlockStatements ={ET_Concatenate, RP_NA, 2, TblBlockStatements_data, 0, NULL, 255};
+Action TblBlock_action[1] = {{ACT_BuildBlock,1,{2}}};
+TableData TblBlock_sub1_data[1] ={{DT_Subtable, &TblBlockStatements}};
+RuleTable TblBlock_sub1 ={ET_Zeroorone, RP_NA, 1, TblBlock_sub1_data, 0, NULL, 258};
+TableData TblBlock_data[3] ={{DT_Token, {.mTokenId=49}},{DT_Subtable, &TblBlock_sub1},{DT_Token, {.mTokenId=48}}};
+RuleTable TblBlock ={ET_Concatenate, RP_NA, 3, TblBlock_data, 1, TblBlock_action, 257};
+TableData TblInterfaceDeclaration_data[2] ={{DT_Subtable, &TblNormalInterfaceDeclaration},{DT_Subtable, &TblAnnotationTypeDeclaration}};
+RuleTable TblInterfaceDeclaration ={ET_Oneof, RP_Single|RP_Top, 2, TblInterfaceDeclaration_data, 0, NULL, 259};
+Action TblNormalInterfaceDeclaration_action[2] = {{ACT_BuildInterface,1,{3}},{ACT_AddInterfaceBody,1,{6}}};
+TableData TblNormalInterfaceDeclaration_sub1_data[1] ={{DT_Subtable, &TblInterfaceModifier}};
+RuleTable TblNormalInterfaceDeclaration_sub1 ={ET_Zeroormore, RP_NA, 1, TblNormalInterfaceDeclaration_sub1_data, 0, NULL, 261};
+extern RuleTable TblNormalClassDeclaration_sub2;
+TableData TblNormalInterfaceDeclaration_sub2_data[1] ={{DT_Subtable, &TblExtendsInterfaces}};
+RuleTable TblNormalInterfaceDeclaration_sub2 ={ET_Zeroorone, RP_NA, 1, TblNormalInterfaceDeclaration_sub2_data, 0, NULL, 262};
+TableData TblNormalInterfaceDeclaration_data[6] ={{DT_Subtable, &TblNormalInterfaceDeclaration_sub1},{DT_Token, {.mTokenId=58}},{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblNormalClassDeclaration_sub2},{DT_Subtable, &TblNormalInterfaceDeclaration_sub2},{DT_Subtable, &TblInterfaceBody}};
+RuleTable TblNormalInterfaceDeclaration ={ET_Concatenate, RP_NA, 6, TblNormalInterfaceDeclaration_data, 2, TblNormalInterfaceDeclaration_action, 260};
+TableData TblInterfaceAttr_data[6] ={{DT_Token, {.mTokenId=70}},{DT_Token, {.mTokenId=56}},{DT_Token, {.mTokenId=63}},{DT_Token, {.mTokenId=61}},{DT_Token, {.mTokenId=69}},{DT_Token, {.mTokenId=59}}};
+RuleTable TblInterfaceAttr ={ET_Oneof, RP_Single, 6, TblInterfaceAttr_data, 0, NULL, 263};
+TableData TblInterfaceModifier_data[2] ={{DT_Subtable, &TblAnnotation},{DT_Subtable, &TblInterfaceAttr}};
+RuleTable TblInterfaceModifier ={ET_Oneof, RP_Single, 2, TblInterfaceModifier_data, 0, NULL, 264};
+TableData TblExtendsInterfaces_data[2] ={{DT_Token, {.mTokenId=64}},{DT_Subtable, &TblInterfaceTypeList}};
+RuleTable TblExtendsInterfaces ={ET_Concatenate, RP_NA, 2, TblExtendsInterfaces_data, 0, NULL, 265};
+Action TblInterfaceBody_action[1] = {{ACT_BuildBlock,1,{2}}};
+TableData TblInterfaceBody_sub1_data[1] ={{DT_Subtable, &TblInterfaceMemberDeclaration}};
+RuleTable TblInterfaceBody_sub1 ={ET_Zeroormore, RP_NA, 1, TblInterfaceBody_sub1_data, 0, NULL, 267};
+TableData TblInterfaceBody_data[3] ={{DT_Token, {.mTokenId=49}},{DT_Subtable, &TblInterfaceBody_sub1},{DT_Token, {.mTokenId=48}}};
+RuleTable TblInterfaceBody ={ET_Concatenate, RP_NA, 3, TblInterfaceBody_data, 1, TblInterfaceBody_action, 266};
+TableData TblInterfaceMemberDeclaration_data[5] ={{DT_Subtable, &TblConstantDeclaration},{DT_Subtable, &TblInterfaceMethodDeclaration},{DT_Subtable, &TblClassDeclaration},{DT_Subtable, &TblInterfaceDeclaration},{DT_Token, {.mTokenId=45}}};
+RuleTable TblInterfaceMemberDeclaration ={ET_Oneof, RP_Single, 5, TblInterfaceMemberDeclaration_data, 0, NULL, 268};
+TableData TblConstantDeclaration_sub1_data[1] ={{DT_Subtable, &TblConstantModifier}};
+RuleTable TblConstantDeclaration_sub1 ={ET_Zeroormore, RP_NA, 1, TblConstantDeclaration_sub1_data, 0, NULL, 270};
+TableData TblConstantDeclaration_data[4] ={{DT_Subtable, &TblConstantDeclaration_sub1},{DT_Subtable, &TblUnannType},{DT_Subtable, &TblVariableDeclaratorList},{DT_Token, {.mTokenId=45}}};
+RuleTable TblConstantDeclaration ={ET_Concatenate, RP_NA, 4, TblConstantDeclaration_data, 0, NULL, 269};
+TableData TblConstantAttr_data[3] ={{DT_Token, {.mTokenId=70}},{DT_Token, {.mTokenId=69}},{DT_Token, {.mTokenId=78}}};
+RuleTable TblConstantAttr ={ET_Oneof, RP_Single, 3, TblConstantAttr_data, 0, NULL, 271};
+TableData TblConstantModifier_data[2] ={{DT_Subtable, &TblAnnotation},{DT_Subtable, &TblConstantAttr}};
+RuleTable TblConstantModifier ={ET_Oneof, RP_Single, 2, TblConstantModifier_data, 0, NULL, 272};
+TableData TblInterfaceMethodDeclaration_sub1_data[1] ={{DT_Subtable, &TblInterfaceMethodModifier}};
+RuleTable TblInterfaceMethodDeclaration_sub1 ={ET_Zeroormore, RP_NA, 1, TblInterfaceMethodDeclaration_sub1_data, 0, NULL, 274};
+TableData TblInterfaceMethodDeclaration_data[3] ={{DT_Subtable, &TblInterfaceMethodDeclaration_sub1},{DT_Subtable, &TblMethodHeader},{DT_Subtable, &TblMethodBody}};
+RuleTable TblInterfaceMethodDeclaration ={ET_Concatenate, RP_NA, 3, TblInterfaceMethodDeclaration_data, 0, NULL, 273};
+TableData TblInterfaceMethodAttr_data[5] ={{DT_Token, {.mTokenId=70}},{DT_Token, {.mTokenId=61}},{DT_Token, {.mTokenId=66}},{DT_Token, {.mTokenId=69}},{DT_Token, {.mTokenId=59}}};
+RuleTable TblInterfaceMethodAttr ={ET_Oneof, RP_Single, 5, TblInterfaceMethodAttr_data, 0, NULL, 275};
+TableData TblInterfaceMethodModifier_data[2] ={{DT_Subtable, &TblAnnotation},{DT_Subtable, &TblInterfaceMethodAttr}};
+RuleTable TblInterfaceMethodModifier ={ET_Oneof, RP_Single, 2, TblInterfaceMethodModifier_data, 0, NULL, 276};
+Action TblAnnotationTypeDeclaration_action[3] = {{ACT_BuildAnnotationType,1,{4}},{ACT_AddModifier,1,{1}},{ACT_AddAnnotationTypeBody,1,{5}}};
+extern RuleTable TblNormalInterfaceDeclaration_sub1;
+TableData TblAnnotationTypeDeclaration_data[5] ={{DT_Subtable, &TblNormalInterfaceDeclaration_sub1},{DT_Token, {.mTokenId=41}},{DT_Token, {.mTokenId=58}},{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblAnnotationTypeBody}};
+RuleTable TblAnnotationTypeDeclaration ={ET_Concatenate, RP_NA, 5, TblAnnotationTypeDeclaration_data, 3, TblAnnotationTypeDeclaration_action, 277};
+Action TblAnnotationTypeBody_action[1] = {{ACT_BuildBlock,1,{2}}};
+TableData TblAnnotationTypeBody_sub1_data[1] ={{DT_Subtable, &TblAnnotationTypeMemberDeclaration}};
+RuleTable TblAnnotationTypeBody_sub1 ={ET_Zeroormore, RP_NA, 1, TblAnnotationTypeBody_sub1_data, 0, NULL, 279};
+TableData TblAnnotationTypeBody_data[3] ={{DT_Token, {.mTokenId=49}},{DT_Subtable, &TblAnnotationTypeBody_sub1},{DT_Token, {.mTokenId=48}}};
+RuleTable TblAnnotationTypeBody ={ET_Concatenate, RP_NA, 3, TblAnnotationTypeBody_data, 1, TblAnnotationTypeBody_action, 278};
+TableData TblAnnotationTypeMemberDeclaration_data[5] ={{DT_Subtable, &TblAnnotationTypeElementDeclaration},{DT_Subtable, &TblConstantDeclaration},{DT_Subtable, &TblClassDeclaration},{DT_Subtable, &TblInterfaceDeclaration},{DT_Token, {.mTokenId=45}}};
+RuleTable TblAnnotationTypeMemberDeclaration ={ET_Oneof, RP_Single, 5, TblAnnotationTypeMemberDeclaration_data, 0, NULL, 280};
+TableData TblAnnotationTypeElementDeclaration_sub1_data[1] ={{DT_Subtable, &TblAnnotationTypeElementModifier}};
+RuleTable TblAnnotationTypeElementDeclaration_sub1 ={ET_Zeroormore, RP_NA, 1, TblAnnotationTypeElementDeclaration_sub1_data, 0, NULL, 282};
+extern RuleTable TblMethodDeclarator_sub2;
+TableData TblAnnotationTypeElementDeclaration_sub2_data[1] ={{DT_Subtable, &TblDefaultValue}};
+RuleTable TblAnnotationTypeElementDeclaration_sub2 ={ET_Zeroorone, RP_NA, 1, TblAnnotationTypeElementDeclaration_sub2_data, 0, NULL, 283};
+TableData TblAnnotationTypeElementDeclaration_data[8] ={{DT_Subtable, &TblAnnotationTypeElementDeclaration_sub1},{DT_Subtable, &TblUnannType},{DT_Subtable, &TblIdentifier},{DT_Token, {.mTokenId=51}},{DT_Token, {.mTokenId=50}},{DT_Subtable, &TblMethodDeclarator_sub2},{DT_Subtable, &TblAnnotationTypeElementDeclaration_sub2},{DT_Token, {.mTokenId=45}}};
+RuleTable TblAnnotationTypeElementDeclaration ={ET_Concatenate, RP_NA, 8, TblAnnotationTypeElementDeclaration_data, 0, NULL, 281};
+TableData TblAnnotationTypeElementAttr_data[2] ={{DT_Token, {.mTokenId=70}},{DT_Token, {.mTokenId=61}}};
+RuleTable TblAnnotationTypeElementAttr ={ET_Oneof, RP_Single, 2, TblAnnotationTypeElementAttr_data, 0, NULL, 284};
+TableData TblAnnotationTypeElementModifier_data[2] ={{DT_Subtable, &TblAnnotation},{DT_Subtable, &TblAnnotationTypeElementAttr}};
+RuleTable TblAnnotationTypeElementModifier ={ET_Oneof, RP_Single, 2, TblAnnotationTypeElementModifier_data, 0, NULL, 285};
+TableData TblDefaultValue_data[2] ={{DT_Token, {.mTokenId=66}},{DT_Subtable, &TblElementValue}};
+RuleTable TblDefaultValue ={ET_Concatenate, RP_NA, 2, TblDefaultValue_data, 0, NULL, 286};
+TableData TblAnnotation_data[3] ={{DT_Subtable, &TblNormalAnnotation},{DT_Subtable, &TblMarkerAnnotation},{DT_Subtable, &TblSingleElementAnnotation}};
+RuleTable TblAnnotation ={ET_Oneof, RP_Single, 3, TblAnnotation_data, 0, NULL, 287};
+Action TblNormalAnnotation_action[1] = {{ACT_BuildAnnotation,1,{2}}};
+TableData TblNormalAnnotation_sub1_data[1] ={{DT_Subtable, &TblElementValuePairList}};
+RuleTable TblNormalAnnotation_sub1 ={ET_Zeroorone, RP_NA, 1, TblNormalAnnotation_sub1_data, 0, NULL, 289};
+TableData TblNormalAnnotation_data[5] ={{DT_Token, {.mTokenId=41}},{DT_Subtable, &TblTypeName},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblNormalAnnotation_sub1},{DT_Token, {.mTokenId=50}}};
+RuleTable TblNormalAnnotation ={ET_Concatenate, RP_NA, 5, TblNormalAnnotation_data, 1, TblNormalAnnotation_action, 288};
+Action TblMarkerAnnotation_action[1] = {{ACT_BuildAnnotation,1,{2}}};
+TableData TblMarkerAnnotation_data[2] ={{DT_Token, {.mTokenId=41}},{DT_Subtable, &TblTypeName}};
+RuleTable TblMarkerAnnotation ={ET_Concatenate, RP_NA, 2, TblMarkerAnnotation_data, 1, TblMarkerAnnotation_action, 290};
+Action TblSingleElementAnnotation_action[1] = {{ACT_BuildAnnotation,1,{2}}};
+TableData TblSingleElementAnnotation_data[5] ={{DT_Token, {.mTokenId=41}},{DT_Subtable, &TblTypeName},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblElementValue},{DT_Token, {.mTokenId=50}}};
+RuleTable TblSingleElementAnnotation ={ET_Concatenate, RP_NA, 5, TblSingleElementAnnotation_data, 1, TblSingleElementAnnotation_action, 291};
+TableData TblElementValuePairList_sub2_data[2] ={{DT_Token, {.mTokenId=44}},{DT_Subtable, &TblElementValuePair}};
+RuleTable TblElementValuePairList_sub2 ={ET_Concatenate, RP_NA, 2, TblElementValuePairList_sub2_data, 0, NULL, 294};
+TableData TblElementValuePairList_sub1_data[1] ={{DT_Subtable, &TblElementValuePairList_sub2}};
+RuleTable TblElementValuePairList_sub1 ={ET_Zeroormore, RP_NA, 1, TblElementValuePairList_sub1_data, 0, NULL, 293};
+TableData TblElementValuePairList_data[2] ={{DT_Subtable, &TblElementValuePair},{DT_Subtable, &TblElementValuePairList_sub1}};
+RuleTable TblElementValuePairList ={ET_Concatenate, RP_NA, 2, TblElementValuePairList_data, 0, NULL, 292};
+TableData TblElementValuePair_data[3] ={{DT_Subtable, &TblIdentifier},{DT_Token, {.mTokenId=25}},{DT_Subtable, &TblElementValue}};
+RuleTable TblElementValuePair ={ET_Concatenate, RP_NA, 3, TblElementValuePair_data, 0, NULL, 295};
+TableData TblElementValue_sub1_data[5] ={{DT_Subtable, &TblConditionalOrExpression},{DT_Token, {.mTokenId=23}},{DT_Subtable, &TblExpression},{DT_Token, {.mTokenId=24}},{DT_Subtable, &TblConditionalExpression}};
+RuleTable TblElementValue_sub1 ={ET_Concatenate, RP_NA, 5, TblElementValue_sub1_data, 0, NULL, 297};
+TableData TblElementValue_sub2_data[5] ={{DT_Subtable, &TblConditionalOrExpression},{DT_Token, {.mTokenId=23}},{DT_Subtable, &TblExpression},{DT_Token, {.mTokenId=24}},{DT_Subtable, &TblLambdaExpression}};
+RuleTable TblElementValue_sub2 ={ET_Concatenate, RP_NA, 5, TblElementValue_sub2_data, 0, NULL, 298};
+TableData TblElementValue_data[5] ={{DT_Subtable, &TblConditionalOrExpression},{DT_Subtable, &TblElementValue_sub1},{DT_Subtable, &TblElementValue_sub2},{DT_Subtable, &TblElementValueArrayInitializer},{DT_Subtable, &TblAnnotation}};
+RuleTable TblElementValue ={ET_Oneof, RP_NA, 5, TblElementValue_data, 0, NULL, 296};
+TableData TblElementValueArrayInitializer_sub1_data[1] ={{DT_Subtable, &TblElementValueList}};
+RuleTable TblElementValueArrayInitializer_sub1 ={ET_Zeroorone, RP_NA, 1, TblElementValueArrayInitializer_sub1_data, 0, NULL, 300};
+extern RuleTable TblEnumBody_sub2;
+TableData TblElementValueArrayInitializer_data[4] ={{DT_Token, {.mTokenId=49}},{DT_Subtable, &TblElementValueArrayInitializer_sub1},{DT_Subtable, &TblEnumBody_sub2},{DT_Token, {.mTokenId=48}}};
+RuleTable TblElementValueArrayInitializer ={ET_Concatenate, RP_NA, 4, TblElementValueArrayInitializer_data, 0, NULL, 299};
+TableData TblElementValueList_sub2_data[2] ={{DT_Token, {.mTokenId=44}},{DT_Subtable, &TblElementValue}};
+RuleTable TblElementValueList_sub2 ={ET_Concatenate, RP_NA, 2, TblElementValueList_sub2_data, 0, NULL, 303};
+TableData TblElementValueList_sub1_data[1] ={{DT_Subtable, &TblElementValueList_sub2}};
+RuleTable TblElementValueList_sub1 ={ET_Zeroormore, RP_NA, 1, TblElementValueList_sub1_data, 0, NULL, 302};
+TableData TblElementValueList_data[2] ={{DT_Subtable, &TblElementValue},{DT_Subtable, &TblElementValueList_sub1}};
+RuleTable TblElementValueList ={ET_Concatenate, RP_NA, 2, TblElementValueList_data, 0, NULL, 301};
+TableData TblPackageModifier_data[1] ={{DT_Subtable, &TblAnnotation}};
+RuleTable TblPackageModifier ={ET_Data, RP_NA, 1, TblPackageModifier_data, 0, NULL, 304};
+Action TblPackageDeclaration_action[2] = {{ACT_BuildField,2,{3,4}},{ACT_BuildPackageName,0,{}}};
+extern RuleTable TblPrimitiveType_sub2;
+TableData TblPackageDeclaration_sub2_data[2] ={{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblIdentifier}};
+RuleTable TblPackageDeclaration_sub2 ={ET_Concatenate, RP_NA, 2, TblPackageDeclaration_sub2_data, 0, NULL, 307};
+TableData TblPackageDeclaration_sub1_data[1] ={{DT_Subtable, &TblPackageDeclaration_sub2}};
+RuleTable TblPackageDeclaration_sub1 ={ET_Zeroormore, RP_NA, 1, TblPackageDeclaration_sub1_data, 0, NULL, 306};
+TableData TblPackageDeclaration_data[5] ={{DT_Subtable, &TblPrimitiveType_sub2},{DT_Token, {.mTokenId=67}},{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblPackageDeclaration_sub1},{DT_Token, {.mTokenId=45}}};
+RuleTable TblPackageDeclaration ={ET_Concatenate, RP_Top, 5, TblPackageDeclaration_data, 2, TblPackageDeclaration_action, 305};
+TableData TblImportDeclaration_data[4] ={{DT_Subtable, &TblSingleTypeImportDeclaration},{DT_Subtable, &TblTypeImportOnDemandDeclaration},{DT_Subtable, &TblSingleStaticImportDeclaration},{DT_Subtable, &TblStaticImportOnDemandDeclaration}};
+RuleTable TblImportDeclaration ={ET_Oneof, RP_Top, 4, TblImportDeclaration_data, 0, NULL, 308};
+Action TblSingleTypeImportDeclaration_action[1] = {{ACT_BuildSingleTypeImport,1,{2}}};
+TableData TblSingleTypeImportDeclaration_data[3] ={{DT_Token, {.mTokenId=73}},{DT_Subtable, &TblTypeName},{DT_Token, {.mTokenId=45}}};
+RuleTable TblSingleTypeImportDeclaration ={ET_Concatenate, RP_NA, 3, TblSingleTypeImportDeclaration_data, 1, TblSingleTypeImportDeclaration_action, 309};
+Action TblTypeImportOnDemandDeclaration_action[1] = {{ACT_BuildAllTypeImport,1,{2}}};
+TableData TblTypeImportOnDemandDeclaration_data[5] ={{DT_Token, {.mTokenId=73}},{DT_Subtable, &TblPackageOrTypeName},{DT_Token, {.mTokenId=43}},{DT_Token, {.mTokenId=35}},{DT_Token, {.mTokenId=45}}};
+RuleTable TblTypeImportOnDemandDeclaration ={ET_Concatenate, RP_NA, 5, TblTypeImportOnDemandDeclaration_data, 1, TblTypeImportOnDemandDeclaration_action, 310};
+Action TblSingleStaticImportDeclaration_action[1] = {{ACT_BuildSingleStaticImport,2,{3,4}}};
+TableData TblSingleStaticImportDeclaration_data[6] ={{DT_Token, {.mTokenId=73}},{DT_Token, {.mTokenId=69}},{DT_Subtable, &TblTypeName},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblIdentifier},{DT_Token, {.mTokenId=45}}};
+RuleTable TblSingleStaticImportDeclaration ={ET_Concatenate, RP_NA, 6, TblSingleStaticImportDeclaration_data, 1, TblSingleStaticImportDeclaration_action, 311};
+Action TblStaticImportOnDemandDeclaration_action[1] = {{ACT_BuildAllStaticImport,1,{3}}};
+TableData TblStaticImportOnDemandDeclaration_data[6] ={{DT_Token, {.mTokenId=73}},{DT_Token, {.mTokenId=69}},{DT_Subtable, &TblTypeName},{DT_Token, {.mTokenId=43}},{DT_Token, {.mTokenId=35}},{DT_Token, {.mTokenId=45}}};
+RuleTable TblStaticImportOnDemandDeclaration ={ET_Concatenate, RP_NA, 6, TblStaticImportOnDemandDeclaration_data, 1, TblStaticImportOnDemandDeclaration_action, 312};
@@ -0,0 +1,159 @@
+#ifndef __BLOCK_GEN_H__
+#define __BLOCK_GEN_H__
+extern RuleTable TblClassDeclaration;
+extern RuleTable TblNormalClassDeclaration;
+extern RuleTable TblNormalClassDeclaration_sub1;
+extern RuleTable TblNormalClassDeclaration_sub2;
+extern RuleTable TblNormalClassDeclaration_sub3;
+extern RuleTable TblNormalClassDeclaration_sub4;
+extern RuleTable TblClassAttr;
+extern RuleTable TblClassModifier;
+extern RuleTable TblTypeParameters;
+extern RuleTable TblTypeParameterList;
+extern RuleTable TblTypeParameterList_sub1;
+extern RuleTable TblTypeParameterList_sub2;
+extern RuleTable TblTypeParameter;
+extern RuleTable TblTypeParameter_sub1;
+extern RuleTable TblTypeParameterModifier;
+extern RuleTable TblTypeBound;
+extern RuleTable TblTypeBound_sub1;
+extern RuleTable TblTypeBound_sub2;
+extern RuleTable TblTypeBound_sub3;
+extern RuleTable TblAdditionalBound;
+extern RuleTable TblSuperclass;
+extern RuleTable TblSuperinterfaces;
+extern RuleTable TblInterfaceTypeList;
+extern RuleTable TblInterfaceTypeList_sub1;
+extern RuleTable TblInterfaceTypeList_sub2;
+extern RuleTable TblClassBody;
+extern RuleTable TblClassBody_sub1;
+extern RuleTable TblClassBodyDeclaration;
+extern RuleTable TblInstanceInitializer;
+extern RuleTable TblStaticInitializer;
+extern RuleTable TblClassMemberDeclaration;
+extern RuleTable TblFieldDeclaration;
+extern RuleTable TblFieldDeclaration_sub1;
+extern RuleTable TblMethodDeclaration;
+extern RuleTable TblMethodDeclaration_sub1;
+extern RuleTable TblMethodBody;
+extern RuleTable TblMethodHeader;
+extern RuleTable TblMethodHeader_sub1;
+extern RuleTable TblMethodHeader_sub2;
+extern RuleTable TblMethodHeader_sub3;
+extern RuleTable TblResult;
+extern RuleTable TblMethodDeclarator;
+extern RuleTable TblMethodDeclarator_sub1;
+extern RuleTable TblMethodDeclarator_sub2;
+extern RuleTable TblThrows;
+extern RuleTable TblExceptionTypeList;
+extern RuleTable TblExceptionTypeList_sub1;
+extern RuleTable TblExceptionTypeList_sub2;
+extern RuleTable TblExceptionType;
+extern RuleTable TblMethodAttr;
+extern RuleTable TblMethodModifier;
+extern RuleTable TblFormalParameterListNoReceiver;
+extern RuleTable TblFormalParameterListNoReceiver_sub1;
+extern RuleTable TblFormalParameterList;
+extern RuleTable TblFormalParameters;
+extern RuleTable TblFormalParameters_sub1;
+extern RuleTable TblFormalParameters_sub2;
+extern RuleTable TblFormalParameters_sub3;
+extern RuleTable TblFormalParameters_sub4;
+extern RuleTable TblFormalParameter;
+extern RuleTable TblFormalParameter_sub1;
+extern RuleTable TblReceiverParameter;
+extern RuleTable TblReceiverParameter_sub1;
+extern RuleTable TblReceiverParameter_sub2;
+extern RuleTable TblLastFormalParameter;
+extern RuleTable TblLastFormalParameter_sub1;
+extern RuleTable TblFieldAttr;
+extern RuleTable TblFieldModifier;
+extern RuleTable TblConstructorDeclaration;
+extern RuleTable TblConstructorDeclaration_sub1;
+extern RuleTable TblConstructorAttr;
+extern RuleTable TblConstructorModifier;
+extern RuleTable TblConstructorDeclarator;
+extern RuleTable TblSimpleTypeName;
+extern RuleTable TblConstructorBody;
+extern RuleTable TblConstructorBody_sub1;
+extern RuleTable TblConstructorBody_sub2;
+extern RuleTable TblExplicitConstructorInvocation;
+extern RuleTable TblExplicitConstructorInvocation_sub1;
+extern RuleTable TblExplicitConstructorInvocation_sub2;
+extern RuleTable TblExplicitConstructorInvocation_sub3;
+extern RuleTable TblExplicitConstructorInvocation_sub4;
+extern RuleTable TblExplicitConstructorInvocation_sub5;
+extern RuleTable TblEnumDeclaration;
+extern RuleTable TblEnumBody;
+extern RuleTable TblEnumBody_sub1;
+extern RuleTable TblEnumBody_sub2;
+extern RuleTable TblEnumBody_sub3;
+extern RuleTable TblEnumConstantList;
+extern RuleTable TblEnumConstantList_sub1;
+extern RuleTable TblEnumConstantList_sub2;
+extern RuleTable TblEnumConstant;
+extern RuleTable TblEnumConstant_sub1;
+extern RuleTable TblEnumConstant_sub2;
+extern RuleTable TblEnumConstant_sub3;
+extern RuleTable TblEnumConstantModifier;
+extern RuleTable TblEnumBodyDeclarations;
+extern RuleTable TblBlockStatement;
+extern RuleTable TblBlockStatements;
+extern RuleTable TblBlockStatements_sub1;
+extern RuleTable TblBlock;
+extern RuleTable TblBlock_sub1;
+extern RuleTable TblInterfaceDeclaration;
+extern RuleTable TblNormalInterfaceDeclaration;
+extern RuleTable TblNormalInterfaceDeclaration_sub1;
+extern RuleTable TblNormalInterfaceDeclaration_sub2;
+extern RuleTable TblInterfaceAttr;
+extern RuleTable TblInterfaceModifier;
+extern RuleTable TblExtendsInterfaces;
+extern RuleTable TblInterfaceBody;
+extern RuleTable TblInterfaceBody_sub1;
+extern RuleTable TblInterfaceMemberDeclaration;
+extern RuleTable TblConstantDeclaration;
+extern RuleTable TblConstantDeclaration_sub1;
+extern RuleTable TblConstantAttr;
+extern RuleTable TblConstantModifier;
+extern RuleTable TblInterfaceMethodDeclaration;
+extern RuleTable TblInterfaceMethodDeclaration_sub1;
+extern RuleTable TblInterfaceMethodAttr;
+extern RuleTable TblInterfaceMethodModifier;
+extern RuleTable TblAnnotationTypeDeclaration;
+extern RuleTable TblAnnotationTypeBody;
+extern RuleTable TblAnnotationTypeBody_sub1;
+extern RuleTable TblAnnotationTypeMemberDeclaration;
+extern RuleTable TblAnnotationTypeElementDeclaration;
+extern RuleTable TblAnnotationTypeElementDeclaration_sub1;
+extern RuleTable TblAnnotationTypeElementDeclaration_sub2;
+extern RuleTable TblAnnotationTypeElementAttr;
+extern RuleTable TblAnnotationTypeElementModifier;
+extern RuleTable TblDefaultValue;
+extern RuleTable TblAnnotation;
+extern RuleTable TblNormalAnnotation;
+extern RuleTable TblNormalAnnotation_sub1;
+extern RuleTable TblMarkerAnnotation;
+extern RuleTable TblSingleElementAnnotation;
+extern RuleTable TblElementValuePairList;
+extern RuleTable TblElementValuePairList_sub1;
+extern RuleTable TblElementValuePairList_sub2;
+extern RuleTable TblElementValuePair;
+extern RuleTable TblElementValue;
+extern RuleTable TblElementValue_sub1;
+extern RuleTable TblElementValue_sub2;
+extern RuleTable TblElementValueArrayInitializer;
+extern RuleTable TblElementValueArrayInitializer_sub1;
+extern RuleTable TblElementValueList;
+extern RuleTable TblElementValueList_sub1;
+extern RuleTable TblElementValueList_sub2;
+extern RuleTable TblPackageModifier;
+extern RuleTable TblPackageDeclaration;
+extern RuleTable TblPackageDeclaration_sub1;
+extern RuleTable TblPackageDeclaration_sub2;
+extern RuleTable TblImportDeclaration;
+extern RuleTable TblSingleTypeImportDeclaration;
+extern RuleTable TblTypeImportOnDemandDeclaration;
+extern RuleTable TblSingleStaticImportDeclaration;
+extern RuleTable TblStaticImportOnDemandDeclaration;
+#endif
@@ -0,0 +1,372 @@
+#include "common_header_autogen.h"
+Action TblPackageName_sub1_action[1] = {{ACT_BuildField,2,{1,3}}};
+TableData TblPackageName_sub1_data[3] ={{DT_Subtable, &TblPackageName},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblIdentifier}};
+RuleTable TblPackageName_sub1 ={ET_Concatenate, RP_NA, 3, TblPackageName_sub1_data, 1, TblPackageName_sub1_action, 314};
+TableData TblPackageName_data[2] ={{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblPackageName_sub1}};
+RuleTable TblPackageName ={ET_Oneof, RP_NA, 2, TblPackageName_data, 0, NULL, 313};
+Action TblTypeName_sub1_action[1] = {{ACT_BuildField,2,{1,3}}};
+TableData TblTypeName_sub1_data[3] ={{DT_Subtable, &TblPackageOrTypeName},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblIdentifier}};
+RuleTable TblTypeName_sub1 ={ET_Concatenate, RP_NA, 3, TblTypeName_sub1_data, 1, TblTypeName_sub1_action, 316};
+TableData TblTypeName_data[2] ={{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblTypeName_sub1}};
+RuleTable TblTypeName ={ET_Oneof, RP_NA, 2, TblTypeName_data, 0, NULL, 315};
+Action TblPackageOrTypeName_sub1_action[1] = {{ACT_BuildField,2,{1,3}}};
+TableData TblPackageOrTypeName_sub1_data[3] ={{DT_Subtable, &TblPackageOrTypeName},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblIdentifier}};
+RuleTable TblPackageOrTypeName_sub1 ={ET_Concatenate, RP_NA, 3, TblPackageOrTypeName_sub1_data, 1, TblPackageOrTypeName_sub1_action, 318};
+TableData TblPackageOrTypeName_data[2] ={{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblPackageOrTypeName_sub1}};
+RuleTable TblPackageOrTypeName ={ET_Oneof, RP_NA, 2, TblPackageOrTypeName_data, 0, NULL, 317};
+Action TblExpressionName_sub1_action[1] = {{ACT_BuildField,2,{1,3}}};
+TableData TblExpressionName_sub1_data[3] ={{DT_Subtable, &TblAmbiguousName},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblIdentifier}};
+RuleTable TblExpressionName_sub1 ={ET_Concatenate, RP_NA, 3, TblExpressionName_sub1_data, 1, TblExpressionName_sub1_action, 320};
+TableData TblExpressionName_data[2] ={{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblExpressionName_sub1}};
+RuleTable TblExpressionName ={ET_Oneof, RP_NA, 2, TblExpressionName_data, 0, NULL, 319};
+TableData TblMethodName_data[1] ={{DT_Subtable, &TblIdentifier}};
+RuleTable TblMethodName ={ET_Data, RP_NA, 1, TblMethodName_data, 0, NULL, 321};
+Action TblAmbiguousName_sub1_action[1] = {{ACT_BuildField,2,{1,3}}};
+TableData TblAmbiguousName_sub1_data[3] ={{DT_Subtable, &TblAmbiguousName},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblIdentifier}};
+RuleTable TblAmbiguousName_sub1 ={ET_Concatenate, RP_NA, 3, TblAmbiguousName_sub1_data, 1, TblAmbiguousName_sub1_action, 323};
+TableData TblAmbiguousName_data[2] ={{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblAmbiguousName_sub1}};
+RuleTable TblAmbiguousName ={ET_Oneof, RP_NA, 2, TblAmbiguousName_data, 0, NULL, 322};
+TableData TblClass_data[1] ={{DT_Token, {.mTokenId=87}}};
+RuleTable TblClass ={ET_Data, RP_NA, 1, TblClass_data, 0, NULL, 324};
+TableData TblClassLiteral_sub3_data[2] ={{DT_Token, {.mTokenId=47}},{DT_Token, {.mTokenId=46}}};
+RuleTable TblClassLiteral_sub3 ={ET_Concatenate, RP_NA, 2, TblClassLiteral_sub3_data, 0, NULL, 328};
+TableData TblClassLiteral_sub2_data[1] ={{DT_Subtable, &TblClassLiteral_sub3}};
+RuleTable TblClassLiteral_sub2 ={ET_Zeroormore, RP_NA, 1, TblClassLiteral_sub2_data, 0, NULL, 327};
+TableData TblClassLiteral_sub1_data[4] ={{DT_Subtable, &TblTypeName},{DT_Subtable, &TblClassLiteral_sub2},{DT_Token, {.mTokenId=43}},{DT_Token, {.mTokenId=87}}};
+RuleTable TblClassLiteral_sub1 ={ET_Concatenate, RP_NA, 4, TblClassLiteral_sub1_data, 0, NULL, 326};
+extern RuleTable TblClassLiteral_sub2;
+TableData TblClassLiteral_sub4_data[4] ={{DT_Subtable, &TblNumericType},{DT_Subtable, &TblClassLiteral_sub2},{DT_Token, {.mTokenId=43}},{DT_Token, {.mTokenId=87}}};
+RuleTable TblClassLiteral_sub4 ={ET_Concatenate, RP_NA, 4, TblClassLiteral_sub4_data, 0, NULL, 329};
+extern RuleTable TblClassLiteral_sub2;
+TableData TblClassLiteral_sub5_data[4] ={{DT_Token, {.mTokenId=68}},{DT_Subtable, &TblClassLiteral_sub2},{DT_Token, {.mTokenId=43}},{DT_Token, {.mTokenId=87}}};
+RuleTable TblClassLiteral_sub5 ={ET_Concatenate, RP_NA, 4, TblClassLiteral_sub5_data, 0, NULL, 330};
+TableData TblClassLiteral_sub6_data[3] ={{DT_Token, {.mTokenId=92}},{DT_Token, {.mTokenId=43}},{DT_Token, {.mTokenId=87}}};
+RuleTable TblClassLiteral_sub6 ={ET_Concatenate, RP_NA, 3, TblClassLiteral_sub6_data, 0, NULL, 331};
+TableData TblClassLiteral_data[4] ={{DT_Subtable, &TblClassLiteral_sub1},{DT_Subtable, &TblClassLiteral_sub4},{DT_Subtable, &TblClassLiteral_sub5},{DT_Subtable, &TblClassLiteral_sub6}};
+RuleTable TblClassLiteral ={ET_Oneof, RP_Single, 4, TblClassLiteral_data, 0, NULL, 325};
+TableData TblPrimaryNoNewArray_single_sub1_data[3] ={{DT_Subtable, &TblTypeName},{DT_Token, {.mTokenId=43}},{DT_Token, {.mTokenId=88}}};
+RuleTable TblPrimaryNoNewArray_single_sub1 ={ET_Concatenate, RP_NA, 3, TblPrimaryNoNewArray_single_sub1_data, 0, NULL, 333};
+Action TblPrimaryNoNewArray_single_sub2_action[1] = {{ACT_BuildParenthesis,1,{2}}};
+TableData TblPrimaryNoNewArray_single_sub2_data[3] ={{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblExpression},{DT_Token, {.mTokenId=50}}};
+RuleTable TblPrimaryNoNewArray_single_sub2 ={ET_Concatenate, RP_NA, 3, TblPrimaryNoNewArray_single_sub2_data, 1, TblPrimaryNoNewArray_single_sub2_action, 334};
+TableData TblPrimaryNoNewArray_single_data[6] ={{DT_Subtable, &TblLiteral},{DT_Subtable, &TblClassLiteral},{DT_Token, {.mTokenId=88}},{DT_Subtable, &TblPrimaryNoNewArray_single_sub1},{DT_Subtable, &TblPrimaryNoNewArray_single_sub2},{DT_Subtable, &TblClassInstanceCreationExpression}};
+RuleTable TblPrimaryNoNewArray_single ={ET_Oneof, RP_Single, 6, TblPrimaryNoNewArray_single_data, 0, NULL, 332};
+TableData TblPrimaryNoNewArray_data[5] ={{DT_Subtable, &TblPrimaryNoNewArray_single},{DT_Subtable, &TblFieldAccess},{DT_Subtable, &TblArrayAccess},{DT_Subtable, &TblMethodInvocation},{DT_Subtable, &TblMethodReference}};
+RuleTable TblPrimaryNoNewArray ={ET_Oneof, RP_NA, 5, TblPrimaryNoNewArray_data, 0, NULL, 335};
+TableData TblClassInstanceCreationExpression_sub1_data[3] ={{DT_Subtable, &TblPrimary},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblUnqualifiedClassInstanceCreationExpression}};
+RuleTable TblClassInstanceCreationExpression_sub1 ={ET_Concatenate, RP_NA, 3, TblClassInstanceCreationExpression_sub1_data, 0, NULL, 337};
+TableData TblClassInstanceCreationExpression_data[2] ={{DT_Subtable, &TblUnqualifiedClassInstanceCreationExpression},{DT_Subtable, &TblClassInstanceCreationExpression_sub1}};
+RuleTable TblClassInstanceCreationExpression ={ET_Oneof, RP_NA, 2, TblClassInstanceCreationExpression_data, 0, NULL, 336};
+Action TblUnqualifiedClassInstanceCreationExpression_action[1] = {{ACT_BuildNewOperation,3,{3,5,7}}};
+extern RuleTable TblClassType_sub2;
+TableData TblUnqualifiedClassInstanceCreationExpression_sub1_data[1] ={{DT_Subtable, &TblArgumentList}};
+RuleTable TblUnqualifiedClassInstanceCreationExpression_sub1 ={ET_Zeroorone, RP_NA, 1, TblUnqualifiedClassInstanceCreationExpression_sub1_data, 0, NULL, 339};
+extern RuleTable TblEnumConstant_sub3;
+TableData TblUnqualifiedClassInstanceCreationExpression_data[7] ={{DT_Token, {.mTokenId=97}},{DT_Subtable, &TblClassType_sub2},{DT_Subtable, &TblClassOrInterfaceTypeToInstantiate},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblUnqualifiedClassInstanceCreationExpression_sub1},{DT_Token, {.mTokenId=50}},{DT_Subtable, &TblEnumConstant_sub3}};
+RuleTable TblUnqualifiedClassInstanceCreationExpression ={ET_Concatenate, RP_NA, 7, TblUnqualifiedClassInstanceCreationExpression_data, 1, TblUnqualifiedClassInstanceCreationExpression_action, 338};
+Action TblClassOrInterfaceTypeToInstantiate_action[2] = {{ACT_BuildUserType,1,{2}},{ACT_AddTypeArgument,1,{4}}};
+extern RuleTable TblPrimitiveType_sub2;
+extern RuleTable TblPrimitiveType_sub2;
+TableData TblClassOrInterfaceTypeToInstantiate_sub2_data[3] ={{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblPrimitiveType_sub2},{DT_Subtable, &TblIdentifier}};
+RuleTable TblClassOrInterfaceTypeToInstantiate_sub2 ={ET_Concatenate, RP_NA, 3, TblClassOrInterfaceTypeToInstantiate_sub2_data, 0, NULL, 342};
+TableData TblClassOrInterfaceTypeToInstantiate_sub1_data[1] ={{DT_Subtable, &TblClassOrInterfaceTypeToInstantiate_sub2}};
+RuleTable TblClassOrInterfaceTypeToInstantiate_sub1 ={ET_Zeroormore, RP_NA, 1, TblClassOrInterfaceTypeToInstantiate_sub1_data, 0, NULL, 341};
+TableData TblClassOrInterfaceTypeToInstantiate_sub3_data[1] ={{DT_Subtable, &TblTypeArgumentsOrDiamond}};
+RuleTable TblClassOrInterfaceTypeToInstantiate_sub3 ={ET_Zeroorone, RP_NA, 1, TblClassOrInterfaceTypeToInstantiate_sub3_data, 0, NULL, 343};
+TableData TblClassOrInterfaceTypeToInstantiate_data[4] ={{DT_Subtable, &TblPrimitiveType_sub2},{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblClassOrInterfaceTypeToInstantiate_sub1},{DT_Subtable, &TblClassOrInterfaceTypeToInstantiate_sub3}};
+RuleTable TblClassOrInterfaceTypeToInstantiate ={ET_Concatenate, RP_NA, 4, TblClassOrInterfaceTypeToInstantiate_data, 2, TblClassOrInterfaceTypeToInstantiate_action, 340};
+TableData TblTypeArgumentsOrDiamond_data[2] ={{DT_Subtable, &TblTypeArguments},{DT_String, {.mString="<>"}}};
+RuleTable TblTypeArgumentsOrDiamond ={ET_Oneof, RP_NA, 2, TblTypeArgumentsOrDiamond_data, 0, NULL, 344};
+TableData TblArgumentList_sub2_data[2] ={{DT_Token, {.mTokenId=44}},{DT_Subtable, &TblExpression}};
+RuleTable TblArgumentList_sub2 ={ET_Concatenate, RP_NA, 2, TblArgumentList_sub2_data, 0, NULL, 347};
+TableData TblArgumentList_sub1_data[1] ={{DT_Subtable, &TblArgumentList_sub2}};
+RuleTable TblArgumentList_sub1 ={ET_Zeroormore, RP_NA, 1, TblArgumentList_sub1_data, 0, NULL, 346};
+TableData TblArgumentList_data[2] ={{DT_Subtable, &TblExpression},{DT_Subtable, &TblArgumentList_sub1}};
+RuleTable TblArgumentList ={ET_Concatenate, RP_NA, 2, TblArgumentList_data, 0, NULL, 345};
+TableData TblArrayInitializer_sub1_data[1] ={{DT_Subtable, &TblVariableInitializerList}};
+RuleTable TblArrayInitializer_sub1 ={ET_Zeroorone, RP_NA, 1, TblArrayInitializer_sub1_data, 0, NULL, 349};
+extern RuleTable TblEnumBody_sub2;
+TableData TblArrayInitializer_data[4] ={{DT_Token, {.mTokenId=49}},{DT_Subtable, &TblArrayInitializer_sub1},{DT_Subtable, &TblEnumBody_sub2},{DT_Token, {.mTokenId=48}}};
+RuleTable TblArrayInitializer ={ET_Concatenate, RP_NA, 4, TblArrayInitializer_data, 0, NULL, 348};
+extern RuleTable TblMethodDeclarator_sub2;
+TableData TblArrayCreationExpression_sub1_data[4] ={{DT_Token, {.mTokenId=97}},{DT_Subtable, &TblPrimitiveType},{DT_Subtable, &TblDimExprs},{DT_Subtable, &TblMethodDeclarator_sub2}};
+RuleTable TblArrayCreationExpression_sub1 ={ET_Concatenate, RP_NA, 4, TblArrayCreationExpression_sub1_data, 0, NULL, 351};
+extern RuleTable TblMethodDeclarator_sub2;
+TableData TblArrayCreationExpression_sub2_data[4] ={{DT_Token, {.mTokenId=97}},{DT_Subtable, &TblClassOrInterfaceType},{DT_Subtable, &TblDimExprs},{DT_Subtable, &TblMethodDeclarator_sub2}};
+RuleTable TblArrayCreationExpression_sub2 ={ET_Concatenate, RP_NA, 4, TblArrayCreationExpression_sub2_data, 0, NULL, 352};
+TableData TblArrayCreationExpression_sub3_data[4] ={{DT_Token, {.mTokenId=97}},{DT_Subtable, &TblPrimitiveType},{DT_Subtable, &TblDims},{DT_Subtable, &TblArrayInitializer}};
+RuleTable TblArrayCreationExpression_sub3 ={ET_Concatenate, RP_NA, 4, TblArrayCreationExpression_sub3_data, 0, NULL, 353};
+TableData TblArrayCreationExpression_sub4_data[4] ={{DT_Token, {.mTokenId=97}},{DT_Subtable, &TblClassOrInterfaceType},{DT_Subtable, &TblDims},{DT_Subtable, &TblArrayInitializer}};
+RuleTable TblArrayCreationExpression_sub4 ={ET_Concatenate, RP_NA, 4, TblArrayCreationExpression_sub4_data, 0, NULL, 354};
+TableData TblArrayCreationExpression_data[4] ={{DT_Subtable, &TblArrayCreationExpression_sub1},{DT_Subtable, &TblArrayCreationExpression_sub2},{DT_Subtable, &TblArrayCreationExpression_sub3},{DT_Subtable, &TblArrayCreationExpression_sub4}};
+RuleTable TblArrayCreationExpression ={ET_Oneof, RP_NA, 4, TblArrayCreationExpression_data, 0, NULL, 350};
+TableData TblDimExprs_sub1_data[1] ={{DT_Subtable, &TblDimExpr}};
+RuleTable TblDimExprs_sub1 ={ET_Zeroormore, RP_NA, 1, TblDimExprs_sub1_data, 0, NULL, 356};
+TableData TblDimExprs_data[2] ={{DT_Subtable, &TblDimExpr},{DT_Subtable, &TblDimExprs_sub1}};
+RuleTable TblDimExprs ={ET_Concatenate, RP_NA, 2, TblDimExprs_data, 0, NULL, 355};
+extern RuleTable TblPrimitiveType_sub2;
+TableData TblDimExpr_data[4] ={{DT_Subtable, &TblPrimitiveType_sub2},{DT_Token, {.mTokenId=47}},{DT_Subtable, &TblExpression},{DT_Token, {.mTokenId=46}}};
+RuleTable TblDimExpr ={ET_Concatenate, RP_NA, 4, TblDimExpr_data, 0, NULL, 357};
+TableData TblArrayAccess_sub1_data[4] ={{DT_Subtable, &TblExpressionName},{DT_Token, {.mTokenId=47}},{DT_Subtable, &TblExpression},{DT_Token, {.mTokenId=46}}};
+RuleTable TblArrayAccess_sub1 ={ET_Concatenate, RP_NA, 4, TblArrayAccess_sub1_data, 0, NULL, 359};
+TableData TblArrayAccess_sub2_data[4] ={{DT_Subtable, &TblPrimaryNoNewArray},{DT_Token, {.mTokenId=47}},{DT_Subtable, &TblExpression},{DT_Token, {.mTokenId=46}}};
+RuleTable TblArrayAccess_sub2 ={ET_Concatenate, RP_NA, 4, TblArrayAccess_sub2_data, 0, NULL, 360};
+TableData TblArrayAccess_data[2] ={{DT_Subtable, &TblArrayAccess_sub1},{DT_Subtable, &TblArrayAccess_sub2}};
+RuleTable TblArrayAccess ={ET_Oneof, RP_NA, 2, TblArrayAccess_data, 0, NULL, 358};
+Action TblFieldAccess_sub1_action[1] = {{ACT_BuildField,2,{1,3}}};
+TableData TblFieldAccess_sub1_data[3] ={{DT_Subtable, &TblPrimary},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblIdentifier}};
+RuleTable TblFieldAccess_sub1 ={ET_Concatenate, RP_NA, 3, TblFieldAccess_sub1_data, 1, TblFieldAccess_sub1_action, 362};
+TableData TblFieldAccess_sub2_data[3] ={{DT_Token, {.mTokenId=80}},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblIdentifier}};
+RuleTable TblFieldAccess_sub2 ={ET_Concatenate, RP_NA, 3, TblFieldAccess_sub2_data, 0, NULL, 363};
+TableData TblFieldAccess_sub3_data[5] ={{DT_Subtable, &TblTypeName},{DT_Token, {.mTokenId=43}},{DT_Token, {.mTokenId=80}},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblIdentifier}};
+RuleTable TblFieldAccess_sub3 ={ET_Concatenate, RP_NA, 5, TblFieldAccess_sub3_data, 0, NULL, 364};
+TableData TblFieldAccess_data[3] ={{DT_Subtable, &TblFieldAccess_sub1},{DT_Subtable, &TblFieldAccess_sub2},{DT_Subtable, &TblFieldAccess_sub3}};
+RuleTable TblFieldAccess ={ET_Oneof, RP_NA, 3, TblFieldAccess_data, 0, NULL, 361};
+Action TblMethodInvocation_sub1_action[2] = {{ACT_BuildCall,1,{1}},{ACT_AddArguments,1,{3}}};
+TableData TblMethodInvocation_sub2_data[1] ={{DT_Subtable, &TblArgumentList}};
+RuleTable TblMethodInvocation_sub2 ={ET_Zeroorone, RP_NA, 1, TblMethodInvocation_sub2_data, 0, NULL, 367};
+TableData TblMethodInvocation_sub1_data[4] ={{DT_Subtable, &TblIdentifier},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblMethodInvocation_sub2},{DT_Token, {.mTokenId=50}}};
+RuleTable TblMethodInvocation_sub1 ={ET_Concatenate, RP_NA, 4, TblMethodInvocation_sub1_data, 2, TblMethodInvocation_sub1_action, 366};
+Action TblMethodInvocation_sub3_action[3] = {{ACT_BuildField,2,{1,4}},{ACT_BuildCall,0,{}},{ACT_AddArguments,1,{6}}};
+extern RuleTable TblClassType_sub2;
+TableData TblMethodInvocation_sub4_data[1] ={{DT_Subtable, &TblArgumentList}};
+RuleTable TblMethodInvocation_sub4 ={ET_Zeroorone, RP_NA, 1, TblMethodInvocation_sub4_data, 0, NULL, 369};
+TableData TblMethodInvocation_sub3_data[7] ={{DT_Subtable, &TblTypeName},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblClassType_sub2},{DT_Subtable, &TblIdentifier},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblMethodInvocation_sub4},{DT_Token, {.mTokenId=50}}};
+RuleTable TblMethodInvocation_sub3 ={ET_Concatenate, RP_NA, 7, TblMethodInvocation_sub3_data, 3, TblMethodInvocation_sub3_action, 368};
+extern RuleTable TblClassType_sub2;
+TableData TblMethodInvocation_sub6_data[1] ={{DT_Subtable, &TblArgumentList}};
+RuleTable TblMethodInvocation_sub6 ={ET_Zeroorone, RP_NA, 1, TblMethodInvocation_sub6_data, 0, NULL, 371};
+TableData TblMethodInvocation_sub5_data[7] ={{DT_Subtable, &TblExpressionName},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblClassType_sub2},{DT_Subtable, &TblIdentifier},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblMethodInvocation_sub6},{DT_Token, {.mTokenId=50}}};
+RuleTable TblMethodInvocation_sub5 ={ET_Concatenate, RP_NA, 7, TblMethodInvocation_sub5_data, 0, NULL, 370};
+extern RuleTable TblClassType_sub2;
+TableData TblMethodInvocation_sub8_data[1] ={{DT_Subtable, &TblArgumentList}};
+RuleTable TblMethodInvocation_sub8 ={ET_Zeroorone, RP_NA, 1, TblMethodInvocation_sub8_data, 0, NULL, 373};
+TableData TblMethodInvocation_sub7_data[7] ={{DT_Subtable, &TblPrimary},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblClassType_sub2},{DT_Subtable, &TblIdentifier},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblMethodInvocation_sub8},{DT_Token, {.mTokenId=50}}};
+RuleTable TblMethodInvocation_sub7 ={ET_Concatenate, RP_NA, 7, TblMethodInvocation_sub7_data, 0, NULL, 372};
+extern RuleTable TblClassType_sub2;
+TableData TblMethodInvocation_sub10_data[1] ={{DT_Subtable, &TblArgumentList}};
+RuleTable TblMethodInvocation_sub10 ={ET_Zeroorone, RP_NA, 1, TblMethodInvocation_sub10_data, 0, NULL, 375};
+TableData TblMethodInvocation_sub9_data[7] ={{DT_Token, {.mTokenId=80}},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblClassType_sub2},{DT_Subtable, &TblIdentifier},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblMethodInvocation_sub10},{DT_Token, {.mTokenId=50}}};
+RuleTable TblMethodInvocation_sub9 ={ET_Concatenate, RP_NA, 7, TblMethodInvocation_sub9_data, 0, NULL, 374};
+extern RuleTable TblClassType_sub2;
+TableData TblMethodInvocation_sub12_data[1] ={{DT_Subtable, &TblArgumentList}};
+RuleTable TblMethodInvocation_sub12 ={ET_Zeroorone, RP_NA, 1, TblMethodInvocation_sub12_data, 0, NULL, 377};
+TableData TblMethodInvocation_sub11_data[9] ={{DT_Subtable, &TblTypeName},{DT_Token, {.mTokenId=43}},{DT_Token, {.mTokenId=80}},{DT_Token, {.mTokenId=43}},{DT_Subtable, &TblClassType_sub2},{DT_Subtable, &TblIdentifier},{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblMethodInvocation_sub12},{DT_Token, {.mTokenId=50}}};
+RuleTable TblMethodInvocation_sub11 ={ET_Concatenate, RP_NA, 9, TblMethodInvocation_sub11_data, 0, NULL, 376};
+TableData TblMethodInvocation_data[6] ={{DT_Subtable, &TblMethodInvocation_sub1},{DT_Subtable, &TblMethodInvocation_sub3},{DT_Subtable, &TblMethodInvocation_sub5},{DT_Subtable, &TblMethodInvocation_sub7},{DT_Subtable, &TblMethodInvocation_sub9},{DT_Subtable, &TblMethodInvocation_sub11}};
+RuleTable TblMethodInvocation ={ET_Oneof, RP_NA, 6, TblMethodInvocation_data, 0, NULL, 365};
+extern RuleTable TblClassType_sub2;
+TableData TblMethodReference_sub1_data[4] ={{DT_Subtable, &TblExpressionName},{DT_Token, {.mTokenId=39}},{DT_Subtable, &TblClassType_sub2},{DT_Subtable, &TblIdentifier}};
+RuleTable TblMethodReference_sub1 ={ET_Concatenate, RP_NA, 4, TblMethodReference_sub1_data, 0, NULL, 379};
+extern RuleTable TblClassType_sub2;
+TableData TblMethodReference_sub2_data[4] ={{DT_Subtable, &TblPrimary},{DT_Token, {.mTokenId=39}},{DT_Subtable, &TblClassType_sub2},{DT_Subtable, &TblIdentifier}};
+RuleTable TblMethodReference_sub2 ={ET_Concatenate, RP_NA, 4, TblMethodReference_sub2_data, 0, NULL, 380};
+extern RuleTable TblClassType_sub2;
+TableData TblMethodReference_sub3_data[4] ={{DT_Subtable, &TblReferenceType},{DT_Token, {.mTokenId=39}},{DT_Subtable, &TblClassType_sub2},{DT_Subtable, &TblIdentifier}};
+RuleTable TblMethodReference_sub3 ={ET_Concatenate, RP_NA, 4, TblMethodReference_sub3_data, 0, NULL, 381};
+extern RuleTable TblClassType_sub2;
+TableData TblMethodReference_sub4_data[4] ={{DT_Token, {.mTokenId=80}},{DT_Token, {.mTokenId=39}},{DT_Subtable, &TblClassType_sub2},{DT_Subtable, &TblIdentifier}};
+RuleTable TblMethodReference_sub4 ={ET_Concatenate, RP_NA, 4, TblMethodReference_sub4_data, 0, NULL, 382};
+extern RuleTable TblClassType_sub2;
+TableData TblMethodReference_sub5_data[6] ={{DT_Subtable, &TblTypeName},{DT_Token, {.mTokenId=43}},{DT_Token, {.mTokenId=80}},{DT_Token, {.mTokenId=39}},{DT_Subtable, &TblClassType_sub2},{DT_Subtable, &TblIdentifier}};
+RuleTable TblMethodReference_sub5 ={ET_Concatenate, RP_NA, 6, TblMethodReference_sub5_data, 0, NULL, 383};
+extern RuleTable TblClassType_sub2;
+TableData TblMethodReference_sub6_data[3] ={{DT_Subtable, &TblClassType},{DT_Token, {.mTokenId=39}},{DT_Subtable, &TblClassType_sub2}};
+RuleTable TblMethodReference_sub6 ={ET_Concatenate, RP_NA, 3, TblMethodReference_sub6_data, 0, NULL, 384};
+TableData TblMethodReference_sub7_data[3] ={{DT_Subtable, &TblArrayType},{DT_Token, {.mTokenId=39}},{DT_Token, {.mTokenId=97}}};
+RuleTable TblMethodReference_sub7 ={ET_Concatenate, RP_NA, 3, TblMethodReference_sub7_data, 0, NULL, 385};
+TableData TblMethodReference_data[8] ={{DT_Subtable, &TblMethodReference_sub1},{DT_Subtable, &TblMethodReference_sub2},{DT_Subtable, &TblMethodReference_sub3},{DT_Subtable, &TblMethodReference_sub4},{DT_Subtable, &TblMethodReference_sub5},{DT_Subtable, &TblMethodReference_sub6},{DT_Token, {.mTokenId=97}},{DT_Subtable, &TblMethodReference_sub7}};
+RuleTable TblMethodReference ={ET_Oneof, RP_NA, 8, TblMethodReference_data, 0, NULL, 378};
+TableData TblPostfixExpression_data[4] ={{DT_Subtable, &TblPrimary},{DT_Subtable, &TblExpressionName},{DT_Subtable, &TblPostIncrementExpression},{DT_Subtable, &TblPostDecrementExpression}};
+RuleTable TblPostfixExpression ={ET_Oneof, RP_NA, 4, TblPostfixExpression_data, 0, NULL, 386};
+Action TblPostIncrementExpression_action[1] = {{ACT_BuildPostfixOperation,2,{2,1}}};
+TableData TblPostIncrementExpression_data[2] ={{DT_Subtable, &TblPostfixExpression},{DT_Token, {.mTokenId=22}}};
+RuleTable TblPostIncrementExpression ={ET_Concatenate, RP_NA, 2, TblPostIncrementExpression_data, 1, TblPostIncrementExpression_action, 387};
+Action TblPostDecrementExpression_action[1] = {{ACT_BuildPostfixOperation,2,{2,1}}};
+TableData TblPostDecrementExpression_data[2] ={{DT_Subtable, &TblPostfixExpression},{DT_Token, {.mTokenId=21}}};
+RuleTable TblPostDecrementExpression ={ET_Concatenate, RP_NA, 2, TblPostDecrementExpression_data, 1, TblPostDecrementExpression_action, 388};
+Action TblUnaryExpression_sub1_action[1] = {{ACT_BuildUnaryOperation,2,{1,2}}};
+TableData TblUnaryExpression_sub1_data[2] ={{DT_Token, {.mTokenId=37}},{DT_Subtable, &TblUnaryExpression}};
+RuleTable TblUnaryExpression_sub1 ={ET_Concatenate, RP_NA, 2, TblUnaryExpression_sub1_data, 1, TblUnaryExpression_sub1_action, 390};
+Action TblUnaryExpression_sub2_action[1] = {{ACT_BuildUnaryOperation,2,{1,2}}};
+TableData TblUnaryExpression_sub2_data[2] ={{DT_Token, {.mTokenId=36}},{DT_Subtable, &TblUnaryExpression}};
+RuleTable TblUnaryExpression_sub2 ={ET_Concatenate, RP_NA, 2, TblUnaryExpression_sub2_data, 1, TblUnaryExpression_sub2_action, 391};
+TableData TblUnaryExpression_sub3_data[2] ={{DT_Token, {.mTokenId=27}},{DT_Subtable, &TblUnaryExpression}};
+RuleTable TblUnaryExpression_sub3 ={ET_Concatenate, RP_NA, 2, TblUnaryExpression_sub3_data, 0, NULL, 392};
+TableData TblUnaryExpression_sub4_data[2] ={{DT_Token, {.mTokenId=26}},{DT_Subtable, &TblUnaryExpression}};
+RuleTable TblUnaryExpression_sub4 ={ET_Concatenate, RP_NA, 2, TblUnaryExpression_sub4_data, 0, NULL, 393};
+Action TblUnaryExpression_sub7_action[1] = {{ACT_BuildCast,2,{1,3}}};
+TableData TblUnaryExpression_sub7_data[3] ={{DT_Subtable, &TblPrimitiveType},{DT_Token, {.mTokenId=50}},{DT_Subtable, &TblUnaryExpression}};
+RuleTable TblUnaryExpression_sub7 ={ET_Concatenate, RP_NA, 3, TblUnaryExpression_sub7_data, 1, TblUnaryExpression_sub7_action, 396};
+Action TblUnaryExpression_sub8_action[1] = {{ACT_BuildCast,2,{1,4}}};
+extern RuleTable TblTypeBound_sub3;
+TableData TblUnaryExpression_sub8_data[4] ={{DT_Subtable, &TblReferenceType},{DT_Subtable, &TblTypeBound_sub3},{DT_Token, {.mTokenId=50}},{DT_Subtable, &TblUnaryExpressionNotPlusMinus}};
+RuleTable TblUnaryExpression_sub8 ={ET_Concatenate, RP_NA, 4, TblUnaryExpression_sub8_data, 1, TblUnaryExpression_sub8_action, 397};
+Action TblUnaryExpression_sub9_action[1] = {{ACT_BuildCast,2,{1,4}}};
+extern RuleTable TblTypeBound_sub3;
+TableData TblUnaryExpression_sub9_data[4] ={{DT_Subtable, &TblReferenceType},{DT_Subtable, &TblTypeBound_sub3},{DT_Token, {.mTokenId=50}},{DT_Subtable, &TblLambdaExpression}};
+RuleTable TblUnaryExpression_sub9 ={ET_Concatenate, RP_NA, 4, TblUnaryExpression_sub9_data, 1, TblUnaryExpression_sub9_action, 398};
+TableData TblUnaryExpression_sub6_data[3] ={{DT_Subtable, &TblUnaryExpression_sub7},{DT_Subtable, &TblUnaryExpression_sub8},{DT_Subtable, &TblUnaryExpression_sub9}};
+RuleTable TblUnaryExpression_sub6 ={ET_Oneof, RP_NA, 3, TblUnaryExpression_sub6_data, 0, NULL, 395};
+TableData TblUnaryExpression_sub5_data[2] ={{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblUnaryExpression_sub6}};
+RuleTable TblUnaryExpression_sub5 ={ET_Concatenate, RP_NA, 2, TblUnaryExpression_sub5_data, 0, NULL, 394};
+TableData TblUnaryExpression_data[8] ={{DT_Subtable, &TblPreIncrementExpression},{DT_Subtable, &TblPreDecrementExpression},{DT_Subtable, &TblUnaryExpression_sub1},{DT_Subtable, &TblUnaryExpression_sub2},{DT_Subtable, &TblPostfixExpression},{DT_Subtable, &TblUnaryExpression_sub3},{DT_Subtable, &TblUnaryExpression_sub4},{DT_Subtable, &TblUnaryExpression_sub5}};
+RuleTable TblUnaryExpression ={ET_Oneof, RP_NA, 8, TblUnaryExpression_data, 0, NULL, 389};
+Action TblPreIncrementExpression_action[1] = {{ACT_BuildUnaryOperation,2,{1,2}}};
+TableData TblPreIncrementExpression_data[2] ={{DT_Token, {.mTokenId=22}},{DT_Subtable, &TblUnaryExpression}};
+RuleTable TblPreIncrementExpression ={ET_Concatenate, RP_NA, 2, TblPreIncrementExpression_data, 1, TblPreIncrementExpression_action, 399};
+Action TblPreDecrementExpression_action[1] = {{ACT_BuildUnaryOperation,2,{1,2}}};
+TableData TblPreDecrementExpression_data[2] ={{DT_Token, {.mTokenId=21}},{DT_Subtable, &TblUnaryExpression}};
+RuleTable TblPreDecrementExpression ={ET_Concatenate, RP_NA, 2, TblPreDecrementExpression_data, 1, TblPreDecrementExpression_action, 400};
+extern RuleTable TblUnaryExpression_sub3;
+extern RuleTable TblUnaryExpression_sub4;
+extern RuleTable TblUnaryExpression_sub5;
+TableData TblUnaryExpressionNotPlusMinus_data[4] ={{DT_Subtable, &TblPostfixExpression},{DT_Subtable, &TblUnaryExpression_sub3},{DT_Subtable, &TblUnaryExpression_sub4},{DT_Subtable, &TblUnaryExpression_sub5}};
+RuleTable TblUnaryExpressionNotPlusMinus ={ET_Oneof, RP_NA, 4, TblUnaryExpressionNotPlusMinus_data, 0, NULL, 401};
+extern RuleTable TblUnaryExpression_sub5;
+TableData TblCastExpression_data[1] ={{DT_Subtable, &TblUnaryExpression_sub5}};
+RuleTable TblCastExpression ={ET_Oneof, RP_NA, 1, TblCastExpression_data, 0, NULL, 402};
+TableData TblMultiplicativeExpression_sub1_data[3] ={{DT_Subtable, &TblMultiplicativeExpression},{DT_Token, {.mTokenId=35}},{DT_Subtable, &TblUnaryExpression}};
+RuleTable TblMultiplicativeExpression_sub1 ={ET_Concatenate, RP_NA, 3, TblMultiplicativeExpression_sub1_data, 0, NULL, 404};
+TableData TblMultiplicativeExpression_sub2_data[3] ={{DT_Subtable, &TblMultiplicativeExpression},{DT_Token, {.mTokenId=34}},{DT_Subtable, &TblUnaryExpression}};
+RuleTable TblMultiplicativeExpression_sub2 ={ET_Concatenate, RP_NA, 3, TblMultiplicativeExpression_sub2_data, 0, NULL, 405};
+TableData TblMultiplicativeExpression_sub3_data[3] ={{DT_Subtable, &TblMultiplicativeExpression},{DT_Token, {.mTokenId=33}},{DT_Subtable, &TblUnaryExpression}};
+RuleTable TblMultiplicativeExpression_sub3 ={ET_Concatenate, RP_NA, 3, TblMultiplicativeExpression_sub3_data, 0, NULL, 406};
+TableData TblMultiplicativeExpression_data[4] ={{DT_Subtable, &TblUnaryExpression},{DT_Subtable, &TblMultiplicativeExpression_sub1},{DT_Subtable, &TblMultiplicativeExpression_sub2},{DT_Subtable, &TblMultiplicativeExpression_sub3}};
+RuleTable TblMultiplicativeExpression ={ET_Oneof, RP_NA, 4, TblMultiplicativeExpression_data, 0, NULL, 403};
+Action TblAdditiveExpression_sub1_action[1] = {{ACT_BuildBinaryOperation,3,{1,2,3}}};
+TableData TblAdditiveExpression_sub1_data[3] ={{DT_Subtable, &TblAdditiveExpression},{DT_Token, {.mTokenId=37}},{DT_Subtable, &TblMultiplicativeExpression}};
+RuleTable TblAdditiveExpression_sub1 ={ET_Concatenate, RP_NA, 3, TblAdditiveExpression_sub1_data, 1, TblAdditiveExpression_sub1_action, 408};
+Action TblAdditiveExpression_sub2_action[1] = {{ACT_BuildBinaryOperation,3,{1,2,3}}};
+TableData TblAdditiveExpression_sub2_data[3] ={{DT_Subtable, &TblAdditiveExpression},{DT_Token, {.mTokenId=36}},{DT_Subtable, &TblMultiplicativeExpression}};
+RuleTable TblAdditiveExpression_sub2 ={ET_Concatenate, RP_NA, 3, TblAdditiveExpression_sub2_data, 1, TblAdditiveExpression_sub2_action, 409};
+TableData TblAdditiveExpression_data[3] ={{DT_Subtable, &TblMultiplicativeExpression},{DT_Subtable, &TblAdditiveExpression_sub1},{DT_Subtable, &TblAdditiveExpression_sub2}};
+RuleTable TblAdditiveExpression ={ET_Oneof, RP_NA, 3, TblAdditiveExpression_data, 0, NULL, 407};
+Action TblShiftExpression_sub1_action[1] = {{ACT_BuildBinaryOperation,3,{1,2,3}}};
+TableData TblShiftExpression_sub1_data[3] ={{DT_Subtable, &TblShiftExpression},{DT_Token, {.mTokenId=16}},{DT_Subtable, &TblAdditiveExpression}};
+RuleTable TblShiftExpression_sub1 ={ET_Concatenate, RP_NA, 3, TblShiftExpression_sub1_data, 1, TblShiftExpression_sub1_action, 411};
+Action TblShiftExpression_sub2_action[1] = {{ACT_BuildBinaryOperation,3,{1,2,3}}};
+TableData TblShiftExpression_sub2_data[3] ={{DT_Subtable, &TblShiftExpression},{DT_Token, {.mTokenId=15}},{DT_Subtable, &TblAdditiveExpression}};
+RuleTable TblShiftExpression_sub2 ={ET_Concatenate, RP_NA, 3, TblShiftExpression_sub2_data, 1, TblShiftExpression_sub2_action, 412};
+Action TblShiftExpression_sub3_action[1] = {{ACT_BuildBinaryOperation,3,{1,2,3}}};
+TableData TblShiftExpression_sub3_data[3] ={{DT_Subtable, &TblShiftExpression},{DT_Token, {.mTokenId=3}},{DT_Subtable, &TblAdditiveExpression}};
+RuleTable TblShiftExpression_sub3 ={ET_Concatenate, RP_NA, 3, TblShiftExpression_sub3_data, 1, TblShiftExpression_sub3_action, 413};
+TableData TblShiftExpression_data[4] ={{DT_Subtable, &TblAdditiveExpression},{DT_Subtable, &TblShiftExpression_sub1},{DT_Subtable, &TblShiftExpression_sub2},{DT_Subtable, &TblShiftExpression_sub3}};
+RuleTable TblShiftExpression ={ET_Oneof, RP_NA, 4, TblShiftExpression_data, 0, NULL, 410};
+Action TblRelationalExpression_sub1_action[1] = {{ACT_BuildBinaryOperation,3,{1,2,3}}};
+TableData TblRelationalExpression_sub1_data[3] ={{DT_Subtable, &TblRelationalExpression},{DT_Token, {.mTokenId=31}},{DT_Subtable, &TblShiftExpression}};
+RuleTable TblRelationalExpression_sub1 ={ET_Concatenate, RP_NA, 3, TblRelationalExpression_sub1_data, 1, TblRelationalExpression_sub1_action, 415};
+Action TblRelationalExpression_sub2_action[1] = {{ACT_BuildBinaryOperation,3,{1,2,3}}};
+TableData TblRelationalExpression_sub2_data[3] ={{DT_Subtable, &TblRelationalExpression},{DT_Token, {.mTokenId=32}},{DT_Subtable, &TblShiftExpression}};
+RuleTable TblRelationalExpression_sub2 ={ET_Concatenate, RP_NA, 3, TblRelationalExpression_sub2_data, 1, TblRelationalExpression_sub2_action, 416};
+Action TblRelationalExpression_sub3_action[1] = {{ACT_BuildBinaryOperation,3,{1,2,3}}};
+TableData TblRelationalExpression_sub3_data[3] ={{DT_Subtable, &TblRelationalExpression},{DT_Token, {.mTokenId=17}},{DT_Subtable, &TblShiftExpression}};
+RuleTable TblRelationalExpression_sub3 ={ET_Concatenate, RP_NA, 3, TblRelationalExpression_sub3_data, 1, TblRelationalExpression_sub3_action, 417};
+Action TblRelationalExpression_sub4_action[1] = {{ACT_BuildBinaryOperation,3,{1,2,3}}};
+TableData TblRelationalExpression_sub4_data[3] ={{DT_Subtable, &TblRelationalExpression},{DT_Token, {.mTokenId=18}},{DT_Subtable, &TblShiftExpression}};
+RuleTable TblRelationalExpression_sub4 ={ET_Concatenate, RP_NA, 3, TblRelationalExpression_sub4_data, 1, TblRelationalExpression_sub4_action, 418};
+TableData TblRelationalExpression_sub5_data[3] ={{DT_Subtable, &TblRelationalExpression},{DT_Token, {.mTokenId=55}},{DT_Subtable, &TblReferenceType}};
+RuleTable TblRelationalExpression_sub5 ={ET_Concatenate, RP_NA, 3, TblRelationalExpression_sub5_data, 0, NULL, 419};
+TableData TblRelationalExpression_data[6] ={{DT_Subtable, &TblShiftExpression},{DT_Subtable, &TblRelationalExpression_sub1},{DT_Subtable, &TblRelationalExpression_sub2},{DT_Subtable, &TblRelationalExpression_sub3},{DT_Subtable, &TblRelationalExpression_sub4},{DT_Subtable, &TblRelationalExpression_sub5}};
+RuleTable TblRelationalExpression ={ET_Oneof, RP_NA, 6, TblRelationalExpression_data, 0, NULL, 414};
+TableData TblEqualityExpression_sub1_data[3] ={{DT_Subtable, &TblEqualityExpression},{DT_Token, {.mTokenId=20}},{DT_Subtable, &TblRelationalExpression}};
+RuleTable TblEqualityExpression_sub1 ={ET_Concatenate, RP_NA, 3, TblEqualityExpression_sub1_data, 0, NULL, 421};
+TableData TblEqualityExpression_sub2_data[3] ={{DT_Subtable, &TblEqualityExpression},{DT_Token, {.mTokenId=19}},{DT_Subtable, &TblRelationalExpression}};
+RuleTable TblEqualityExpression_sub2 ={ET_Concatenate, RP_NA, 3, TblEqualityExpression_sub2_data, 0, NULL, 422};
+TableData TblEqualityExpression_data[3] ={{DT_Subtable, &TblRelationalExpression},{DT_Subtable, &TblEqualityExpression_sub1},{DT_Subtable, &TblEqualityExpression_sub2}};
+RuleTable TblEqualityExpression ={ET_Oneof, RP_NA, 3, TblEqualityExpression_data, 0, NULL, 420};
+TableData TblAndExpression_sub1_data[3] ={{DT_Subtable, &TblAndExpression},{DT_Token, {.mTokenId=30}},{DT_Subtable, &TblEqualityExpression}};
+RuleTable TblAndExpression_sub1 ={ET_Concatenate, RP_NA, 3, TblAndExpression_sub1_data, 0, NULL, 424};
+TableData TblAndExpression_data[2] ={{DT_Subtable, &TblEqualityExpression},{DT_Subtable, &TblAndExpression_sub1}};
+RuleTable TblAndExpression ={ET_Oneof, RP_NA, 2, TblAndExpression_data, 0, NULL, 423};
+TableData TblExclusiveOrExpression_sub1_data[3] ={{DT_Subtable, &TblExclusiveOrExpression},{DT_Token, {.mTokenId=28}},{DT_Subtable, &TblAndExpression}};
+RuleTable TblExclusiveOrExpression_sub1 ={ET_Concatenate, RP_NA, 3, TblExclusiveOrExpression_sub1_data, 0, NULL, 426};
+TableData TblExclusiveOrExpression_data[2] ={{DT_Subtable, &TblAndExpression},{DT_Subtable, &TblExclusiveOrExpression_sub1}};
+RuleTable TblExclusiveOrExpression ={ET_Oneof, RP_NA, 2, TblExclusiveOrExpression_data, 0, NULL, 425};
+TableData TblInclusiveOrExpression_sub1_data[3] ={{DT_Subtable, &TblInclusiveOrExpression},{DT_Token, {.mTokenId=29}},{DT_Subtable, &TblExclusiveOrExpression}};
+RuleTable TblInclusiveOrExpression_sub1 ={ET_Concatenate, RP_NA, 3, TblInclusiveOrExpression_sub1_data, 0, NULL, 428};
+TableData TblInclusiveOrExpression_data[2] ={{DT_Subtable, &TblExclusiveOrExpression},{DT_Subtable, &TblInclusiveOrExpression_sub1}};
+RuleTable TblInclusiveOrExpression ={ET_Oneof, RP_NA, 2, TblInclusiveOrExpression_data, 0, NULL, 427};
+TableData TblConditionalAndExpression_sub1_data[3] ={{DT_Subtable, &TblConditionalAndExpression},{DT_Token, {.mTokenId=14}},{DT_Subtable, &TblInclusiveOrExpression}};
+RuleTable TblConditionalAndExpression_sub1 ={ET_Concatenate, RP_NA, 3, TblConditionalAndExpression_sub1_data, 0, NULL, 430};
+TableData TblConditionalAndExpression_data[2] ={{DT_Subtable, &TblInclusiveOrExpression},{DT_Subtable, &TblConditionalAndExpression_sub1}};
+RuleTable TblConditionalAndExpression ={ET_Oneof, RP_NA, 2, TblConditionalAndExpression_data, 0, NULL, 429};
+TableData TblConditionalOrExpression_sub1_data[3] ={{DT_Subtable, &TblConditionalOrExpression},{DT_Token, {.mTokenId=13}},{DT_Subtable, &TblConditionalAndExpression}};
+RuleTable TblConditionalOrExpression_sub1 ={ET_Concatenate, RP_NA, 3, TblConditionalOrExpression_sub1_data, 0, NULL, 432};
+TableData TblConditionalOrExpression_data[2] ={{DT_Subtable, &TblConditionalAndExpression},{DT_Subtable, &TblConditionalOrExpression_sub1}};
+RuleTable TblConditionalOrExpression ={ET_Oneof, RP_NA, 2, TblConditionalOrExpression_data, 0, NULL, 431};
+extern RuleTable TblElementValue_sub1;
+extern RuleTable TblElementValue_sub2;
+TableData TblConditionalExpression_data[3] ={{DT_Subtable, &TblConditionalOrExpression},{DT_Subtable, &TblElementValue_sub1},{DT_Subtable, &TblElementValue_sub2}};
+RuleTable TblConditionalExpression ={ET_Oneof, RP_NA, 3, TblConditionalExpression_data, 0, NULL, 433};
+extern RuleTable TblElementValue_sub1;
+extern RuleTable TblElementValue_sub2;
+TableData TblAssignmentExpression_data[4] ={{DT_Subtable, &TblConditionalOrExpression},{DT_Subtable, &TblElementValue_sub1},{DT_Subtable, &TblElementValue_sub2},{DT_Subtable, &TblAssignment}};
+RuleTable TblAssignmentExpression ={ET_Oneof, RP_NA, 4, TblAssignmentExpression_data, 0, NULL, 434};
+Action TblAssignment_action[1] = {{ACT_BuildAssignment,3,{1,2,3}}};
+TableData TblAssignment_data[3] ={{DT_Subtable, &TblLeftHandSide},{DT_Subtable, &TblAssignmentOperator},{DT_Subtable, &TblExpression}};
+RuleTable TblAssignment ={ET_Concatenate, RP_NA, 3, TblAssignment_data, 1, TblAssignment_action, 435};
+extern RuleTable TblExpressionName_sub1;
+TableData TblLeftHandSide_data[4] ={{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblExpressionName_sub1},{DT_Subtable, &TblFieldAccess},{DT_Subtable, &TblArrayAccess}};
+RuleTable TblLeftHandSide ={ET_Oneof, RP_NA, 4, TblLeftHandSide_data, 0, NULL, 436};
+TableData TblAssignmentOperator_data[12] ={{DT_Token, {.mTokenId=25}},{DT_Token, {.mTokenId=10}},{DT_Token, {.mTokenId=9}},{DT_Token, {.mTokenId=8}},{DT_Token, {.mTokenId=12}},{DT_Token, {.mTokenId=11}},{DT_Token, {.mTokenId=2}},{DT_Token, {.mTokenId=1}},{DT_Token, {.mTokenId=0}},{DT_Token, {.mTokenId=7}},{DT_Token, {.mTokenId=5}},{DT_Token, {.mTokenId=6}}};
+RuleTable TblAssignmentOperator ={ET_Oneof, RP_NA, 12, TblAssignmentOperator_data, 0, NULL, 437};
+Action TblLambdaExpression_action[1] = {{ACT_BuildLambda,2,{1,3}}};
+TableData TblLambdaExpression_data[3] ={{DT_Subtable, &TblLambdaParameters},{DT_Token, {.mTokenId=4}},{DT_Subtable, &TblLambdaBody}};
+RuleTable TblLambdaExpression ={ET_Concatenate, RP_NA, 3, TblLambdaExpression_data, 1, TblLambdaExpression_action, 438};
+TableData TblLambdaParameters_sub2_data[1] ={{DT_Subtable, &TblLambdaParameterList}};
+RuleTable TblLambdaParameters_sub2 ={ET_Zeroorone, RP_NA, 1, TblLambdaParameters_sub2_data, 0, NULL, 441};
+TableData TblLambdaParameters_sub1_data[3] ={{DT_Token, {.mTokenId=51}},{DT_Subtable, &TblLambdaParameters_sub2},{DT_Token, {.mTokenId=50}}};
+RuleTable TblLambdaParameters_sub1 ={ET_Concatenate, RP_NA, 3, TblLambdaParameters_sub1_data, 0, NULL, 440};
+TableData TblLambdaParameters_data[2] ={{DT_Subtable, &TblLambdaParameters_sub1},{DT_Subtable, &TblIdentifier}};
+RuleTable TblLambdaParameters ={ET_Oneof, RP_NA, 2, TblLambdaParameters_data, 0, NULL, 439};
+TableData TblLambdaParameterList_sub3_data[2] ={{DT_Token, {.mTokenId=44}},{DT_Subtable, &TblLambdaParameter}};
+RuleTable TblLambdaParameterList_sub3 ={ET_Concatenate, RP_NA, 2, TblLambdaParameterList_sub3_data, 0, NULL, 445};
+TableData TblLambdaParameterList_sub2_data[1] ={{DT_Subtable, &TblLambdaParameterList_sub3}};
+RuleTable TblLambdaParameterList_sub2 ={ET_Zeroormore, RP_NA, 1, TblLambdaParameterList_sub2_data, 0, NULL, 444};
+TableData TblLambdaParameterList_sub1_data[2] ={{DT_Subtable, &TblLambdaParameter},{DT_Subtable, &TblLambdaParameterList_sub2}};
+RuleTable TblLambdaParameterList_sub1 ={ET_Concatenate, RP_NA, 2, TblLambdaParameterList_sub1_data, 0, NULL, 443};
+TableData TblLambdaParameterList_sub6_data[2] ={{DT_Token, {.mTokenId=44}},{DT_Subtable, &TblIdentifier}};
+RuleTable TblLambdaParameterList_sub6 ={ET_Concatenate, RP_NA, 2, TblLambdaParameterList_sub6_data, 0, NULL, 448};
+TableData TblLambdaParameterList_sub5_data[1] ={{DT_Subtable, &TblLambdaParameterList_sub6}};
+RuleTable TblLambdaParameterList_sub5 ={ET_Zeroormore, RP_NA, 1, TblLambdaParameterList_sub5_data, 0, NULL, 447};
+TableData TblLambdaParameterList_sub4_data[2] ={{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblLambdaParameterList_sub5}};
+RuleTable TblLambdaParameterList_sub4 ={ET_Concatenate, RP_NA, 2, TblLambdaParameterList_sub4_data, 0, NULL, 446};
+TableData TblLambdaParameterList_data[2] ={{DT_Subtable, &TblLambdaParameterList_sub1},{DT_Subtable, &TblLambdaParameterList_sub4}};
+RuleTable TblLambdaParameterList ={ET_Oneof, RP_NA, 2, TblLambdaParameterList_data, 0, NULL, 442};
+extern RuleTable TblFormalParameter_sub1;
+TableData TblLambdaParameter_sub1_data[3] ={{DT_Subtable, &TblFormalParameter_sub1},{DT_Subtable, &TblLambdaParameterType},{DT_Subtable, &TblVariableDeclaratorId}};
+RuleTable TblLambdaParameter_sub1 ={ET_Concatenate, RP_NA, 3, TblLambdaParameter_sub1_data, 0, NULL, 450};
+TableData TblLambdaParameter_data[2] ={{DT_Subtable, &TblLambdaParameter_sub1},{DT_Subtable, &TblVariableArityParameter}};
+RuleTable TblLambdaParameter ={ET_Oneof, RP_NA, 2, TblLambdaParameter_data, 0, NULL, 449};
+extern RuleTable TblUnannArrayType_sub1;
+extern RuleTable TblUnannArrayType_sub2;
+extern RuleTable TblUnannArrayType_sub3;
+TableData TblLambdaParameterType_data[14] ={{DT_Token, {.mTokenId=96}},{DT_Token, {.mTokenId=85}},{DT_Token, {.mTokenId=101}},{DT_Token, {.mTokenId=93}},{DT_Token, {.mTokenId=95}},{DT_Token, {.mTokenId=86}},{DT_Token, {.mTokenId=77}},{DT_Token, {.mTokenId=68}},{DT_Subtable, &TblUnannClassOrInterfaceType},{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblUnannArrayType_sub1},{DT_Subtable, &TblUnannArrayType_sub2},{DT_Subtable, &TblUnannArrayType_sub3},{DT_Token, {.mTokenId=100}}};
+RuleTable TblLambdaParameterType ={ET_Oneof, RP_NA, 14, TblLambdaParameterType_data, 0, NULL, 451};
+extern RuleTable TblFormalParameter_sub1;
+extern RuleTable TblPrimitiveType_sub2;
+TableData TblVariableArityParameter_data[5] ={{DT_Subtable, &TblFormalParameter_sub1},{DT_Subtable, &TblUnannType},{DT_Subtable, &TblPrimitiveType_sub2},{DT_Token, {.mTokenId=38}},{DT_Subtable, &TblIdentifier}};
+RuleTable TblVariableArityParameter ={ET_Concatenate, RP_NA, 5, TblVariableArityParameter_data, 0, NULL, 452};
+extern RuleTable TblExpressionName_sub1;
+extern RuleTable TblUnaryExpression_sub1;
+extern RuleTable TblUnaryExpression_sub2;
+extern RuleTable TblUnaryExpression_sub3;
+extern RuleTable TblUnaryExpression_sub4;
+extern RuleTable TblUnaryExpression_sub5;
+TableData TblLambdaBody_data[25] ={{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblExpressionName_sub1},{DT_Subtable, &TblPrimary},{DT_Subtable, &TblPreIncrementExpression},{DT_Subtable, &TblPreDecrementExpression},{DT_Subtable, &TblUnaryExpression_sub1},{DT_Subtable, &TblUnaryExpression_sub2},{DT_Subtable, &TblPostfixExpression},{DT_Subtable, &TblUnaryExpression_sub3},{DT_Subtable, &TblUnaryExpression_sub4},{DT_Subtable, &TblUnaryExpression_sub5},{DT_Subtable, &TblMultiplicativeExpression},{DT_Subtable, &TblAdditiveExpression},{DT_Subtable, &TblShiftExpression},{DT_Subtable, &TblRelationalExpression},{DT_Subtable, &TblEqualityExpression},{DT_Subtable, &TblAndExpression},{DT_Subtable, &TblExclusiveOrExpression},{DT_Subtable, &TblInclusiveOrExpression},{DT_Subtable, &TblConditionalAndExpression},{DT_Subtable, &TblConditionalOrExpression},{DT_Subtable, &TblConditionalExpression},{DT_Subtable, &TblLambdaExpression},{DT_Subtable, &TblAssignmentExpression},{DT_Subtable, &TblBlock}};
+RuleTable TblLambdaBody ={ET_Oneof, RP_NA, 25, TblLambdaBody_data, 0, NULL, 453};
+TableData TblConstantExpression_data[1] ={{DT_Subtable, &TblExpression}};
+RuleTable TblConstantExpression ={ET_Data, RP_NA, 1, TblConstantExpression_data, 0, NULL, 454};
+TableData TblPrimary_data[2] ={{DT_Subtable, &TblPrimaryNoNewArray},{DT_Subtable, &TblArrayCreationExpression}};
+RuleTable TblPrimary ={ET_Oneof, RP_NA, 2, TblPrimary_data, 0, NULL, 455};
+extern RuleTable TblExpressionName_sub1;
+extern RuleTable TblUnaryExpression_sub1;
+extern RuleTable TblUnaryExpression_sub2;
+extern RuleTable TblUnaryExpression_sub3;
+extern RuleTable TblUnaryExpression_sub4;
+extern RuleTable TblUnaryExpression_sub5;
+TableData TblExpression_data[24] ={{DT_Subtable, &TblIdentifier},{DT_Subtable, &TblExpressionName_sub1},{DT_Subtable, &TblPrimary},{DT_Subtable, &TblPreIncrementExpression},{DT_Subtable, &TblPreDecrementExpression},{DT_Subtable, &TblUnaryExpression_sub1},{DT_Subtable, &TblUnaryExpression_sub2},{DT_Subtable, &TblPostfixExpression},{DT_Subtable, &TblUnaryExpression_sub3},{DT_Subtable, &TblUnaryExpression_sub4},{DT_Subtable, &TblUnaryExpression_sub5},{DT_Subtable, &TblMultiplicativeExpression},{DT_Subtable, &TblAdditiveExpression},{DT_Subtable, &TblShiftExpression},{DT_Subtable, &TblRelationalExpression},{DT_Subtable, &TblEqualityExpression},{DT_Subtable, &TblAndExpression},{DT_Subtable, &TblExclusiveOrExpression},{DT_Subtable, &TblInclusiveOrExpression},{DT_Subtable, &TblConditionalAndExpression},{DT_Subtable, &TblConditionalOrExpression},{DT_Subtable, &TblConditionalExpression},{DT_Subtable, &TblLambdaExpression},{DT_Subtable, &TblAssignmentExpression}};
+RuleTable TblExpression ={ET_Oneof, RP_NA, 24, TblExpression_data, 0, NULL, 456};
+TableData TblBinaryExpression_data[10] ={{DT_Subtable, &TblMultiplicativeExpression},{DT_Subtable, &TblAdditiveExpression},{DT_Subtable, &TblShiftExpression},{DT_Subtable, &TblRelationalExpression},{DT_Subtable, &TblEqualityExpression},{DT_Subtable, &TblAndExpression},{DT_Subtable, &TblExclusiveOrExpression},{DT_Subtable, &TblInclusiveOrExpression},{DT_Subtable, &TblConditionalAndExpression},{DT_Subtable, &TblConditionalOrExpression}};
+RuleTable TblBinaryExpression ={ET_Oneof, RP_NA, 10, TblBinaryExpression_data, 0, NULL, 457};
@@ -0,0 +1,55 @@
+#include "ruletable.h"
+KeywordTableEntry KeywordTable[51] = {
+  "synchronized",
+  "implements",
+  "instanceof",
+  "protected",
+  "transient",
+  "interface",
+  "strictfp",
+  "volatile",
+  "abstract",
+  "continue",
+  "private",
+  "extends",
+  "finally",
+  "default",
+  "package",
+  "boolean",
+  "static",
+  "public",
+  "native",
+  "throws",
+  "import",
+  "assert",
+  "switch",
+  "return",
+  "double",
+  "final",
+  "throw",
+  "super",
+  "const",
+  "while",
+  "catch",
+  "break",
+  "short",
+  "float",
+  "class",
+  "this",
+  "goto",
+  "else",
+  "case",
+  "void",
+  "long",
+  "enum",
+  "char",
+  "byte",
+  "new",
+  "try",
+  "for",
+  "var",
+  "int",
+  "if",
+  "do"
+};
+unsigned KeywordTableSize = 51;
@@ -0,0 +1,16 @@
+#ifndef __RESERVED_GEN_H__
+#define __RESERVED_GEN_H__
+#include "ruletable.h"
+extern RuleTable TblCHAR;
+extern RuleTable TblDIGIT;
+extern RuleTable TblASCII;
+extern RuleTable TblESCAPE;
+extern RuleTable TblESCAPE_sub1;
+extern RuleTable TblESCAPE_sub2;
+extern RuleTable TblESCAPE_sub3;
+extern RuleTable TblESCAPE_sub4;
+extern RuleTable TblESCAPE_sub5;
+extern RuleTable TblESCAPE_sub6;
+extern RuleTable TblESCAPE_sub7;
+extern RuleTable TblESCAPE_sub8;
+#endif
@@ -0,0 +1,4 @@
+#ifndef __SEPARATOR_GEN_H__
+#define __SEPARATOR_GEN_H__
+extern SepTableEntry SepTable[SEP_NA];
+#endif
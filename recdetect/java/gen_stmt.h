@@ -0,0 +1,92 @@
+#ifndef __STMT_GEN_H__
+#define __STMT_GEN_H__
+extern RuleTable TblLocalVariableDeclarationStatement;
+extern RuleTable TblLocalVariableDeclaration;
+extern RuleTable TblVariableModifier;
+extern RuleTable TblVariableDeclaratorList;
+extern RuleTable TblVariableDeclaratorList_sub1;
+extern RuleTable TblVariableDeclaratorList_sub2;
+extern RuleTable TblVariableDeclarator;
+extern RuleTable TblVariableDeclarator_sub1;
+extern RuleTable TblVariableDeclarator_sub2;
+extern RuleTable TblVariableDeclaratorId;
+extern RuleTable TblDims;
+extern RuleTable TblDims_sub1;
+extern RuleTable TblDim;
+extern RuleTable TblVariableInitializer;
+extern RuleTable TblVariableInitializerList;
+extern RuleTable TblVariableInitializerList_sub1;
+extern RuleTable TblVariableInitializerList_sub2;
+extern RuleTable TblStatement;
+extern RuleTable TblStatementNoShortIf;
+extern RuleTable TblStatementWithoutTrailingSubstatement;
+extern RuleTable TblIfThenStatement;
+extern RuleTable TblIfThenElseStatement;
+extern RuleTable TblIfThenElseStatementNoShortIf;
+extern RuleTable TblEmptyStatement;
+extern RuleTable TblLabeledStatement;
+extern RuleTable TblLabeledStatementNoShortIf;
+extern RuleTable TblExpressionStatement;
+extern RuleTable TblStatementExpression;
+extern RuleTable TblAssertStatement;
+extern RuleTable TblAssertStatement_sub1;
+extern RuleTable TblAssertStatement_sub2;
+extern RuleTable TblSwitchStatement;
+extern RuleTable TblSwitchBlock;
+extern RuleTable TblSwitchBlock_sub1;
+extern RuleTable TblSwitchBlock_sub2;
+extern RuleTable TblSwitchBlock_sub3;
+extern RuleTable TblSwitchBlock_sub4;
+extern RuleTable TblSwitchBlockStatementGroup;
+extern RuleTable TblSwitchLabels;
+extern RuleTable TblSwitchLabel;
+extern RuleTable TblSwitchLabel_sub1;
+extern RuleTable TblSwitchLabel_sub2;
+extern RuleTable TblSwitchLabel_sub3;
+extern RuleTable TblEnumConstantName;
+extern RuleTable TblWhileStatement;
+extern RuleTable TblWhileStatementNoShortIf;
+extern RuleTable TblDoStatement;
+extern RuleTable TblForStatement;
+extern RuleTable TblForStatementNoShortIf;
+extern RuleTable TblBasicForStatement;
+extern RuleTable TblBasicForStatement_sub1;
+extern RuleTable TblBasicForStatement_sub2;
+extern RuleTable TblBasicForStatement_sub3;
+extern RuleTable TblBasicForStatementNoShortIf;
+extern RuleTable TblForInit;
+extern RuleTable TblForUpdate;
+extern RuleTable TblStatementExpressionList;
+extern RuleTable TblStatementExpressionList_sub1;
+extern RuleTable TblStatementExpressionList_sub2;
+extern RuleTable TblEnhancedForStatement;
+extern RuleTable TblEnhancedForStatementNoShortIf;
+extern RuleTable TblBreakStatement;
+extern RuleTable TblBreakStatement_sub1;
+extern RuleTable TblContinueStatement;
+extern RuleTable TblReturnStatement;
+extern RuleTable TblThrowStatement;
+extern RuleTable TblSynchronizedStatement;
+extern RuleTable TblTryStatement;
+extern RuleTable TblTryStatement_sub1;
+extern RuleTable TblTryStatement_sub2;
+extern RuleTable TblTryStatement_sub3;
+extern RuleTable TblCatches;
+extern RuleTable TblCatches_sub1;
+extern RuleTable TblCatchClause;
+extern RuleTable TblCatchFormalParameter;
+extern RuleTable TblCatchType;
+extern RuleTable TblCatchType_sub1;
+extern RuleTable TblCatchType_sub2;
+extern RuleTable TblFinally;
+extern RuleTable TblTryWithResourcesStatement;
+extern RuleTable TblTryWithResourcesStatement_sub1;
+extern RuleTable TblResourceSpecification;
+extern RuleTable TblResourceSpecification_sub1;
+extern RuleTable TblResourceList;
+extern RuleTable TblResourceList_sub1;
+extern RuleTable TblResourceList_sub2;
+extern RuleTable TblResource;
+extern RuleTable TblResource_sub1;
+extern RuleTable TblVariableAccess;
+#endif
@@ -0,0 +1,9 @@
+#ifndef __TOKEN_GEN_H__
+#define __TOKEN_GEN_H__
+#include "token.h"
+extern unsigned gSystemTokensNum;
+extern unsigned gOperatorTokensNum;
+extern unsigned gSeparatorTokensNum;
+extern unsigned gKeywordTokensNum;
+extern Token gSystemTokens[];
+#endif
@@ -0,0 +1,49 @@
+#ifndef __TYPE_GEN_H__
+#define __TYPE_GEN_H__
+extern TypeKeyword TypeKeywordTable[TY_NA];
+extern RuleTable TblBoolType;
+extern RuleTable TblIntType;
+extern RuleTable TblFPType;
+extern RuleTable TblNumericType;
+extern RuleTable TblPrimitiveType;
+extern RuleTable TblPrimitiveType_sub1;
+extern RuleTable TblPrimitiveType_sub2;
+extern RuleTable TblPrimitiveType_sub3;
+extern RuleTable TblNullType;
+extern RuleTable TblWildcardBounds;
+extern RuleTable TblWildcardBounds_sub1;
+extern RuleTable TblWildcardBounds_sub2;
+extern RuleTable TblWildcard;
+extern RuleTable TblWildcard_sub1;
+extern RuleTable TblTypeArgument;
+extern RuleTable TblTypeArgument_sub1;
+extern RuleTable TblTypeArgument_sub2;
+extern RuleTable TblTypeArgument_sub3;
+extern RuleTable TblTypeArgumentList;
+extern RuleTable TblTypeArgumentList_sub1;
+extern RuleTable TblTypeArgumentList_sub2;
+extern RuleTable TblTypeArguments;
+extern RuleTable TblClassType;
+extern RuleTable TblClassType_sub1;
+extern RuleTable TblClassType_sub2;
+extern RuleTable TblClassType_sub3;
+extern RuleTable TblInterfaceType;
+extern RuleTable TblTypeVariable;
+extern RuleTable TblArrayType;
+extern RuleTable TblClassOrInterfaceType;
+extern RuleTable TblReferenceType;
+extern RuleTable TblTYPE;
+extern RuleTable TblUnannClassType;
+extern RuleTable TblUnannClassType_sub1;
+extern RuleTable TblUnannClassType_sub2;
+extern RuleTable TblUnannClassOrInterfaceType;
+extern RuleTable TblUnannInterfaceType;
+extern RuleTable TblUnannTypeVariable;
+extern RuleTable TblUnannArrayType;
+extern RuleTable TblUnannArrayType_sub1;
+extern RuleTable TblUnannArrayType_sub2;
+extern RuleTable TblUnannArrayType_sub3;
+extern RuleTable TblUnannReferenceType;
+extern RuleTable TblUnannPrimitiveType;
+extern RuleTable TblUnannType;
+#endif
@@ -80,6 +80,7 @@ public:
 #define NODEKIND(K) bool Is##K() {return mKind == NK_##K;}
 #include "ast_nk.def"
 
+  NodeKind GetKind() {return mKind;}
   bool IsScope() {return IsBlock() || IsClass() || IsFunction() || IsInterface();}
   bool TypeEquivalent(TreeNode*);
 
@@ -114,6 +115,7 @@ public:
   ~PackageNode() {}
 
   void SetName(const char *s) {mName = s;}
+  const char* GetName() {return mName;}
   void Dump(unsigned indent);
 };
 
@@ -353,6 +355,8 @@ public:
   void     AddAttr(AttrId a)       {mAttrs.PushBack(a);}
   AttrId   AttrAtIndex(unsigned i) {return mAttrs.ValueAtIndex(i);}
 
+  DimensionNode* GetDims() {return mDims;}
+
   void Release() { if (mDims) mDims->Release();}
   void Dump(unsigned);
 };
@@ -377,7 +381,11 @@ class AnnotationTypeNode : public TreeNode {
 private:
   IdentifierNode *mName;
 public:
+  AnnotationTypeNode() : mName(NULL) {mKind = NK_AnnotationType;}
+  ~AnnotationTypeNode(){}
+
   void SetName(IdentifierNode *n) {mName = n;}
+  IdentifierNode* GetId() {return mName;}
 };
 
 // Annotation/Pragma is complicated, but everything starts from the
@@ -395,6 +403,12 @@ public:
   ~AnnotationNode(){}
 
   void SetName(IdentifierNode *n) {mName = n;}
+  void SetType(AnnotationTypeNode *n) {mType = n;}
+  void SetExpr(TreeNode *n) {mExpr = n;}
+
+  IdentifierNode*     GetId()   {return mName;}
+  AnnotationTypeNode* GetType() {return mType;}
+  TreeNode*           GetExpr() {return mExpr;}
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -468,6 +482,7 @@ public:
   void SetField(IdentifierNode *f) {mField = f;}
 
   const char* GetName() {return mName;}
+  void SetName(const char *s) {mName = s;}
   void Dump(unsigned);
 };
 
@@ -534,6 +549,7 @@ public:
   ~LiteralNode(){}
 
   const char* GetName() {return mName;}
+  LitData     GetData() {return mData;}
   void Dump(unsigned);
 };
 
@@ -754,6 +770,9 @@ public:
   unsigned GetArgsNum() {return mArgs.GetNum();}
   TreeNode* GetArg(unsigned index) {return mArgs.ExprAtIndex(index);}
 
+  const char* GetName() {return mName;}
+  void SetName(const char *s) {mName = s;}
+
   void Release() {mArgs.Release();}
   void Dump(unsigned);
 };
@@ -776,6 +795,15 @@ public:
 // We may move those initializer into the constructor body.
 //////////////////////////////////////////////////////////////////////////
 
+// The statements of a function body or an instance initializer which are
+// skipped by the lazy parsing. They are parsed when asked for the first time.
+// See parser_lazy.cpp
+class LazyBody {
+public:
+  virtual ~LazyBody() {}
+  virtual bool Parse(BlockNode*) = 0;  // Parse and add the statements to the block.
+};
+
 class BlockNode : public TreeNode {
 public:
   SmallList<TreeNode*> mChildren;
@@ -785,10 +813,19 @@ public:
   bool                mIsInstInit; // Instance Initializer
   SmallVector<AttrId> mAttrs;
 
+  LazyBody           *mLazy;       // Not NULL if the statements are not parsed yet.
+
 public:
-  BlockNode(){mKind = NK_Block; mIsInstInit = false;}
+  BlockNode(){mKind = NK_Block; mIsInstInit = false; mLazy = NULL;}
   ~BlockNode() {Release();}
 
+  // Lazy parsing related. ParseLazy() returns false if the statements have
+  // illegal syntax.
+  bool IsLazy()               {return mLazy != NULL;}
+  void SetLazy(LazyBody *l)   {mLazy = l;}
+  bool ParseLazy()            {if (mLazy && mLazy->Parse(this)) mLazy = NULL;
+                               return !mLazy;}
+
   // Instance Initializer and Attributes related
   bool IsInstInit()    {return mIsInstInit;}
   void SetIsInstInit() {mIsInstInit = true;}
@@ -835,6 +872,11 @@ public:
 
   BlockNode* GetBody() {return mBody;}
   void AddBody(BlockNode *b) {mBody = b; CleanUp();}
+  void SetBody(BlockNode *b) {mBody = b;}
+
+  // The body with its statements parsed, if it was skipped by the lazy parsing.
+  // Returns NULL if the statements have illegal syntax.
+  BlockNode* ParseBody();
 
   bool IsConstructor()    {return mIsConstructor;}
   void SetIsConstructor() {mIsConstructor = true;}
@@ -865,6 +907,7 @@ public:
   TreeNode* GetType(){return mType;}
 
   void SetDims(DimensionNode *t) {mDims = t;}
+  DimensionNode* GetDims()       {return mDims;}
   unsigned GetDimsNum()          {return mDims->GetDimsNum();}
   bool     IsArray()             {return mDims && GetDimsNum() > 0;}
   unsigned AddDim(unsigned i = 0){mDims->AddDim(i);}           // 0 means unspecified
@@ -895,11 +938,23 @@ private:
   SmallVector<IdentifierNode*> mFields;
   SmallVector<FunctionNode*>   mMethods;
 public:
-  InterfaceNode() : mIsAnnotation(false) {mKind = NK_Interface;}
+  InterfaceNode() : mName(NULL), mIsAnnotation(false) {mKind = NK_Interface;}
   ~InterfaceNode() {}
 
   void SetName(const char *n) {mName = n;}
+  const char* GetName() {return mName;}
   void SetIsAnnotation(bool b) {mIsAnnotation = b;}
+  bool IsAnnotation() {return mIsAnnotation;}
+
+  unsigned GetSuperInterfacesNum() {return mSuperInterfaces.GetNum();}
+  unsigned GetFieldsNum()          {return mFields.GetNum();}
+  unsigned GetMethodsNum()         {return mMethods.GetNum();}
+  InterfaceNode*  GetSuperInterface(unsigned i) {return mSuperInterfaces.ValueAtIndex(i);}
+  IdentifierNode* GetField(unsigned i)          {return mFields.ValueAtIndex(i);}
+  FunctionNode*   GetMethod(unsigned i)         {return mMethods.ValueAtIndex(i);}
+  void AddSuperInterface(InterfaceNode *n) {mSuperInterfaces.PushBack(n);}
+  void AddField(IdentifierNode *n)         {mFields.PushBack(n);}
+  void AddMethod(FunctionNode *n)          {mMethods.PushBack(n);}
 
   void Construct(BlockNode *);
   void Dump(unsigned);
@@ -964,6 +1019,14 @@ public:
   void AddAttr(AttrId a) {mAttributes.PushBack(a);}
   void AddBody(BlockNode *b) {mBody = b;}
 
+  unsigned GetSuperClassesNum()    {return mSuperClasses.GetNum();}
+  unsigned GetSuperInterfacesNum() {return mSuperInterfaces.GetNum();}
+  unsigned GetAttrsNum()           {return mAttributes.GetNum();}
+  ClassNode*     GetSuperClass(unsigned i)     {return mSuperClasses.ValueAtIndex(i);}
+  InterfaceNode* GetSuperInterface(unsigned i) {return mSuperInterfaces.ValueAtIndex(i);}
+  AttrId         AttrAtIndex(unsigned i)       {return mAttributes.ValueAtIndex(i);}
+  BlockNode*     GetBody()                     {return mBody;}
+
   unsigned GetFieldsNum()      {return mFields.GetNum();}
   unsigned GetMethodsNum()     {return mMethods.GetNum();}
   unsigned GetConstructorNum() {return mConstructors.GetNum();}
@@ -977,7 +1040,16 @@ public:
   ClassNode* GetLocalClass(unsigned i)     {return mLocalClasses.ValueAtIndex(i);}
   InterfaceNode* GetLocalInterface(unsigned i)  {return mLocalInterfaces.ValueAtIndex(i);}
 
+  // The members are usually collected from mBody by Construct().
+  void AddField(IdentifierNode *n)     {mFields.PushBack(n);}
+  void AddMethod(FunctionNode *n)      {mMethods.PushBack(n);}
+  void AddConstructor(FunctionNode *n) {mConstructors.PushBack(n);}
+  void AddInstInit(BlockNode *n)       {mInstInits.PushBack(n);}
+  void AddLocalClass(ClassNode *n)     {mLocalClasses.PushBack(n);}
+  void AddLocalInterface(InterfaceNode *n) {mLocalInterfaces.PushBack(n);}
+
   void Construct();
+  void ClearMembers();
   void Release();
   void Dump(unsigned);
 };
@@ -1022,6 +1094,10 @@ public:
   void AddParam(IdentifierNode *n) {mParams.PushBack(n);}
   void SetBody(TreeNode *n) {mBody = n;}
 
+  unsigned        GetParamsNum()       {return mParams.GetNum();}
+  IdentifierNode* GetParam(unsigned i) {return mParams.ValueAtIndex(i);}
+  TreeNode*       GetBody()            {return mBody;}
+
   void Release() {mParams.Release();}
   void Dump(unsigned);
 };
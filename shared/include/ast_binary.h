@@ -0,0 +1,284 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file defines the binary format of AST, with its writer and reader.
+//
+// It's the way to hand an ASTModule to another process or save it on disk,
+// without reparsing. The format is flat and position independent, so that a
+// reader can walk the tree directly from an mmap'd file without allocating
+// or fixing up anything.
+//
+// The file is laid out as
+//
+//   ASTBinHeader
+//   uint32_t   mTrees[mTreesNum]     record offsets of root nodes
+//   uint32_t   mImports[mImportsNum] record offsets of ImportNode
+//   records                          one for each TreeNode, 4-byte aligned
+//   string table                     NUL-terminated strings, each stored once
+//
+// A record is a ASTBinRecord followed by three arrays of 32-bit words,
+//
+//   uint32_t mGroupEnds[mGroupsNum]  the end index of each child group
+//   int32_t  mChildren[...]          children, as offsets relative to the
+//                                    start of this record. 0 means NULL.
+//   uint32_t mExtras[mExtrasNum]     kind specific data, like attributes.
+//
+// Children of a node are organized into groups, one group for each member
+// of the TreeNode. A group has one child for a single TreeNode* member, and
+// any number of children for a SmallVector. The groups of each node kind are
+// listed below as ABG_* enums.
+//
+// A TreeNode referenced by multiple parents, e.g. a field of ClassNode which
+// is also a child of its body, is written once and shared by all references.
+// mParent is not written.
+//
+// ASTBinReader::Load() rebuilds the TreeNodes from the records, eg. for
+// java2mpl --read-ast to dump the module as parsed.
+//
+// All integers are in the byte order of the writer. ASTBinReader checks the
+// byte order and rejects the file if it's different.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __AST_BINARY_H__
+#define __AST_BINARY_H__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "ast.h"
+
+#define AST_BIN_VERSION    1
+#define AST_BIN_BYTE_ORDER 0x01020304
+
+// A string offset for NULL strings.
+#define AST_BIN_NO_STRING  0xffffffff
+
+struct ASTBinHeader {
+  char     mMagic[4];       // "MAST"
+  uint32_t mVersion;
+  uint32_t mByteOrder;      // AST_BIN_BYTE_ORDER
+  uint32_t mSize;           // size of the whole file.
+  uint32_t mFileName;       // string offset of the source file name.
+  uint32_t mPackage;        // record offset of PackageNode, or 0.
+  uint32_t mTreesNum;
+  uint32_t mImportsNum;
+  uint32_t mRecordsStart;   // offset of the first record.
+  uint32_t mStrTabStart;    // offset of the string table, also the end of records.
+  uint32_t mStrTabSize;
+};
+
+struct ASTBinRecord {
+  uint8_t  mKind;           // NodeKind
+  uint8_t  mFlags;          // ASTBinFlag
+  uint8_t  mGroupsNum;
+  uint8_t  mPad;
+  uint32_t mName;           // string offset, or AST_BIN_NO_STRING
+  uint32_t mData;           // kind specific, see below.
+  int32_t  mLabel;          // relative offset of the label, or 0.
+  uint32_t mChildrenNum;    // total number of children in all groups.
+  uint32_t mExtrasNum;
+};
+
+// mFlags
+enum ASTBinFlag {
+  ABF_IsPost        = 1,    // UnaOperatorNode
+  ABF_IsDefault     = 1,    // SwitchLabelNode
+  ABF_IsInstInit    = 1,    // BlockNode
+  ABF_IsConstructor = 1,    // FunctionNode
+  ABF_JavaEnum      = 1,    // ClassNode
+  ABF_IsAnnotation  = 1     // InterfaceNode
+};
+
+// Child groups of each node kind. Kinds not listed have no children.
+//
+// mData and mExtras of each kind are,
+//   Import      : mData is ImportProperty
+//   Identifier  : mExtras are AttrId
+//   Dimension   : mExtras are the dimensions, 0 means unspecified.
+//   Attr        : mData is AttrId
+//   PrimType    : mData is TypeId
+//   Literal     : mData is LitId. mExtras are the raw bits of the value, one
+//                 word for int/float/bool/char, two words for double. mName
+//                 is the text of a string literal, or the name otherwise.
+//   UnaOperator, BinOperator, TerOperator : mData is OprId
+//   Block, Function, Class : mExtras are AttrId
+enum {ABG_IdentifierType, ABG_IdentifierInit, ABG_IdentifierDims, ABG_IdentifierNum};
+enum {ABG_FieldParent, ABG_FieldField, ABG_FieldNum};
+enum {ABG_UserTypeId, ABG_UserTypeArgs, ABG_UserTypeNum};
+enum {ABG_CastDestType, ABG_CastExpr, ABG_CastNum};
+enum {ABG_ParenthesisExpr, ABG_ParenthesisNum};
+enum {ABG_VarListVars, ABG_VarListNum};
+enum {ABG_ExprListExprs, ABG_ExprListNum};
+enum {ABG_UnaOperatorOpnd, ABG_UnaOperatorNum};
+enum {ABG_BinOperatorA, ABG_BinOperatorB, ABG_BinOperatorNum};
+enum {ABG_TerOperatorA, ABG_TerOperatorB, ABG_TerOperatorC, ABG_TerOperatorNum};
+enum {ABG_LambdaParams, ABG_LambdaBody, ABG_LambdaNum};
+enum {ABG_BlockChildren, ABG_BlockNum};
+enum {ABG_FunctionType, ABG_FunctionParams, ABG_FunctionBody, ABG_FunctionThrows,
+      ABG_FunctionAnnotations, ABG_FunctionDims, ABG_FunctionNum};
+enum {ABG_ClassSuperClasses, ABG_ClassSuperInterfaces, ABG_ClassBody, ABG_ClassFields,
+      ABG_ClassMethods, ABG_ClassConstructors, ABG_ClassInstInits, ABG_ClassLocalClasses,
+      ABG_ClassLocalInterfaces, ABG_ClassNum};
+enum {ABG_InterfaceSuperInterfaces, ABG_InterfaceFields, ABG_InterfaceMethods,
+      ABG_InterfaceNum};
+enum {ABG_AnnotationTypeId, ABG_AnnotationTypeNum};
+enum {ABG_AnnotationId, ABG_AnnotationType, ABG_AnnotationExpr, ABG_AnnotationNum};
+enum {ABG_ExceptionException, ABG_ExceptionNum};
+enum {ABG_ReturnResult, ABG_ReturnNum};
+enum {ABG_CondBranchCond, ABG_CondBranchTrue, ABG_CondBranchFalse, ABG_CondBranchNum};
+enum {ABG_BreakTarget, ABG_BreakNum};
+enum {ABG_ForLoopInit, ABG_ForLoopCond, ABG_ForLoopUpdate, ABG_ForLoopBody, ABG_ForLoopNum};
+enum {ABG_WhileLoopCond, ABG_WhileLoopBody, ABG_WhileLoopNum};
+enum {ABG_DoLoopCond, ABG_DoLoopBody, ABG_DoLoopNum};
+enum {ABG_NewId, ABG_NewParams, ABG_NewBody, ABG_NewNum};
+enum {ABG_CallMethod, ABG_CallArgs, ABG_CallNum};
+enum {ABG_SwitchLabelValue, ABG_SwitchLabelNum};
+enum {ABG_SwitchCaseLabels, ABG_SwitchCaseStmts, ABG_SwitchCaseNum};
+enum {ABG_SwitchCond, ABG_SwitchCases, ABG_SwitchNum};
+enum {ABG_PassChildren, ABG_PassNum};
+
+//////////////////////////////////////////////////////////////////////////////
+//                              Writer
+//////////////////////////////////////////////////////////////////////////////
+
+class ASTModule;
+
+// Everything of a TreeNode that goes into its record.
+struct ASTBinNodeInfo {
+  TreeNode                            *mNode;
+  uint32_t                             mOffset;   // offset of its record.
+  uint8_t                              mFlags;
+  uint32_t                             mName;     // string offset.
+  uint32_t                             mData;
+  std::vector<std::vector<TreeNode*> > mGroups;
+  std::vector<uint32_t>                mExtras;
+};
+
+class ASTBinWriter {
+private:
+  std::vector<ASTBinNodeInfo>              mNodes;
+  std::unordered_map<TreeNode*, unsigned>  mNodeIndex;   // index in mNodes.
+  std::string                              mStrTab;
+  std::unordered_map<std::string, uint32_t> mStrIndex;   // offset in mStrTab.
+
+  uint32_t AddString(const char *s);
+  void     AddNode(TreeNode *node);
+  void     CollectNode(ASTBinNodeInfo &info);
+  void     WriteRecord(const ASTBinNodeInfo &info, std::string &out);
+  uint32_t GetNodeOffset(TreeNode *node);
+
+public:
+  ASTBinWriter() {}
+  ~ASTBinWriter() {}
+
+  // Serialize 'module' into 'out'. Returns false if it's too big for
+  // 32-bit offsets.
+  bool Write(ASTModule *module, std::string &out);
+
+  // Write to a temporary file and rename it, so that readers never see a
+  // partial file.
+  bool WriteFile(ASTModule *module, const char *path);
+
+  // The same for a module already serialized by Write(), eg. a cached one.
+  static bool WriteBuffer(const std::string &buf, const char *path);
+};
+
+//////////////////////////////////////////////////////////////////////////////
+//                              Reader
+//////////////////////////////////////////////////////////////////////////////
+
+class ASTBinReader;
+
+// A view of a record. It's a small value, and nothing is copied out of the
+// buffer. A NULL child gives a view whose IsNull() is true.
+class ASTBinNode {
+private:
+  const ASTBinRecord *mRec;
+  const ASTBinReader *mReader;
+
+  const uint32_t* GroupEnds() const {return (const uint32_t*)(mRec + 1);}
+  const int32_t*  Children()  const {return (const int32_t*)(GroupEnds() + mRec->mGroupsNum);}
+  const uint32_t* Extras()    const {return (const uint32_t*)(Children() + mRec->mChildrenNum);}
+
+public:
+  ASTBinNode() : mRec(NULL), mReader(NULL) {}
+  ASTBinNode(const ASTBinRecord *r, const ASTBinReader *reader) : mRec(r), mReader(reader) {}
+
+  bool     IsNull()   const {return mRec == NULL;}
+  const ASTBinRecord* GetRecord() const {return mRec;}
+  NodeKind GetKind()  const {return (NodeKind)mRec->mKind;}
+  unsigned GetFlags() const {return mRec->mFlags;}
+  unsigned GetData()  const {return mRec->mData;}
+  const char* GetName() const;
+  ASTBinNode  GetLabel() const;
+
+  unsigned GetGroupsNum() const {return mRec->mGroupsNum;}
+  unsigned GetChildrenNum(unsigned group) const;
+  ASTBinNode GetChild(unsigned group, unsigned i = 0) const;
+
+  unsigned GetExtrasNum() const {return mRec->mExtrasNum;}
+  unsigned GetExtra(unsigned i) const {return Extras()[i];}
+
+  // The size of the record in bytes.
+  static unsigned RecordSize(const ASTBinRecord *r) {
+    return sizeof(ASTBinRecord) + 4 * (r->mGroupsNum + r->mChildrenNum + r->mExtrasNum);
+  }
+
+  void Dump(unsigned indent) const;
+};
+
+class ASTBinReader {
+private:
+  const char   *mBuf;
+  unsigned      mSize;
+  void         *mMap;      // not NULL if the file is mmap'd by us.
+  unsigned      mMapSize;
+
+  const ASTBinHeader* Header() const {return (const ASTBinHeader*)mBuf;}
+  bool Verify();
+
+public:
+  ASTBinReader() : mBuf(NULL), mSize(0), mMap(NULL), mMapSize(0) {}
+  ~ASTBinReader() {Close();}
+
+  // mmap the file. Returns false if it's not a valid AST file.
+  bool Open(const char *path);
+  // Use a buffer owned by the caller, which must be 4-byte aligned and
+  // live as long as the reader.
+  bool Attach(const void *buf, unsigned size);
+  void Close();
+
+  const char* GetFileName() const {return GetString(Header()->mFileName);}
+  ASTBinNode  GetPackage() const;
+  unsigned    GetTreesNum() const {return Header()->mTreesNum;}
+  ASTBinNode  GetTree(unsigned i) const;
+  unsigned    GetImportsNum() const {return Header()->mImportsNum;}
+  ASTBinNode  GetImport(unsigned i) const;
+
+  const char* GetString(uint32_t off) const;
+  ASTBinNode  NodeAt(uint32_t off) const;
+
+  // Rebuild the TreeNodes into 'module', which is empty, so that the module
+  // is the same as the one written. The names are put in gStringPool, the
+  // file can be closed after. Returns false if a node kind has no TreeNode.
+  bool Load(ASTModule *module) const;
+
+  void Dump() const;
+};
+
+#endif
@@ -167,6 +167,6 @@ public:
   TreeNode* AddTypeArgument();
 };
 
-// A global builder is good enough.
-extern ASTBuilder gASTBuilder;
+// A global builder is good enough. One per thread.
+extern thread_local ASTBuilder gASTBuilder;
 #endif
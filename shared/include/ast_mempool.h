@@ -41,7 +41,7 @@ private:
 public:
   std::vector<TreeNode*> mTreeNodes; // only TreeNode* is stored, no matter what's
 public:
-  TreePool(){}
+  TreePool() {mMP.SetTag(MS_Tree);}
   ~TreePool();
 
   void  SetBlockSize(unsigned s) {mMP.SetBlockSize(s);}
@@ -23,6 +23,7 @@
 
 class ASTTree;
 class ASTScope;
+class LazyBody;
 
 // The module is a member of class Parser.
 class ASTModule {
@@ -40,6 +41,8 @@ public:
                                      // are children of mRootScope.
   ASTScopePool           mScopePool; // All the scopes are store in this pool. It also contains
                                      // a vector of ASTScope pointer for traversal. 
+  std::vector<LazyBody*> mLazyBodies; // The bodies skipped by lazy parsing. They keep
+                                      // the tokens alive. Released in ~ASTModule();
 public:
   ASTModule();
   ~ASTModule();
@@ -49,13 +52,22 @@ public:
   void AddImport(ImportNode *imp) {mImports.PushBack(imp);}
 
   void AddTree(ASTTree* t) { mTrees.push_back(t); }
+  void AddLazyBody(LazyBody *b) { mLazyBodies.push_back(b); }
 
   ASTScope* NewScope(ASTScope *p);
 
+  // Reset the module so that it can be used for another compilation unit.
+  void Clear();
+
+  // Move the trees, package, imports and lazy bodies to 'dst', which takes
+  // over their memory. The scopes are not moved. This module is cleared.
+  void MoveTo(ASTModule *dst);
+
   void Dump();
 };
 
-// Assume currently only one global module is being processed.
-extern ASTModule gModule;
+// Assume currently only one global module is being processed in a thread.
+// Each thread has its own module, so that files can be parsed in parallel.
+extern thread_local ASTModule gModule;
 
 #endif
@@ -90,10 +90,11 @@ private:
   MemPool                mMemPool;
   std::vector<ASTScope*> mScopes;
 public:
-  ASTScopePool() {}
+  ASTScopePool() {mMemPool.SetTag(MS_Scope);}
   ~ASTScopePool();
   
   ASTScope* NewScope(ASTScope *parent);
+  void      Clear();  // remove all scopes, but keep memory.
 };
 
 #endif
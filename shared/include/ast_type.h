@@ -72,6 +72,7 @@ public:
   const char* GetName() {return mId->GetName();}
 
   unsigned TypeArgsNum() {return mTypeArguments.GetNum();}
+  IdentifierNode* TypeArgAtIndex(unsigned i) {return mTypeArguments.ValueAtIndex(i);}
   void     AddTypeArg(IdentifierNode *n) {mTypeArguments.PushBack(n);}
   void     AddTypeArgs(TreeNode *n);
 
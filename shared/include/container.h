@@ -44,6 +44,7 @@ class ContainerMemPool : public MemPool {
 public:
   unsigned mElemSize;
 public:
+  ContainerMemPool() {mTag = MS_Container;}
   char* AddrOfIndex(unsigned index);
   void  SetElemSize(unsigned i) {mElemSize = i;}
   char* AllocElem() {return Alloc(mElemSize);}
@@ -629,7 +630,7 @@ private:
   }
 
 public:
-  Guamian() {mHeader = NULL;}
+  Guamian() {mHeader = NULL; mMemPool.SetTag(MS_Container);}
   ~Guamian(){Release();}
 
   void AddElem(K key, E data) {
@@ -867,6 +868,7 @@ public:
     // mExtraChildrenPool won't go element by element. So just need basic
     // operations from MemPool. Don't need SetElemSize().
     mExtraChildrenPool.SetBlockSize(1024);
+    mExtraChildrenPool.SetTag(MS_Container);
   }
   ~ContTree() {Release(); mRoot = NULL;}
 
@@ -0,0 +1,136 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the C++ API for embedding the frontend in a program,
+// instead of running java2mpl per file. See frontend_c.h for the C API.
+//
+// FrontEnd::Parse() parses a source in memory and returns a ParseResult,
+// which owns the AST. Nothing is printed to stdout unless asked for. The
+// grammar tables are static, and the left recursions are built once by
+// FrontEnd::Init() and shared by all the following calls.
+//
+// Different threads can parse at the same time, because the module and the
+// memo tables of parsing are per thread. A ParseResult can be used by any
+// thread after it's returned.
+//
+// [NOTE] A MERROR or a failed MASSERT still exits the process, as it does in
+//        java2mpl.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __FRONTEND_H__
+#define __FRONTEND_H__
+
+#include <stddef.h>
+#include <string>
+#include <functional>
+
+#include "ast_module.h"
+#include "parse_budget.h"
+
+class ASTTree;
+class WorkPool;
+class Parser;
+
+struct ParseOptions {
+  bool      mValidateOnly;  // Only tell if the source is legal, no AST is built.
+  bool      mLazyBodies;    // Skip the bodies, see FunctionNode::ParseBody().
+  WorkPool *mWorkPool;      // Parse the top level constructs in parallel if not NULL.
+  ParseBudget mBudget;      // The budgets of each top level construct.
+
+  ParseOptions() : mValidateOnly(false), mLazyBodies(false), mWorkPool(NULL) {}
+};
+
+class ParseResult {
+private:
+  friend class FrontEnd;
+  friend class ParseStream;
+
+  std::string mName;              // mModule.mFileName points to it.
+  ASTModule   mModule;
+  bool        mSucc;
+  unsigned    mFurthestToken;
+  std::string mFurthestTokenName;
+  std::string mBudgetError;
+
+  ParseResult(const char *name);
+public:
+  ~ParseResult() {}
+
+  // Returns true if there is no syntax error.
+  bool        IsSucc()               {return mSucc;}
+  const char* GetName()              {return mName.c_str();}
+
+  // The furthest token reached, which tells where an illegal source fails.
+  unsigned    GetFurthestToken()     {return mFurthestToken;}
+  const char* GetFurthestTokenName() {return mFurthestTokenName.c_str();}
+
+  // Not empty if a construct exceeds the budgets, telling which one and where.
+  const char* GetBudgetError()       {return mBudgetError.c_str();}
+
+  ASTModule*  GetModule()            {return &mModule;}
+  unsigned    GetTreesNum()          {return mModule.mTrees.size();}
+  ASTTree*    GetTree(unsigned i)    {return mModule.mTrees[i];}
+
+  // The same text as java2mpl dumps the module.
+  void Dump(std::string &out);
+
+  // The binary AST, see ast_binary.h. Returns false if it's too big.
+  bool WriteBinary(std::string &out);
+};
+
+// Push mode. The source is fed in chunks as it arrives, and the callback
+// gets each top level tree as soon as it's built. The trees are built in
+// gModule of the thread, so a thread can have only one stream at a time.
+// mLazyBodies and mWorkPool are ignored.
+class ParseStream {
+private:
+  friend class FrontEnd;
+
+  ParseResult *mResult;
+  Parser      *mParser;
+
+  ParseStream(const char *name, const ParseOptions &opts,
+              const std::function<void(ASTTree*)> &callback);
+public:
+  ~ParseStream();
+
+  // Returns false once illegal syntax is met.
+  bool Feed(const char *data, size_t size);
+
+  // Parse the rest. The result takes over the trees, and the stream is
+  // done. The caller deletes the result.
+  ParseResult* Finish();
+};
+
+class FrontEnd {
+public:
+  // It's called by Parse() too, and only the first call does the work.
+  static void Init();
+
+  // 'name' is only the name of module. Returns NULL only if ParseFile()
+  // cannot read the file. The caller deletes the result.
+  static ParseResult* Parse(const char *name, const char *buf, size_t size,
+                            const ParseOptions &opts = ParseOptions());
+  static ParseResult* ParseFile(const char *name,
+                                const ParseOptions &opts = ParseOptions());
+
+  // The caller deletes the stream.
+  static ParseStream* StartStream(const char *name,
+                                  const ParseOptions &opts = ParseOptions(),
+                                  const std::function<void(ASTTree*)> &callback = NULL);
+};
+
+#endif
@@ -0,0 +1,69 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the C API for embedding the frontend. It's a thin
+// wrapper of the C++ API in frontend.h, and the result is an opaque handle.
+// C programs walk the AST in its binary format, see ast_binary.h
+//
+// The strings and buffers returned by fe_result_dump() and
+// fe_result_binary_ast() are allocated with malloc(), and freed by the caller.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __FRONTEND_C_H__
+#define __FRONTEND_C_H__
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct fe_result fe_result;
+
+// Flags of parsing
+#define FE_VALIDATE_ONLY 0x1   // Only tell if the source is legal.
+#define FE_LAZY_BODIES   0x2   // Skip the statements of method bodies.
+
+void        fe_init(void);
+
+// Return NULL only if fe_parse_file() cannot read the file.
+fe_result*  fe_parse_buffer(const char *name, const char *buf, size_t size, unsigned flags);
+fe_result*  fe_parse_file(const char *name, unsigned flags);
+void        fe_result_free(fe_result *res);
+
+int         fe_result_succ(fe_result *res);
+unsigned    fe_result_trees_num(fe_result *res);
+unsigned    fe_result_furthest_token(fe_result *res);
+const char* fe_result_furthest_token_name(fe_result *res);
+
+char*       fe_result_dump(fe_result *res);
+void*       fe_result_binary_ast(fe_result *res, size_t *size);
+
+// Push mode. The callback gets the index of each top level tree as soon as
+// it's built. fe_stream_feed() returns 0 once illegal syntax is met.
+// fe_stream_finish() frees the stream.
+typedef struct fe_stream fe_stream;
+typedef void (*fe_tree_callback)(void *ctx, unsigned index);
+
+fe_stream*  fe_stream_new(const char *name, unsigned flags, fe_tree_callback cb, void *ctx);
+int         fe_stream_feed(fe_stream *stream, const char *data, size_t size);
+fe_result*  fe_stream_finish(fe_stream *stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -55,6 +55,20 @@ public:
   bool endoffile;
   int ReadALine();  // read a line from def file.
 
+  // The source could be in memory instead of a file. The lines are read
+  // from mBuf when srcfile is NULL and mBuf is not.
+  const char *mBuf;
+  size_t      mBufSize;
+  size_t      mBufPos;       // the start of next line in mBuf.
+  size_t      mLineOffset;   // the start of current line in mBuf.
+  std::string mBufCopy;      // the copy of source given to PrepareForString().
+
+  // A /* comment is not closed at the end of file. The Lexer for a part
+  // of a file uses it to tell if the comment goes on into the next part.
+  bool        mCommentOpen;
+
+  int ReadALineFromBuf();
+
   // get the identifier name after the % or $ prefix
   void GetName(void);
 
@@ -80,6 +94,15 @@ public:
 
   void PrepareForFile(const std::string filename);
   void PrepareForString(const std::string &src);
+  void PrepareForBuffer(const char *buf, size_t size); // 'buf' is not copied.
+
+  // Push mode. Complete lines are appended to the source given to
+  // PrepareForString() as they arrive. Running out of lines sets endoffile,
+  // and the next append clears it.
+  void AppendLines(const char *data, size_t size);
+
+  size_t GetLineOffset() const { return mLineOffset; }
+  bool   CommentOpen() const { return mCommentOpen; }
 
   int GetCuridx() const { return curidx; }
   void SetCuridx(int i) { curidx = i; }
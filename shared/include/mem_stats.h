@@ -0,0 +1,84 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the accounting of memory used by the pools.
+//
+// Each MemPool is tagged by the subsystem owning it. The pools, StringPool
+// and AppealNode report the changes of
+//   reserved : bytes of blocks allocated from the system,
+//   used     : bytes handed out to the objects,
+//   wasted   : bytes at the end of blocks skipped by the pool,
+//   objects  : number of live allocations,
+// and the high-water mark of each is kept, per subsystem. The peak RSS of the
+// process is reported along with them.
+//
+// The accounting is off by default and costs a check of gMemStatsOn. Turn it
+// on by MemStats::Enable() before the memory to be seen is allocated.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __MEM_STATS_H__
+#define __MEM_STATS_H__
+
+#include <ostream>
+
+typedef enum {
+  MS_Other,
+  MS_Token,       // TokenPool
+  MS_String,      // StringPool
+  MS_Tree,        // TreePool, the AST nodes
+  MS_Scope,       // ASTScopePool
+  MS_Container,   // SmallVector, SmallList, Guamian, ContTree
+  MS_Appeal,      // AppealNode
+  MS_NA
+}MemSubsystem;
+
+struct MemUsage {
+  long long mReserved;
+  long long mUsed;
+  long long mWasted;
+  long long mObjects;
+  long long mPeakReserved;
+  long long mPeakUsed;
+  long long mPeakWasted;
+  long long mPeakObjects;
+};
+
+extern bool gMemStatsOn;
+
+class MemStats {
+public:
+  static void Enable() {gMemStatsOn = true;}
+  static bool IsEnabled() {return gMemStatsOn;}
+
+  static void Update(MemSubsystem s, long long reserved, long long used,
+                     long long wasted, long long objects);
+
+  static const char* GetName(MemSubsystem s);
+  static void Get(MemSubsystem s, MemUsage &usage);
+  static void GetTotal(MemUsage &usage);  // peaks are the sums of peaks.
+  static void ResetPeaks();
+  static long long GetPeakRSS();          // in KB, of the whole process.
+  static void Report(std::ostream &os);
+};
+
+// The changes are passed only if the accounting is on.
+inline void MemAccount(MemSubsystem s, long long reserved, long long used,
+                       long long wasted, long long objects) {
+  if (gMemStatsOn)
+    MemStats::Update(s, reserved, used, wasted, objects);
+}
+
+#endif
@@ -36,6 +36,8 @@
 
 #include <cstdlib>
 
+#include "mem_stats.h"
+
 //  Each time when extra memory is needed, a fixed size BLOCK will be allocated.
 //  It's defined by mBlockSize. Anything above this size will not
 //  be supported.
@@ -56,11 +58,19 @@ protected:
   Block    *mCurrBlock; // Currently available block
   Block    *mBlocks;    // all blocks, with the ending blocks could be free.
   unsigned  mBlockSize;
+
+  // Memory accounting, see mem_stats.h
+  MemSubsystem mTag;
+  unsigned     mObjects;  // live allocations
+
+  long long WastedBefore(Block *b);
 public:
-  MemPool() : mCurrBlock(NULL), mBlocks(NULL), mBlockSize(DEFAULT_BLOCK_SIZE) {}
+  MemPool() : mCurrBlock(NULL), mBlocks(NULL), mBlockSize(DEFAULT_BLOCK_SIZE),
+              mTag(MS_Other), mObjects(0) {}
   ~MemPool();
 
   void  SetBlockSize(unsigned i) {mBlockSize = i;}
+  void  SetTag(MemSubsystem t) {mTag = t;}
   char* AllocBlock();
   char* Alloc(unsigned);
   void  Release(unsigned i);  // release the last occupied i bytes.
@@ -0,0 +1,86 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the speculative parallel lexer of a whole file.
+//
+// The only state the Lexer carries from one line to the next is an open /*
+// comment. So the file is split at newlines into chunks, and each chunk is
+// lexed by its own Lexer in parallel, assuming it doesn't start inside a
+// comment.
+//
+// A fix-up pass then walks the chunks in order. If the previous chunk ends
+// in an open comment, the speculation of this chunk is wrong. The chunk is
+// re-lexed from inside the comment until the re-lexing reaches a line which
+// the speculative lexing also started fresh, and the rest of the speculative
+// tokens is taken from there. So only the mis-speculated prefix is re-lexed.
+//
+// The speculative lexing can also fail, when the text of a comment isn't
+// valid code, eg. a ' in it. The chunk is then re-lexed entirely in the
+// fix-up pass.
+//
+// The resulting token stream is the same as calling Lexer::LexToken() on the
+// file, including the whitespace and comment tokens.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PARALLEL_LEXER_H__
+#define __PARALLEL_LEXER_H__
+
+#include <vector>
+#include <string>
+#include <utility>
+
+class Lexer;
+class Token;
+class WorkPool;
+
+struct LexChunk {
+  size_t              mStart;        // offset in the text.
+  size_t              mEnd;          // offset after the last char.
+  std::vector<Token*> mTokens;
+  bool                mCommentOpen;  // ends inside an open /* comment.
+  bool                mFailed;       // the speculative lexing failed.
+
+  // <offset in the text, index in mTokens> of each line which the lexing
+  // started fresh, not inside a comment.
+  std::vector<std::pair<size_t, unsigned> > mFreshLines;
+};
+
+class ParallelLexer {
+private:
+  std::string            mText;
+  std::vector<LexChunk*> mChunks;
+  std::vector<Lexer*>    mLexers;         // The tokens are in their token pools.
+  std::vector<Token*>    mTokens;         // The final token stream.
+  unsigned               mMisSpeculated;  // Number of chunks re-lexed.
+
+  Lexer* NewLexer();
+  bool   LexChunkText(Lexer*, size_t base, bool fresh, LexChunk *out, LexChunk *spec);
+  void   SpeculateChunk(LexChunk*);
+  void   FixChunk(LexChunk*, bool comment_open);
+
+public:
+  ParallelLexer() : mMisSpeculated(0) {}
+  ~ParallelLexer();
+
+  // Returns false if the file cannot be read. 'pool' could be NULL, then
+  // the chunks are lexed one by one.
+  bool LexFile(const char *name, WorkPool *pool, size_t chunk_size = 64 * 1024);
+
+  std::vector<Token*>& GetTokens() {return mTokens;}
+  unsigned GetMisSpeculatedNum()   {return mMisSpeculated;}
+};
+
+#endif
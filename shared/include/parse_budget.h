@@ -0,0 +1,37 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// The budgets of parsing a top level construct. A construct exceeding any
+// of them is reported as illegal, instead of running for a long time on a
+// pathological input. See parser_budget.cpp
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PARSE_BUDGET_H__
+#define __PARSE_BUDGET_H__
+
+// 0 means no limit.
+struct ParseBudget {
+  unsigned mAppealNodes;  // AppealNodes created.
+  unsigned mWaves;        // instances of all the left recursion traversals.
+  unsigned mMatches;      // matchings of a rule table at a token. It's never
+                          // beyond MAX_SUCC_TOKENS, the size of match arrays.
+  unsigned mMillis;       // wall time in milliseconds.
+
+  ParseBudget() : mAppealNodes(0), mWaves(0), mMatches(0), mMillis(0) {}
+  bool IsSet() const {return mAppealNodes || mWaves || mMatches || mMillis;}
+};
+
+#endif
@@ -0,0 +1,109 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the persistent on-disk parse cache.
+//
+// A cache entry is keyed by the content of the source file and the grammar.
+// The key is the hex of a 64-bit FNV-1a hash of the content, the content
+// length, GetGrammarHash() and FRONTEND_STAMP, a hash of the frontend sources
+// made by shared/src/Makefile. So renaming or touching a file still hits,
+// while any change to the file, the rule or token tables, or the code
+// printing the output misses.
+//
+// An entry is a small binary file,
+//
+//   char     magic[8]      "MPLFEPC" + version
+//   uint32   flags         PC_Succ if the file had no syntax error
+//   uint32   sections num
+//   then for each section
+//     uint32 kind          PCSectionKind
+//     uint64 size
+//     char   data[size]
+//
+// Writers create a temporary file in the cache directory and rename() it to
+// the final name, so readers in other processes see either nothing or the
+// complete entry. A corrupted or truncated entry is treated as a miss and
+// removed.
+//
+// The cache is bounded by size. A hit updates the mtime of the entry, and
+// when the total size exceeds the limit, the entries with the oldest mtime
+// are removed first, which gives LRU across processes sharing the directory.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PARSE_CACHE_H__
+#define __PARSE_CACHE_H__
+
+#include <string>
+#include <vector>
+#include <mutex>
+
+#define PARSE_CACHE_VERSION 1
+
+enum PCFlag {
+  PC_Succ = 1
+};
+
+enum PCSectionKind {
+  PCS_Output = 1,   // Everything printed by parser and verifier.
+  PCS_AST,          // The AST in the format of ast_binary.h
+  PCS_NA
+};
+
+struct PCSection {
+  unsigned    mKind;
+  std::string mData;
+};
+
+struct PCEntry {
+  unsigned               mFlags;
+  std::vector<PCSection> mSections;
+
+  const std::string* GetSection(unsigned kind) const;
+  void AddSection(unsigned kind, const std::string &data);
+};
+
+class ParseCache {
+private:
+  std::string        mDir;
+  unsigned long long mMaxBytes;
+  unsigned long long mTotalBytes;  // estimated size of the directory.
+  unsigned           mTmpSeq;      // for unique temporary names.
+
+  std::mutex         mLock;        // protect all the members.
+
+  unsigned           mHits;
+  unsigned           mMisses;
+  unsigned           mStores;
+  unsigned           mEvictions;
+
+  std::string EntryPath(const std::string &key);
+  unsigned long long ScanDir(bool evict);
+
+public:
+  ParseCache(const char *dir, unsigned long long max_bytes);
+  ~ParseCache() {}
+
+  static std::string MakeKey(const std::string &content);
+
+  bool Lookup(const std::string &key, PCEntry &entry);
+  void Store(const std::string &key, const PCEntry &entry);
+
+  unsigned GetHits()   {return mHits;}
+  unsigned GetMisses() {return mMisses;}
+  void Report();
+};
+
+#endif
@@ -0,0 +1,139 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file defines the observer of parsing events. The parser reports what it
+// is doing, ie. entering and exiting rule tables, looking up the succ/fail
+// records, appealing, the waves of left recursion, sorting out, and building
+// AST nodes, to a ParseObserver. Tracing is one observer, see ParseTracer.
+//
+// The traversal is the hottest path of the parser. The events are reported
+// only if the parser is built with PARSE_EVENTS defined, ie.
+//   make clean; make PARSE_EVENTS=1
+// Otherwise PARSE_EVENT() is empty and there is not even a check of the
+// observer pointer left in the traversal.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PARSE_OBSERVER_H__
+#define __PARSE_OBSERVER_H__
+
+#include "parser.h"
+
+#ifdef PARSE_EVENTS
+#define PARSE_EVENT(obs, call) do { if (obs) (obs)->call; } while (0)
+#else
+#define PARSE_EVENT(obs, call) do {} while (0)
+#endif
+
+class ParseObserver {
+public:
+  virtual ~ParseObserver() {}
+
+  // The observer for a sub parser which works in another thread, see
+  // parser_parallel.cpp. It's called in that thread, and the sub parser owns
+  // the result. NULL means the sub parser reports nothing.
+  virtual ParseObserver* Clone() {return NULL;}
+
+  // Rule tables and tokens. 'token' is the current token. ExitTable() could be
+  // reported more than once for a table, LeaveTable() is reported once when
+  // the traversal of the table returns.
+  virtual void EnterTable(RuleTable *t, unsigned token) {}
+  virtual void ExitTable(RuleTable *t, unsigned token, bool succ, AppealStatus reason) {}
+  virtual void LeaveTable(RuleTable *t) {}
+  virtual void EnterToken(Token *t, unsigned token) {}
+  virtual void ExitToken(Token *t, unsigned token, bool succ) {}
+
+  // The succ/fail records of tables, looked up at the entry of a table.
+  virtual void MemoHit(RuleTable *t, unsigned token, bool succ) {}
+  virtual void MemoMiss(RuleTable *t, unsigned token) {}
+  virtual void AddFailed(RuleTable *t, unsigned token) {}
+  virtual void RetryWasSucc(RuleTable *t, unsigned token) {}
+  virtual void Appeal(RuleTable *t, unsigned token) {}
+
+  // An AppealNode is created for a rule table, or a lead node of recursion.
+  virtual void NewAppealNode(AppealNode *n) {}
+
+  // Left recursion.
+  virtual void EnterLeadNode(RuleTable *t, AppealNode *n, unsigned group) {}
+  virtual void ExitLeadNode(RuleTable *t, AppealNode *n) {}
+  virtual void ExitOtherLeadNode(RuleTable *t) {}
+  virtual void ConnectPrevious(RuleTable *t, AppealNode *n) {}
+  virtual void WaveInstance(AppealNode *lead, bool first) {}
+  virtual void FixedPoint(AppealNode *lead) {}
+
+  // Sorting out and patching the WasSucc nodes.
+  virtual void SortOut(AppealNode *root, const char *phase) {}
+  virtual void PatchRound(unsigned round) {}
+  virtual void FoundWasSucc(AppealNode *n) {}
+  virtual void FoundPatch(AppealNode *n) {}
+
+  // AST
+  virtual void AstNodeBuilt(AppealNode *n, TreeNode *tree) {}
+};
+
+// The observer behind --trace-table, --trace-left-rec, --trace-appeal,
+// --trace-failed, --trace-stack, --trace-sortout and --trace-patch-was-succ.
+class ParseTracer : public ParseObserver {
+public:
+  bool mTable;         // trace enter/exit rule tables
+  bool mLeftRec;       // trace left recursion
+  bool mAppeal;        // trace appealing
+  bool mFailed;        // trace gFailed
+  bool mVisited;       // trace the lookups of gSucc and gFailed
+  bool mSortOut;       // trace Sort out.
+  bool mPatchWasSucc;  // trace patching was succ node.
+
+private:
+  int  mIndentation;
+
+  void DumpIndentation();
+  void DumpSuccTokens();
+  void DumpSortOutNode(AppealNode*);
+  void DumpEnterTable(const char *name, unsigned token);
+  void DumpExitTable(const char *name, unsigned token, bool succ, AppealStatus reason);
+
+public:
+  ParseTracer() : mTable(false), mLeftRec(false), mAppeal(false), mFailed(false),
+                  mVisited(false), mSortOut(false), mPatchWasSucc(false),
+                  mIndentation(-2) {}
+
+  ParseObserver* Clone();
+
+  void EnterTable(RuleTable*, unsigned);
+  void ExitTable(RuleTable*, unsigned, bool, AppealStatus);
+  void LeaveTable(RuleTable*) {mIndentation -= 2;}
+  void EnterToken(Token*, unsigned);
+  void ExitToken(Token*, unsigned, bool);
+
+  void MemoHit(RuleTable*, unsigned, bool);
+  void MemoMiss(RuleTable*, unsigned);
+  void AddFailed(RuleTable*, unsigned);
+  void RetryWasSucc(RuleTable*, unsigned);
+  void Appeal(RuleTable*, unsigned);
+
+  void EnterLeadNode(RuleTable*, AppealNode*, unsigned);
+  void ExitLeadNode(RuleTable*, AppealNode*);
+  void ExitOtherLeadNode(RuleTable*);
+  void ConnectPrevious(RuleTable*, AppealNode*);
+  void WaveInstance(AppealNode*, bool);
+  void FixedPoint(AppealNode*);
+
+  void SortOut(AppealNode*, const char*);
+  void PatchRound(unsigned);
+  void FoundWasSucc(AppealNode*);
+  void FoundPatch(AppealNode*);
+};
+
+#endif
@@ -0,0 +1,97 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the parse server, which keeps one process running for
+// many parse requests. The grammar state and the worker threads with their
+// modules and memo tables stay warm between requests.
+//
+// A client talks to the server over stdin/stdout, or over a Unix domain
+// socket. A request is a line, and for 'buffer' the source follows it.
+//
+//   parse  FORMAT PATH
+//   buffer FORMAT SIZE NAME      followed by SIZE bytes of source
+//   quit                         close this client
+//   shutdown                     close this client and stop accepting others
+//
+// FORMAT is one of
+//   dump       the module dump, the same as java2mpl prints.
+//   ast        the binary AST, see ast_binary.h
+//   validate   nothing for a legal source, or "at token N 'name'".
+//
+// Each request gets one response, in the order of the requests of a client,
+//
+//   STATUS SIZE\n               followed by SIZE bytes of payload
+//
+// STATUS is 'ok', 'fail' if there is illegal syntax, or 'error' if the
+// request cannot be done, and the payload is the error message.
+//
+// Requests are parsed in parallel by a WorkPool. At most 'queue' requests
+// of all clients are in the server at the same time; beyond that the server
+// stops reading requests until a response is written. A request keeps no
+// memory after its response: the result and the strings of the request,
+// which are in a LocalStringPool, are freed. The module of the worker is
+// cleared by FrontEnd::Parse() of the next request.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PARSE_SERVER_H__
+#define __PARSE_SERVER_H__
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+#include "parse_budget.h"
+
+class WorkPool;
+struct ServerClient;
+struct ServerRequest;
+
+class ParseServer {
+private:
+  WorkPool                *mPool;
+  unsigned                 mQueueSize;  // max requests in the server.
+  unsigned                 mInFlight;
+  std::mutex               mLock;       // protect mInFlight.
+  std::condition_variable  mSlotCond;   // signaled when mInFlight decreases.
+
+  int                      mListenFd;
+  std::atomic<bool>        mShutdown;
+  ParseBudget              mBudget;     // of each top level construct.
+
+  void AcquireSlot();
+  void ReleaseSlot();
+  bool ReadRequest(ServerClient*, ServerRequest*);
+  void Process(ServerRequest*);
+  void WriterLoop(ServerClient*);
+
+public:
+  ParseServer(unsigned jobs, unsigned queue_size);
+  ~ParseServer();
+
+  void SetBudget(const ParseBudget &b) {mBudget = b;}
+
+  // Serve one client until it quits or closes 'in'.
+  void Serve(int in, int out);
+
+  // Serve the clients connecting to 'path', until one of them asks for
+  // shutdown. Returns false if it cannot listen on 'path'.
+  bool ServeSocket(const char *path);
+};
+
+#endif
@@ -20,6 +20,16 @@
 #include <fstream>
 #include <stack>
 #include <list>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <string>
+#include <map>
+#include <unordered_map>
+#include <functional>
+#include <chrono>
 
 #include "lexer.h"
 #include "ast_module.h"
@@ -27,6 +37,8 @@
 #include "recursion.h"
 #include "succ_match.h"
 #include "gen_summary.h"
+#include "spsc_ring.h"
+#include "parse_budget.h"
 
 class Function;
 class Stmt;
@@ -35,6 +47,12 @@ class RuleTable;
 class TableData;
 class ASTTree;
 class TreeNode;
+class BlockNode;
+class WorkPool;
+class ParallelLexer;
+class LazyBlock;
+struct LazyContext;
+class ParseObserver;
 
 typedef enum {
   FailWasFailed,
@@ -142,8 +160,14 @@ public:
   AppealNode() {mData.mTable=NULL; mParent = NULL;
                 mAfter = AppealStatus_NA; mSimplifiedIndex = 0; mIsTable = true;
                 mStartIndex = 0; mSorted = false; mFinalMatch = 0;
-                mIsPseudo = false; mAstTreeNode = NULL;}
-  ~AppealNode(){mMatches.Release();}
+                mIsPseudo = false; mAstTreeNode = NULL;
+                MemAccount(MS_Appeal, sizeof(AppealNode), sizeof(AppealNode), 0, 1);}
+  ~AppealNode(){mMatches.Release();
+                MemAccount(MS_Appeal, -(long long)sizeof(AppealNode),
+                           -(long long)sizeof(AppealNode), 0, -1);}
+
+  // Make a used node as if it's just created. The memory is kept.
+  void Reset();
 
   void AddChild(AppealNode *n) { mChildren.push_back(n); }
   void RemoveChild(AppealNode *n);
@@ -179,7 +203,46 @@ public:
   bool DescendantOf(AppealNode *p);
 };
 
+enum BudgetKind {
+  BK_None,
+  BK_AppealNodes,
+  BK_Waves,
+  BK_Matches,
+  BK_Time
+};
+
 class RecursionTraversal;
+
+// A frame of the traversal engine, see parser_engine.cpp. It's all the state
+// of a rule table being traversed. The match sets live in Parser::mMatchStack.
+enum TravFrameKind {
+  TF_Table,      // TraverseRuleTable() of a rule table.
+  TF_LeadNode,   // The Wavefront traversal of a recursion group from a LeadNode.
+  TF_Regular     // The regular traversal of a rule table, by its EntryType.
+};
+
+struct TravFrame {
+  unsigned char mKind;
+  unsigned char mState;       // Where to resume when the child frame returns.
+  bool          mFound;
+  bool          mFlag;        // TF_Table: in a recursion group.
+                              // TF_Regular: it was succ.
+  RuleTable    *mTable;
+  AppealNode   *mNode;        // The appeal node of mTable.
+  AppealNode   *mParent;
+  RecursionTraversal *mRecTra;
+  unsigned      mToken;       // mCurToken when the frame is pushed.
+  unsigned      mLongest;     // TF_Regular: the longest match if it was succ.
+  unsigned      mNewToken;    // Oneof: the position after most tokens eaten.
+  unsigned      mI;           // The element of mTable being traversed.
+  unsigned      mJ;           // The previous matching being tried.
+  unsigned      mBase;        // The match sets start at mMatchStack[mBase],
+  unsigned      mVisitedNum;  // in this order.
+  unsigned      mFinalNum;
+  unsigned      mPrevNum;
+  unsigned      mSubNum;      // At the top, so it can grow.
+};
+
 struct RecStackEntry {
   RecursionTraversal *mRecTra;
   unsigned *mGroupId;
@@ -199,34 +262,26 @@ public:
   Lexer *mLexer;
   const char *filename;
   bool mEndOfFile;
+  bool mIllegalSyntax;      // a top level construct failed to match.
 
   // debug info
-  int  mIndentation;
-  bool mTraceTable;         // trace enter/exit rule tables
-  bool mTraceLeftRec;       // trace enter/exit rule tables
-  bool mTraceAppeal;        // trace appealing
-  bool mTraceFailed;        // trace gFailed
-  bool mTraceTiming;        // trace gFailed
-  bool mTraceVisited;       // trace mVisitedStack
-  bool mTraceSortOut;       // trace Sort out.
+  bool mTraceTiming;        // trace parsing time
   bool mTraceAstBuild;      // trace AST build.
-  bool mTracePatchWasSucc;  // trace patching was succ node.
   bool mTraceWarning;       // print the warning.
 
+  // The events of traversal, sort out and AST building are reported to
+  // mObserver, see parse_observer.h. The parser owns it.
+  ParseObserver *mObserver;
+
   void SetLexerTrace() {mLexer->SetTrace();}
-  void DumpIndentation();
-  void DumpEnterTable(const char *tablename, unsigned indent);
-  void DumpExitTable(const char *tablename, unsigned indent,
-                     bool succ, AppealStatus reason = Succ);
-  void DumpAppeal(RuleTable *table, unsigned token);
-  void DumpSuccTokens();
-  void DumpSortOut(AppealNode *root, const char * /*hint*/);
-  void DumpSortOutNode(AppealNode*);
+  void SetObserver(ParseObserver *obs);
 
 private:
   std::vector<Token*>   mTokens;         // Storage of all tokens, including active, discarded,
                                          // and pending.
-  std::vector<Token*>   mActiveTokens;   // vector for tokens during matching.
+  std::vector<Token*>   mOwnTokens;      // storage of mActiveTokens if it's not a sub parser.
+  std::vector<Token*>  &mActiveTokens;   // vector for tokens during matching. A sub parser
+                                         // refers to the tokens of its parent.
   std::vector<unsigned> mStartingTokens; // The starting token of each self-complete statement.
                                          // It's an index of mActiveTokens.
   unsigned              mCurToken;       // index in mActiveTokens, the next token to be matched.
@@ -239,13 +294,26 @@ private:
 
   bool TraverseStmt();                                // success if all tokens are matched.
   bool TraverseRuleTable(RuleTable*, AppealNode*);    // success if all tokens are matched.
-  bool TraverseRuleTableRegular(RuleTable*, AppealNode*);    // success if all tokens are matched.
   bool TraverseRuleTablePre(AppealNode*);
-  bool TraverseTableData(TableData*, AppealNode*);    // success if all tokens are matched.
-  bool TraverseConcatenate(RuleTable*, AppealNode*);
-  bool TraverseOneof(RuleTable*, AppealNode*);
-  bool TraverseZeroormore(RuleTable*, AppealNode*);
-  bool TraverseZeroorone(RuleTable*, AppealNode*);
+
+  // The traversal engine. The rule tables are traversed with an explicit
+  // stack of frames instead of recursive calls. See parser_engine.cpp
+  std::vector<TravFrame> mFrames;
+  std::vector<unsigned>  mMatchStack;    // The match sets of the frames.
+  std::vector<unsigned>  mMatchScratch;
+  bool                   mFrameResult;   // The result of the last popped frame.
+
+  void PushFrame(TravFrameKind, RuleTable*, AppealNode*, AppealNode*);
+  void PopFrame(bool);
+  bool CallTableData(TableData*, AppealNode*, bool&);
+  void StepTable(unsigned);
+  void StepLeadNode(unsigned);
+  void StepRegular(unsigned);
+  void StepOneof(unsigned);
+  void StepZeroormore(unsigned);
+  void StepConcatenate(unsigned);
+  void FinishLeadNode(unsigned);
+  void FinishRegular(unsigned, bool);
 
   // There are some special cases we can speed up the traversal.
   // 1. If the target is a token, we just need compare mCurToken with it.
@@ -275,7 +343,9 @@ private:
 
   // Appealing System
   std::vector<AppealNode*> mAppealNodes;
+  unsigned    mNumAppealNodes;   // The nodes created, including the reused.
   AppealNode *mRootNode;
+  AppealNode* NewAppealNode();
   void ClearAppealNodes();
 
   void Appeal(AppealNode *node, AppealNode *root);
@@ -308,18 +378,273 @@ private:
 // The following section is all about left recursion parsing
 /////////////////////////////////////////////////////////////
 private:
-  RecursionAll               mRecursionAll;
+  RecursionAll              *mRecursionAll;  // Shared, see RecursionAll::GetShared()
   SmallVector<RecStackEntry> mRecStack;
+  // The traversals of mRecStack by group id and start token. Nested
+  // constructs push many of them, which are looked up at each table.
+  std::unordered_map<unsigned long long, RecursionTraversal*> mRecIndex;
 
   void PushRecStack(unsigned, RecursionTraversal*, unsigned);
+  void PopRecStack(unsigned, unsigned);
   RecursionTraversal* FindRecStack(unsigned /*group id*/, unsigned /*token*/);
 
   LeftRecursion* FindRecursion(RuleTable *);
   bool IsLeadNode(RuleTable *);
-  bool TraverseLeadNode(AppealNode*, AppealNode *parent);
   void SetIsDone(unsigned /*group*/, unsigned /*token*/);
   void SetIsDone(RuleTable*, unsigned);
 
+//////////////////////////////////////////////////////////////
+// The following section is about lexing in a separate thread.
+// The lexer thread pushes the tokens into mTokenRing, and LexOneLine()
+// pops them. A NULL token means the end of file.
+/////////////////////////////////////////////////////////////
+private:
+  SPSCRing<Token*>  *mTokenRing;
+  std::thread       *mLexThread;
+  std::atomic<bool>  mStopLex;    // Ask the lexer thread to quit.
+  bool               mRingDone;   // The NULL token was popped.
+
+  // A side waiting on a full or empty ring spins a while, then blocks here.
+  std::mutex              mRingLock;
+  std::condition_variable mRingCond;
+  std::atomic<unsigned>   mRingWaiters; // the sides blocked on mRingCond.
+
+  void     LexThreadLoop();
+  bool     PushToRing(Token*);
+  unsigned LexFromRing();
+  void     WaitRing(const std::function<bool()> &ready);
+  void     WakeRing();
+
+public:
+  void StartLexThread(unsigned ring_size = 4096);
+  void StopLexThread();
+
+//////////////////////////////////////////////////////////////
+// The following section is about parsing the top level constructs
+// of a file in parallel. See parser_parallel.cpp
+/////////////////////////////////////////////////////////////
+private:
+  WorkPool                *mWorkPool;  // Not NULL if parsing in parallel.
+  Parser                  *mParent;    // The parent if it's a sub parser.
+  std::vector<ASTTree*>    mSubTrees;  // The trees of a sub parser. They will be
+                                       // moved to the module by the parent.
+
+  ParallelLexer           *mParallelLexer;
+  bool                     mParallelLex;  // Lex the file in parallel too.
+
+  Parser(Parser *parent);
+  void LexAll();
+  bool LexAllParallel();
+  void FindTopBoundaries(std::vector<unsigned>&);
+  void ParseParallel();
+
+public:
+  void SetWorkPool(WorkPool *pool) {mWorkPool = pool;}
+  void SetParallelLex()            {mParallelLex = true;}
+
+//////////////////////////////////////////////////////////////
+// The following section is about reparsing an edited file. Only the top
+// level constructs, or the members of a class, touched by an edit are lexed
+// and parsed again.
+// See parser_incremental.cpp
+/////////////////////////////////////////////////////////////
+private:
+  struct IncMember {
+    unsigned mStart;       // the first token, index of mActiveTokens.
+    unsigned mEnd;         // the last token.
+    unsigned mFirstLine;
+    unsigned mLastLine;
+    unsigned mNodes;       // its children in the class body.
+    std::shared_ptr<ASTTree> mTree;   // the owner of its nodes, if reparsed alone.
+    std::shared_ptr<Lexer>   mLexer;  // and of its tokens.
+  };
+
+  struct IncConstruct {
+    unsigned mStart;       // the first token, index of mActiveTokens.
+    unsigned mFirstLine;   // line of the first token.
+    unsigned mLastLine;    // line of the last token.
+    ASTTree *mTree;
+    std::vector<std::shared_ptr<Lexer> > mLexers;  // the owners of its tokens.
+    bool     mHasMembers;  // a class whose members can be reparsed alone.
+    unsigned mLbrace;      // the '{' and '}' of the class body.
+    unsigned mRbrace;
+    std::vector<IncMember> mMembers;
+  };
+
+  bool                      mIncValid;     // The state below matches mIncSource.
+  std::string               mIncSource;
+  std::vector<size_t>       mIncLineStarts;
+  std::vector<char>         mIncCleanLines;  // The line is not started inside a comment.
+  std::vector<unsigned>     mIncTokenLines;  // The line of each token in mActiveTokens.
+  std::vector<IncConstruct> mIncConstructs;
+
+  unsigned                  mIncRelexedLines;   // Statistics of the last reparse.
+  unsigned                  mIncReparsedTokens;
+  unsigned                  mIncReparsed;
+  unsigned                  mIncReparsedMembers;
+
+  // ParseStmt() keeps the members of a class here, see IncFindMembers().
+  bool                      mIncFindMembers;
+  bool                      mIncBodyFound;
+  unsigned                  mIncLbrace;
+  unsigned                  mIncRbrace;
+  std::vector<AppealNode*>  mIncMemberNodes;
+
+  void IncSplitLines(const std::string&, std::vector<size_t>&);
+  bool IncLexLines(const std::string&, const std::vector<size_t>&, unsigned, unsigned,
+                   std::shared_ptr<Lexer>&, std::vector<Token*>&,
+                   std::vector<unsigned>&, std::vector<char>&);
+  void IncDeleteTree(ASTTree*);
+  bool IncParse(unsigned, unsigned, std::shared_ptr<Lexer>&);
+  bool IncFullParse(const std::string&);
+  void IncClear();
+  void IncFindMembers();
+  bool IncGetMembers(BlockNode*, std::vector<IncMember>&);
+  void IncSetMembers(IncConstruct&);
+  void IncShift(IncConstruct&, int, int);
+  bool IncReparseMembers(const std::string&, std::vector<size_t>&, unsigned, unsigned, int);
+
+public:
+  bool     ParseIncremental(const std::string &src);
+  unsigned GetRelexedLines()    {return mIncRelexedLines;}
+  unsigned GetReparsedTokens()  {return mIncReparsedTokens;}
+  unsigned GetReparsedNum()     {return mIncReparsed;}
+  unsigned GetReparsedMembers() {return mIncReparsedMembers;}
+
+//////////////////////////////////////////////////////////////
+// The following section is about lazy parsing. The statements of method
+// bodies and instance initializers are skipped, and parsed when asked for.
+// See parser_lazy.cpp
+/////////////////////////////////////////////////////////////
+private:
+  friend class LazyBlock;
+
+  bool                           mLazy;        // Skip the bodies.
+  RuleTable                     *mTopTable;    // Not NULL if only this table is parsed,
+                                               // instead of the top rules.
+  std::map<unsigned, LazyBlock*> mLazyBlocks;  // The skipped bodies, indexed by their '{'
+                                               // in mActiveTokens.
+  std::shared_ptr<LazyContext>   mLazyContext;
+
+  Parser(const char *name, std::vector<Token*> &tokens, RuleTable *top);
+  void CollapseBodies();
+  void SetLazyBody(AppealNode*, TreeNode*);
+  void FinishLazy();
+
+public:
+  void SetLazyBodies()             {mLazy = true;}
+
+//////////////////////////////////////////////////////////////
+// The following section is about validating only. The file is parsed to
+// tell if it's legal, and nothing is built after a top level construct is
+// matched, ie. no SortOut, no PatchWasSucc, no SimplifySortedTree and no
+// BuildAST.
+/////////////////////////////////////////////////////////////
+private:
+  bool     mValidateOnly;
+  unsigned mFurthestToken;  // Index in mActiveTokens of the furthest token reached.
+
+  // The nodes free to be reused, and those in recursion groups to be freed
+  // once no recursion is traversed. See FreeNode().
+  std::vector<AppealNode*> mFreeNodes;
+  std::vector<AppealNode*> mKeptNodes;
+  bool RecycleNodes() {return mValidateOnly && !mObserver;}
+  void FreeNode(AppealNode*, bool);
+  void FreeKeptNodes();
+
+public:
+  void        SetValidateOnly()  {mValidateOnly = true;}
+  unsigned    GetFurthestToken() {return mFurthestToken;}
+  const char* GetFurthestTokenName();
+
+//////////////////////////////////////////////////////////////
+// The following section is about embedding the parser in a library. The
+// source could be in memory, and a quiet parser prints nothing to stdout
+// except the traces asked for. See frontend.h
+/////////////////////////////////////////////////////////////
+private:
+  bool mQuiet;
+  void Init();
+
+public:
+  Parser(const char *name, const std::string &src);
+  void SetQuiet()                  {mQuiet = true;}
+
+//////////////////////////////////////////////////////////////
+// The following section is about parsing in push mode. The source is fed
+// in chunks as it arrives, and a top level construct is parsed once it's
+// complete. See parser_stream.cpp
+/////////////////////////////////////////////////////////////
+private:
+  bool                          mStreaming;
+  bool                          mStreamEnd;      // FinishStream() is called.
+  std::string                   mStreamPartial;  // The incomplete last line.
+  unsigned                      mStreamScanned;  // Tokens scanned for boundaries.
+  int                           mStreamBraces;
+  int                           mStreamParens;
+  unsigned                      mStreamReady;    // The token after the last complete construct.
+  unsigned                      mStreamEmitted;  // Trees of gModule passed to mStreamCallback.
+  std::function<void(ASTTree*)> mStreamCallback;
+
+  void StreamScan();
+  bool StreamParseStmt();
+
+public:
+  void StartStream(const std::function<void(ASTTree*)> &callback);
+  bool FeedStream(const char *data, size_t size);
+  bool FinishStream();
+
+//////////////////////////////////////////////////////////////
+// The following section is about the budgets of a top level construct.
+// Once a budget is exceeded, the traversal unwinds as a fail, and the
+// construct is reported as illegal with the budget, the rule table and the
+// token where it happened. See parser_budget.cpp
+/////////////////////////////////////////////////////////////
+private:
+  ParseBudget mBudget;
+  bool        mBudgetOn;        // CheckBudget() is needed.
+  unsigned    mMatchLimit;      // mBudget.mMatches, or MAX_SUCC_TOKENS.
+  BudgetKind  mBudgetHit;
+  RuleTable  *mBudgetTable;     // The table being traversed when it's exceeded.
+  unsigned    mBudgetToken;
+  unsigned    mBudgetStartToken;  // The first token of the construct.
+  unsigned    mWaves;
+  unsigned    mBudgetTicks;     // CheckBudget() calls since the clock was read.
+  std::chrono::steady_clock::time_point mBudgetStart;
+  std::string mBudgetError;
+
+  void InitBudget();
+  void StartBudget();
+  bool CheckBudget(RuleTable*);
+  bool AddWave(RuleTable*);
+  void ExceedBudget(BudgetKind, RuleTable*);
+  void ReportBudget();
+
+public:
+  void SetBudget(const ParseBudget &b);
+  const ParseBudget& GetBudget()      {return mBudget;}
+  bool BudgetExceeded()               {return mBudgetHit != BK_None;}
+  const std::string& GetBudgetError() {return mBudgetError;}
+  bool OverMatchBudget(unsigned, RuleTable*);
+
+//////////////////////////////////////////////////////////////
+// The following section is about the compiled rule tables. autogen generates
+// a C++ function for each rule table of tokens only, see gen_match.cpp.
+// They are called instead of the regular traversal, unless mInterpret.
+// Neither is the lookahead of a subtable checked before entering it then.
+// The functions below are what they call back.
+/////////////////////////////////////////////////////////////
+private:
+  bool mInterpret;
+
+public:
+  void     SetInterpret()     {mInterpret = true;}
+  bool     GetInterpret()     {return mInterpret;}
+  unsigned GetCurToken()      {return mCurToken;}
+  bool     MatchToken(unsigned id, AppealNode*);
+  unsigned GetCurTokenId();
+  void     SetMatches(unsigned start, unsigned num);
+
 public:
   Parser(const char *f);
   ~Parser();
@@ -338,7 +663,7 @@ public:
 // I put 256 as the biggest number. For all the code I've see it should be ok.
 // If someday someone has a 'stack smashing' error, please check this.
 #define MAX_SUCC_TOKENS 256
-extern unsigned gSuccTokensNum;
-extern unsigned gSuccTokens[MAX_SUCC_TOKENS];
+extern thread_local unsigned gSuccTokensNum;
+extern thread_local unsigned gSuccTokens[MAX_SUCC_TOKENS];
 
 #endif
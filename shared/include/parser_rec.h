@@ -91,16 +91,11 @@ private:
 
   SmallVector<AppealNode*> mAppealPoints; // places to start appealing
 
-  bool     mTrace;
-  unsigned mIndentation;
-
 private:
   bool        mSucc;
   unsigned    mStartToken;
+  AppealNode *mLead;      // The lead node of current instance.
 
-  bool FindFirstInstance();
-  bool FindRestInstance();
-  bool FindInstances();
   void FinalConnection();
 
 public:
@@ -112,9 +107,6 @@ public:
 
   RuleTable* GetRuleTable() {return mRuleTable;}
 
-  void     SetTrace(bool b){mTrace = b;}
-  void     SetIndentation(unsigned i) {mIndentation = i;}
-  void     DumpIndentation();
 
   void AddVisitedLeadNode(RuleTable *rt) {mVisitedLeadNodes.PushBack(rt);}
   bool LeadNodeVisited(RuleTable *rt) {return mVisitedLeadNodes.Find(rt);}
@@ -128,7 +120,15 @@ public:
   RecursionTraversal(AppealNode *sel, AppealNode *parent, Parser *parser);
   ~RecursionTraversal();
 
-  void Work();
+  // The steps of finding the instances. The engine traverses the lead node
+  // returned by Start*Instance(), and passes the result to End*Instance().
+  AppealNode* StartFirstInstance();
+  bool        EndFirstInstance(bool found);
+  void        NextInstance();
+  AppealNode* StartRestInstance();
+  bool        EndRestInstance(bool found);
+  void        Finish(bool found);
+
   bool ConnectPrevious(AppealNode*);
 };
 
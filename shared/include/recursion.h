@@ -151,6 +151,10 @@ public:
 
   Recursion* FindRecursion(RuleTable *lead);
   bool IsLeadNode(RuleTable*);
+
+  // The recursions depend only on the grammar. They are built once and
+  // shared by all parsers of all threads, which only read them.
+  static RecursionAll* GetShared();
 };
 
 #endif
@@ -0,0 +1,89 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file defines the profiler of rule tables. It's a ParseObserver which
+// counts, per rule table, the entries, the lookups of succ/fail records,
+// the look ahead rejections, the AppealNodes and the waves of left recursion,
+// and measures the inclusive and exclusive time with TSC.
+//
+// A profiler is given to each parser. When a profiler is deleted, its data
+// are merged into its target, so a parser, its sub parsers and all the files
+// of a batch can be summarized in one report.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RULE_PROFILER_H__
+#define __RULE_PROFILER_H__
+
+#include <vector>
+#include <mutex>
+#include <ostream>
+#include <stdint.h>
+
+#include "parse_observer.h"
+
+struct RuleProfile {
+  uint64_t mEntries;
+  uint64_t mMemoSucc;     // entries which hit a succ record
+  uint64_t mMemoFail;     // entries which hit a fail record
+  uint64_t mLookAhead;    // entries rejected by look ahead
+  uint64_t mAppealNodes;  // AppealNodes created for the table
+  uint64_t mWaves;        // instances of the recursion if it's a lead node
+  uint64_t mInclusive;    // ticks, the nested entries of itself counted once
+  uint64_t mExclusive;    // ticks, without the children tables
+};
+
+class RuleProfiler : public ParseObserver {
+private:
+  struct Frame {
+    unsigned mIndex;
+    uint64_t mStart;
+    uint64_t mChildren;   // ticks of children tables
+  };
+
+  RuleProfiler            *mTarget;
+  std::mutex               mLock;      // guards merging into this profiler.
+  std::vector<RuleProfile> mRules;     // indexed by RuleTable::mIndex
+  std::vector<unsigned>    mActive;    // entries of a table on mStack
+  std::vector<Frame>       mStack;
+
+  // Calibration of the ticks.
+  uint64_t mStartTicks;
+  uint64_t mStartNanos;
+
+  void Merge(const std::vector<RuleProfile> &rules);
+  double TicksPerMs();
+  void SortedRules(std::vector<unsigned> &order);
+
+public:
+  RuleProfiler(RuleProfiler *target = NULL);
+  ~RuleProfiler();
+
+  ParseObserver* Clone() {return new RuleProfiler(this);}
+
+  void EnterTable(RuleTable*, unsigned);
+  void ExitTable(RuleTable*, unsigned, bool, AppealStatus);
+  void LeaveTable(RuleTable*);
+  void MemoHit(RuleTable*, unsigned, bool);
+  void WaveInstance(AppealNode*, bool);
+  void NewAppealNode(AppealNode*);
+
+  // The hottest 'top' rules by exclusive time, 0 means all.
+  void Report(std::ostream &os, unsigned top);
+  void WriteCSV(std::ostream &os);
+  void WriteJSON(std::ostream &os);
+};
+
+#endif
@@ -124,6 +124,23 @@ struct LookAheadTable {
 // Generated in gen_lookahead.cpp.
 extern LookAheadTable *gLookAheadTable;
 
+// A rule table is single match if only its longest matching can be part of
+// a successful parsing, so the parser keeps just that one. This will be an
+// array with NumOfRules elements.
+// Generated in gen_lookahead.cpp.
+extern bool *gSingleMatch;
+
+// The compiled matching of a rule table. It does what the regular traversal
+// of the table does, and returns if it's matched.
+class Parser;
+class AppealNode;
+typedef bool (*MatchFunc)(Parser*, AppealNode*);
+
+// This will be an array with NumOfRules elements, NULL if the rule table
+// is only interpreted.
+// Generated in gen_match.cpp.
+extern MatchFunc *gMatchFuncs;
+
 // Struct of the table entry
 struct RuleTable{
   EntryType   mType;
@@ -68,4 +68,9 @@ extern bool RuleReachable(RuleTable *from, RuleTable *to);
 // If two lookaheads are equal.
 extern bool LookAheadEqual(LookAhead, LookAhead);
 
+// A 64-bit fingerprint of all the rule tables, including the lookahead tables.
+// It changes whenever autogen generates a different grammar, and is used to
+// tell if anything derived from a parse is still valid.
+extern unsigned long long GetGrammarHash();
+
 #endif
@@ -0,0 +1,84 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+///////////////////////////////////////////////////////////////////////////////
+// This file contains a lock-free ring buffer of single producer and single
+// consumer.
+//
+// The producer only writes mTail, and the consumer only writes mHead. Each
+// side reads the other's index with acquire semantics, so a slot is always
+// completely written before the consumer can see it, and completely read
+// before the producer can reuse it.
+//
+// The ring never blocks. TryPush() fails if the ring is full and TryPop()
+// fails if it's empty. It's up to the user how to wait, and a full ring is
+// the natural backpressure on the producer.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPSC_RING_H__
+#define __SPSC_RING_H__
+
+#include <atomic>
+#include "massert.h"
+
+template <class T> class SPSCRing {
+private:
+  T        *mSlots;
+  unsigned  mMask;        // capacity - 1, capacity is power of 2.
+
+  // Keep the two indices in different cache lines, since they are
+  // written by different threads.
+  alignas(64) std::atomic<unsigned> mHead;  // next slot to pop.
+  alignas(64) std::atomic<unsigned> mTail;  // next slot to push.
+
+public:
+  // 'capacity' is rounded up to the power of 2.
+  SPSCRing(unsigned capacity) {
+    unsigned size = 2;
+    while (size < capacity)
+      size <<= 1;
+    mSlots = new T[size];
+    mMask = size - 1;
+    mHead.store(0, std::memory_order_relaxed);
+    mTail.store(0, std::memory_order_relaxed);
+  }
+  ~SPSCRing() {delete [] mSlots;}
+
+  unsigned GetCapacity() {return mMask + 1;}
+
+  // Called by the producer only.
+  bool TryPush(const T &t) {
+    unsigned tail = mTail.load(std::memory_order_relaxed);
+    unsigned head = mHead.load(std::memory_order_acquire);
+    if (tail - head > mMask)
+      return false;
+    mSlots[tail & mMask] = t;
+    mTail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Called by the consumer only.
+  bool TryPop(T &t) {
+    unsigned head = mHead.load(std::memory_order_relaxed);
+    unsigned tail = mTail.load(std::memory_order_acquire);
+    if (head == tail)
+      return false;
+    t = mSlots[head & mMask];
+    mHead.store(head + 1, std::memory_order_release);
+    return true;
+  }
+};
+
+#endif
@@ -22,13 +22,23 @@
 //   (3) If not found, a) Add std::string to the StringPool
 //                     b) Insert the corresponding StringMapEntry
 //
-// StringMap is (de)allocated through Mempool. String's are in StringPool.
+// The buckets are doubled when there are twice as many entries. 
+//
+// FindAddrFor() takes no lock, and can be called while one thread is in
+// LookupAddrFor(). An entry is never changed once it's in a bucket, and the
+// buckets of a smaller table are kept until the map is deleted, so a reader
+// still on it walks valid entries. It may miss the strings added since, which
+// the caller looks up again with LookupAddrFor().
+//
+// StringMapEntry-s are allocated with new. String's are in StringPool.
 //===----------------------------------------------------------------------===//
 
 #ifndef __STRINGMAP_H__
 #define __STRINGMAP_H__
 
 #include <string>
+#include <vector>
+#include <atomic>
 
 class StringPool;
 
@@ -36,20 +46,26 @@ class StringPool;
 class StringMapEntry {
 public:
   char           *Addr;   // Addr in the string pool
+  unsigned        Hash;   // of the string
   StringMapEntry *Next; 
 public:
-  StringMapEntry() { Addr = NULL; Next = NULL; }
-  StringMapEntry(char *A) { Addr = A; Next = NULL; }
-  StringMapEntry(char *A, StringMapEntry *E) { Addr = A; Next = E; }
-
+  StringMapEntry(char *A, unsigned H, StringMapEntry *E) { Addr = A; Hash = H; Next = E; }
   ~StringMapEntry() {}
 };
 
+struct StringMapTable {
+  std::atomic<StringMapEntry*> *mBuckets;
+  unsigned                      mNumBuckets;  // a power of 2.
+};
+
 class StringMap {
 protected:
-  StringPool     *mPool;
-  StringMapEntry *mBuckets = nullptr;
-  unsigned        mNumBuckets = 0;
+  StringPool                   *mPool;
+  std::atomic<StringMapTable*>  mTable;
+  std::vector<StringMapTable*>  mTables;      // The current one is the last.
+  unsigned                      mNumEntries;
+
+  void Grow();
 
 public:
   explicit StringMap(unsigned numbuckets);
@@ -59,9 +75,9 @@ public:
   void     Init(unsigned numbuckets);
   void     SetPool(StringPool *p) {mPool = p;}
 
-  unsigned BucketNoFor(const std::string &s);
   char*    LookupAddrFor(const std::string &s);
-  void     InsertEntry(char *, unsigned);
+  char*    FindAddrFor(const std::string &s);   // NULL if not in the map.
+  void     InsertEntry(char *, unsigned hash);
 };
 
 #endif
@@ -24,6 +24,7 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <mutex>
 
 //  Each time when extra memory is needed, a fixed size BLOCK will be allocated.
 //  It's defined by BLOCK_SIZE. Anything above this size will not
@@ -42,6 +43,12 @@ private:
   StringMap            *mMap;
   std::vector<SPBlock>  mBlocks;
   int                   mFirstAvail; // -1 means no available.
+  long long             mObjects;    // strings allocated, see mem_stats.h
+  std::mutex            mLock;       // FindString() could be called from
+                                     // parsers in different threads. Only
+                                     // adding a string takes it.
+
+  char* FindOrAdd(const std::string&);
 
 public:
   char* AllocBlock();
@@ -60,7 +67,22 @@ public:
 };
 
 // Lexing, Parsing, AST Building and IR Building all share one global
-// StringPool for their symbols or necessary strings.
+// StringPool for their symbols or necessary strings. It's shared by all
+// threads, so that the same string has the same address everywhere.
 extern StringPool gStringPool;
 
+// While a LocalStringPool is alive, gStringPool.FindString() of its thread
+// puts the strings not in gStringPool yet into the local pool, and they are
+// freed with it. The same string has the same address only in this thread
+// then, so it can't be used by a parser with a WorkPool. The parse server
+// has one for each request, so that gStringPool doesn't grow with them.
+class LocalStringPool {
+private:
+  StringPool  mPool;
+  StringPool *mSaved;   // the outer one of this thread, if any.
+public:
+  LocalStringPool();
+  ~LocalStringPool();
+};
+
 #endif  // __STRINGPOOL_H__
@@ -0,0 +1,41 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the per-thread capturing of std::cout.
+//
+// Lexer, Parser, AST dumping and Verifier all print to std::cout directly.
+// When multiple files are parsed in parallel threads, their output would be
+// interleaved. OutCapture redirects everything a thread writes to std::cout
+// into a string owned by the caller, and the caller decides when and in what
+// order to print it.
+//
+// Threads without an OutCapture still write to the original stdout.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __THREAD_OUT_H__
+#define __THREAD_OUT_H__
+
+#include <string>
+
+class OutCapture {
+private:
+  std::string *mPrev;   // the enclosing capture of this thread, if any.
+public:
+  OutCapture(std::string *dest);
+  ~OutCapture();
+};
+
+#endif
@@ -0,0 +1,99 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the timing of parsing phases.
+//
+// A TimeSpan measures the scope it lives in, eg. lexing the file, traversing
+// or building the AST of a top level construct, verifying a file. Spans are
+// recorded only if gTimeline is enabled, each thread into its own buffer, so
+// they nest per thread and parallel parsing shows up as parallel tracks.
+//
+// The spans are exported in the Chrome trace event format, which is opened by
+// chrome://tracing or Perfetto, and summarized per phase.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __TIMELINE_H__
+#define __TIMELINE_H__
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <ostream>
+#include <stdint.h>
+
+class Timeline {
+private:
+  struct Span {
+    const char *mName;
+    std::string mDetail;
+    uint64_t    mStart;   // ns since mOrigin
+    uint64_t    mDur;     // ns
+  };
+
+  struct Buffer {
+    unsigned          mTid;
+    std::vector<Span> mSpans;
+  };
+
+  bool                 mEnabled;
+  uint64_t             mOrigin;
+  std::mutex           mLock;      // guards mBuffers
+  std::vector<Buffer*> mBuffers;   // one per thread, never freed before exit
+
+  Buffer* GetBuffer();
+
+public:
+  Timeline();
+  ~Timeline();
+
+  void Enable();
+  bool IsEnabled() {return mEnabled;}
+  uint64_t Now();
+
+  void Add(const char *name, const std::string &detail, uint64_t start, uint64_t end);
+
+  // Both are called when no thread is recording.
+  void WriteChromeTrace(std::ostream &os);
+  void Summary(std::ostream &os);
+};
+
+extern Timeline gTimeline;
+
+class TimeSpan {
+private:
+  const char *mName;    // a string literal
+  std::string mDetail;
+  uint64_t    mStart;
+  bool        mOn;
+public:
+  TimeSpan(const char *name) : mName(name), mOn(gTimeline.IsEnabled()) {
+    if (mOn)
+      mStart = gTimeline.Now();
+  }
+  TimeSpan(const char *name, const std::string &detail)
+    : mName(name), mOn(gTimeline.IsEnabled()) {
+    if (mOn) {
+      mDetail = detail;
+      mStart = gTimeline.Now();
+    }
+  }
+  ~TimeSpan() {
+    if (mOn)
+      gTimeline.Add(mName, mDetail, mStart, gTimeline.Now());
+  }
+};
+
+#endif
@@ -43,7 +43,7 @@ private:
   SmallVector<Token*>   mTokens;
 
 public:
-  TokenPool() {mTokens.SetBlockSize(1024);}
+  TokenPool() {mTokens.SetBlockSize(1024); mMemPool.SetTag(MS_Token);}
   ~TokenPool(){}   // memory is freed in destructor of mMP.
   char* NewToken(unsigned);
 };
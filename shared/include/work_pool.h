@@ -0,0 +1,73 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains a work-stealing thread pool.
+//
+// Each worker thread owns a deque of tasks. A worker takes tasks from the back
+// of its own deque, so the most recently pushed (and cache-hot) task is run
+// first. When its own deque is empty, it steals from the front of the other
+// workers' deques, which are the oldest and usually the biggest pieces of work.
+//
+// Tasks submitted from outside the pool are spread over the workers in a
+// round-robin way. Tasks submitted by a worker go to its own deque.
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WORK_POOL_H__
+#define __WORK_POOL_H__
+
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+typedef std::function<void()> WorkTask;
+
+struct WorkQueue {
+  std::deque<WorkTask> mTasks;
+  std::mutex           mLock;
+};
+
+class WorkPool {
+private:
+  std::vector<WorkQueue*>  mQueues;    // one for each worker.
+  std::vector<std::thread> mThreads;
+  unsigned                 mNextQueue; // round-robin for outside submission.
+
+  std::mutex               mLock;      // protect the counters below.
+  std::condition_variable  mWorkCond;  // signaled when there is new task.
+  std::condition_variable  mDoneCond;  // signaled when mPending becomes 0.
+  unsigned                 mPending;   // tasks submitted but not finished.
+  unsigned                 mQueued;    // tasks in the queues, not taken yet.
+  bool                     mStop;
+
+  void WorkerLoop(unsigned id);
+  bool TakeTask(unsigned id, WorkTask &task);
+
+public:
+  WorkPool(unsigned threads_num = 0); // 0 means the number of hardware threads.
+  ~WorkPool();
+
+  unsigned GetThreadsNum() {return mThreads.size();}
+
+  void Submit(const WorkTask &task);
+  void Wait();    // wait until all submitted tasks are finished.
+
+  static unsigned DefaultThreadsNum();
+};
+
+#endif
@@ -377,6 +377,19 @@ void BinOperatorNode::Dump(unsigned indent) {
   mOpndB->Dump(0);
 }
 
+//////////////////////////////////////////////////////////////////////////////////////
+//                           TerOperatorNode
+//////////////////////////////////////////////////////////////////////////////////////
+
+void TerOperatorNode::Dump(unsigned indent) {
+  DumpIndentation(indent);
+  mOpndA->Dump(0);
+  DUMP0_NORETURN(" ? ");
+  mOpndB->Dump(0);
+  DUMP0_NORETURN(" : ");
+  mOpndC->Dump(0);
+}
+
 //////////////////////////////////////////////////////////////////////////////////////
 //                           UnaOperatorNode
 //////////////////////////////////////////////////////////////////////////////////////
@@ -831,6 +844,16 @@ void ClassNode::Construct() {
   }
 }
 
+// The members are collected again by Construct() after mBody is changed.
+void ClassNode::ClearMembers() {
+  mFields.Release();
+  mMethods.Release();
+  mConstructors.Release();
+  mInstInits.Release();
+  mLocalClasses.Release();
+  mLocalInterfaces.Release();
+}
+
 // Release() only takes care of those container memory. The release of all tree nodes
 // is taken care by the tree node pool.
 void ClassNode::Release() {
@@ -932,6 +955,15 @@ bool FunctionNode::OverrideEquivalent(FunctionNode *fun) {
   return true;
 }
 
+BlockNode* FunctionNode::ParseBody() {
+  if (mBody && mBody->IsLazy()) {
+    if (!mBody->ParseLazy())
+      return NULL;
+    CleanUp();
+  }
+  return mBody;
+}
+
 // When BlockNode is added to the FunctionNode, we need further
 // cleanup, i.e. clean up the PassNode.
 void FunctionNode::CleanUp() {
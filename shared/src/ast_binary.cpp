@@ -0,0 +1,1183 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+#include <iostream>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ast_binary.h"
+#include "ast_module.h"
+#include "ast_type.h"
+#include "ast_attr.h"
+#include "stringpool.h"
+#include "massert.h"
+
+static const char *gNodeKindNames[] = {
+#undef  NODEKIND
+#define NODEKIND(K) #K,
+#include "ast_nk.def"
+  "Null",
+};
+
+//////////////////////////////////////////////////////////////////////////////
+//                              ASTBinWriter
+//////////////////////////////////////////////////////////////////////////////
+
+uint32_t ASTBinWriter::AddString(const char *s) {
+  if (!s)
+    return AST_BIN_NO_STRING;
+  std::string str(s);
+  std::unordered_map<std::string, uint32_t>::iterator it = mStrIndex.find(str);
+  if (it != mStrIndex.end())
+    return it->second;
+  uint32_t off = mStrTab.size();
+  mStrTab.append(s, str.size() + 1);
+  mStrIndex[str] = off;
+  return off;
+}
+
+static void AddAttrs(std::vector<uint32_t> &extras, TreeNode *node, unsigned num) {
+  for (unsigned i = 0; i < num; i++) {
+    if (node->IsIdentifier())
+      extras.push_back(((IdentifierNode*)node)->AttrAtIndex(i));
+    else if (node->IsBlock())
+      extras.push_back(((BlockNode*)node)->AttrAtIndex(i));
+    else if (node->IsFunction())
+      extras.push_back(((FunctionNode*)node)->AttrAtIndex(i));
+    else if (node->IsClass())
+      extras.push_back(((ClassNode*)node)->AttrAtIndex(i));
+  }
+}
+
+// Fill in everything of 'info.mNode' except the offset.
+void ASTBinWriter::CollectNode(ASTBinNodeInfo &info) {
+  TreeNode *node = info.mNode;
+  std::vector<std::vector<TreeNode*> > &g = info.mGroups;
+  info.mFlags = 0;
+  info.mName = AST_BIN_NO_STRING;
+  info.mData = 0;
+
+#define GROUPS(K) g.resize(ABG_##K##Num)
+  if (node->IsPackage()) {
+    info.mName = AddString(((PackageNode*)node)->GetName());
+  } else if (node->IsImport()) {
+    ImportNode *n = (ImportNode*)node;
+    info.mName = AddString(n->GetName());
+    info.mData = (n->IsImportType()   ? ImpType   : 0) |
+                 (n->IsImportStatic() ? ImpStatic : 0) |
+                 (n->IsImportSingle() ? ImpSingle : 0) |
+                 (n->IsImportAll()    ? ImpAll    : 0) |
+                 (n->IsImportLocal()  ? ImpLocal  : 0) |
+                 (n->IsImportSystem() ? ImpSystem : 0);
+  } else if (node->IsIdentifier()) {
+    IdentifierNode *n = (IdentifierNode*)node;
+    info.mName = AddString(n->GetName());
+    GROUPS(Identifier);
+    g[ABG_IdentifierType].push_back(n->GetType());
+    g[ABG_IdentifierInit].push_back(n->GetInit());
+    g[ABG_IdentifierDims].push_back(n->GetDims());
+    AddAttrs(info.mExtras, n, n->GetAttrsNum());
+  } else if (node->IsField()) {
+    FieldNode *n = (FieldNode*)node;
+    info.mName = AddString(n->GetName());
+    GROUPS(Field);
+    g[ABG_FieldParent].push_back(n->GetParent());
+    g[ABG_FieldField].push_back(n->GetField());
+  } else if (node->IsDimension()) {
+    DimensionNode *n = (DimensionNode*)node;
+    for (unsigned i = 0; i < n->GetDimsNum(); i++)
+      info.mExtras.push_back(n->GetNthDim(i));
+  } else if (node->IsAttr()) {
+    info.mData = ((AttrNode*)node)->GetId();
+  } else if (node->IsPrimType()) {
+    PrimTypeNode *n = (PrimTypeNode*)node;
+    info.mName = AddString(n->GetName());
+    info.mData = n->GetPrimType();
+  } else if (node->IsUserType()) {
+    UserTypeNode *n = (UserTypeNode*)node;
+    GROUPS(UserType);
+    g[ABG_UserTypeId].push_back(n->GetId());
+    for (unsigned i = 0; i < n->TypeArgsNum(); i++)
+      g[ABG_UserTypeArgs].push_back(n->TypeArgAtIndex(i));
+  } else if (node->IsCast()) {
+    CastNode *n = (CastNode*)node;
+    GROUPS(Cast);
+    g[ABG_CastDestType].push_back(n->GetDestType());
+    g[ABG_CastExpr].push_back(n->GetExpr());
+  } else if (node->IsParenthesis()) {
+    GROUPS(Parenthesis);
+    g[ABG_ParenthesisExpr].push_back(((ParenthesisNode*)node)->GetExpr());
+  } else if (node->IsVarList()) {
+    VarListNode *n = (VarListNode*)node;
+    GROUPS(VarList);
+    for (unsigned i = 0; i < n->GetNum(); i++)
+      g[ABG_VarListVars].push_back(n->VarAtIndex(i));
+  } else if (node->IsExprList()) {
+    ExprListNode *n = (ExprListNode*)node;
+    GROUPS(ExprList);
+    for (unsigned i = 0; i < n->GetNum(); i++)
+      g[ABG_ExprListExprs].push_back(n->ExprAtIndex(i));
+  } else if (node->IsLiteral()) {
+    LiteralNode *n = (LiteralNode*)node;
+    LitData data = n->GetData();
+    info.mData = data.mType;
+    uint32_t words[2] = {0, 0};
+    switch (data.mType) {
+    case LT_IntegerLiteral:
+      memcpy(words, &data.mData.mInt, sizeof(int));
+      info.mExtras.push_back(words[0]);
+      break;
+    case LT_FPLiteral:
+      memcpy(words, &data.mData.mFloat, sizeof(float));
+      info.mExtras.push_back(words[0]);
+      break;
+    case LT_DoubleLiteral:
+      memcpy(words, &data.mData.mDouble, sizeof(double));
+      info.mExtras.push_back(words[0]);
+      info.mExtras.push_back(words[1]);
+      break;
+    case LT_BooleanLiteral:
+      info.mExtras.push_back(data.mData.mBool);
+      break;
+    case LT_CharacterLiteral:
+      info.mExtras.push_back((unsigned char)data.mData.mChar);
+      break;
+    default:
+      break;
+    }
+    if (data.mType == LT_StringLiteral)
+      info.mName = AddString(data.mData.mStr);
+    else
+      info.mName = AddString(n->GetName());
+  } else if (node->IsUnaOperator()) {
+    UnaOperatorNode *n = (UnaOperatorNode*)node;
+    info.mData = n->GetOprId();
+    info.mFlags = n->IsPost() ? ABF_IsPost : 0;
+    GROUPS(UnaOperator);
+    g[ABG_UnaOperatorOpnd].push_back(n->GetOpnd());
+  } else if (node->IsBinOperator()) {
+    BinOperatorNode *n = (BinOperatorNode*)node;
+    info.mData = n->mOprId;
+    GROUPS(BinOperator);
+    g[ABG_BinOperatorA].push_back(n->mOpndA);
+    g[ABG_BinOperatorB].push_back(n->mOpndB);
+  } else if (node->IsTerOperator()) {
+    TerOperatorNode *n = (TerOperatorNode*)node;
+    info.mData = n->mOprId;
+    GROUPS(TerOperator);
+    g[ABG_TerOperatorA].push_back(n->mOpndA);
+    g[ABG_TerOperatorB].push_back(n->mOpndB);
+    g[ABG_TerOperatorC].push_back(n->mOpndC);
+  } else if (node->IsLambda()) {
+    LambdaNode *n = (LambdaNode*)node;
+    GROUPS(Lambda);
+    for (unsigned i = 0; i < n->GetParamsNum(); i++)
+      g[ABG_LambdaParams].push_back(n->GetParam(i));
+    g[ABG_LambdaBody].push_back(n->GetBody());
+  } else if (node->IsBlock()) {
+    BlockNode *n = (BlockNode*)node;
+    info.mFlags = n->IsInstInit() ? ABF_IsInstInit : 0;
+    GROUPS(Block);
+    for (unsigned i = 0; i < n->GetChildrenNum(); i++)
+      g[ABG_BlockChildren].push_back(n->GetChildAtIndex(i));
+    AddAttrs(info.mExtras, n, n->GetAttrsNum());
+  } else if (node->IsFunction()) {
+    FunctionNode *n = (FunctionNode*)node;
+    info.mName = AddString(n->GetName());
+    info.mFlags = n->IsConstructor() ? ABF_IsConstructor : 0;
+    GROUPS(Function);
+    g[ABG_FunctionType].push_back(n->GetType());
+    for (unsigned i = 0; i < n->GetParamsNum(); i++)
+      g[ABG_FunctionParams].push_back(n->GetParam(i));
+    g[ABG_FunctionBody].push_back(n->GetBody());
+    for (unsigned i = 0; i < n->GetThrowNum(); i++)
+      g[ABG_FunctionThrows].push_back(n->ThrowAtIndex(i));
+    for (unsigned i = 0; i < n->GetAnnotationsNum(); i++)
+      g[ABG_FunctionAnnotations].push_back(n->AnnotationAtIndex(i));
+    g[ABG_FunctionDims].push_back(n->GetDims());
+    AddAttrs(info.mExtras, n, n->GetAttrsNum());
+  } else if (node->IsClass()) {
+    ClassNode *n = (ClassNode*)node;
+    info.mName = AddString(n->GetName());
+    info.mFlags = n->IsJavaEnum() ? ABF_JavaEnum : 0;
+    GROUPS(Class);
+    for (unsigned i = 0; i < n->GetSuperClassesNum(); i++)
+      g[ABG_ClassSuperClasses].push_back(n->GetSuperClass(i));
+    for (unsigned i = 0; i < n->GetSuperInterfacesNum(); i++)
+      g[ABG_ClassSuperInterfaces].push_back(n->GetSuperInterface(i));
+    g[ABG_ClassBody].push_back(n->GetBody());
+    for (unsigned i = 0; i < n->GetFieldsNum(); i++)
+      g[ABG_ClassFields].push_back(n->GetField(i));
+    for (unsigned i = 0; i < n->GetMethodsNum(); i++)
+      g[ABG_ClassMethods].push_back(n->GetMethod(i));
+    for (unsigned i = 0; i < n->GetConstructorNum(); i++)
+      g[ABG_ClassConstructors].push_back(n->GetConstructor(i));
+    for (unsigned i = 0; i < n->GetInstInitsNum(); i++)
+      g[ABG_ClassInstInits].push_back(n->GetInstInit(i));
+    for (unsigned i = 0; i < n->GetLocalClassesNum(); i++)
+      g[ABG_ClassLocalClasses].push_back(n->GetLocalClass(i));
+    for (unsigned i = 0; i < n->GetLocalInterfacesNum(); i++)
+      g[ABG_ClassLocalInterfaces].push_back(n->GetLocalInterface(i));
+    AddAttrs(info.mExtras, n, n->GetAttrsNum());
+  } else if (node->IsInterface()) {
+    InterfaceNode *n = (InterfaceNode*)node;
+    info.mName = AddString(n->GetName());
+    info.mFlags = n->IsAnnotation() ? ABF_IsAnnotation : 0;
+    GROUPS(Interface);
+    for (unsigned i = 0; i < n->GetSuperInterfacesNum(); i++)
+      g[ABG_InterfaceSuperInterfaces].push_back(n->GetSuperInterface(i));
+    for (unsigned i = 0; i < n->GetFieldsNum(); i++)
+      g[ABG_InterfaceFields].push_back(n->GetField(i));
+    for (unsigned i = 0; i < n->GetMethodsNum(); i++)
+      g[ABG_InterfaceMethods].push_back(n->GetMethod(i));
+  } else if (node->IsAnnotationType()) {
+    GROUPS(AnnotationType);
+    g[ABG_AnnotationTypeId].push_back(((AnnotationTypeNode*)node)->GetId());
+  } else if (node->IsAnnotation()) {
+    AnnotationNode *n = (AnnotationNode*)node;
+    GROUPS(Annotation);
+    g[ABG_AnnotationId].push_back(n->GetId());
+    g[ABG_AnnotationType].push_back(n->GetType());
+    g[ABG_AnnotationExpr].push_back(n->GetExpr());
+  } else if (node->IsException()) {
+    GROUPS(Exception);
+    g[ABG_ExceptionException].push_back(((ExceptionNode*)node)->GetException());
+  } else if (node->IsReturn()) {
+    GROUPS(Return);
+    g[ABG_ReturnResult].push_back(((ReturnNode*)node)->GetResult());
+  } else if (node->IsCondBranch()) {
+    CondBranchNode *n = (CondBranchNode*)node;
+    GROUPS(CondBranch);
+    g[ABG_CondBranchCond].push_back(n->GetCond());
+    g[ABG_CondBranchTrue].push_back(n->GetTrueBranch());
+    g[ABG_CondBranchFalse].push_back(n->GetFalseBranch());
+  } else if (node->IsBreak()) {
+    GROUPS(Break);
+    g[ABG_BreakTarget].push_back(((BreakNode*)node)->GetTarget());
+  } else if (node->IsForLoop()) {
+    ForLoopNode *n = (ForLoopNode*)node;
+    GROUPS(ForLoop);
+    for (unsigned i = 0; i < n->GetInitNum(); i++)
+      g[ABG_ForLoopInit].push_back(n->InitAtIndex(i));
+    g[ABG_ForLoopCond].push_back(n->GetCond());
+    for (unsigned i = 0; i < n->GetUpdateNum(); i++)
+      g[ABG_ForLoopUpdate].push_back(n->UpdateAtIndex(i));
+    g[ABG_ForLoopBody].push_back(n->GetBody());
+  } else if (node->IsWhileLoop()) {
+    WhileLoopNode *n = (WhileLoopNode*)node;
+    GROUPS(WhileLoop);
+    g[ABG_WhileLoopCond].push_back(n->GetCond());
+    g[ABG_WhileLoopBody].push_back(n->GetBody());
+  } else if (node->IsDoLoop()) {
+    DoLoopNode *n = (DoLoopNode*)node;
+    GROUPS(DoLoop);
+    g[ABG_DoLoopCond].push_back(n->GetCond());
+    g[ABG_DoLoopBody].push_back(n->GetBody());
+  } else if (node->IsNew()) {
+    NewNode *n = (NewNode*)node;
+    GROUPS(New);
+    g[ABG_NewId].push_back(n->GetId());
+    for (unsigned i = 0; i < n->GetParamsNum(); i++)
+      g[ABG_NewParams].push_back(n->GetParam(i));
+    g[ABG_NewBody].push_back(n->GetBody());
+  } else if (node->IsCall()) {
+    CallNode *n = (CallNode*)node;
+    info.mName = AddString(n->GetName());
+    GROUPS(Call);
+    g[ABG_CallMethod].push_back(n->GetMethod());
+    for (unsigned i = 0; i < n->GetArgsNum(); i++)
+      g[ABG_CallArgs].push_back(n->GetArg(i));
+  } else if (node->IsSwitchLabel()) {
+    SwitchLabelNode *n = (SwitchLabelNode*)node;
+    info.mFlags = n->IsDefault() ? ABF_IsDefault : 0;
+    GROUPS(SwitchLabel);
+    g[ABG_SwitchLabelValue].push_back(n->GetValue());
+  } else if (node->IsSwitchCase()) {
+    SwitchCaseNode *n = (SwitchCaseNode*)node;
+    GROUPS(SwitchCase);
+    for (unsigned i = 0; i < n->GetLabelsNum(); i++)
+      g[ABG_SwitchCaseLabels].push_back(n->GetLabelAtIndex(i));
+    for (unsigned i = 0; i < n->GetStmtsNum(); i++)
+      g[ABG_SwitchCaseStmts].push_back(n->GetStmtAtIndex(i));
+  } else if (node->IsSwitch()) {
+    SwitchNode *n = (SwitchNode*)node;
+    GROUPS(Switch);
+    g[ABG_SwitchCond].push_back(n->GetCond());
+    for (unsigned i = 0; i < n->GetCasesNum(); i++)
+      g[ABG_SwitchCases].push_back(n->GetCaseAtIndex(i));
+  } else if (node->IsPass()) {
+    PassNode *n = (PassNode*)node;
+    GROUPS(Pass);
+    for (unsigned i = 0; i < n->GetChildrenNum(); i++)
+      g[ABG_PassChildren].push_back(n->GetChild(i));
+  }
+#undef GROUPS
+}
+
+// Add 'node' and everything reachable from it. Nodes are added in pre-order,
+// using a work list instead of recursion since trees can be deep.
+void ASTBinWriter::AddNode(TreeNode *root) {
+  std::vector<TreeNode*> working_list;
+  working_list.push_back(root);
+  while (!working_list.empty()) {
+    TreeNode *node = working_list.back();
+    working_list.pop_back();
+    if (!node || mNodeIndex.find(node) != mNodeIndex.end())
+      continue;
+
+    mNodeIndex[node] = mNodes.size();
+    mNodes.push_back(ASTBinNodeInfo());
+    ASTBinNodeInfo &info = mNodes.back();
+    info.mNode = node;
+    info.mOffset = 0;
+    CollectNode(info);
+
+    // Push in reverse order, so the first child is handled first.
+    for (int i = info.mGroups.size() - 1; i >= 0; i--) {
+      const std::vector<TreeNode*> &group = info.mGroups[i];
+      for (int j = group.size() - 1; j >= 0; j--)
+        working_list.push_back(group[j]);
+    }
+    working_list.push_back(node->GetLabel());
+  }
+}
+
+uint32_t ASTBinWriter::GetNodeOffset(TreeNode *node) {
+  if (!node)
+    return 0;
+  std::unordered_map<TreeNode*, unsigned>::iterator it = mNodeIndex.find(node);
+  MASSERT(it != mNodeIndex.end() && "TreeNode is not collected.");
+  return mNodes[it->second].mOffset;
+}
+
+static void PutWord(std::string &out, uint32_t w) {
+  out.append((const char*)&w, 4);
+}
+
+void ASTBinWriter::WriteRecord(const ASTBinNodeInfo &info, std::string &out) {
+  MASSERT(out.size() == info.mOffset && "Wrong record offset.");
+
+  ASTBinRecord rec;
+  memset(&rec, 0, sizeof(ASTBinRecord));
+  rec.mKind = info.mNode->GetKind();
+  rec.mFlags = info.mFlags;
+  rec.mGroupsNum = info.mGroups.size();
+  rec.mName = info.mName;
+  rec.mData = info.mData;
+  TreeNode *label = info.mNode->GetLabel();
+  rec.mLabel = label ? (int32_t)(GetNodeOffset(label) - info.mOffset) : 0;
+  rec.mChildrenNum = 0;
+  for (unsigned i = 0; i < info.mGroups.size(); i++)
+    rec.mChildrenNum += info.mGroups[i].size();
+  rec.mExtrasNum = info.mExtras.size();
+  out.append((const char*)&rec, sizeof(ASTBinRecord));
+
+  uint32_t end = 0;
+  for (unsigned i = 0; i < info.mGroups.size(); i++) {
+    end += info.mGroups[i].size();
+    PutWord(out, end);
+  }
+  for (unsigned i = 0; i < info.mGroups.size(); i++) {
+    const std::vector<TreeNode*> &group = info.mGroups[i];
+    for (unsigned j = 0; j < group.size(); j++) {
+      int32_t rel = group[j] ? (int32_t)(GetNodeOffset(group[j]) - info.mOffset) : 0;
+      PutWord(out, (uint32_t)rel);
+    }
+  }
+  for (unsigned i = 0; i < info.mExtras.size(); i++)
+    PutWord(out, info.mExtras[i]);
+}
+
+bool ASTBinWriter::Write(ASTModule *module, std::string &out) {
+  mNodes.clear();
+  mNodeIndex.clear();
+  mStrTab.clear();
+  mStrIndex.clear();
+
+  ASTBinHeader header;
+  memset(&header, 0, sizeof(ASTBinHeader));
+  memcpy(header.mMagic, "MAST", 4);
+  header.mVersion = AST_BIN_VERSION;
+  header.mByteOrder = AST_BIN_BYTE_ORDER;
+  header.mFileName = AddString(module->mFileName);
+
+  if (module->mPackage)
+    AddNode(module->mPackage);
+  for (unsigned i = 0; i < module->mImports.GetNum(); i++)
+    AddNode(module->mImports.ValueAtIndex(i));
+  for (unsigned i = 0; i < module->mTrees.size(); i++)
+    AddNode(module->mTrees[i]->mRootNode);
+
+  header.mTreesNum = module->mTrees.size();
+  header.mImportsNum = module->mImports.GetNum();
+
+  // Assign the offsets of records.
+  unsigned long long off = sizeof(ASTBinHeader) + 4 * (header.mTreesNum + header.mImportsNum);
+  header.mRecordsStart = off;
+  for (unsigned i = 0; i < mNodes.size(); i++) {
+    ASTBinNodeInfo &info = mNodes[i];
+    info.mOffset = off;
+    unsigned long long children = 0;
+    for (unsigned j = 0; j < info.mGroups.size(); j++)
+      children += info.mGroups[j].size();
+    off += sizeof(ASTBinRecord) + 4 * (info.mGroups.size() + children + info.mExtras.size());
+    if (off > 0x7fffffff)
+      return false;
+  }
+  header.mStrTabStart = off;
+  header.mStrTabSize = mStrTab.size();
+  off += mStrTab.size();
+  if (off > 0x7fffffff)
+    return false;
+  header.mSize = off;
+  header.mPackage = GetNodeOffset(module->mPackage);
+
+  out.clear();
+  out.reserve(header.mSize);
+  out.append((const char*)&header, sizeof(ASTBinHeader));
+  for (unsigned i = 0; i < module->mTrees.size(); i++)
+    PutWord(out, GetNodeOffset(module->mTrees[i]->mRootNode));
+  for (unsigned i = 0; i < module->mImports.GetNum(); i++)
+    PutWord(out, GetNodeOffset(module->mImports.ValueAtIndex(i)));
+  for (unsigned i = 0; i < mNodes.size(); i++)
+    WriteRecord(mNodes[i], out);
+  out.append(mStrTab);
+  MASSERT(out.size() == header.mSize);
+  return true;
+}
+
+bool ASTBinWriter::WriteFile(ASTModule *module, const char *path) {
+  std::string buf;
+  if (!Write(module, buf))
+    return false;
+  return WriteBuffer(buf, path);
+}
+
+bool ASTBinWriter::WriteBuffer(const std::string &buf, const char *path) {
+  std::string tmp_path = path;
+  tmp_path += ".tmp";
+  FILE *fp = fopen(tmp_path.c_str(), "wb");
+  if (!fp)
+    return false;
+  bool ok = fwrite(buf.data(), 1, buf.size(), fp) == buf.size();
+  ok = (fclose(fp) == 0) && ok;
+  if (!ok || rename(tmp_path.c_str(), path)) {
+    unlink(tmp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                              ASTBinNode
+//////////////////////////////////////////////////////////////////////////////
+
+const char* ASTBinNode::GetName() const {
+  return mReader->GetString(mRec->mName);
+}
+
+ASTBinNode ASTBinNode::GetLabel() const {
+  if (!mRec->mLabel)
+    return ASTBinNode();
+  return ASTBinNode((const ASTBinRecord*)((const char*)mRec + mRec->mLabel), mReader);
+}
+
+unsigned ASTBinNode::GetChildrenNum(unsigned group) const {
+  MASSERT(group < mRec->mGroupsNum);
+  unsigned start = group ? GroupEnds()[group - 1] : 0;
+  return GroupEnds()[group] - start;
+}
+
+ASTBinNode ASTBinNode::GetChild(unsigned group, unsigned i) const {
+  MASSERT(i < GetChildrenNum(group));
+  unsigned start = group ? GroupEnds()[group - 1] : 0;
+  int32_t rel = Children()[start + i];
+  if (!rel)
+    return ASTBinNode();
+  return ASTBinNode((const ASTBinRecord*)((const char*)mRec + rel), mReader);
+}
+
+// A generic dump which shows everything in the record. Each child is tagged
+// with the index of its group, and NULL children are skipped.
+static void DumpBinNode(const ASTBinNode &node, unsigned indent, int group) {
+  for (unsigned i = 0; i < indent; i++)
+    std::cout << ' ';
+  if (group >= 0)
+    std::cout << group << ": ";
+
+  std::cout << gNodeKindNames[node.GetKind()];
+  if (node.GetName())
+    std::cout << " \"" << node.GetName() << "\"";
+  if (node.GetData())
+    std::cout << " data:" << node.GetData();
+  if (node.GetFlags())
+    std::cout << " flags:" << node.GetFlags();
+  if (node.GetExtrasNum()) {
+    std::cout << " extras:";
+    for (unsigned i = 0; i < node.GetExtrasNum(); i++)
+      std::cout << (i ? "," : "") << node.GetExtra(i);
+  }
+  ASTBinNode label = node.GetLabel();
+  if (!label.IsNull())
+    std::cout << " label:" << label.GetName();
+  std::cout << std::endl;
+
+  for (unsigned g = 0; g < node.GetGroupsNum(); g++) {
+    for (unsigned i = 0; i < node.GetChildrenNum(g); i++) {
+      ASTBinNode child = node.GetChild(g, i);
+      if (!child.IsNull())
+        DumpBinNode(child, indent + 2, g);
+    }
+  }
+}
+
+void ASTBinNode::Dump(unsigned indent) const {
+  if (!IsNull())
+    DumpBinNode(*this, indent, -1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                              ASTBinReader
+//////////////////////////////////////////////////////////////////////////////
+
+bool ASTBinReader::Open(const char *path) {
+  Close();
+  int fd = open(path, O_RDONLY);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  if (fstat(fd, &st) || st.st_size < sizeof(ASTBinHeader) || st.st_size > 0x7fffffff) {
+    close(fd);
+    return false;
+  }
+  void *addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED)
+    return false;
+
+  mMap = addr;
+  mMapSize = st.st_size;
+  if (!Attach(addr, st.st_size)) {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+bool ASTBinReader::Attach(const void *buf, unsigned size) {
+  mBuf = (const char*)buf;
+  mSize = size;
+  if (((uintptr_t)buf & 3) || !Verify()) {
+    mBuf = NULL;
+    mSize = 0;
+    return false;
+  }
+  return true;
+}
+
+void ASTBinReader::Close() {
+  if (mMap)
+    munmap(mMap, mMapSize);
+  mMap = NULL;
+  mMapSize = 0;
+  mBuf = NULL;
+  mSize = 0;
+}
+
+static unsigned RecordIndex(const std::vector<uint32_t> &starts, uint32_t off) {
+  return std::lower_bound(starts.begin(), starts.end(), off) - starts.begin();
+}
+
+// Shared nodes make the records a DAG, but a broken file could have a cycle
+// which makes any recursive walk run forever. It's a depth first search with
+// an explicit stack. All the offsets are known to be valid.
+static bool HasCycle(const char *buf, const std::vector<uint32_t> &starts) {
+  enum {White, Gray, Black};
+  std::vector<char> color(starts.size(), White);
+  // pair of record index and the next child to visit. The label is visited
+  // as the last child.
+  std::vector<std::pair<unsigned, unsigned> > stack;
+  for (unsigned root = 0; root < starts.size(); root++) {
+    if (color[root] != White)
+      continue;
+    color[root] = Gray;
+    stack.push_back(std::make_pair(root, 0));
+    while (!stack.empty()) {
+      unsigned idx = stack.back().first;
+      unsigned next = stack.back().second;
+      const ASTBinRecord *r = (const ASTBinRecord*)(buf + starts[idx]);
+      if (next > r->mChildrenNum) {
+        color[idx] = Black;
+        stack.pop_back();
+        continue;
+      }
+      stack.back().second++;
+      const int32_t *children = (const int32_t*)((const uint32_t*)(r + 1) + r->mGroupsNum);
+      int32_t rel = next < r->mChildrenNum ? children[next] : r->mLabel;
+      if (!rel)
+        continue;
+      unsigned child = RecordIndex(starts, starts[idx] + rel);
+      if (color[child] == Gray)
+        return true;
+      if (color[child] == White) {
+        color[child] = Gray;
+        stack.push_back(std::make_pair(child, 0));
+      }
+    }
+  }
+  return false;
+}
+
+// Check the whole file once, so that walking the records later needs no
+// bound checking. It makes sure every offset lands on a record or a string
+// inside the buffer.
+bool ASTBinReader::Verify() {
+  if (mSize < sizeof(ASTBinHeader))
+    return false;
+  const ASTBinHeader *h = Header();
+  if (memcmp(h->mMagic, "MAST", 4) || h->mVersion != AST_BIN_VERSION ||
+      h->mByteOrder != AST_BIN_BYTE_ORDER || h->mSize != mSize)
+    return false;
+
+  unsigned long long roots = (unsigned long long)h->mTreesNum + h->mImportsNum;
+  if (h->mRecordsStart != sizeof(ASTBinHeader) + 4 * roots ||
+      h->mStrTabStart < h->mRecordsStart || (h->mStrTabStart & 3) ||
+      (unsigned long long)h->mStrTabStart + h->mStrTabSize != mSize)
+    return false;
+  if (h->mStrTabSize && mBuf[mSize - 1] != '\0')
+    return false;
+  if (h->mFileName != AST_BIN_NO_STRING && h->mFileName >= h->mStrTabSize)
+    return false;
+
+  // Collect the start of records. They are in increasing order.
+  std::vector<uint32_t> starts;
+  uint32_t off = h->mRecordsStart;
+  while (off < h->mStrTabStart) {
+    if (h->mStrTabStart - off < sizeof(ASTBinRecord))
+      return false;
+    const ASTBinRecord *r = (const ASTBinRecord*)(mBuf + off);
+    unsigned long long size = sizeof(ASTBinRecord) +
+      4ULL * ((unsigned long long)r->mGroupsNum + r->mChildrenNum + r->mExtrasNum);
+    if (size > h->mStrTabStart - off || r->mKind > NK_Null)
+      return false;
+    if (r->mName != AST_BIN_NO_STRING && r->mName >= h->mStrTabSize)
+      return false;
+    starts.push_back(off);
+    off += size;
+  }
+
+  const uint32_t *root_offs = (const uint32_t*)(h + 1);
+  for (unsigned i = 0; i < roots; i++) {
+    if (!std::binary_search(starts.begin(), starts.end(), root_offs[i]))
+      return false;
+  }
+  if (h->mPackage && !std::binary_search(starts.begin(), starts.end(), h->mPackage))
+    return false;
+
+  for (unsigned i = 0; i < starts.size(); i++) {
+    const ASTBinRecord *r = (const ASTBinRecord*)(mBuf + starts[i]);
+    const uint32_t *ends = (const uint32_t*)(r + 1);
+    const int32_t *children = (const int32_t*)(ends + r->mGroupsNum);
+    uint32_t prev = 0;
+    for (unsigned g = 0; g < r->mGroupsNum; g++) {
+      if (ends[g] < prev || ends[g] > r->mChildrenNum)
+        return false;
+      prev = ends[g];
+    }
+    if (prev != r->mChildrenNum)
+      return false;
+    for (unsigned c = 0; c <= r->mChildrenNum; c++) {
+      // The last one is the label.
+      int32_t rel = c < r->mChildrenNum ? children[c] : r->mLabel;
+      if (!rel)
+        continue;
+      long long target = (long long)starts[i] + rel;
+      if (target < 0 || target > 0xffffffffLL ||
+          !std::binary_search(starts.begin(), starts.end(), (uint32_t)target))
+        return false;
+    }
+  }
+
+  return !HasCycle(mBuf, starts);
+}
+
+const char* ASTBinReader::GetString(uint32_t off) const {
+  if (off == AST_BIN_NO_STRING)
+    return NULL;
+  return mBuf + Header()->mStrTabStart + off;
+}
+
+ASTBinNode ASTBinReader::NodeAt(uint32_t off) const {
+  if (!off)
+    return ASTBinNode();
+  return ASTBinNode((const ASTBinRecord*)(mBuf + off), this);
+}
+
+ASTBinNode ASTBinReader::GetPackage() const {
+  return NodeAt(Header()->mPackage);
+}
+
+ASTBinNode ASTBinReader::GetTree(unsigned i) const {
+  MASSERT(i < GetTreesNum());
+  const uint32_t *offs = (const uint32_t*)(Header() + 1);
+  return NodeAt(offs[i]);
+}
+
+ASTBinNode ASTBinReader::GetImport(unsigned i) const {
+  MASSERT(i < GetImportsNum());
+  const uint32_t *offs = (const uint32_t*)(Header() + 1);
+  return NodeAt(offs[GetTreesNum() + i]);
+}
+
+void ASTBinReader::Dump() const {
+  const char *name = GetFileName();
+  std::cout << "============= Binary AST: " << (name ? name : "") << " ===========" << std::endl;
+  if (!GetPackage().IsNull())
+    GetPackage().Dump(0);
+  for (unsigned i = 0; i < GetImportsNum(); i++)
+    GetImport(i).Dump(0);
+  for (unsigned i = 0; i < GetTreesNum(); i++) {
+    std::cout << "== Sub Tree ==" << std::endl;
+    GetTree(i).Dump(0);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                              Loading
+//
+// The nodes are created first, each in the pool of the first tree reaching
+// it, then their children are set. So a node shared by multiple parents is
+// created once, and nothing walks the tree recursively.
+//////////////////////////////////////////////////////////////////////////////
+
+typedef std::unordered_map<const ASTBinRecord*, TreeNode*> BinNodeMap;
+
+static const char* BinName(const ASTBinNode &b) {
+  const char *name = b.GetName();
+  return name ? gStringPool.FindString(name) : NULL;
+}
+
+#define NEW_NODE(T) new (pool->NewTreeNode(sizeof(T))) T
+
+// Create the TreeNode of 'b' with everything in its record, but no children.
+static TreeNode* NewBinNode(const ASTBinNode &b, TreePool *pool) {
+  switch (b.GetKind()) {
+  case NK_Package:
+    return NEW_NODE(PackageNode)(BinName(b));
+  case NK_Import: {
+    ImportNode *n = NEW_NODE(ImportNode)();
+    n->SetName(BinName(b));
+    unsigned prop = b.GetData();
+    if (prop & ImpType)   n->SetImportType();
+    if (prop & ImpStatic) n->SetImportStatic();
+    if (prop & ImpSingle) n->SetImportSingle();
+    if (prop & ImpAll)    n->SetImportAll();
+    if (prop & ImpLocal)  n->SetImportLocal();
+    if (prop & ImpSystem) n->SetImportSystem();
+    return n;
+  }
+  case NK_Identifier: {
+    IdentifierNode *n = NEW_NODE(IdentifierNode)(BinName(b));
+    for (unsigned i = 0; i < b.GetExtrasNum(); i++)
+      n->AddAttr((AttrId)b.GetExtra(i));
+    return n;
+  }
+  case NK_Field: {
+    FieldNode *n = NEW_NODE(FieldNode)();
+    n->SetName(BinName(b));
+    return n;
+  }
+  case NK_Dimension: {
+    DimensionNode *n = NEW_NODE(DimensionNode)();
+    for (unsigned i = 0; i < b.GetExtrasNum(); i++)
+      n->AddDim(b.GetExtra(i));
+    return n;
+  }
+  case NK_Attr:
+    return gAttrPool.GetAttrNode((AttrId)b.GetData());
+  case NK_PrimType:
+    return gPrimTypePool.FindType((TypeId)b.GetData());
+  case NK_UserType:    return NEW_NODE(UserTypeNode)();
+  case NK_Cast:        return NEW_NODE(CastNode)();
+  case NK_Parenthesis: return NEW_NODE(ParenthesisNode)();
+  case NK_VarList:     return NEW_NODE(VarListNode)();
+  case NK_ExprList:    return NEW_NODE(ExprListNode)();
+  case NK_Literal: {
+    LitData data;
+    memset(&data, 0, sizeof(LitData));
+    data.mType = (LitId)b.GetData();
+    uint32_t words[2] = {0, 0};
+    for (unsigned i = 0; i < b.GetExtrasNum() && i < 2; i++)
+      words[i] = b.GetExtra(i);
+    switch (data.mType) {
+    case LT_IntegerLiteral: memcpy(&data.mData.mInt, words, sizeof(int)); break;
+    case LT_FPLiteral:      memcpy(&data.mData.mFloat, words, sizeof(float)); break;
+    case LT_DoubleLiteral:  memcpy(&data.mData.mDouble, words, sizeof(double)); break;
+    case LT_BooleanLiteral: data.mData.mBool = words[0]; break;
+    case LT_CharacterLiteral: data.mData.mChar = words[0]; break;
+    case LT_StringLiteral:  data.mData.mStr = (char*)BinName(b); break;
+    default: break;
+    }
+    return NEW_NODE(LiteralNode)(data);
+  }
+  case NK_UnaOperator: {
+    UnaOperatorNode *n = NEW_NODE(UnaOperatorNode)((OprId)b.GetData());
+    n->SetIsPost(b.GetFlags() & ABF_IsPost);
+    return n;
+  }
+  case NK_BinOperator: return NEW_NODE(BinOperatorNode)((OprId)b.GetData());
+  case NK_TerOperator: return NEW_NODE(TerOperatorNode)((OprId)b.GetData());
+  case NK_Lambda:      return NEW_NODE(LambdaNode)();
+  case NK_Block: {
+    BlockNode *n = NEW_NODE(BlockNode)();
+    if (b.GetFlags() & ABF_IsInstInit)
+      n->SetIsInstInit();
+    for (unsigned i = 0; i < b.GetExtrasNum(); i++)
+      n->AddAttr((AttrId)b.GetExtra(i));
+    return n;
+  }
+  case NK_Function: {
+    FunctionNode *n = NEW_NODE(FunctionNode)();
+    n->SetName(BinName(b));
+    if (b.GetFlags() & ABF_IsConstructor)
+      n->SetIsConstructor();
+    for (unsigned i = 0; i < b.GetExtrasNum(); i++)
+      n->AddAttr((AttrId)b.GetExtra(i));
+    return n;
+  }
+  case NK_Class: {
+    ClassNode *n = NEW_NODE(ClassNode)();
+    n->SetName(BinName(b));
+    if (b.GetFlags() & ABF_JavaEnum)
+      n->SetJavaEnum();
+    for (unsigned i = 0; i < b.GetExtrasNum(); i++)
+      n->AddAttr((AttrId)b.GetExtra(i));
+    return n;
+  }
+  case NK_Interface: {
+    InterfaceNode *n = NEW_NODE(InterfaceNode)();
+    n->SetName(BinName(b));
+    n->SetIsAnnotation(b.GetFlags() & ABF_IsAnnotation);
+    return n;
+  }
+  case NK_AnnotationType: return NEW_NODE(AnnotationTypeNode)();
+  case NK_Annotation:  return NEW_NODE(AnnotationNode)();
+  case NK_Exception:   return NEW_NODE(ExceptionNode)();
+  case NK_Return:      return NEW_NODE(ReturnNode)();
+  case NK_CondBranch:  return NEW_NODE(CondBranchNode)();
+  case NK_Break:       return NEW_NODE(BreakNode)();
+  case NK_ForLoop:     return NEW_NODE(ForLoopNode)();
+  case NK_WhileLoop:   return NEW_NODE(WhileLoopNode)();
+  case NK_DoLoop:      return NEW_NODE(DoLoopNode)();
+  case NK_New:         return NEW_NODE(NewNode)();
+  case NK_Call: {
+    CallNode *n = NEW_NODE(CallNode)();
+    n->SetName(BinName(b));
+    return n;
+  }
+  case NK_SwitchLabel: {
+    SwitchLabelNode *n = NEW_NODE(SwitchLabelNode)();
+    n->SetIsDefault(b.GetFlags() & ABF_IsDefault);
+    return n;
+  }
+  case NK_SwitchCase:  return NEW_NODE(SwitchCaseNode)();
+  case NK_Switch:      return NEW_NODE(SwitchNode)();
+  case NK_Pass:        return NEW_NODE(PassNode)();
+  default:
+    return NULL;
+  }
+}
+
+#undef NEW_NODE
+
+// Set the children and label of 'node', the TreeNode of 'b'.
+static void SetBinChildren(const ASTBinNode &b, TreeNode *node, BinNodeMap &nodes) {
+  // The i-th child of group g, and the number of children of g.
+#define CHILD(T, g, i) ((T*)nodes[b.GetChild(ABG_##g, i).GetRecord()])
+#define NUM(g) b.GetChildrenNum(ABG_##g)
+  ASTBinNode label = b.GetLabel();
+  if (!label.IsNull())
+    node->SetLabel(nodes[label.GetRecord()]);
+
+  switch (b.GetKind()) {
+  case NK_Identifier: {
+    IdentifierNode *n = (IdentifierNode*)node;
+    n->SetType(CHILD(TreeNode, IdentifierType, 0));
+    n->SetInit(CHILD(TreeNode, IdentifierInit, 0));
+    n->SetDims(CHILD(DimensionNode, IdentifierDims, 0));
+    break;
+  }
+  case NK_Field: {
+    FieldNode *n = (FieldNode*)node;
+    n->SetParent(CHILD(TreeNode, FieldParent, 0));
+    n->SetField(CHILD(IdentifierNode, FieldField, 0));
+    break;
+  }
+  case NK_UserType: {
+    UserTypeNode *n = (UserTypeNode*)node;
+    n->SetId(CHILD(IdentifierNode, UserTypeId, 0));
+    for (unsigned i = 0; i < NUM(UserTypeArgs); i++)
+      n->AddTypeArg(CHILD(IdentifierNode, UserTypeArgs, i));
+    break;
+  }
+  case NK_Cast: {
+    CastNode *n = (CastNode*)node;
+    n->SetDestType(CHILD(TreeNode, CastDestType, 0));
+    n->SetExpr(CHILD(TreeNode, CastExpr, 0));
+    break;
+  }
+  case NK_Parenthesis:
+    ((ParenthesisNode*)node)->SetExpr(CHILD(TreeNode, ParenthesisExpr, 0));
+    break;
+  case NK_VarList:
+    for (unsigned i = 0; i < NUM(VarListVars); i++)
+      ((VarListNode*)node)->AddVar(CHILD(IdentifierNode, VarListVars, i));
+    break;
+  case NK_ExprList:
+    for (unsigned i = 0; i < NUM(ExprListExprs); i++)
+      ((ExprListNode*)node)->AddExpr(CHILD(TreeNode, ExprListExprs, i));
+    break;
+  case NK_UnaOperator:
+    ((UnaOperatorNode*)node)->SetOpnd(CHILD(TreeNode, UnaOperatorOpnd, 0));
+    break;
+  case NK_BinOperator: {
+    BinOperatorNode *n = (BinOperatorNode*)node;
+    n->mOpndA = CHILD(TreeNode, BinOperatorA, 0);
+    n->mOpndB = CHILD(TreeNode, BinOperatorB, 0);
+    break;
+  }
+  case NK_TerOperator: {
+    TerOperatorNode *n = (TerOperatorNode*)node;
+    n->mOpndA = CHILD(TreeNode, TerOperatorA, 0);
+    n->mOpndB = CHILD(TreeNode, TerOperatorB, 0);
+    n->mOpndC = CHILD(TreeNode, TerOperatorC, 0);
+    break;
+  }
+  case NK_Lambda: {
+    LambdaNode *n = (LambdaNode*)node;
+    for (unsigned i = 0; i < NUM(LambdaParams); i++)
+      n->AddParam(CHILD(IdentifierNode, LambdaParams, i));
+    n->SetBody(CHILD(TreeNode, LambdaBody, 0));
+    break;
+  }
+  case NK_Block:
+    for (unsigned i = 0; i < NUM(BlockChildren); i++)
+      ((BlockNode*)node)->AddChild(CHILD(TreeNode, BlockChildren, i));
+    break;
+  case NK_Function: {
+    FunctionNode *n = (FunctionNode*)node;
+    n->SetType(CHILD(TreeNode, FunctionType, 0));
+    for (unsigned i = 0; i < NUM(FunctionParams); i++)
+      n->AddParam(CHILD(TreeNode, FunctionParams, i));
+    n->SetBody(CHILD(BlockNode, FunctionBody, 0));
+    for (unsigned i = 0; i < NUM(FunctionThrows); i++)
+      n->AddThrow(CHILD(ExceptionNode, FunctionThrows, i));
+    for (unsigned i = 0; i < NUM(FunctionAnnotations); i++)
+      n->AddAnnotation(CHILD(AnnotationNode, FunctionAnnotations, i));
+    n->SetDims(CHILD(DimensionNode, FunctionDims, 0));
+    break;
+  }
+  case NK_Class: {
+    ClassNode *n = (ClassNode*)node;
+    for (unsigned i = 0; i < NUM(ClassSuperClasses); i++)
+      n->AddSuperClass(CHILD(ClassNode, ClassSuperClasses, i));
+    for (unsigned i = 0; i < NUM(ClassSuperInterfaces); i++)
+      n->AddSuperInterface(CHILD(InterfaceNode, ClassSuperInterfaces, i));
+    n->AddBody(CHILD(BlockNode, ClassBody, 0));
+    for (unsigned i = 0; i < NUM(ClassFields); i++)
+      n->AddField(CHILD(IdentifierNode, ClassFields, i));
+    for (unsigned i = 0; i < NUM(ClassMethods); i++)
+      n->AddMethod(CHILD(FunctionNode, ClassMethods, i));
+    for (unsigned i = 0; i < NUM(ClassConstructors); i++)
+      n->AddConstructor(CHILD(FunctionNode, ClassConstructors, i));
+    for (unsigned i = 0; i < NUM(ClassInstInits); i++)
+      n->AddInstInit(CHILD(BlockNode, ClassInstInits, i));
+    for (unsigned i = 0; i < NUM(ClassLocalClasses); i++)
+      n->AddLocalClass(CHILD(ClassNode, ClassLocalClasses, i));
+    for (unsigned i = 0; i < NUM(ClassLocalInterfaces); i++)
+      n->AddLocalInterface(CHILD(InterfaceNode, ClassLocalInterfaces, i));
+    break;
+  }
+  case NK_Interface: {
+    InterfaceNode *n = (InterfaceNode*)node;
+    for (unsigned i = 0; i < NUM(InterfaceSuperInterfaces); i++)
+      n->AddSuperInterface(CHILD(InterfaceNode, InterfaceSuperInterfaces, i));
+    for (unsigned i = 0; i < NUM(InterfaceFields); i++)
+      n->AddField(CHILD(IdentifierNode, InterfaceFields, i));
+    for (unsigned i = 0; i < NUM(InterfaceMethods); i++)
+      n->AddMethod(CHILD(FunctionNode, InterfaceMethods, i));
+    break;
+  }
+  case NK_AnnotationType:
+    ((AnnotationTypeNode*)node)->SetName(CHILD(IdentifierNode, AnnotationTypeId, 0));
+    break;
+  case NK_Annotation: {
+    AnnotationNode *n = (AnnotationNode*)node;
+    n->SetName(CHILD(IdentifierNode, AnnotationId, 0));
+    n->SetType(CHILD(AnnotationTypeNode, AnnotationType, 0));
+    n->SetExpr(CHILD(TreeNode, AnnotationExpr, 0));
+    break;
+  }
+  case NK_Exception:
+    ((ExceptionNode*)node)->SetException(CHILD(IdentifierNode, ExceptionException, 0));
+    break;
+  case NK_Return:
+    ((ReturnNode*)node)->SetResult(CHILD(TreeNode, ReturnResult, 0));
+    break;
+  case NK_CondBranch: {
+    CondBranchNode *n = (CondBranchNode*)node;
+    n->SetCond(CHILD(TreeNode, CondBranchCond, 0));
+    n->SetTrueBranch(CHILD(TreeNode, CondBranchTrue, 0));
+    n->SetFalseBranch(CHILD(TreeNode, CondBranchFalse, 0));
+    break;
+  }
+  case NK_Break:
+    ((BreakNode*)node)->SetTarget(CHILD(TreeNode, BreakTarget, 0));
+    break;
+  case NK_ForLoop: {
+    ForLoopNode *n = (ForLoopNode*)node;
+    for (unsigned i = 0; i < NUM(ForLoopInit); i++)
+      n->AddInit(CHILD(TreeNode, ForLoopInit, i));
+    n->SetCond(CHILD(TreeNode, ForLoopCond, 0));
+    for (unsigned i = 0; i < NUM(ForLoopUpdate); i++)
+      n->AddUpdate(CHILD(TreeNode, ForLoopUpdate, i));
+    n->SetBody(CHILD(TreeNode, ForLoopBody, 0));
+    break;
+  }
+  case NK_WhileLoop: {
+    WhileLoopNode *n = (WhileLoopNode*)node;
+    n->SetCond(CHILD(TreeNode, WhileLoopCond, 0));
+    n->SetBody(CHILD(TreeNode, WhileLoopBody, 0));
+    break;
+  }
+  case NK_DoLoop: {
+    DoLoopNode *n = (DoLoopNode*)node;
+    n->SetCond(CHILD(TreeNode, DoLoopCond, 0));
+    n->SetBody(CHILD(TreeNode, DoLoopBody, 0));
+    break;
+  }
+  case NK_New: {
+    NewNode *n = (NewNode*)node;
+    n->SetId(CHILD(TreeNode, NewId, 0));
+    for (unsigned i = 0; i < NUM(NewParams); i++)
+      n->AddParam(CHILD(TreeNode, NewParams, i));
+    n->SetBody(CHILD(BlockNode, NewBody, 0));
+    break;
+  }
+  case NK_Call: {
+    CallNode *n = (CallNode*)node;
+    n->SetMethod(CHILD(TreeNode, CallMethod, 0));
+    for (unsigned i = 0; i < NUM(CallArgs); i++)
+      n->AddArg(CHILD(TreeNode, CallArgs, i));
+    break;
+  }
+  case NK_SwitchLabel:
+    ((SwitchLabelNode*)node)->SetValue(CHILD(TreeNode, SwitchLabelValue, 0));
+    break;
+  case NK_SwitchCase: {
+    SwitchCaseNode *n = (SwitchCaseNode*)node;
+    for (unsigned i = 0; i < NUM(SwitchCaseLabels); i++)
+      n->AddLabel(CHILD(TreeNode, SwitchCaseLabels, i));
+    for (unsigned i = 0; i < NUM(SwitchCaseStmts); i++)
+      n->AddStmt(CHILD(TreeNode, SwitchCaseStmts, i));
+    break;
+  }
+  case NK_Switch: {
+    SwitchNode *n = (SwitchNode*)node;
+    n->SetCond(CHILD(TreeNode, SwitchCond, 0));
+    for (unsigned i = 0; i < NUM(SwitchCases); i++)
+      n->AddCase(CHILD(TreeNode, SwitchCases, i));
+    break;
+  }
+  case NK_Pass:
+    for (unsigned i = 0; i < NUM(PassChildren); i++)
+      ((PassNode*)node)->AddChild(CHILD(TreeNode, PassChildren, i));
+    break;
+  default:
+    break;
+  }
+#undef CHILD
+#undef NUM
+}
+
+// Create the nodes reachable from 'root' which are not created yet, in the
+// pool of 'tree'. Returns false if one cannot be created, or there is no
+// 'tree' for it.
+static bool NewBinNodes(const ASTBinNode &root, ASTTree *tree, BinNodeMap &nodes,
+                        std::vector<ASTBinNode> &order) {
+  std::vector<ASTBinNode> working_list;
+  working_list.push_back(root);
+  while (!working_list.empty()) {
+    ASTBinNode b = working_list.back();
+    working_list.pop_back();
+    if (b.IsNull() || nodes.find(b.GetRecord()) != nodes.end())
+      continue;
+    TreeNode *node = tree ? NewBinNode(b, &tree->mTreePool) : NULL;
+    if (!node)
+      return false;
+    nodes[b.GetRecord()] = node;
+    order.push_back(b);
+    for (unsigned g = 0; g < b.GetGroupsNum(); g++) {
+      for (unsigned i = 0; i < b.GetChildrenNum(g); i++)
+        working_list.push_back(b.GetChild(g, i));
+    }
+    working_list.push_back(b.GetLabel());
+  }
+  return true;
+}
+
+bool ASTBinReader::Load(ASTModule *module) const {
+  BinNodeMap nodes;
+  std::vector<ASTBinNode> order;
+  std::vector<ASTTree*> trees;
+  bool ok = true;
+  for (unsigned i = 0; ok && i < GetTreesNum(); i++) {
+    ASTTree *tree = new ASTTree();
+    trees.push_back(tree);
+    ok = NewBinNodes(GetTree(i), tree, nodes, order);
+    tree->mRootNode = nodes[GetTree(i).GetRecord()];
+  }
+
+  // The package and imports are trees too. If not, they go to the last tree.
+  ASTTree *last = trees.empty() ? NULL : trees.back();
+  if (ok)
+    ok = NewBinNodes(GetPackage(), last, nodes, order);
+  for (unsigned i = 0; ok && i < GetImportsNum(); i++)
+    ok = NewBinNodes(GetImport(i), last, nodes, order);
+
+  if (!ok) {
+    for (unsigned i = 0; i < trees.size(); i++)
+      delete trees[i];
+    return false;
+  }
+
+  for (unsigned i = 0; i < order.size(); i++)
+    SetBinChildren(order[i], nodes[order[i].GetRecord()], nodes);
+
+  const char *name = GetFileName();
+  module->SetFileName(name ? gStringPool.FindString(name) : NULL);
+  if (!GetPackage().IsNull())
+    module->SetPackage((PackageNode*)nodes[GetPackage().GetRecord()]);
+  for (unsigned i = 0; i < GetImportsNum(); i++)
+    module->AddImport((ImportNode*)nodes[GetImport(i).GetRecord()]);
+  for (unsigned i = 0; i < trees.size(); i++)
+    module->AddTree(trees[i]);
+  return true;
+}
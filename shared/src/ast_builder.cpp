@@ -24,7 +24,7 @@
 #include "ast_module.h"
 #include "massert.h"
 
-ASTBuilder gASTBuilder;
+thread_local ASTBuilder gASTBuilder;
 
 ////////////////////////////////////////////////////////////////////////////////////////
 // For the time being, we simply use a big switch-case. Later on we could use a more
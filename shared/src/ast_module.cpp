@@ -16,7 +16,7 @@
 #include "ast_module.h"
 #include "ast.h"
 
-ASTModule gModule;
+thread_local ASTModule gModule;
 
 ASTModule::ASTModule() {
   mRootScope = mScopePool.NewScope(NULL);
@@ -33,9 +33,49 @@ ASTModule::~ASTModule() {
   }
   mTrees.clear();
 
+  for (unsigned i = 0; i < mLazyBodies.size(); i++)
+    delete mLazyBodies[i];
+  mLazyBodies.clear();
+
   mImports.Release();
 }
 
+// Free the trees and scopes of the last compilation unit. A thread could
+// parse multiple files one after another with the same gModule.
+void ASTModule::Clear() {
+  std::vector<ASTTree*>::iterator it = mTrees.begin();
+  for (; it != mTrees.end(); it++) {
+    ASTTree *tree = *it;
+    if (tree)
+      delete tree;
+  }
+  mTrees.clear();
+
+  for (unsigned i = 0; i < mLazyBodies.size(); i++)
+    delete mLazyBodies[i];
+  mLazyBodies.clear();
+
+  mImports.Clear();
+  mPackage = NULL;
+  mFileName = NULL;
+
+  mScopePool.Clear();
+  mRootScope = mScopePool.NewScope(NULL);
+}
+
+void ASTModule::MoveTo(ASTModule *dst) {
+  dst->mFileName = mFileName;
+  dst->mPackage = mPackage;
+  for (unsigned i = 0; i < mImports.GetNum(); i++)
+    dst->mImports.PushBack(mImports.ValueAtIndex(i));
+  dst->mTrees.insert(dst->mTrees.end(), mTrees.begin(), mTrees.end());
+  dst->mLazyBodies.insert(dst->mLazyBodies.end(), mLazyBodies.begin(), mLazyBodies.end());
+
+  mTrees.clear();
+  mLazyBodies.clear();
+  Clear();
+}
+
 // AFAIK, all languages allow only one package name if it allows.
 void ASTModule::SetPackage(PackageNode *p) {
   MASSERT(!mPackage);
@@ -104,6 +104,17 @@ void ASTScope::Release() {
 ASTScopePool::~ASTScopePool() {
 }
 
+// Remove all the scopes. The memory of mMemPool is kept for reuse.
+void ASTScopePool::Clear() {
+  std::vector<ASTScope*>::iterator it = mScopes.begin();
+  for (; it != mScopes.end(); it++) {
+    ASTScope *s = *it;
+    s->Release();
+  }
+  mScopes.clear();
+  mMemPool.Clear();
+}
+
 // Create a new scope under 'parent'.
 ASTScope* ASTScopePool::NewScope(ASTScope *parent) {
   char *addr = mMemPool.Alloc(sizeof(ASTScope));
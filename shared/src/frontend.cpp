@@ -0,0 +1,240 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "frontend.h"
+#include "frontend_c.h"
+#include "parser.h"
+#include "ast_binary.h"
+#include "thread_out.h"
+
+ParseResult::ParseResult(const char *name) : mName(name) {
+  mSucc = false;
+  mFurthestToken = 0;
+}
+
+void ParseResult::Dump(std::string &out) {
+  OutCapture capture(&out);
+  mModule.Dump();
+}
+
+bool ParseResult::WriteBinary(std::string &out) {
+  ASTBinWriter writer;
+  return writer.Write(&mModule, out);
+}
+
+void FrontEnd::Init() {
+  RecursionAll::GetShared();
+}
+
+// The parser builds the trees in gModule of this thread, and the result
+// takes them over.
+ParseResult* FrontEnd::Parse(const char *name, const char *buf, size_t size,
+                             const ParseOptions &opts) {
+  Init();
+
+  ParseResult *result = new ParseResult(name);
+  gModule.Clear();
+  Parser *parser = new Parser(result->mName.c_str(), std::string(buf, size));
+  parser->SetQuiet();
+  parser->SetWorkPool(opts.mWorkPool);
+  parser->SetBudget(opts.mBudget);
+  if (opts.mLazyBodies)
+    parser->SetLazyBodies();
+  if (opts.mValidateOnly)
+    parser->SetValidateOnly();
+  parser->InitRecursion();
+
+  result->mSucc = parser->Parse();
+  result->mFurthestToken = parser->GetFurthestToken();
+  result->mFurthestTokenName = parser->GetFurthestTokenName();
+  result->mBudgetError = parser->GetBudgetError();
+  delete parser;
+
+  gModule.MoveTo(&result->mModule);
+  return result;
+}
+
+ParseResult* FrontEnd::ParseFile(const char *name, const ParseOptions &opts) {
+  FILE *fp = fopen(name, "rb");
+  if (!fp)
+    return NULL;
+  std::string src;
+  char buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+    src.append(buf, n);
+  fclose(fp);
+  return Parse(name, src.c_str(), src.size(), opts);
+}
+
+ParseStream::ParseStream(const char *name, const ParseOptions &opts,
+                         const std::function<void(ASTTree*)> &callback) {
+  mResult = new ParseResult(name);
+  gModule.Clear();
+  mParser = new Parser(mResult->mName.c_str(), std::string());
+  mParser->SetQuiet();
+  mParser->SetBudget(opts.mBudget);
+  if (opts.mValidateOnly)
+    mParser->SetValidateOnly();
+  mParser->InitRecursion();
+  mParser->StartStream(callback);
+}
+
+ParseStream::~ParseStream() {
+  if (mParser) {
+    delete mParser;
+    gModule.Clear();
+  }
+  delete mResult;
+}
+
+bool ParseStream::Feed(const char *data, size_t size) {
+  return mParser->FeedStream(data, size);
+}
+
+ParseResult* ParseStream::Finish() {
+  ParseResult *result = mResult;
+  result->mSucc = mParser->FinishStream();
+  result->mFurthestToken = mParser->GetFurthestToken();
+  result->mFurthestTokenName = mParser->GetFurthestTokenName();
+  result->mBudgetError = mParser->GetBudgetError();
+  delete mParser;
+  mParser = NULL;
+  mResult = NULL;
+
+  gModule.MoveTo(&result->mModule);
+  return result;
+}
+
+ParseStream* FrontEnd::StartStream(const char *name, const ParseOptions &opts,
+                                   const std::function<void(ASTTree*)> &callback) {
+  Init();
+  return new ParseStream(name, opts, callback);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                              C API
+//////////////////////////////////////////////////////////////////////////////
+
+struct fe_result {
+  ParseResult *mResult;
+};
+
+static ParseOptions FlagsToOptions(unsigned flags) {
+  ParseOptions opts;
+  opts.mValidateOnly = flags & FE_VALIDATE_ONLY;
+  opts.mLazyBodies = flags & FE_LAZY_BODIES;
+  return opts;
+}
+
+static fe_result* NewCResult(ParseResult *result) {
+  if (!result)
+    return NULL;
+  fe_result *res = new fe_result;
+  res->mResult = result;
+  return res;
+}
+
+static void* CopyToMalloc(const std::string &s, size_t extra) {
+  char *p = (char*)malloc(s.size() + extra);
+  if (!p)
+    return NULL;
+  memcpy(p, s.data(), s.size());
+  if (extra)
+    p[s.size()] = '\0';
+  return p;
+}
+
+extern "C" {
+
+void fe_init(void) {
+  FrontEnd::Init();
+}
+
+fe_result* fe_parse_buffer(const char *name, const char *buf, size_t size, unsigned flags) {
+  return NewCResult(FrontEnd::Parse(name, buf, size, FlagsToOptions(flags)));
+}
+
+fe_result* fe_parse_file(const char *name, unsigned flags) {
+  return NewCResult(FrontEnd::ParseFile(name, FlagsToOptions(flags)));
+}
+
+void fe_result_free(fe_result *res) {
+  if (!res)
+    return;
+  delete res->mResult;
+  delete res;
+}
+
+int fe_result_succ(fe_result *res) {
+  return res->mResult->IsSucc();
+}
+
+unsigned fe_result_trees_num(fe_result *res) {
+  return res->mResult->GetTreesNum();
+}
+
+unsigned fe_result_furthest_token(fe_result *res) {
+  return res->mResult->GetFurthestToken();
+}
+
+const char* fe_result_furthest_token_name(fe_result *res) {
+  return res->mResult->GetFurthestTokenName();
+}
+
+char* fe_result_dump(fe_result *res) {
+  std::string out;
+  res->mResult->Dump(out);
+  return (char*)CopyToMalloc(out, 1);
+}
+
+struct fe_stream {
+  ParseStream *mStream;
+  unsigned     mTrees;
+};
+
+fe_stream* fe_stream_new(const char *name, unsigned flags, fe_tree_callback cb, void *ctx) {
+  fe_stream *stream = new fe_stream;
+  stream->mTrees = 0;
+  std::function<void(ASTTree*)> callback;
+  if (cb)
+    callback = [stream, cb, ctx](ASTTree*) {cb(ctx, stream->mTrees++);};
+  stream->mStream = FrontEnd::StartStream(name, FlagsToOptions(flags), callback);
+  return stream;
+}
+
+int fe_stream_feed(fe_stream *stream, const char *data, size_t size) {
+  return stream->mStream->Feed(data, size);
+}
+
+fe_result* fe_stream_finish(fe_stream *stream) {
+  fe_result *res = NewCResult(stream->mStream->Finish());
+  delete stream->mStream;
+  delete stream;
+  return res;
+}
+
+void* fe_result_binary_ast(fe_result *res, size_t *size) {
+  std::string out;
+  if (!res->mResult->WriteBinary(out))
+    return NULL;
+  *size = out.size();
+  return CopyToMalloc(out, 0);
+}
+
+}
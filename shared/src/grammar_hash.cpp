@@ -0,0 +1,149 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+// GetGrammarHash() is in its own file, because it refers to the lookahead
+// tables which are not linked into every tool using shared.a.
+
+#include <cstring>
+
+#include "ruletable_util.h"
+#include "common_header_autogen.h"
+#include "gen_summary.h"
+#include "gen_token.h"
+#include "token.h"
+
+////////////////////////////////////////////////////////////////////////////////////
+//                            Grammar Fingerprint
+// FNV-1a over everything in the rule tables which affects the parsing result.
+// Sub-tables are hashed by their index, so each table is visited once. The
+// token tables of the lexer are hashed too, since the rule tables refer to
+// the system tokens by index.
+////////////////////////////////////////////////////////////////////////////////////
+
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME        0x100000001b3ULL
+
+static void HashBytes(unsigned long long &h, const void *p, unsigned len) {
+  const unsigned char *c = (const unsigned char*)p;
+  for (unsigned i = 0; i < len; i++) {
+    h ^= c[i];
+    h *= FNV_PRIME;
+  }
+}
+
+static void HashUnsigned(unsigned long long &h, unsigned v) {
+  HashBytes(h, &v, sizeof(unsigned));
+}
+
+// The terminating NUL is hashed too, so "ab","c" differs from "a","bc".
+static void HashString(unsigned long long &h, const char *s) {
+  if (!s)
+    s = "";
+  HashBytes(h, s, strlen(s) + 1);
+}
+
+static void HashTokenTables(unsigned long long &h) {
+  HashUnsigned(h, SEP_NA);
+  for (unsigned i = 0; i < SEP_NA; i++) {
+    HashString(h, SepTable[i].mText);
+    HashUnsigned(h, SepTable[i].mId);
+  }
+  HashUnsigned(h, OPR_NA);
+  for (unsigned i = 0; i < OPR_NA; i++) {
+    HashString(h, OprTable[i].mText);
+    HashUnsigned(h, OprTable[i].mId);
+  }
+  HashUnsigned(h, KeywordTableSize);
+  for (unsigned i = 0; i < KeywordTableSize; i++)
+    HashString(h, KeywordTable[i].mText);
+
+  HashUnsigned(h, gSystemTokensNum);
+  for (unsigned i = 0; i < gSystemTokensNum; i++) {
+    const Token *token = &gSystemTokens[i];
+    HashUnsigned(h, token->mTkType);
+    if (token->mTkType == TT_SP)
+      HashUnsigned(h, token->mData.mSepId);
+    else if (token->mTkType == TT_OP)
+      HashUnsigned(h, token->mData.mOprId);
+    else if (token->mTkType == TT_KW)
+      HashString(h, token->mData.mName);
+  }
+}
+
+static unsigned long long ComputeGrammarHash() {
+  unsigned long long h = FNV_OFFSET_BASIS;
+  HashTokenTables(h);
+  HashUnsigned(h, RuleTableNum);
+  for (unsigned i = 0; i < RuleTableNum; i++) {
+    const RuleTable *rt = gRuleTableSummarys[i].mAddr;
+    HashString(h, gRuleTableSummarys[i].mName);
+    HashUnsigned(h, rt->mIndex);
+    HashUnsigned(h, rt->mType);
+    HashUnsigned(h, rt->mProperties);
+    HashUnsigned(h, rt->mNum);
+    for (unsigned j = 0; j < rt->mNum; j++) {
+      const TableData *data = rt->mData + j;
+      HashUnsigned(h, data->mType);
+      switch (data->mType) {
+      case DT_Subtable:
+        HashUnsigned(h, data->mData.mEntry->mIndex);
+        break;
+      case DT_String:
+        HashString(h, data->mData.mString);
+        break;
+      case DT_Char:
+        HashUnsigned(h, (unsigned)data->mData.mChar);
+        break;
+      case DT_Type:
+        HashUnsigned(h, data->mData.mTypeId);
+        break;
+      case DT_Token:
+        HashUnsigned(h, data->mData.mTokenId);
+        break;
+      default:
+        break;
+      }
+    }
+
+    HashUnsigned(h, rt->mNumAction);
+    for (unsigned j = 0; j < rt->mNumAction; j++) {
+      const Action *act = rt->mActions + j;
+      HashUnsigned(h, act->mId);
+      HashUnsigned(h, act->mNumElem);
+      for (unsigned k = 0; k < act->mNumElem; k++)
+        HashUnsigned(h, act->mElems[k]);
+    }
+
+    LookAheadTable latable = gLookAheadTable[rt->mIndex];
+    HashUnsigned(h, latable.mNum);
+    for (unsigned j = 0; j < latable.mNum; j++) {
+      LookAhead la = latable.mData[j];
+      // LA_Char and LA_String are not used by the parser, and their data is
+      // not reliable since autogen initializes them through the first member
+      // of the union. Only their type is hashed.
+      HashUnsigned(h, la.mType);
+      if (la.mType == LA_Token)
+        HashUnsigned(h, la.mData.mTokenId);
+    }
+  }
+
+  return h;
+}
+
+// The tables never change at runtime, so it's computed only once.
+unsigned long long GetGrammarHash() {
+  static unsigned long long hash = ComputeGrammarHash();
+  return hash;
+}
@@ -36,6 +36,9 @@
    The trailing new-line character has been removed.
  */
 int Lexer::ReadALine() {
+  if (!srcfile && mBuf)
+    return ReadALineFromBuf();
+
   if (!srcfile) {
     line[0] = '\0';
     return -1;
@@ -57,6 +60,36 @@ int Lexer::ReadALine() {
   return current_line_size;
 }
 
+// The same as ReadALine(), but reads from mBuf. It mimics getline(), so the
+// lines are exactly the same as reading from a file.
+int Lexer::ReadALineFromBuf() {
+  if (mBufPos >= mBufSize) {  // EOF
+    line[0] = '\0';
+    current_line_size = -1;
+    endoffile = true;
+    curidx = 0;
+    return current_line_size;
+  }
+
+  const char *start = mBuf + mBufPos;
+  const char *nl = (const char*)memchr(start, '\n', mBufSize - mBufPos);
+  size_t len = nl ? (nl - start) : (mBufSize - mBufPos);
+
+  if (len + 1 > linebuf_size) {
+    linebuf_size = len + 1;
+    line = static_cast<char *>(realloc(line, linebuf_size));
+    MASSERT(line && "cannot allocate line buffer");
+  }
+  memcpy(line, start, len);
+  line[len] = '\0';
+
+  mLineOffset = mBufPos;
+  mBufPos += nl ? len + 1 : len;
+  current_line_size = len;
+  curidx = 0;
+  return current_line_size;
+}
+
 Lexer::Lexer()
   : thename(""),
     theintval(0),
@@ -71,6 +104,11 @@ Lexer::Lexer()
     endoffile(false),
     mPredefinedTokenNum(0),
     mTrace(false),
+    mBuf(nullptr),
+    mBufSize(0),
+    mBufPos(0),
+    mLineOffset(0),
+    mCommentOpen(false),
     _linenum(0) {
       seencomments.clear();
       mCheckSeparator = true;
@@ -101,6 +139,50 @@ void Lexer::PrepareForFile(const std::string filename) {
   }
 }
 
+void Lexer::PrepareForString(const std::string &src) {
+  mBufCopy = src;
+  PrepareForBuffer(mBufCopy.c_str(), mBufCopy.size());
+}
+
+void Lexer::PrepareForBuffer(const char *buf, size_t size) {
+  srcfile = nullptr;
+  mBuf = buf;
+  mBufSize = size;
+  mBufPos = 0;
+  mLineOffset = 0;
+  endoffile = false;
+
+  // allocate line buffer.
+  linebuf_size = (size_t)MAX_LINE_SIZE;
+  line = static_cast<char *>(malloc(linebuf_size));  // initial line buffer.
+  if (!line) {
+    MASSERT("cannot allocate line buffer\n");
+  }
+
+  // try to read the first line
+  if (ReadALine() < 0) {
+    _linenum = 0;
+  } else {
+    _linenum = 1;
+  }
+}
+
+void Lexer::AppendLines(const char *data, size_t size) {
+  MASSERT(!srcfile && (mBuf == mBufCopy.data()) && "Not lexing a string.");
+  // The lines already read are dropped.
+  mBufCopy.erase(0, mBufPos);
+  mLineOffset = mLineOffset > mBufPos ? mLineOffset - mBufPos : 0;
+  mBufPos = 0;
+  mBufCopy.append(data, size);
+  mBuf = mBufCopy.data();
+  mBufSize = mBufCopy.size();
+
+  if (endoffile) {
+    endoffile = false;
+    ReadALine();
+  }
+}
+
 ///////////////////////////////////////////////////////////////////////////
 //                Utilities for finding system tokens
 // Remember the order of tokens are operators, separators, and keywords.
@@ -309,7 +391,11 @@ LitData Lexer::GetLiteral() {
 //
 // Return true if a comment is read. The contents are ignore.
 bool Lexer::GetComment() {
-  if (line[curidx] == '/' && line[curidx+1] == '/') {
+  // A comment left open at the end of the lines so far goes on in the lines
+  // appended in push mode.
+  bool open = mCommentOpen;
+
+  if (!open && line[curidx] == '/' && line[curidx+1] == '/') {
     curidx = current_line_size;
     return true;
   }
@@ -317,16 +403,22 @@ bool Lexer::GetComment() {
   // Handle comments in /* */
   // If there is a /* without ending */, the rest of code until the end of the current
   // source file will be treated as comment.
-  if (line[curidx] == '/' && line[curidx+1] == '*') {
-    curidx += 2; // skip /*
+  if (open || (line[curidx] == '/' && line[curidx+1] == '*')) {
+    if (!open)
+      curidx += 2; // skip /*
     bool get_ending = false;  // if we get the ending */
+    mCommentOpen = false;
 
     // the while loop stops only at either (1) end of file (2) finding */
     while (1) {
       if (curidx == current_line_size) {
-        if (ReadALine() < 0)
+        if (ReadALine() < 0) {
+          mCommentOpen = true;
           return true;
+        }
         _linenum++;  // a new line read.
+        // The new line could be empty, check it again.
+        continue;
       }
       if ((line[curidx] == '*' && line[curidx+1] == '/')) {
         get_ending = true;
@@ -601,8 +693,9 @@ bool Lexer::TraverseSecondTry(const RuleTable *rule_table) {
     //          Have to build a line for the lexer.
     unsigned len = w_yyy_start - w_zeroxxx_start;
     if (len) {
-      char *newline = (char*)malloc(len);
+      char *newline = (char*)malloc(len + 1);
       strncpy(newline, line + w_zeroxxx_start, len);
+      newline[len] = '\0';
       line = newline;
       curidx = 0;
 
@@ -0,0 +1,139 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+#include <atomic>
+#include <iomanip>
+#include <sys/resource.h>
+
+#include "mem_stats.h"
+
+bool gMemStatsOn = false;
+
+struct MemCounter {
+  std::atomic<long long> mCurr;
+  std::atomic<long long> mPeak;
+
+  void Add(long long n) {
+    if (!n)
+      return;
+    long long curr = mCurr.fetch_add(n, std::memory_order_relaxed) + n;
+    long long peak = mPeak.load(std::memory_order_relaxed);
+    while (curr > peak &&
+           !mPeak.compare_exchange_weak(peak, curr, std::memory_order_relaxed))
+      ;
+  }
+};
+
+struct MemCounters {
+  MemCounter mReserved;
+  MemCounter mUsed;
+  MemCounter mWasted;
+  MemCounter mObjects;
+};
+
+// Zero initialized as a static.
+static MemCounters gCounters[MS_NA];
+
+static const char *gNames[MS_NA] = {
+  "Other", "Token", "String", "Tree", "Scope", "Container", "AppealNode"
+};
+
+void MemStats::Update(MemSubsystem s, long long reserved, long long used,
+                      long long wasted, long long objects) {
+  MemCounters &c = gCounters[s];
+  c.mReserved.Add(reserved);
+  c.mUsed.Add(used);
+  c.mWasted.Add(wasted);
+  c.mObjects.Add(objects);
+}
+
+const char* MemStats::GetName(MemSubsystem s) {
+  return gNames[s];
+}
+
+void MemStats::Get(MemSubsystem s, MemUsage &u) {
+  MemCounters &c = gCounters[s];
+  u.mReserved = c.mReserved.mCurr.load();
+  u.mUsed = c.mUsed.mCurr.load();
+  u.mWasted = c.mWasted.mCurr.load();
+  u.mObjects = c.mObjects.mCurr.load();
+  u.mPeakReserved = c.mReserved.mPeak.load();
+  u.mPeakUsed = c.mUsed.mPeak.load();
+  u.mPeakWasted = c.mWasted.mPeak.load();
+  u.mPeakObjects = c.mObjects.mPeak.load();
+}
+
+void MemStats::GetTotal(MemUsage &total) {
+  total = MemUsage();
+  for (unsigned i = 0; i < MS_NA; i++) {
+    MemUsage u;
+    Get((MemSubsystem)i, u);
+    total.mReserved += u.mReserved;
+    total.mUsed += u.mUsed;
+    total.mWasted += u.mWasted;
+    total.mObjects += u.mObjects;
+    total.mPeakReserved += u.mPeakReserved;
+    total.mPeakUsed += u.mPeakUsed;
+    total.mPeakWasted += u.mPeakWasted;
+    total.mPeakObjects += u.mPeakObjects;
+  }
+}
+
+// The peaks start over from the current usage.
+void MemStats::ResetPeaks() {
+  for (unsigned i = 0; i < MS_NA; i++) {
+    MemCounters &c = gCounters[i];
+    c.mReserved.mPeak = c.mReserved.mCurr.load();
+    c.mUsed.mPeak = c.mUsed.mCurr.load();
+    c.mWasted.mPeak = c.mWasted.mCurr.load();
+    c.mObjects.mPeak = c.mObjects.mCurr.load();
+  }
+}
+
+long long MemStats::GetPeakRSS() {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage))
+    return 0;
+  return usage.ru_maxrss;
+}
+
+static void ReportLine(std::ostream &os, const char *name, const MemUsage &u) {
+  os << std::left << std::setw(12) << name << std::right
+     << std::setw(13) << u.mReserved / 1024.0 << std::setw(13) << u.mUsed / 1024.0
+     << std::setw(13) << u.mWasted / 1024.0 << std::setw(13) << u.mObjects
+     << std::setw(13) << u.mPeakReserved / 1024.0 << std::setw(13) << u.mPeakUsed / 1024.0
+     << std::setw(13) << u.mPeakWasted / 1024.0 << std::setw(13) << u.mPeakObjects
+     << std::endl;
+}
+
+void MemStats::Report(std::ostream &os) {
+  os << "================ Memory Stats ================" << std::endl;
+  os << std::left << std::setw(12) << "Subsystem" << std::right
+     << std::setw(13) << "Reserved(KB)" << std::setw(13) << "Used(KB)"
+     << std::setw(13) << "Wasted(KB)" << std::setw(13) << "Objects"
+     << std::setw(13) << "PeakRes(KB)" << std::setw(13) << "PeakUsed(KB)"
+     << std::setw(13) << "PeakWst(KB)" << std::setw(13) << "PeakObjs" << std::endl;
+  os << std::fixed << std::setprecision(1);
+  for (unsigned i = 0; i < MS_NA; i++) {
+    MemUsage u;
+    Get((MemSubsystem)i, u);
+    ReportLine(os, gNames[i], u);
+  }
+  MemUsage total;
+  GetTotal(total);
+  ReportLine(os, "Total", total);
+  os << "Peak RSS(KB): " << GetPeakRSS() << std::endl;
+  os.unsetf(std::ios::floatfield);
+}
@@ -33,7 +33,26 @@ MemPool::~MemPool() {
   Release();
 }
 
+// The skipped tails of blocks before 'b'.
+long long MemPool::WastedBefore(Block *b) {
+  long long wasted = 0;
+  for (Block *block = mBlocks; block && block != b; block = block->next)
+    wasted += mBlockSize - block->used;
+  return wasted;
+}
+
 void MemPool::Release() {
+  if (gMemStatsOn && mBlocks) {
+    long long reserved = 0;
+    long long used = 0;
+    for (Block *block = mBlocks; block; block = block->next) {
+      reserved += mBlockSize;
+      used += block->used;
+    }
+    MemStats::Update(mTag, -reserved, -used, -WastedBefore(mCurrBlock), -(long long)mObjects);
+  }
+  mObjects = 0;
+
   Block *block = mBlocks;
   while (block) {
     Block *next_block = block->next;
@@ -48,6 +67,7 @@ void MemPool::Release() {
 char* MemPool::AllocBlock() {
   Block *block = new Block;
   block->addr = (char*)malloc(mBlockSize);
+  MemAccount(mTag, mBlockSize, 0, 0, 0);
   block->used = 0;
   block->next = NULL;
   block->prev = NULL;
@@ -90,14 +110,22 @@ char* MemPool::Alloc(unsigned size) {
   } else {
     int avail = mBlockSize - mCurrBlock->used;
     if (avail < size) {
-      addr = AllocBlock();
-      MASSERT (addr && "MemPool failed to alloc a block");
+      MemAccount(mTag, 0, 0, avail, 0);
+      // The blocks after mCurrBlock are free after Clear() or Release(num).
+      if (mCurrBlock->next) {
+        mCurrBlock = mCurrBlock->next;
+      } else {
+        addr = AllocBlock();
+        MASSERT (addr && "MemPool failed to alloc a block");
+      }
     }
   }
 
   // At this point, it's guaranteed that 'b' is able to hold 'size'
   addr = mCurrBlock->addr + mCurrBlock->used;
   mCurrBlock->used += size;
+  mObjects++;
+  MemAccount(mTag, 0, size, 0, 1);
   return addr;
 }
 
@@ -111,11 +139,19 @@ void MemPool::Release(unsigned num) {
   if (!mCurrBlock)
     MERROR("Release on empty pool.");
 
+  // It's taken as the release of one object.
+  long long objects = mObjects ? 1 : 0;
+  mObjects -= objects;
+  MemAccount(mTag, 0, -(long long)num, 0, -objects);
+
   while(mCurrBlock) {
     if (num > mCurrBlock->used) {
       num -= mCurrBlock->used;
       mCurrBlock->used = 0;
       mCurrBlock = mCurrBlock->prev;
+      // The tail of the block before is not skipped any more.
+      if (mCurrBlock)
+        MemAccount(mTag, 0, 0, -(long long)(mBlockSize - mCurrBlock->used), 0);
     } else {
       mCurrBlock->used -= num;
       num -= num;
@@ -130,6 +166,14 @@ void MemPool::Release(unsigned num) {
 // Removes all data in the memory pool. Reset everything to the beginning
 // of the pool. But we keep the memory.
 void MemPool::Clear() {
+  if (gMemStatsOn && mBlocks) {
+    long long used = 0;
+    for (Block *block = mBlocks; block; block = block->next)
+      used += block->used;
+    MemStats::Update(mTag, 0, -used, -WastedBefore(mCurrBlock), -(long long)mObjects);
+  }
+  mObjects = 0;
+
   mCurrBlock = mBlocks;
   Block *temp_block = mCurrBlock;
   while(temp_block) {
@@ -0,0 +1,196 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <algorithm>
+#include <mutex>
+
+#include "parallel_lexer.h"
+#include "lexer.h"
+#include "token.h"
+#include "work_pool.h"
+#include "massert.h"
+
+ParallelLexer::~ParallelLexer() {
+  for (unsigned i = 0; i < mChunks.size(); i++)
+    delete mChunks[i];
+  for (unsigned i = 0; i < mLexers.size(); i++)
+    delete mLexers[i];
+}
+
+// Lexers are created by the workers in parallel.
+static std::mutex sLexersLock;
+
+Lexer* ParallelLexer::NewLexer() {
+  Lexer *lexer = new Lexer();
+  std::lock_guard<std::mutex> lock(sLexersLock);
+  mLexers.push_back(lexer);
+  return lexer;
+}
+
+// Lex until the end of 'lexer' buffer, which is at 'base' of mText. 'fresh'
+// tells if the current line of 'lexer' is started fresh.
+//
+// If 'spec' is not NULL, it stops at the first fresh line which 'spec' also
+// started fresh, and the rest is copied from 'spec'.
+//
+// Returns false if some text can't be lexed. It's a mis-speculation if the
+// chunk actually starts inside a comment, eg. a ' in the comment.
+bool ParallelLexer::LexChunkText(Lexer *lexer, size_t base, bool fresh,
+                                 LexChunk *out, LexChunk *spec) {
+  while (1) {
+    if (fresh) {
+      size_t offset = base + lexer->GetLineOffset();
+      if (spec) {
+        std::pair<size_t, unsigned> key(offset, 0);
+        std::vector<std::pair<size_t, unsigned> >::iterator it =
+          std::lower_bound(spec->mFreshLines.begin(), spec->mFreshLines.end(), key);
+        if (it != spec->mFreshLines.end() && it->first == offset) {
+          out->mTokens.insert(out->mTokens.end(),
+                              spec->mTokens.begin() + it->second,
+                              spec->mTokens.end());
+          out->mCommentOpen = spec->mCommentOpen;
+          return true;
+        }
+      }
+      out->mFreshLines.push_back(std::make_pair(offset, (unsigned)out->mTokens.size()));
+    }
+
+    // The same as Parser::LexOneLine()
+    while (!lexer->EndOfLine() && !lexer->EndOfFile()) {
+      Token *t = lexer->LexToken();
+      if (!t)
+        return false;
+      out->mTokens.push_back(t);
+    }
+    if (lexer->EndOfFile())
+      break;
+    lexer->ReadALine();
+    // There is no new line at the end of file.
+    fresh = !lexer->EndOfFile();
+  }
+
+  out->mCommentOpen = lexer->CommentOpen();
+  return true;
+}
+
+void ParallelLexer::SpeculateChunk(LexChunk *chunk) {
+  Lexer *lexer = NewLexer();
+  lexer->PrepareForBuffer(mText.data() + chunk->mStart, chunk->mEnd - chunk->mStart);
+  chunk->mFailed = !LexChunkText(lexer, chunk->mStart, true, chunk, NULL);
+}
+
+// The speculation of the chunk is wrong, either it actually starts inside a
+// comment, or it failed. The chunk is lexed again from where the previous
+// chunk ends. The speculative tokens are reused only if the speculation
+// didn't fail, since the rest after failure is missing.
+//
+// If 'comment_open', we put an artificial "/*" in front of the chunk to get
+// the Lexer into the comment, and drop the comment token since it's already
+// given by the previous chunk.
+void ParallelLexer::FixChunk(LexChunk *chunk, bool comment_open) {
+  mMisSpeculated++;
+
+  LexChunk *fixed = new LexChunk();
+  fixed->mStart = chunk->mStart;
+  fixed->mEnd = chunk->mEnd;
+  fixed->mCommentOpen = false;
+  fixed->mFailed = false;
+  LexChunk *spec = chunk->mFailed ? NULL : chunk;
+
+  Lexer *lexer = NewLexer();
+  bool ok;
+  if (comment_open) {
+    std::string text("/*");
+    text.append(mText, chunk->mStart, chunk->mEnd - chunk->mStart);
+    lexer->PrepareForString(text);
+
+    Token *t = lexer->LexToken();
+    MASSERT(t && t->IsComment() && "Not in comment?");
+    ok = LexChunkText(lexer, chunk->mStart - 2, false, fixed, spec);
+  } else {
+    lexer->PrepareForBuffer(mText.data() + chunk->mStart, chunk->mEnd - chunk->mStart);
+    ok = LexChunkText(lexer, chunk->mStart, true, fixed, spec);
+  }
+  // The same as lexing the file sequentially.
+  MASSERT(ok && "Non token got? Problem here!");
+
+  chunk->mTokens.swap(fixed->mTokens);
+  chunk->mFreshLines.swap(fixed->mFreshLines);
+  chunk->mCommentOpen = fixed->mCommentOpen;
+  chunk->mFailed = false;
+  delete fixed;
+}
+
+bool ParallelLexer::LexFile(const char *name, WorkPool *pool, size_t chunk_size) {
+  std::ifstream file(name, std::ios::in | std::ios::binary);
+  if (!file.is_open())
+    return false;
+  std::ostringstream ss;
+  ss << file.rdbuf();
+  mText = ss.str();
+
+  // Split at newlines.
+  size_t size = mText.size();
+  const char *text = mText.data();
+  size_t start = 0;
+  while (start < size) {
+    size_t end = std::min(start + chunk_size, size);
+    const char *nl = (const char*)memchr(text + end - 1, '\n', size - end + 1);
+    end = nl ? (nl - text + 1) : size;
+
+    LexChunk *chunk = new LexChunk();
+    chunk->mStart = start;
+    chunk->mEnd = end;
+    chunk->mCommentOpen = false;
+    chunk->mFailed = false;
+    mChunks.push_back(chunk);
+    start = end;
+  }
+
+  // An empty file still needs a Lexer to tell it's the end.
+  if (mChunks.empty()) {
+    LexChunk *chunk = new LexChunk();
+    chunk->mStart = 0;
+    chunk->mEnd = 0;
+    chunk->mCommentOpen = false;
+    chunk->mFailed = false;
+    mChunks.push_back(chunk);
+  }
+
+  for (unsigned i = 0; i < mChunks.size(); i++) {
+    LexChunk *chunk = mChunks[i];
+    if (pool)
+      pool->Submit([this, chunk]() {SpeculateChunk(chunk);});
+    else
+      SpeculateChunk(chunk);
+  }
+  if (pool)
+    pool->Wait();
+
+  // The fix-up pass.
+  bool comment_open = false;
+  for (unsigned i = 0; i < mChunks.size(); i++) {
+    LexChunk *chunk = mChunks[i];
+    if (comment_open || chunk->mFailed)
+      FixChunk(chunk, comment_open);
+    mTokens.insert(mTokens.end(), chunk->mTokens.begin(), chunk->mTokens.end());
+    comment_open = chunk->mCommentOpen;
+  }
+
+  return true;
+}
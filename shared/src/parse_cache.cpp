@@ -0,0 +1,296 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <ctime>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+
+#include "parse_cache.h"
+#include "ruletable_util.h"
+#include "frontend_stamp.h"
+
+#define PC_MAGIC_LEN 8
+#define PC_SUFFIX    ".pc"
+#define PC_TMP_PREFIX "tmp-"
+
+// Temporary files older than this are left by crashed writers.
+#define PC_STALE_TMP_SECONDS 3600
+
+static void PCMagic(char *magic) {
+  memcpy(magic, "MPLFEPC", 7);
+  magic[7] = (char)PARSE_CACHE_VERSION;
+}
+
+const std::string* PCEntry::GetSection(unsigned kind) const {
+  for (unsigned i = 0; i < mSections.size(); i++) {
+    if (mSections[i].mKind == kind)
+      return &mSections[i].mData;
+  }
+  return NULL;
+}
+
+void PCEntry::AddSection(unsigned kind, const std::string &data) {
+  PCSection s;
+  s.mKind = kind;
+  s.mData = data;
+  mSections.push_back(s);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                       Entry Encoding and Decoding
+// Integers are in the native byte order, the cache is local to a machine.
+//////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+static void PutInt(std::string &buf, T v) {
+  buf.append((const char*)&v, sizeof(T));
+}
+
+template <typename T>
+static bool GetInt(const std::string &buf, size_t &pos, T &v) {
+  if (pos + sizeof(T) > buf.size())
+    return false;
+  memcpy(&v, buf.data() + pos, sizeof(T));
+  pos += sizeof(T);
+  return true;
+}
+
+static void EncodeEntry(const PCEntry &entry, std::string &buf) {
+  char magic[PC_MAGIC_LEN];
+  PCMagic(magic);
+  buf.append(magic, PC_MAGIC_LEN);
+  PutInt<uint32_t>(buf, entry.mFlags);
+  PutInt<uint32_t>(buf, entry.mSections.size());
+  for (unsigned i = 0; i < entry.mSections.size(); i++) {
+    const PCSection &s = entry.mSections[i];
+    PutInt<uint32_t>(buf, s.mKind);
+    PutInt<uint64_t>(buf, s.mData.size());
+    buf.append(s.mData);
+  }
+}
+
+static bool DecodeEntry(const std::string &buf, PCEntry &entry) {
+  char magic[PC_MAGIC_LEN];
+  PCMagic(magic);
+  if (buf.size() < PC_MAGIC_LEN || memcmp(buf.data(), magic, PC_MAGIC_LEN))
+    return false;
+
+  size_t pos = PC_MAGIC_LEN;
+  uint32_t flags, num;
+  if (!GetInt(buf, pos, flags) || !GetInt(buf, pos, num))
+    return false;
+  entry.mFlags = flags;
+  entry.mSections.clear();
+  for (unsigned i = 0; i < num; i++) {
+    uint32_t kind;
+    uint64_t size;
+    if (!GetInt(buf, pos, kind) || !GetInt(buf, pos, size))
+      return false;
+    if (size > buf.size() - pos)
+      return false;
+    entry.AddSection(kind, buf.substr(pos, size));
+    pos += size;
+  }
+  // Trailing garbage means the entry isn't what we wrote.
+  return pos == buf.size();
+}
+
+static bool ReadWholeFile(const std::string &path, std::string &buf) {
+  std::ifstream f(path.c_str(), std::ios::in | std::ios::binary);
+  if (!f.is_open())
+    return false;
+  std::ostringstream ss;
+  ss << f.rdbuf();
+  buf = ss.str();
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                              ParseCache
+//////////////////////////////////////////////////////////////////////////////
+
+ParseCache::ParseCache(const char *dir, unsigned long long max_bytes) {
+  mDir = dir;
+  while (mDir.size() > 1 && mDir[mDir.size() - 1] == '/')
+    mDir.erase(mDir.size() - 1);
+  mMaxBytes = max_bytes;
+  mTmpSeq = 0;
+  mHits = 0;
+  mMisses = 0;
+  mStores = 0;
+  mEvictions = 0;
+
+  // Create the directory and its parents. Errors are found when storing.
+  for (size_t i = 1; i <= mDir.size(); i++) {
+    if (i == mDir.size() || mDir[i] == '/')
+      mkdir(mDir.substr(0, i).c_str(), 0755);
+  }
+
+  mTotalBytes = ScanDir(false);
+}
+
+// FNV-1a of the content, the content length, the grammar hash and the stamp
+// of the frontend sources. The length makes a collision of two different
+// files even less likely.
+std::string ParseCache::MakeKey(const std::string &content) {
+  unsigned long long h = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < content.size(); i++) {
+    h ^= (unsigned char)content[i];
+    h *= 0x100000001b3ULL;
+  }
+  char buf[96];
+  snprintf(buf, 96, "%016llx-%llx-%016llx-%s", h, (unsigned long long)content.size(),
+           GetGrammarHash(), FRONTEND_STAMP);
+  return std::string(buf);
+}
+
+std::string ParseCache::EntryPath(const std::string &key) {
+  return mDir + "/" + key + PC_SUFFIX;
+}
+
+bool ParseCache::Lookup(const std::string &key, PCEntry &entry) {
+  std::string path = EntryPath(key);
+  std::string buf;
+  bool found = ReadWholeFile(path, buf);
+  if (found && !DecodeEntry(buf, entry)) {
+    unlink(path.c_str());
+    found = false;
+  }
+
+  // Refresh the mtime for LRU.
+  if (found)
+    utimes(path.c_str(), NULL);
+
+  std::lock_guard<std::mutex> lock(mLock);
+  if (found)
+    mHits++;
+  else
+    mMisses++;
+  return found;
+}
+
+// Failures are silently ignored, the cache is only an optimization.
+void ParseCache::Store(const std::string &key, const PCEntry &entry) {
+  std::string buf;
+  EncodeEntry(entry, buf);
+
+  unsigned seq;
+  {
+    std::lock_guard<std::mutex> lock(mLock);
+    seq = mTmpSeq++;
+  }
+  std::ostringstream tmp;
+  tmp << mDir << "/" << PC_TMP_PREFIX << getpid() << "-" << seq;
+  std::string tmp_path = tmp.str();
+
+  FILE *fp = fopen(tmp_path.c_str(), "wb");
+  if (!fp)
+    return;
+  bool ok = fwrite(buf.data(), 1, buf.size(), fp) == buf.size();
+  ok = (fflush(fp) == 0) && ok;
+  ok = (fsync(fileno(fp)) == 0) && ok;
+  ok = (fclose(fp) == 0) && ok;
+  if (!ok || rename(tmp_path.c_str(), EntryPath(key).c_str())) {
+    unlink(tmp_path.c_str());
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mLock);
+  mStores++;
+  mTotalBytes += buf.size();
+  if (mTotalBytes > mMaxBytes)
+    mTotalBytes = ScanDir(true);
+}
+
+struct PCFileInfo {
+  std::string        mPath;
+  unsigned long long mSize;
+  struct timespec    mTime;
+};
+
+static bool PCOlder(const PCFileInfo &a, const PCFileInfo &b) {
+  if (a.mTime.tv_sec != b.mTime.tv_sec)
+    return a.mTime.tv_sec < b.mTime.tv_sec;
+  return a.mTime.tv_nsec < b.mTime.tv_nsec;
+}
+
+// Returns the total size of entries in the directory. If 'evict' is true,
+// the least recently used entries are removed until the total is below 90%
+// of the limit, so that we don't rescan the directory for every store.
+unsigned long long ParseCache::ScanDir(bool evict) {
+  DIR *d = opendir(mDir.c_str());
+  if (!d)
+    return 0;
+
+  std::vector<PCFileInfo> files;
+  unsigned long long total = 0;
+  time_t now = time(NULL);
+  struct dirent *ent;
+  while ((ent = readdir(d))) {
+    std::string name = ent->d_name;
+    std::string path = mDir + "/" + name;
+    struct stat st;
+    if (!name.compare(0, strlen(PC_TMP_PREFIX), PC_TMP_PREFIX)) {
+      if (!stat(path.c_str(), &st) && now - st.st_mtime > PC_STALE_TMP_SECONDS)
+        unlink(path.c_str());
+      continue;
+    }
+    size_t slen = strlen(PC_SUFFIX);
+    if (name.size() <= slen || name.compare(name.size() - slen, slen, PC_SUFFIX))
+      continue;
+    if (stat(path.c_str(), &st))
+      continue;
+    PCFileInfo info;
+    info.mPath = path;
+    info.mSize = st.st_size;
+    info.mTime = st.st_mtim;
+    files.push_back(info);
+    total += info.mSize;
+  }
+  closedir(d);
+
+  if (!evict || total <= mMaxBytes)
+    return total;
+
+  std::sort(files.begin(), files.end(), PCOlder);
+  unsigned long long target = mMaxBytes / 10 * 9;
+  for (unsigned i = 0; i < files.size() && total > target; i++) {
+    // Another process may have removed it already.
+    unlink(files[i].mPath.c_str());
+    total -= files[i].mSize;
+    mEvictions++;
+  }
+  return total;
+}
+
+void ParseCache::Report() {
+  std::lock_guard<std::mutex> lock(mLock);
+  unsigned lookups = mHits + mMisses;
+  double rate = lookups ? (100.0 * mHits / lookups) : 0.0;
+  char buf[32];
+  snprintf(buf, 32, "%.1f%%", rate);
+  std::cout << "Parse cache: " << mHits << " hits, " << mMisses << " misses, hit rate "
+            << buf << ", " << mStores << " stored, " << mEvictions << " evicted, "
+            << mTotalBytes / 1024 << " KB in " << mDir << std::endl;
+}
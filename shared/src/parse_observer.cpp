@@ -0,0 +1,277 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+#include <deque>
+
+#include "parse_observer.h"
+#include "ruletable_util.h"
+
+/////////////////////////////////////////////////////////////////////////////
+//                       ParseTracer
+/////////////////////////////////////////////////////////////////////////////
+
+ParseObserver* ParseTracer::Clone() {
+  ParseTracer *t = new ParseTracer();
+  t->mTable = mTable;
+  t->mLeftRec = mLeftRec;
+  t->mAppeal = mAppeal;
+  t->mFailed = mFailed;
+  t->mVisited = mVisited;
+  t->mSortOut = mSortOut;
+  t->mPatchWasSucc = mPatchWasSucc;
+  return t;
+}
+
+void ParseTracer::DumpIndentation() {
+  for (int i = 0; i < mIndentation; i++)
+    std::cout << " ";
+}
+
+void ParseTracer::DumpSuccTokens() {
+  std::cout << " " << gSuccTokensNum << ": ";
+  for (unsigned i = 0; i < gSuccTokensNum; i++)
+    std::cout << gSuccTokens[i] << ",";
+}
+
+void ParseTracer::DumpEnterTable(const char *name, unsigned token) {
+  DumpIndentation();
+  std::cout << "Enter " << name << "@" << token << "{" << std::endl;
+}
+
+void ParseTracer::DumpExitTable(const char *name, unsigned token, bool succ, AppealStatus reason) {
+  DumpIndentation();
+  std::cout << "Exit  " << name << "@" << token;
+  if (succ) {
+    if (reason == SuccWasSucc)
+      std::cout << " succ@WasSucc" << "}";
+    else if (reason == SuccStillWasSucc)
+      std::cout << " succ@StillWasSucc" << "}";
+    else if (reason == Succ)
+      std::cout << " succ" << "}";
+
+    DumpSuccTokens();
+    std::cout << std::endl;
+  } else {
+    if (reason == FailWasFailed)
+      std::cout << " fail@WasFailed" << "}" << std::endl;
+    else if (reason == FailNotIdentifier)
+      std::cout << " fail@NotIdentifer" << "}" << std::endl;
+    else if (reason == FailNotLiteral)
+      std::cout << " fail@NotLiteral" << "}" << std::endl;
+    else if (reason == FailChildrenFailed)
+      std::cout << " fail@ChildrenFailed" << "}" << std::endl;
+    else if (reason == Fail2ndOf1st)
+      std::cout << " fail@2ndOf1st" << "}" << std::endl;
+    else if (reason == FailLookAhead)
+      std::cout << " fail@LookAhead" << "}" << std::endl;
+    else if (reason == AppealStatus_NA)
+      std::cout << " fail@NA" << "}" << std::endl;
+  }
+}
+
+// The indentation goes with the tables, whether they are traced or not.
+void ParseTracer::EnterTable(RuleTable *t, unsigned token) {
+  mIndentation += 2;
+  if (mTable)
+    DumpEnterTable(GetRuleTableName(t), token);
+}
+
+void ParseTracer::ExitTable(RuleTable *t, unsigned token, bool succ, AppealStatus reason) {
+  if (mTable)
+    DumpExitTable(GetRuleTableName(t), token, succ, reason);
+}
+
+void ParseTracer::EnterToken(Token *t, unsigned token) {
+  mIndentation += 2;
+  if (mTable) {
+    std::string name = "token:";
+    name += t->GetName();
+    DumpEnterTable(name.c_str(), token);
+  }
+}
+
+void ParseTracer::ExitToken(Token *t, unsigned token, bool succ) {
+  if (mTable) {
+    std::string name = "token:";
+    name += t->GetName();
+    if (succ)
+      DumpExitTable(name.c_str(), token, true, Succ);
+    else
+      DumpExitTable(name.c_str(), token, false, AppealStatus_NA);
+  }
+  mIndentation -= 2;
+}
+
+void ParseTracer::MemoHit(RuleTable *t, unsigned token, bool succ) {
+  if (mVisited) {
+    DumpIndentation();
+    std::cout << "Visited " << GetRuleTableName(t) << "@" << token;
+    std::cout << (succ ? " WasSucc" : " WasFailed") << std::endl;
+  }
+}
+
+void ParseTracer::MemoMiss(RuleTable *t, unsigned token) {
+  if (mVisited) {
+    DumpIndentation();
+    std::cout << "Visited " << GetRuleTableName(t) << "@" << token << " New" << std::endl;
+  }
+}
+
+void ParseTracer::AddFailed(RuleTable *t, unsigned token) {
+  if (mFailed) {
+    DumpIndentation();
+    std::cout << "AddFailed " << GetRuleTableName(t) << "@" << token << std::endl;
+  }
+}
+
+void ParseTracer::RetryWasSucc(RuleTable *t, unsigned token) {
+  if (mTable) {
+    DumpIndentation();
+    std::cout << "Traverse-Pre WasSucc, mCurToken:" << token;
+    std::cout << std::endl;
+  }
+}
+
+void ParseTracer::Appeal(RuleTable *t, unsigned token) {
+  if (mAppeal) {
+    for (int i = 0; i < mIndentation + 2; i++)
+      std::cout << " ";
+    std::cout << "!!Reset the Failed flag of " << GetRuleTableName(t) << " @" << token << std::endl;
+  }
+}
+
+void ParseTracer::EnterLeadNode(RuleTable *t, AppealNode *n, unsigned group) {
+  if (mLeftRec) {
+    DumpIndentation();
+    std::cout << "<LR>: Enter LeadNode " << GetRuleTableName(t)
+      << "@" << n->GetStartIndex() << " node:" << n;
+    std::cout << " group id:" << group << std::endl;
+  }
+}
+
+void ParseTracer::ExitLeadNode(RuleTable *t, AppealNode *n) {
+  if (mLeftRec) {
+    DumpIndentation();
+    std::cout << "<LR>: Exit LeadNode " << GetRuleTableName(t);
+    if (n->IsSucc())
+      std::cout << " succ longest match@" << n->LongestMatch() << std::endl;
+    else
+      std::cout << " fail" << std::endl;
+  }
+}
+
+// The exit of the table is dumped by ExitTable().
+void ParseTracer::ExitOtherLeadNode(RuleTable *t) {
+  if (mTable) {
+    DumpIndentation();
+    std::cout << "<LR>: Exit Other LeadNode " << GetRuleTableName(t) << std::endl;
+  }
+}
+
+void ParseTracer::ConnectPrevious(RuleTable *t, AppealNode *n) {
+  if (mLeftRec) {
+    DumpIndentation();
+    std::cout << "<LR>: ConnectPrevious " << GetRuleTableName(t)
+              << "@" << n->GetStartIndex()
+              << " node:" << n << std::endl;
+  }
+}
+
+void ParseTracer::WaveInstance(AppealNode *lead, bool first) {
+  if (mLeftRec) {
+    DumpIndentation();
+    if (first)
+      std::cout << "<LR>: FirstInstance " << lead << std::endl;
+    else
+      std::cout << "<LR>: RestInstance " << lead << std::endl;
+  }
+}
+
+void ParseTracer::FixedPoint(AppealNode *lead) {
+  if (mLeftRec) {
+    DumpIndentation();
+    std::cout << "<LR>: Fake Succ. Fixed Point." << std::endl;
+  }
+}
+
+void ParseTracer::PatchRound(unsigned round) {
+  if (mPatchWasSucc)
+    std::cout << "=== In round " << round << std::endl;
+}
+
+void ParseTracer::FoundWasSucc(AppealNode *n) {
+  if (mPatchWasSucc)
+    std::cout << "Find WasSucc " << n << std::endl;
+}
+
+void ParseTracer::FoundPatch(AppealNode *n) {
+  if (mPatchWasSucc)
+    std::cout << "Find one match " << n << std::endl;
+}
+
+// Dump the result after SortOut. We should see a tree with root being one of the
+// top rules. We ignore mRootNode since it's just a fake one.
+
+static thread_local std::deque<AppealNode *> to_be_dumped;
+static thread_local std::deque<unsigned> to_be_dumped_id;
+static thread_local unsigned seq_num = 1;
+
+// 'root' cannot be mRootNode which is just a fake node.
+void ParseTracer::SortOut(AppealNode *root, const char *phase) {
+  if (!mSortOut)
+    return;
+
+  std::cout << "======= " << phase << " Dump SortOut =======" << std::endl;
+  // we start from the only child of mRootNode.
+  to_be_dumped.clear();
+  to_be_dumped_id.clear();
+  seq_num = 1;
+
+  to_be_dumped.push_back(root);
+  to_be_dumped_id.push_back(seq_num++);
+
+  while(!to_be_dumped.empty()) {
+    AppealNode *node = to_be_dumped.front();
+    to_be_dumped.pop_front();
+    DumpSortOutNode(node);
+  }
+}
+
+void ParseTracer::DumpSortOutNode(AppealNode *n) {
+  unsigned dump_id = to_be_dumped_id.front();
+  to_be_dumped_id.pop_front();
+
+  if (n->mSimplifiedIndex > 0)
+    std::cout << "[" << dump_id << ":" << n->mSimplifiedIndex<< "] ";
+  else
+    std::cout << "[" << dump_id << "] ";
+  if (n->IsToken()) {
+    std::cout << "Token" << std::endl;
+  } else {
+    RuleTable *t = n->GetTable();
+    std::cout << "Table " << GetRuleTableName(t) << "@" << n->GetStartIndex() << ": ";
+
+    if (n->mAfter == SuccWasSucc)
+      std::cout << "WasSucc";
+
+    std::vector<AppealNode*>::iterator it = n->mSortedChildren.begin();
+    for (; it != n->mSortedChildren.end(); it++) {
+      std::cout << seq_num << ",";
+      to_be_dumped.push_back(*it);
+      to_be_dumped_id.push_back(seq_num++);
+    }
+    std::cout << std::endl;
+  }
+}
@@ -0,0 +1,346 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <deque>
+
+#include "parse_server.h"
+#include "stringpool.h"
+#include "frontend.h"
+#include "work_pool.h"
+#include "massert.h"
+
+struct ServerRequest {
+  std::string mFormat;
+  std::string mName;
+  std::string mSource;   // for 'buffer'
+  bool        mFromFile;
+  std::string mStatus;
+  std::string mPayload;
+  bool        mDone;
+
+  ServerRequest() : mFromFile(false), mDone(false) {}
+};
+
+// The requests of a client are answered in the order they come, by a writer
+// thread of the client.
+struct ServerClient {
+  int                        mIn;
+  int                        mOut;
+  char                       mBuf[4096];
+  unsigned                   mBufPos;
+  unsigned                   mBufEnd;
+  bool                       mBroken;    // writing to mOut failed.
+
+  std::deque<ServerRequest*> mRequests;
+  bool                       mEnd;       // no more requests.
+  std::mutex                 mLock;
+  std::condition_variable    mCond;      // a request is added, done, or mEnd.
+
+  ServerClient(int in, int out) : mIn(in), mOut(out), mBufPos(0), mBufEnd(0),
+                                  mBroken(false), mEnd(false) {}
+
+  bool Fill();
+  bool ReadLine(std::string &line);
+  bool ReadBytes(size_t size, std::string &out);
+  bool Write(const char *data, size_t size);
+};
+
+bool ServerClient::Fill() {
+  while (true) {
+    ssize_t n = read(mIn, mBuf, sizeof(mBuf));
+    if (n > 0) {
+      mBufPos = 0;
+      mBufEnd = n;
+      return true;
+    }
+    if (n < 0 && errno == EINTR)
+      continue;
+    return false;
+  }
+}
+
+// Returns false at the end of input. The '\n' is not in 'line'.
+bool ServerClient::ReadLine(std::string &line) {
+  line.clear();
+  while (true) {
+    if (mBufPos == mBufEnd && !Fill())
+      return !line.empty();
+    char *start = mBuf + mBufPos;
+    char *nl = (char*)memchr(start, '\n', mBufEnd - mBufPos);
+    if (nl) {
+      line.append(start, nl - start);
+      mBufPos += nl - start + 1;
+      return true;
+    }
+    line.append(start, mBufEnd - mBufPos);
+    mBufPos = mBufEnd;
+  }
+}
+
+bool ServerClient::ReadBytes(size_t size, std::string &out) {
+  out.clear();
+  out.reserve(size);
+  while (out.size() < size) {
+    if (mBufPos == mBufEnd && !Fill())
+      return false;
+    size_t n = mBufEnd - mBufPos;
+    if (n > size - out.size())
+      n = size - out.size();
+    out.append(mBuf + mBufPos, n);
+    mBufPos += n;
+  }
+  return true;
+}
+
+// A client closing its end must not kill the server by SIGPIPE, so sockets
+// are written with MSG_NOSIGNAL.
+bool ServerClient::Write(const char *data, size_t size) {
+  while (size) {
+    ssize_t n = send(mOut, data, size, MSG_NOSIGNAL);
+    if (n < 0 && errno == ENOTSOCK)
+      n = write(mOut, data, size);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    data += n;
+    size -= n;
+  }
+  return true;
+}
+
+ParseServer::ParseServer(unsigned jobs, unsigned queue_size) {
+  FrontEnd::Init();
+  mPool = new WorkPool(jobs);
+  mQueueSize = queue_size ? queue_size : 1;
+  mInFlight = 0;
+  mListenFd = -1;
+  mShutdown = false;
+}
+
+ParseServer::~ParseServer() {
+  delete mPool;
+}
+
+void ParseServer::AcquireSlot() {
+  std::unique_lock<std::mutex> lock(mLock);
+  mSlotCond.wait(lock, [this]() {return mInFlight < mQueueSize;});
+  mInFlight++;
+}
+
+void ParseServer::ReleaseSlot() {
+  std::lock_guard<std::mutex> lock(mLock);
+  mInFlight--;
+  mSlotCond.notify_one();
+}
+
+// Returns false at the end of input, 'quit' or 'shutdown'. A bad request
+// is returned with mStatus 'error' and done.
+bool ParseServer::ReadRequest(ServerClient *client, ServerRequest *req) {
+  std::string line;
+  if (!client->ReadLine(line))
+    return false;
+  if (!line.empty() && line[line.size() - 1] == '\r')
+    line.erase(line.size() - 1);
+
+  if (line == "quit")
+    return false;
+  if (line == "shutdown") {
+    mShutdown = true;
+    if (mListenFd >= 0)
+      shutdown(mListenFd, SHUT_RDWR);
+    return false;
+  }
+
+  size_t sp1 = line.find(' ');
+  size_t sp2 = sp1 == std::string::npos ? sp1 : line.find(' ', sp1 + 1);
+  std::string cmd = line.substr(0, sp1);
+  if (sp2 != std::string::npos) {
+    req->mFormat = line.substr(sp1 + 1, sp2 - sp1 - 1);
+    req->mName = line.substr(sp2 + 1);
+  }
+
+  if (req->mFormat != "dump" && req->mFormat != "ast" && req->mFormat != "validate") {
+    req->mPayload = "bad request: " + line;
+  } else if (cmd == "parse" && !req->mName.empty()) {
+    req->mFromFile = true;
+    return true;
+  } else if (cmd == "buffer") {
+    // The name follows the size.
+    char *end = NULL;
+    unsigned long long size = strtoull(req->mName.c_str(), &end, 10);
+    if (end != req->mName.c_str() && *end == ' ' && end[1]) {
+      req->mName = end + 1;
+      if (!client->ReadBytes(size, req->mSource))
+        return false;
+      return true;
+    }
+    req->mPayload = "bad request: " + line;
+  } else {
+    req->mPayload = "bad request: " + line;
+  }
+
+  req->mStatus = "error";
+  req->mDone = true;
+  return true;
+}
+
+void ParseServer::Process(ServerRequest *req) {
+  // The strings of the request are freed with its result.
+  LocalStringPool strings;
+  ParseOptions opts;
+  opts.mValidateOnly = (req->mFormat == "validate");
+  opts.mBudget = mBudget;
+
+  ParseResult *result;
+  if (req->mFromFile) {
+    result = FrontEnd::ParseFile(req->mName.c_str(), opts);
+  } else {
+    result = FrontEnd::Parse(req->mName.c_str(), req->mSource.data(),
+                             req->mSource.size(), opts);
+    std::string().swap(req->mSource);
+  }
+
+  if (!result) {
+    req->mStatus = "error";
+    req->mPayload = "cannot read " + req->mName;
+    return;
+  }
+
+  req->mStatus = result->IsSucc() ? "ok" : "fail";
+  if (req->mFormat == "dump") {
+    result->Dump(req->mPayload);
+  } else if (req->mFormat == "ast") {
+    if (!result->WriteBinary(req->mPayload)) {
+      req->mStatus = "error";
+      req->mPayload = "AST is too big";
+    }
+  } else if (!result->IsSucc() && *result->GetBudgetError()) {
+    req->mPayload = result->GetBudgetError();
+  } else if (!result->IsSucc()) {
+    req->mPayload = "at token " + std::to_string(result->GetFurthestToken()) +
+                    " '" + result->GetFurthestTokenName() + "'";
+  }
+  delete result;
+}
+
+void ParseServer::WriterLoop(ServerClient *client) {
+  while (true) {
+    ServerRequest *req;
+    {
+      std::unique_lock<std::mutex> lock(client->mLock);
+      client->mCond.wait(lock, [client]() {
+        return client->mRequests.empty() ? client->mEnd : client->mRequests.front()->mDone;
+      });
+      if (client->mRequests.empty())
+        break;
+      req = client->mRequests.front();
+      client->mRequests.pop_front();
+    }
+
+    if (!client->mBroken) {
+      std::string head = req->mStatus + " " + std::to_string(req->mPayload.size()) + "\n";
+      if (!client->Write(head.data(), head.size()) ||
+          !client->Write(req->mPayload.data(), req->mPayload.size()))
+        client->mBroken = true;
+    }
+    delete req;
+    ReleaseSlot();
+  }
+}
+
+void ParseServer::Serve(int in, int out) {
+  ServerClient client(in, out);
+  std::thread writer(&ParseServer::WriterLoop, this, &client);
+
+  while (true) {
+    ServerRequest *req = new ServerRequest();
+    if (!ReadRequest(&client, req)) {
+      delete req;
+      break;
+    }
+
+    AcquireSlot();
+    std::lock_guard<std::mutex> lock(client.mLock);
+    client.mRequests.push_back(req);
+    if (req->mDone) {
+      client.mCond.notify_all();
+      continue;
+    }
+    ServerClient *c = &client;
+    mPool->Submit([this, req, c]() {
+      Process(req);
+      // Notify while holding the lock, since 'c' is gone once the writer
+      // sees the last request done.
+      std::lock_guard<std::mutex> lock(c->mLock);
+      req->mDone = true;
+      c->mCond.notify_all();
+    });
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(client.mLock);
+    client.mEnd = true;
+    client.mCond.notify_all();
+  }
+  writer.join();
+}
+
+bool ParseServer::ServeSocket(const char *path) {
+  struct sockaddr_un addr;
+  if (strlen(path) >= sizeof(addr.sun_path))
+    return false;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, path);
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0)
+    return false;
+  unlink(path);
+  if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) || listen(fd, 64)) {
+    close(fd);
+    return false;
+  }
+
+  mListenFd = fd;
+  std::vector<std::thread> clients;
+  while (!mShutdown) {
+    int c = accept(fd, NULL, NULL);
+    if (c < 0) {
+      if (errno == EINTR)
+        continue;
+      break;
+    }
+    clients.push_back(std::thread([this, c]() {
+      Serve(c, c);
+      close(c);
+    }));
+  }
+
+  for (unsigned i = 0; i < clients.size(); i++)
+    clients[i].join();
+  mListenFd = -1;
+  close(fd);
+  unlink(path);
+  return true;
+}
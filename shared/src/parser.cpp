@@ -28,6 +28,8 @@
 #include "ast.h"
 #include "ast_builder.h"
 #include "parser_rec.h"
+#include "parse_observer.h"
+#include "timeline.h"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                   Top Issues in Parsing System
@@ -204,33 +206,96 @@
 // the SortOut process.
 //////////////////////////////////////////////////////////////////////////////////
 
-Parser::Parser(const char *name) : filename(name) {
+Parser::Parser(const char *name) : filename(name), mActiveTokens(mOwnTokens) {
   mLexer = new Lexer();
   const std::string file(name);
 
   gModule.SetFileName(name);
   mLexer->PrepareForFile(file);
+  Init();
+}
+
+// Parse the source in memory. 'name' is only the name of module, and the
+// file is never opened.
+Parser::Parser(const char *name, const std::string &src)
+  : filename(name), mActiveTokens(mOwnTokens) {
+  mLexer = new Lexer();
+  gModule.SetFileName(name);
+  mLexer->PrepareForString(src);
+  Init();
+}
+
+// The state every constructor starts from. They set only what differs after.
+void Parser::Init() {
   mCurToken = 0;
   mPending = 0;
   mEndOfFile = false;
+  mIllegalSyntax = false;
 
-  mTraceTable = false;
-  mTraceLeftRec = false;
-  mTraceAppeal = false;
-  mTraceVisited = false;
-  mTraceFailed = false;
   mTraceTiming = false;
-  mTraceSortOut = false;
   mTraceAstBuild = false;
-  mTracePatchWasSucc = false;
   mTraceWarning = false;
+  mObserver = NULL;
 
-  mIndentation = -2;
   mRoundsOfPatching = 0;
+  mNumAppealNodes = 0;
+  mRootNode = NULL;
+
+  mWorkPool = NULL;
+  mParent = NULL;
+
+  mTokenRing = NULL;
+  mLexThread = NULL;
+  mStopLex = false;
+  mRingDone = false;
+  mRingWaiters = 0;
+
+  mParallelLexer = NULL;
+  mParallelLex = false;
+
+  mIncValid = false;
+  mIncRelexedLines = 0;
+  mIncReparsedTokens = 0;
+  mIncReparsed = 0;
+  mIncReparsedMembers = 0;
+  mIncFindMembers = false;
+  mIncBodyFound = false;
+  mIncLbrace = 0;
+  mIncRbrace = 0;
+
+  mLazy = false;
+  mTopTable = NULL;
+
+  mValidateOnly = false;
+  mFurthestToken = 0;
+
+  mQuiet = false;
+  mRecursionAll = NULL;
+
+  mStreaming = false;
+  mStreamEnd = false;
+  mStreamScanned = 0;
+  mStreamBraces = 0;
+  mStreamParens = 0;
+  mStreamReady = 0;
+  mStreamEmitted = 0;
+
+  InitBudget();
+  mInterpret = false;
 }
 
 Parser::~Parser() {
+  StopLexThread();
+  // Those of the last construct, or of the one failed.
+  ClearAppealNodes();
   delete mLexer;
+  delete mParallelLexer;
+  delete mObserver;
+}
+
+void Parser::SetObserver(ParseObserver *obs) {
+  delete mObserver;
+  mObserver = obs;
 }
 
 void Parser::Dump() {
@@ -244,28 +309,17 @@ void Parser::ClearFailed() {
 // Add one fail case for the table
 void Parser::AddFailed(RuleTable *table, unsigned token) {
   //std::cout << " push " << mCurToken << " from " << table;
-  gFailed[table->mIndex].push_back(token);
+  PARSE_EVENT(mObserver, AddFailed(table, token));
+  gFailed[table->mIndex].insert(token);
 }
 
 // Remove one fail case for the table
 void Parser::ResetFailed(RuleTable *table, unsigned token) {
-  std::vector<unsigned>::iterator it = gFailed[table->mIndex].begin();;
-  for (; it != gFailed[table->mIndex].end(); it++) {
-    if (*it == token)
-      break;
-  }
-
-  if (it != gFailed[table->mIndex].end())
-    gFailed[table->mIndex].erase(it);
+  gFailed[table->mIndex].erase(token);
 }
 
 bool Parser::WasFailed(RuleTable *table, unsigned token) {
-  std::vector<unsigned>::iterator it = gFailed[table->mIndex].begin();
-  for (; it != gFailed[table->mIndex].end(); it++) {
-    if (*it == token)
-      return true;
-  }
-  return false;
+  return gFailed[table->mIndex].count(token);
 }
 
 // Lex all tokens in a line, save to mTokens.
@@ -279,6 +333,14 @@ unsigned Parser::LexOneLine() {
   if (mCurToken < mActiveTokens.size())
     return mActiveTokens.size() - mCurToken;
 
+  // No lexer if all tokens were lexed already, by the parent of a sub
+  // parser, or by the parallel lexer.
+  if (!mLexer)
+    return 0;
+
+  if (mTokenRing)
+    return LexFromRing();
+
   while (!token_num) {
     // read untile end of line
     while (!mLexer->EndOfLine() && !mLexer->EndOfFile()) {
@@ -311,11 +373,131 @@ unsigned Parser::LexOneLine() {
   return token_num;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+//                         Lexing in a separate thread
+//
+// The lexer thread does exactly what LexOneLine() does, but pushes the tokens
+// to the ring instead of mActiveTokens. The tokens are allocated in the token
+// pool of mLexer and are never changed after being pushed, so the ring carries
+// only the pointers. When the ring is full the lexer thread waits, so it
+// never runs too far ahead of the parser.
+//
+// A side waiting on the ring checks it RING_SPINS times, then blocks on
+// mRingCond, so a slow lexer or parser doesn't burn the other core. After a
+// push or pop, a side wakes the other only if it's blocked. The fences make
+// sure that either the waiter sees the change of the ring when it checks
+// the last time, or the other side sees the waiter.
+//////////////////////////////////////////////////////////////////////////////
+
+#define RING_SPINS 256
+
+void Parser::StartLexThread(unsigned ring_size) {
+  MASSERT(!mLexThread && "Lexer thread already started.");
+  MASSERT((mCurToken == mActiveTokens.size()) && "Tokens lexed before lexer thread.");
+  mTokenRing = new SPSCRing<Token*>(ring_size);
+  mStopLex = false;
+  mRingDone = false;
+  mRingWaiters = 0;
+  mLexThread = new std::thread(&Parser::LexThreadLoop, this);
+}
+
+void Parser::WaitRing(const std::function<bool()> &ready) {
+  for (unsigned i = 0; i < RING_SPINS; i++) {
+    if (ready())
+      return;
+  }
+  std::unique_lock<std::mutex> lock(mRingLock);
+  mRingWaiters++;
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  mRingCond.wait(lock, ready);
+  mRingWaiters--;
+}
+
+void Parser::WakeRing() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (mRingWaiters.load(std::memory_order_relaxed)) {
+    std::lock_guard<std::mutex> lock(mRingLock);
+    mRingCond.notify_all();
+  }
+}
+
+// The parser could stop before the end of file, e.g. illegal syntax. The
+// lexer thread could be waiting on a full ring, so tell it to quit.
+void Parser::StopLexThread() {
+  if (!mLexThread)
+    return;
+  mStopLex = true;
+  WakeRing();
+  mLexThread->join();
+  delete mLexThread;
+  delete mTokenRing;
+  mLexThread = NULL;
+  mTokenRing = NULL;
+}
+
+// Returns false if asked to quit.
+bool Parser::PushToRing(Token *t) {
+  bool pushed = mTokenRing->TryPush(t);
+  if (!pushed)
+    WaitRing([&]() {return (pushed = mTokenRing->TryPush(t)) || mStopLex;});
+  if (pushed)
+    WakeRing();
+  return pushed;
+}
+
+void Parser::LexThreadLoop() {
+  TimeSpan span("Lex");
+  while (1) {
+    while (!mLexer->EndOfLine() && !mLexer->EndOfFile()) {
+      Token *t = mLexer->LexToken();
+      MASSERT(t && "Non token got? Problem here!");
+      if (t->IsComment())
+        continue;
+      if (t->IsSeparator() && t->IsWhiteSpace())
+        continue;
+      if (!PushToRing(t))
+        return;
+    }
+    if (mLexer->EndOfFile())
+      break;
+    mLexer->ReadALine();
+  }
+  PushToRing(NULL);
+}
+
+// Wait for at least one token, then take all tokens available in the ring.
+// Returns the number of tokens taken. Returns 0 if EOF.
+unsigned Parser::LexFromRing() {
+  if (mRingDone)
+    return 0;
+
+  Token *t = NULL;
+  if (!mTokenRing->TryPop(t))
+    WaitRing([&]() {return mTokenRing->TryPop(t);});
+
+  unsigned token_num = 0;
+  while (1) {
+    if (!t) {
+      mRingDone = true;
+      break;
+    }
+    mActiveTokens.push_back(t);
+    token_num++;
+    if (!mTokenRing->TryPop(t))
+      break;
+  }
+  // The lexer thread could wait for the room.
+  WakeRing();
+  return token_num;
+}
+
 // Move mCurToken one step. If there is no available in mActiveToken, it reads in a new line.
 // Return true : if success
 //       false : if no more valuable token read, or end of file
 bool Parser::MoveCurToken() {
   mCurToken++;
+  if (mCurToken > mFurthestToken)
+    mFurthestToken = mCurToken;
   if (mCurToken == mActiveTokens.size()) {
     unsigned num = LexOneLine();
     if (!num) {
@@ -326,6 +508,13 @@ bool Parser::MoveCurToken() {
   return true;
 }
 
+// The token where the parsing got stuck if there is illegal syntax.
+const char* Parser::GetFurthestTokenName() {
+  if (mFurthestToken >= mActiveTokens.size())
+    return "end of file";
+  return mActiveTokens[mFurthestToken]->GetName();
+}
+
 Token* Parser::GetActiveToken(unsigned i) {
   if (i >= mActiveTokens.size())
     MASSERT(0 && "mActiveTokens OutOfBound");
@@ -334,16 +523,34 @@ Token* Parser::GetActiveToken(unsigned i) {
 
 bool Parser::Parse() {
   gASTBuilder.SetTrace(mTraceAstBuild);
-  bool succ = false;
-  while (1) {
+
+  // The bodies are found on the tokens of the whole file. The timeline
+  // has the lexing as one phase too, instead of a span per line.
+  if (mLazy || (gTimeline.IsEnabled() && mLexer && !mLexThread))
+    LexAll();
+  if (mLazy)
+    CollapseBodies();
+
+  // The parallel parsing stops at the first illegal syntax, or hands over
+  // the rest of file to the sequential parsing below.
+  if (mWorkPool)
+    ParseParallel();
+
+  bool succ = !mIllegalSyntax;
+  while (succ)
     succ = ParseStmt();
-    if (!succ)
-      break;
-  }
 
-  gModule.Dump();
+  if (mLazy)
+    FinishLazy();
 
-  return succ;
+  if (!mValidateOnly && !mQuiet) {
+    TimeSpan span("Dump");
+    gModule.Dump();
+  }
+
+  // ParseStmt() returns false at both the end of file and illegal syntax.
+  // The whole file is good only if there is no illegal syntax.
+  return !mIllegalSyntax;
 }
 
 // Right now I didn't use mempool yet, will come back.
@@ -355,6 +562,42 @@ void Parser::ClearAppealNodes() {
       delete node;
   }
   mAppealNodes.clear();
+  mFreeNodes.clear();
+  mKeptNodes.clear();
+  mNumAppealNodes = 0;
+}
+
+// A node freed by PopFrame() is reused before a new one is allocated. The
+// reused are still counted by the budget, so a budget stops the traversal
+// at the same place no matter the nodes are reused or not.
+AppealNode* Parser::NewAppealNode() {
+  mNumAppealNodes++;
+  if (!mFreeNodes.empty()) {
+    AppealNode *node = mFreeNodes.back();
+    mFreeNodes.pop_back();
+    node->Reset();
+    return node;
+  }
+  AppealNode *node = new AppealNode();
+  mAppealNodes.push_back(node);
+  return node;
+}
+
+// A validating parser keeps no tree, and the node of a rule table is not
+// referred once its frame is popped, unless 'in_group' the table is in a
+// recursion group. RecursionTraversal keeps the lead nodes and the appeal
+// points, and Appeal() walks the parents from them, which are all in the
+// group. Those are kept until the outermost traversal is finished.
+void Parser::FreeNode(AppealNode *node, bool in_group) {
+  if (in_group)
+    mKeptNodes.push_back(node);
+  else
+    mFreeNodes.push_back(node);
+}
+
+void Parser::FreeKeptNodes() {
+  mFreeNodes.insert(mFreeNodes.end(), mKeptNodes.begin(), mKeptNodes.end());
+  mKeptNodes.clear();
 }
 
 // This is for the appealing of mistaken Fail cases created during the first instance
@@ -380,8 +623,7 @@ void Parser::Appeal(AppealNode *start, AppealNode *root) {
   // So a check for 'node' Not Null is to handle separated trees.
   while(node && (node != root)) {
     if ((node->mAfter == FailChildrenFailed)) {
-      if (mTraceAppeal)
-        DumpAppeal(node->GetTable(), node->GetStartIndex());
+      PARSE_EVENT(mObserver, Appeal(node->GetTable(), node->GetStartIndex()));
       ResetFailed(node->GetTable(), node->GetStartIndex());
     }
     node = node->GetParent();
@@ -394,6 +636,8 @@ void Parser::Appeal(AppealNode *start, AppealNode *root) {
 // in Java/c++, or a function/statement in c/c++. In another word, it's the top
 // level constructs in a compilation unit (aka Module).
 bool Parser::ParseStmt() {
+  TimeSpan span("Construct");
+
   // clear status
   ClearFailed();
   ClearSucc();
@@ -403,8 +647,7 @@ bool Parser::ParseStmt() {
   mPending = 0;
 
   // set the root appealing node
-  mRootNode = new AppealNode();
-  mAppealNodes.push_back(mRootNode);
+  mRootNode = NewAppealNode();
 
   // mActiveTokens contain some un-matched tokens from last time of TraverseStmt(),
   // because at the end of every TraverseStmt() when it finishes its matching it always
@@ -429,23 +672,43 @@ bool Parser::ParseStmt() {
   if (mTraceTiming)
     gettimeofday(&start, NULL);
 
-  bool succ = TraverseStmt();
+  bool succ;
+  {
+    TimeSpan span("Traverse");
+    StartBudget();
+    succ = TraverseStmt();
+  }
   if (mTraceTiming) {
     gettimeofday(&stop, NULL);
     std::cout << "Parse Time: " << (stop.tv_sec - start.tv_sec) * 1000000 + stop.tv_usec - start.tv_usec;
     std::cout << " us" << std::endl;
   }
 
-  // Each top level construct gets a AST tree.
-  if (succ) {
+  // Each top level construct gets a AST tree, unless we only validate.
+  if (succ && !mValidateOnly) {
     if (mTraceTiming)
       gettimeofday(&start, NULL);
 
-    PatchWasSucc(mRootNode->mSortedChildren[0]);
-    SimplifySortedTree();
-    ASTTree *tree = BuildAST();
+    {
+      TimeSpan span("PatchWasSucc");
+      PatchWasSucc(mRootNode->mSortedChildren[0]);
+    }
+    if (mIncFindMembers)
+      IncFindMembers();
+    {
+      TimeSpan span("Simplify");
+      SimplifySortedTree();
+    }
+    ASTTree *tree;
+    {
+      TimeSpan span("BuildAST");
+      tree = BuildAST();
+    }
     if (tree) {
-      gModule.AddTree(tree);
+      if (mParent || mTopTable)
+        mSubTrees.push_back(tree);
+      else
+        gModule.AddTree(tree);
     }
 
     if (mTraceTiming) {
@@ -466,10 +729,21 @@ bool Parser::TraverseStmt() {
   bool succ = false;
 
   // Go through the top level construct, find the right one.
-  for (unsigned i = 0; i < gTopRulesNum; i++){
-    RuleTable *t = gTopRules[i];
+  RuleTable **tops = gTopRules;
+  unsigned tops_num = gTopRulesNum;
+  if (mTopTable) {
+    tops = &mTopTable;
+    tops_num = 1;
+  }
+  for (unsigned i = 0; i < tops_num; i++){
+    RuleTable *t = tops[i];
     mRootNode->ClearChildren();
     succ = TraverseRuleTable(t, mRootNode);
+    // The construct is cut short, no other top rule is tried.
+    if (mBudgetHit != BK_None) {
+      succ = false;
+      break;
+    }
     if (succ) {
       // Need adjust the mCurToken. A rule could try multiple possible
       // children rules, although there is one any only one valid child
@@ -485,81 +759,31 @@ bool Parser::TraverseStmt() {
       mCurToken = topnode->GetMatch(0) + 1;
 
       mRootNode->mAfter = Succ;
-      SortOut();
+      if (!mValidateOnly)
+        SortOut();
       break;
     }
   }
 
-  if (!succ)
-    std::cout << "Illegal syntax detected!" << std::endl;
-  else
+  if (!succ) {
+    mIllegalSyntax = true;
+    if (mBudgetHit != BK_None)
+      ReportBudget();
+    if (!mValidateOnly && !mQuiet)
+      std::cout << "Illegal syntax detected!" << std::endl;
+  } else if (!mValidateOnly && !mQuiet) {
     std::cout << "Matched " << mCurToken << " tokens." << std::endl;
+  }
 
   return succ;
 }
 
-void Parser::DumpAppeal(RuleTable *table, unsigned token) {
-  for (unsigned i = 0; i < mIndentation + 2; i++)
-    std::cout << " ";
-  const char *name = GetRuleTableName(table);
-  std::cout << "!!Reset the Failed flag of " << name << " @" << token << std::endl;
-}
-
-void Parser::DumpIndentation() {
-  for (unsigned i = 0; i < mIndentation; i++)
-    std::cout << " ";
-}
-
-void Parser::DumpEnterTable(const char *table_name, unsigned indent) {
-  for (unsigned i = 0; i < indent; i++)
-    std::cout << " ";
-  std::cout << "Enter " << table_name << "@" << mCurToken << "{" << std::endl;
-}
-
-void Parser::DumpExitTable(const char *table_name, unsigned indent, bool succ, AppealStatus reason) {
-  for (unsigned i = 0; i < indent; i++)
-    std::cout << " ";
-  std::cout << "Exit  " << table_name << "@" << mCurToken;
-  if (succ) {
-    if (reason == SuccWasSucc)
-      std::cout << " succ@WasSucc" << "}";
-    else if (reason == SuccStillWasSucc)
-      std::cout << " succ@StillWasSucc" << "}";
-    else if (reason == Succ)
-      std::cout << " succ" << "}";
-
-    DumpSuccTokens();
-    std::cout << std::endl;
-  } else {
-    if (reason == FailWasFailed)
-      std::cout << " fail@WasFailed" << "}" << std::endl;
-    else if (reason == FailNotIdentifier)
-      std::cout << " fail@NotIdentifer" << "}" << std::endl;
-    else if (reason == FailNotLiteral)
-      std::cout << " fail@NotLiteral" << "}" << std::endl;
-    else if (reason == FailChildrenFailed)
-      std::cout << " fail@ChildrenFailed" << "}" << std::endl;
-    else if (reason == Fail2ndOf1st)
-      std::cout << " fail@2ndOf1st" << "}" << std::endl;
-    else if (reason == FailLookAhead)
-      std::cout << " fail@LookAhead" << "}" << std::endl;
-    else if (reason == AppealStatus_NA)
-      std::cout << " fail@NA" << "}" << std::endl;
-  }
-}
-
 // Please read the comments point 6 at the beginning of this file.
 // We need prepare certain storage for multiple possible matchings. The successful token
 // number could be more than one. I'm using fixed array to save them. If needed to extend
 // in the future, just extend it.
-unsigned gSuccTokensNum;
-unsigned gSuccTokens[MAX_SUCC_TOKENS];
-
-void Parser::DumpSuccTokens() {
-  std::cout << " " << gSuccTokensNum << ": ";
-  for (unsigned i = 0; i < gSuccTokensNum; i++)
-    std::cout << gSuccTokens[i] << ",";
-}
+thread_local unsigned gSuccTokensNum;
+thread_local unsigned gSuccTokens[MAX_SUCC_TOKENS];
 
 // Update gSuccTokens into 'node'.
 void Parser::UpdateSuccInfo(unsigned curr_token, AppealNode *node) {
@@ -567,7 +791,14 @@ void Parser::UpdateSuccInfo(unsigned curr_token, AppealNode *node) {
   RuleTable *rule_table = node->GetTable();
   SuccMatch *succ_match = &gSucc[rule_table->mIndex];
   succ_match->AddStartToken(curr_token);
-  succ_match->AddSuccNode(node);
+  // The succ nodes are used only by PatchWasSucc(). Validating needs only
+  // the matchings.
+  if (mValidateOnly) {
+    for (unsigned i = 0; i < node->GetMatchNum(); i++)
+      succ_match->AddMatch(node->GetMatch(i));
+  } else {
+    succ_match->AddSuccNode(node);
+  }
   for (unsigned i = 0; i < gSuccTokensNum; i++) {
     node->AddMatch(gSuccTokens[i]);
     succ_match->AddMatch(gSuccTokens[i]);
@@ -578,6 +809,8 @@ void Parser::UpdateSuccInfo(unsigned curr_token, AppealNode *node) {
 void Parser::RemoveSuccNode(unsigned curr_token, AppealNode *node) {
   MASSERT(node->IsTable());
   RuleTable *rule_table = node->GetTable();
+  if (mValidateOnly)
+    return;
   SuccMatch *succ_match = &gSucc[rule_table->mIndex];
   MASSERT(succ_match);
   succ_match->GetStartToken(curr_token);
@@ -597,9 +830,6 @@ bool Parser::TraverseRuleTablePre(AppealNode *appeal) {
   unsigned saved_mCurToken = mCurToken;
   bool is_done = false;
   RuleTable *rule_table = appeal->GetTable();
-  const char *name = NULL;
-  if (mTraceTable)
-    name = GetRuleTableName(rule_table);
 
   // Check if it was succ. Set the gSuccTokens/gSuccTokensNum appropriately
   // The longest matching is chosen for the next rule table to match.
@@ -607,6 +837,7 @@ bool Parser::TraverseRuleTablePre(AppealNode *appeal) {
   if (succ) {
     bool was_succ = succ->GetStartToken(mCurToken);
     if (was_succ) {
+      PARSE_EVENT(mObserver, MemoHit(rule_table, mCurToken, true));
       // Those affected by the 1st appearance of 1st instance which returns false.
       // 1stOf1st is not add to WasFail, but those affected will be added to WasFail.
       // The affected can be succ later. So there is possibility both succ and fail
@@ -617,6 +848,11 @@ bool Parser::TraverseRuleTablePre(AppealNode *appeal) {
 
       is_done = succ->IsDone();
 
+      if (OverMatchBudget(succ->GetMatchNum(), rule_table)) {
+        appeal->mAfter = FailChildrenFailed;
+        return true;
+      }
+
       gSuccTokensNum = succ->GetMatchNum();
       for (unsigned i = 0; i < gSuccTokensNum; i++) {
         gSuccTokens[i] = succ->GetOneMatch(i);
@@ -638,8 +874,10 @@ bool Parser::TraverseRuleTablePre(AppealNode *appeal) {
 
   if (WasFailed(rule_table, saved_mCurToken)) {
     appeal->mAfter = FailWasFailed;
-    if (mTraceTable)
-      DumpExitTable(name, mIndentation, false, appeal->mAfter);
+    PARSE_EVENT(mObserver, MemoHit(rule_table, saved_mCurToken, false));
+    PARSE_EVENT(mObserver, ExitTable(rule_table, mCurToken, false, appeal->mAfter));
+  } else if (appeal->mAfter != SuccWasSucc) {
+    PARSE_EVENT(mObserver, MemoMiss(rule_table, saved_mCurToken));
   }
 
   return is_done;
@@ -687,286 +925,25 @@ bool Parser::LookAheadFail(RuleTable *rule_table, unsigned token) {
     return true;
 }
 
-// return true : if the rule_table is matched
-//       false : if faled.
-//
-// [NOTE] About how to move mCurToken
-//        1. TraverseRuleTable will restore the mCurToken if it fails.
-//        2. TraverseRuleTable will let the children's traverse to move mCurToken
-//           if they succeeded.
-//        3. TraverseOneof, TraverseZeroxxxx, TraverseConcatenate follow rule 1&2.
-//        4. TraverseRuleTablePre and TraverseLeadNode both exit early, so they
-//           need follow the rule 1&1 also.
-//        3. TraverseRuleTablePre move mCurToken is succ, and actually it doesn't
-//           touch mCurToken when fail.
-//        4. TraverseLeadNode() also follows the rule 1&2. It moves mCurToken
-//           when succ and restore it when fail.
-bool Parser::TraverseRuleTable(RuleTable *rule_table, AppealNode *parent) {
-  if (mEndOfFile)
-    return false;
-
-  mIndentation += 2;
-  const char *name = NULL;
-  if (mTraceTable) {
-    name = GetRuleTableName(rule_table);
-    DumpEnterTable(name, mIndentation);
-  }
-
-  // set the apppeal node
-  AppealNode *appeal = new AppealNode();
-  mAppealNodes.push_back(appeal);
-  appeal->SetTable(rule_table);
-  appeal->SetStartIndex(mCurToken);
-  appeal->SetParent(parent);
-  parent->AddChild(appeal);
-
-  unsigned saved_mCurToken = mCurToken;
-  bool is_done = TraverseRuleTablePre(appeal);
-
-  unsigned group_id;
-  bool in_group = FindRecursionGroup(rule_table, group_id);
-
-  // 1. In a recursion, a rule could fail in the first a few instances,
-  //    but could match in a later instance. So I need check is_done.
-  // 2. For A not-in-group rule, a WasFailed is a real fail.
-  if (appeal->IsFail() && (!in_group || is_done)) {
-    mIndentation -= 2;
-    return false;
-  }
-
-  if (LookAheadFail(rule_table, saved_mCurToken) &&
-      (rule_table->mType != ET_Zeroormore) &&
-      (rule_table->mType != ET_Zeroorone)) {
-    appeal->mAfter = FailLookAhead;
-    AddFailed(rule_table, saved_mCurToken);
-    if (mTraceTable)
-      DumpExitTable(name, mIndentation, false, appeal->mAfter);
-    mIndentation -= 2;
-    return false;
-  }
-
-  // If the rule is NOT in any recursion group, we simply return the result.
-  // If the rule is done, we also simply return the result.
-  if (appeal->IsSucc()) {
-    if (!in_group || is_done) {
-      if (mTraceTable)
-        DumpExitTable(name, mIndentation, true, appeal->mAfter);
-      mIndentation -= 2;
-      return true;
-    } else {
-      if (mTraceTable) {
-        DumpIndentation();
-        std::cout << "Traverse-Pre WasSucc, mCurToken:" << mCurToken;
-        std::cout << std::endl;
-      }
-    }
-  }
-
-  RecursionTraversal *rec_tra = FindRecStack(group_id, appeal->GetStartIndex());
-
-  // group_id is 0 which is the default value if rule_table is not in a group
-  // Need to reset rec_tra;
-  if (!in_group)
-    rec_tra = NULL;
-
-  // If the rule is already traversed in this iteration(instance), we return the result.
-  if (rec_tra && rec_tra->RecursionNodeVisited(rule_table)) {
-    if (mTraceTable)
-      DumpExitTable(name, mIndentation, true, appeal->mAfter);
-    mIndentation -= 2;
-    return true;
-  }
-
-  // This part is to handle the 2nd appearance of the Rest Instances
-  //
-  // IsSucc() assures it's not 2nd appearance of 1st Instance?
-  // Because the 1st instantce is not done yet and cannot be IsSucc().
-  if (appeal->IsSucc() && mRecursionAll.IsLeadNode(rule_table)) {
-    // If we are entering a lead node which already succssfully matched some
-    // tokens and not IsDone yet, it means we are in second or later instances.
-    // We should find RecursionTraversal for it.
-    MASSERT(rec_tra);
-
-    // Check if it's visited, assure it's 2nd appearance.
-    // There are only two appearances of the Leading rule tables in one single
-    // wave (instance) of the Wavefront traversal, the 1st is not visited, the
-    // 2nd is visited.
-
-    if (rec_tra->LeadNodeVisited(rule_table)) {  
-      if (mTraceLeftRec) {
-        DumpIndentation();
-        std::cout << "<LR>: ConnectPrevious " << GetRuleTableName(rule_table)
-                  << "@" << appeal->GetStartIndex()
-                  << " node:" << appeal << std::endl;
-      }
-      // It will be connect to the previous instance, which have full appeal tree.
-      // WasSucc node is used for succ node which has no full appeal tree. So better
-      // change the status to Succ.
-      appeal->mAfter = Succ;
-      if (mTraceTable)
-        DumpExitTable(name, mIndentation, true, Succ);
-
-      mIndentation -= 2;
-      return rec_tra->ConnectPrevious(appeal);
-    }
-  }
-
-  // This part is to handle a special case: The second appearance in the first instance
-  // (wave) in the Wavefront algorithm. At this moment, the first appearance in this
-  // instance hasn't finished its traversal, so there is no previous succ or fail case.
-  //
-  // We need to simply return false, but we cannot add them to the Fail mapping.
-  if (rec_tra &&
-      rec_tra->GetInstance() == InstanceFirst &&
-      rec_tra->LeadNodeVisited(rule_table)) {
-    rec_tra->AddAppealPoint(appeal);
-    if (mTraceTable)
-      DumpExitTable(name, mIndentation, false, Fail2ndOf1st);
-    mIndentation -= 2;
-    return false;
-  }
-
-  // Restore the mCurToken since TraverseRuleTablePre() update the mCurToken
-  // if succ. And we need use the old mCurToken.
-  mCurToken = saved_mCurToken;
-
-  // Now it's time to do regular traversal on a LeadNode.
-  // The scenarios of LeadNode is one of the below.
-  // 1. The first time we hit the LeadNode
-  // 2. The first time in an instance we hit the LeadNode. It WasSucc, but
-  //    we have to do re-traversal.
-  //
-  // The match info of 'appeal' and its SuccMatch will be updated
-  // inside TraverseLeadNode().
-
-  if (mRecursionAll.IsLeadNode(rule_table)) {
-    bool found = TraverseLeadNode(appeal, parent);
-    if (!found) {
-      appeal->mAfter = FailChildrenFailed;
-      gSuccTokensNum = 0;
-    } else {
-      gSuccTokensNum = appeal->GetMatchNum();
-      for (unsigned i = 0; i < gSuccTokensNum; i++)
-        gSuccTokens[i] = appeal->GetMatch(i);
-    }
-    if (mTraceTable) {
-      const char *name = GetRuleTableName(rule_table);
-      DumpExitTable(name, mIndentation, found, appeal->mAfter);
-    }
-    mIndentation -= 2;
-    return found;
-  }
-
-  // It's a regular (non leadnode) table, either inside or outside of a
-  // recursion, we just need do the regular traversal.
-  // If it's inside a Left Recursion, it will finally goes to that
-  // recursion. I don't need take care here.
-
-  bool matched = TraverseRuleTableRegular(rule_table, appeal);
-  if (rec_tra)
-    rec_tra->AddVisitedRecursionNode(rule_table);
-
-  if (!in_group && matched)
-    SetIsDone(rule_table, saved_mCurToken);
-
-  if (mTraceTable)
-    DumpExitTable(name, mIndentation, matched, appeal->mAfter);
-
-  mIndentation -= 2;
-  return matched;
-}
-
-bool Parser::TraverseRuleTableRegular(RuleTable *rule_table, AppealNode *parent) {
-  bool matched = false;
-  unsigned old_pos = mCurToken;
-  gSuccTokensNum = 0;
-
-  bool was_succ = (parent->mAfter == SuccWasSucc) || (parent->mAfter == SuccStillWasSucc);
-  unsigned match_num = parent->GetMatchNum();
-  unsigned longest_match = 0;
-  if (was_succ)
-    longest_match = parent->LongestMatch();
-
-  // [NOTE] TblLiteral and TblIdentifier don't use the SuccMatch info,
-  //        since it's quite simple, we don't need SuccMatch to reduce
-  //        the traversal time.
-  if ((rule_table == &TblIdentifier))
-    return TraverseIdentifier(rule_table, parent);
-
-  if ((rule_table == &TblLiteral))
-    return TraverseLiteral(rule_table, parent);
-
-  EntryType type = rule_table->mType;
-  switch(type) {
-  case ET_Oneof:
-    matched = TraverseOneof(rule_table, parent);
-    break;
-  case ET_Zeroormore:
-    matched = TraverseZeroormore(rule_table, parent);
-    break;
-  case ET_Zeroorone:
-    matched = TraverseZeroorone(rule_table, parent);
-    break;
-  case ET_Concatenate:
-    matched = TraverseConcatenate(rule_table, parent);
-    break;
-  case ET_Data:
-    matched = TraverseTableData(rule_table->mData, parent);
-    break;
-  case ET_Null:
-  default:
-    break;
-  }
-
-  if(matched) {
-
-    // If parent WasSucc before entering this function, and have the same
-    // or bigger longest match, it's StillWasSucc. Don't need update succinfo.
-
-    unsigned longest = 0;
-    for (unsigned i = 0; i < gSuccTokensNum; i++) {
-      unsigned m = gSuccTokens[i];
-      longest = m > longest ? m : longest;
-    }
-
-    if (!was_succ || (longest > longest_match)) {
-      UpdateSuccInfo(old_pos, parent);
-      parent->mAfter = Succ;
-    } else {
-      parent->mAfter = SuccStillWasSucc;
-    }
-
-    ResetFailed(rule_table, old_pos);
-    return true;
-  } else {
-    parent->mAfter = FailChildrenFailed;
-    mCurToken = old_pos;
-    AddFailed(rule_table, mCurToken);
-    return false;
-  }
-}
-
 bool Parser::TraverseToken(Token *token, AppealNode *parent) {
   Token *curr_token = GetActiveToken(mCurToken);
   bool found = false;
-  mIndentation += 2;
-
-  if (mTraceTable) {
-    std::string name = "token:";
-    name += token->GetName();
-    DumpEnterTable(name.c_str(), mIndentation);
-  }
+  PARSE_EVENT(mObserver, EnterToken(token, mCurToken));
 
   if (token == curr_token) {
-    AppealNode *appeal = new AppealNode();
-    mAppealNodes.push_back(appeal);
-    appeal->mAfter = Succ;
-    appeal->SetToken(curr_token);
-    appeal->SetStartIndex(mCurToken);
-    appeal->AddMatch(mCurToken);
-    appeal->SetParent(parent);
-
-    parent->AddChild(appeal);
+    // Nobody but SortOut looks at a token node, so validating needs none.
+    // It's still counted by the budget.
+    if (!mValidateOnly || parent == mRootNode) {
+      AppealNode *appeal = NewAppealNode();
+      appeal->mAfter = Succ;
+      appeal->SetToken(curr_token);
+      appeal->SetStartIndex(mCurToken);
+      appeal->AddMatch(mCurToken);
+      appeal->SetParent(parent);
+      parent->AddChild(appeal);
+    } else {
+      mNumAppealNodes++;
+    }
 
     found = true;
     gSuccTokensNum = 1;
@@ -974,23 +951,13 @@ bool Parser::TraverseToken(Token *token, AppealNode *parent) {
     MoveCurToken();
   }
 
-  if (mTraceTable) {
-    std::string name = "token:";
-    name += token->GetName();
-    if (found)
-      DumpExitTable(name.c_str(), mIndentation, true, Succ);
-    else
-      DumpExitTable(name.c_str(), mIndentation, false, AppealStatus_NA);
-  }
-
-  mIndentation -= 2;
+  PARSE_EVENT(mObserver, ExitToken(token, mCurToken, found));
   return found;
 }
 
 // Supplemental function invoked when TraverseSpecialToken succeeds.
 // It helps set all the data structures.
 void Parser::TraverseSpecialTableSucc(RuleTable *rule_table, AppealNode *appeal) {
-  const char *name = GetRuleTableName(rule_table);
   Token *curr_token = GetActiveToken(mCurToken);
   gSuccTokensNum = 1;
   gSuccTokens[0] = mCurToken;
@@ -1008,7 +975,6 @@ void Parser::TraverseSpecialTableSucc(RuleTable *rule_table, AppealNode *appeal)
 void Parser::TraverseSpecialTableFail(RuleTable *rule_table,
                                       AppealNode *appeal,
                                       AppealStatus status) {
-  const char *name = GetRuleTableName(rule_table);
   AddFailed(rule_table, mCurToken);
   appeal->mAfter = status;
 }
@@ -1018,7 +984,6 @@ void Parser::TraverseSpecialTableFail(RuleTable *rule_table,
 // or the others where 'appeal' is actually a parent node.
 bool Parser::TraverseLiteral(RuleTable *rule_table, AppealNode *appeal) {
   Token *curr_token = GetActiveToken(mCurToken);
-  const char *name = GetRuleTableName(rule_table);
   bool found = false;
   gSuccTokensNum = 0;
 
@@ -1037,7 +1002,6 @@ bool Parser::TraverseLiteral(RuleTable *rule_table, AppealNode *appeal) {
 // 'appeal' is parent node.
 bool Parser::TraverseIdentifier(RuleTable *rule_table, AppealNode *appeal) {
   Token *curr_token = GetActiveToken(mCurToken);
-  const char *name = GetRuleTableName(rule_table);
   bool found = false;
   gSuccTokensNum = 0;
 
@@ -1051,328 +1015,6 @@ bool Parser::TraverseIdentifier(RuleTable *rule_table, AppealNode *appeal) {
   return found;
 }
 
-
-// It always return true.
-// Moves until hit a NON-target data
-// [Note]
-//   1. Every iteration we go through all table data, and pick the one matching the most tokens.
-//   2. If noone of table data can match, it quit.
-//   3. gSuccTokens and gSuccTokensNum are a little bit complicated. Since Zeroormore can match
-//      any number of tokens it can, the number of matchings will grow each time one instance
-//      is matched.
-//   4. We don't count the 'mCurToken' as a succ matching to return. It means catch 'zero'.
-//      Although 'zero' is a correct matching, it's left to the final parent which should be a
-//      Concatenate node. It's handled in TraverseConcatenate().
-bool Parser::TraverseZeroormore(RuleTable *rule_table, AppealNode *parent) {
-  unsigned saved_mCurToken = mCurToken;
-  gSuccTokensNum = 0;
-
-  MASSERT((rule_table->mNum == 1) && "zeroormore node has more than one elements?");
-  TableData *data = rule_table->mData;
-
-  // prepare the prev_succ_tokens[_num] for the 1st iteration.
-  unsigned prev_succ_tokens_num = 1;
-  unsigned prev_succ_tokens[MAX_SUCC_TOKENS];
-  prev_succ_tokens[0] = mCurToken - 1;
-
-  // Need to avoid duplicated mCurToken. Look at the rule
-  // rule SwitchBlock : '{' + ZEROORMORE(ZEROORMORE(SwitchBlockStatementGroup) + ZEROORMORE(SwitchLabel)) + '}'
-  // The inner "ZEROORMORE(SwitchBlockStatementGroup) + ZEROORMORE(SwitchLabel)" could return multiple
-  // succ matches including the 'zero' match. The next time we go through the outer ZEROORMORE(...) it
-  // could traverse the same mCurToken again, at least 'zero' is always duplicated. This will be
-  // an endless loop.
-  SmallVector<unsigned> visited;
-
-  SmallVector<unsigned> final_succ_tokens;
-
-  while(1) {
-    // A set of results of current instance
-    bool found_subtable = false;
-    unsigned subtable_tokens_num = 0;
-    unsigned subtable_succ_tokens[MAX_SUCC_TOKENS];
-
-    // Like TraverseConcatenate, we will try all good matchings of previous instance.
-    for (unsigned j = 0; j < prev_succ_tokens_num; j++) {
-      mCurToken = prev_succ_tokens[j] + 1;
-      visited.PushBack(prev_succ_tokens[j]);
-
-      bool temp_found = TraverseTableData(data, parent);
-      found_subtable |= temp_found;
-
-      if (temp_found) {
-        for (unsigned id = 0; id < gSuccTokensNum; id++)
-          subtable_succ_tokens[subtable_tokens_num + id] = gSuccTokens[id];
-        subtable_tokens_num += gSuccTokensNum;
-      }
-    }
-
-    // It's possible that sub-table is also a ZEROORxxx, and is succ without
-    // real matching. This will be considered as a STOP.
-    if (found_subtable && (subtable_tokens_num > 0)) {
-      // set final
-      for (unsigned id = 0; id < subtable_tokens_num; id++) {
-        unsigned token = subtable_succ_tokens[id];
-        if (!final_succ_tokens.Find(token))
-          final_succ_tokens.PushBack(token);
-      }
-      // set prev
-      prev_succ_tokens_num = 0;
-      for (unsigned id = 0; id < subtable_tokens_num; id++) {
-        unsigned t = subtable_succ_tokens[id];
-        if (!visited.Find(t))
-          prev_succ_tokens[prev_succ_tokens_num++] = t;
-      }
-    } else {
-      break;
-    }
-  }
-
-  gSuccTokensNum = final_succ_tokens.GetNum();
-  for (unsigned id = 0; id < final_succ_tokens.GetNum(); id++) {
-    unsigned token = final_succ_tokens.ValueAtIndex(id);
-    gSuccTokens[id] = token;
-    // Actually we don't transfer mCurToken to the caller.
-    // We are look into the succ info instead. However, we update mCurToken
-    // here for easy dump info.
-    if (token + 1 > mCurToken)
-      mCurToken = token + 1;
-  }
-
-  if (!gSuccTokensNum)
-    mCurToken = saved_mCurToken;
-
-  return true;
-}
-
-// For Zeroorone node it's easier to handle gSuccTokens(Num). Just let the elements
-// handle themselves.
-bool Parser::TraverseZeroorone(RuleTable *rule_table, AppealNode *parent) {
-  MASSERT((rule_table->mNum == 1) && "zeroormore node has more than one elements?");
-  TableData *data = rule_table->mData;
-  gSuccTokensNum = 0;
-  bool found = TraverseTableData(data, parent);
-  return true;
-}
-
-// 1. Save all the possible matchings from children.
-// 2. As return value we choose the longest matching.
-bool Parser::TraverseOneof(RuleTable *rule_table, AppealNode *parent) {
-  bool found = false;
-  unsigned succ_tokens_num = 0;
-  unsigned succ_tokens[MAX_SUCC_TOKENS];
-  unsigned new_mCurToken = mCurToken; // position after most tokens eaten
-  unsigned old_mCurToken = mCurToken;
-
-  gSuccTokensNum = 0;
-
-  for (unsigned i = 0; i < rule_table->mNum; i++) {
-    TableData *data = rule_table->mData + i;
-    bool temp_found = TraverseTableData(data, parent);
-    found = found | temp_found;
-    if (temp_found) {
-      // 1. Save the possilbe matchings
-      // 2. Remove be duplicated matchings
-      for (unsigned j = 0; j < gSuccTokensNum; j++) {
-        bool duplicated = false;
-        for (unsigned k = 0; k < succ_tokens_num; k++) {
-          if (succ_tokens[k] == gSuccTokens[j]) {
-            duplicated = true;
-            break;
-          }
-        }
-        if (!duplicated)
-          succ_tokens[succ_tokens_num++] = gSuccTokens[j];
-      }
-
-      if (mCurToken > new_mCurToken)
-        new_mCurToken = mCurToken;
-      // Restore the position of original mCurToken.
-      mCurToken = old_mCurToken;
-
-      // Some ONEOF rules can have only children matching current token seq.
-      if (rule_table->mProperties & RP_Single)
-        break;
-    }
-  }
-
-  gSuccTokensNum = succ_tokens_num;
-  for (unsigned k = 0; k < succ_tokens_num; k++)
-    gSuccTokens[k] = succ_tokens[k];
-
-  // move position according to the longest matching
-  mCurToken = new_mCurToken;
-  return found;
-}
-
-//
-// [NOTE] 1. There could be an issue of matching number explosion. Each node could have
-//           multiple matchings, and when they are concatenated the number would be
-//           matchings_1 * matchings_2 * ... This needs to be taken care of since we need
-//           all the possible matches so that later nodes can still have opportunity.
-//        2. Each node will try all starting tokens which are the ending token of previous
-//           node.
-//        3. We need take care of the gSuccTokensNum and gSuccTokens carefully. Eg.
-//           The gSuccTokensNum/gSuccTokens need be taken care in a rule like below
-//              rule AA : BB + CC + ZEROORONE(xxx)
-//           If ZEROORONE(xxx) doesn't match anything, it sets gSuccTokensNum to 0. However
-//           rule AA matches multiple tokens. So gSuccTokensNum needs to be recalculated.
-//        4. We are going to take succ match info from SuccMatch, not from a specific
-//           AppealNode. SuccMatch has the complete info.
-//
-bool Parser::TraverseConcatenate(RuleTable *rule_table, AppealNode *parent) {
-  // Init found to true.
-  bool found = true;
-
-  unsigned prev_succ_tokens_num = 0;
-  unsigned prev_succ_tokens[MAX_SUCC_TOKENS];
-
-  // Final status. It only saves the latest successful status.
-  unsigned final_succ_tokens_num = 0;
-  unsigned final_succ_tokens[MAX_SUCC_TOKENS];
-
-  // Make sure it's 0 when fail and restore mCurToken;
-  gSuccTokensNum = 0;
-  unsigned saved_mCurToken = mCurToken;
-
-  // It's possible last_matched become -1.
-  int last_matched = mCurToken - 1;
-
-  // prepare the prev_succ_tokens[_num] for the 1st iteration.
-  prev_succ_tokens_num = 1;
-  prev_succ_tokens[0] = mCurToken - 1;
-
-  for (unsigned i = 0; i < rule_table->mNum; i++) {
-    bool is_zeroxxx = false;
-    TableData *data = rule_table->mData + i;
-    if (data->mType == DT_Subtable) {
-      RuleTable *zero_rt = data->mData.mEntry;
-      if (zero_rt->mType == ET_Zeroormore || zero_rt->mType == ET_Zeroorone)
-        is_zeroxxx = true;
-    }
-
-    // A set of results of current subtable
-    bool found_subtable = false;
-    unsigned subtable_tokens_num = 0;
-    unsigned subtable_succ_tokens[MAX_SUCC_TOKENS];
-
-    // We will iterate on all previous succ matches.
-    for (unsigned j = 0; j < prev_succ_tokens_num; j++) {
-      unsigned prev = prev_succ_tokens[j];
-      mCurToken = prev + 1;
-
-      bool temp_found = TraverseTableData(data, parent);
-      found_subtable |= temp_found;
-
-      if (temp_found) {
-        bool duplicated_with_prev = false;
-        for (unsigned id = 0; id < gSuccTokensNum; id++) {
-          subtable_succ_tokens[subtable_tokens_num + id] = gSuccTokens[id];
-          if (gSuccTokens[id] == prev)
-            duplicated_with_prev = true;
-        }
-        subtable_tokens_num += gSuccTokensNum;
-
-        // for Zeroorone/Zeroormore node it always returns true. NO matter how
-        // many tokens it really matches, 'zero' is also a correct match. we
-        // need take it into account. [Except it's a duplication]
-        if (is_zeroxxx && !duplicated_with_prev) {
-          subtable_succ_tokens[subtable_tokens_num] = prev;
-          subtable_tokens_num++;
-        }
-      }
-    }
-
-    if (found_subtable) {
-      // ZEROORXXX subtable may match nothing. Although it doesn't move mCurToken,
-      // it does move the rule. It's still a good succ.
-      if (subtable_tokens_num > 0) {
-        // 1. set final
-        final_succ_tokens_num = subtable_tokens_num;
-        for (unsigned id = 0; id < subtable_tokens_num; id++)
-          final_succ_tokens[id] = subtable_succ_tokens[id];
-        // 2. set prev
-        prev_succ_tokens_num = subtable_tokens_num;
-        for (unsigned id = 0; id < subtable_tokens_num; id++)
-          prev_succ_tokens[id] = subtable_succ_tokens[id];
-      }
-    } else {
-      found = false;
-      break;
-    }
-  }
-
-  // Look at this special case, where all children are ZEROORxxx
-  //   rule DimExpr : ZEROORMORE(Annotation) + ZEROORONE(Expression)
-  // It's possible it actually matches nothing, but we fake it as 1 matching
-  // with 'zero' token. This need be adjusted at the end of traversal.
-  if (final_succ_tokens_num == 1) {
-    int compare = final_succ_tokens[0];
-    if (compare == last_matched)
-      found = false;
-  }
-
-  if (found) {
-     // mCurToken doesn't have much meaning in current algorithm when
-     // transfer to the next rule table, because the next rule will take
-     // the succ info and get all matching token of prev, and set them
-     // as the starting mCurToken.
-     //
-     // However, we do set mCurToken to the biggest matching.
-     gSuccTokensNum = final_succ_tokens_num;
-     for (unsigned id = 0; id < final_succ_tokens_num; id++) {
-       unsigned token = final_succ_tokens[id];
-       if (token + 1 > mCurToken)
-         mCurToken = token + 1;
-       gSuccTokens[id] = token;
-     }
-  } else {
-    // Need reset gSuccTokensNum and mCurToken;
-    gSuccTokensNum = 0;
-    mCurToken = saved_mCurToken;
-  }
-
-  return found;
-}
-
-// The mCurToken moves if found target, or restore the original location.
-bool Parser::TraverseTableData(TableData *data, AppealNode *parent) {
-  if (mEndOfFile)
-    return false;
-
-  unsigned old_pos = mCurToken;
-  bool     found = false;
-  Token   *curr_token = GetActiveToken(mCurToken);
-  gSuccTokensNum = 0;
-
-  switch (data->mType) {
-  case DT_Char:
-  case DT_String:
-    //MASSERT(0 && "Hit Char/String in TableData during matching!");
-    //TODO: Need compare literal. But so far looks like it's impossible to
-    //      have a literal token able to match a string/char in rules.
-    break;
-  // separator, operator, keywords are generated as DT_Token.
-  // just need check the pointer of token
-  case DT_Token:
-    found = TraverseToken(&gSystemTokens[data->mData.mTokenId], parent);
-    break;
-  case DT_Type:
-    break;
-  case DT_Subtable: {
-    RuleTable *t = data->mData.mEntry;
-    found = TraverseRuleTable(t, parent);
-    if (!found)
-      mCurToken = old_pos;
-    break;
-  }
-  case DT_Null:
-  default:
-    break;
-  }
-
-  return found;
-}
-
 void Parser::SetIsDone(unsigned group_id, unsigned start_token) {
   Group2Rule g2r = gGroup2Rule[group_id];
   for (unsigned i = 0; i < g2r.mNum; i++) {
@@ -1424,9 +1066,11 @@ void Parser::SetIsDone(RuleTable *rt, unsigned start_token) {
 /////////////////////////////////////////////////////////////////////////////
 
 // We don't want to use recursive. So a deque is used here.
-static std::deque<AppealNode*> to_be_sorted;
+static thread_local std::deque<AppealNode*> to_be_sorted;
 
 void Parser::SortOut() {
+  TimeSpan span("SortOut");
+
   // we remove all failed children, leaving only succ child
   std::vector<AppealNode*>::iterator it = mRootNode->mChildren.begin();
   for (; it != mRootNode->mChildren.end(); it++) {
@@ -1461,8 +1105,7 @@ void Parser::SortOut() {
     SortOutNode(node);
   }
 
-  if (mTraceSortOut)
-    DumpSortOut(root, "Main sortout");
+  PARSE_EVENT(mObserver, SortOut(root, "Main sortout"));
 }
 
 // 'node' is already trimmed when passed into this function.
@@ -1496,7 +1139,7 @@ void Parser::SortOutNode(AppealNode *node) {
 
   // The lead node of a traversal group need special solution, if they are
   // simply connect to previous instance(s).
-  if (mRecursionAll.IsLeadNode(rule_table)) {
+  if (mRecursionAll->IsLeadNode(rule_table)) {
     bool connect_only = true;
     std::vector<AppealNode*>::iterator it = node->mChildren.begin();
     for (; it != node->mChildren.end(); it++) {
@@ -1821,58 +1464,6 @@ void Parser::SortOutData(AppealNode *parent) {
   }
 }
 
-// Dump the result after SortOut. We should see a tree with root being one of the
-// top rules. We ignore mRootNode since it's just a fake one.
-
-static std::deque<AppealNode *> to_be_dumped;
-static std::deque<unsigned> to_be_dumped_id;
-static unsigned seq_num = 1;
-
-// 'root' cannot be mRootNode which is just a fake node.
-void Parser::DumpSortOut(AppealNode *root, const char *phase) {
-  std::cout << "======= " << phase << " Dump SortOut =======" << std::endl;
-  // we start from the only child of mRootNode.
-  to_be_dumped.clear();
-  to_be_dumped_id.clear();
-  seq_num = 1;
-
-  to_be_dumped.push_back(root);
-  to_be_dumped_id.push_back(seq_num++);
-
-  while(!to_be_dumped.empty()) {
-    AppealNode *node = to_be_dumped.front();
-    to_be_dumped.pop_front();
-    DumpSortOutNode(node);
-  }
-}
-
-void Parser::DumpSortOutNode(AppealNode *n) {
-  unsigned dump_id = to_be_dumped_id.front();
-  to_be_dumped_id.pop_front();
-
-  if (n->mSimplifiedIndex > 0)
-    std::cout << "[" << dump_id << ":" << n->mSimplifiedIndex<< "] ";
-  else
-    std::cout << "[" << dump_id << "] ";
-  if (n->IsToken()) {
-    std::cout << "Token" << std::endl;
-  } else {
-    RuleTable *t = n->GetTable();
-    std::cout << "Table " << GetRuleTableName(t) << "@" << n->GetStartIndex() << ": ";
-
-    if (n->mAfter == SuccWasSucc)
-      std::cout << "WasSucc";
-
-    std::vector<AppealNode*>::iterator it = n->mSortedChildren.begin();
-    for (; it != n->mSortedChildren.end(); it++) {
-      std::cout << seq_num << ",";
-      to_be_dumped.push_back(*it);
-      to_be_dumped_id.push_back(seq_num++);
-    }
-    std::cout << std::endl;
-  }
-}
-
 /////////////////////////////////////////////////////////////////////////////
 //                       Build AST
 /////////////////////////////////////////////////////////////////////////////
@@ -1885,7 +1476,7 @@ void Parser::DumpSortOutNode(AppealNode *n) {
 
 // A appealnode is popped out and create tree node if and only if all its
 // children have been generated a tree node for them.
-static std::vector<AppealNode*> done_nodes;
+static thread_local std::vector<AppealNode*> done_nodes;
 static bool NodeIsDone(AppealNode *n) {
   std::vector<AppealNode*>::const_iterator cit = done_nodes.begin();
   for (; cit != done_nodes.end(); cit++) {
@@ -1895,14 +1486,14 @@ static bool NodeIsDone(AppealNode *n) {
   return false;
 }
 
-static std::vector<AppealNode*> was_succ_list;
+static thread_local std::vector<AppealNode*> was_succ_list;
 
 // The SuccWasSucc node and its patching node is a one-one mapping.
 // We don't use a map to maintain this. We use vectors to do this
 // by adding the pair of nodes at the same time. Their index in the
 // vectors are the same.
-static std::vector<AppealNode*> was_succ_matched_list;
-static std::vector<AppealNode*> patching_list;
+static thread_local std::vector<AppealNode*> was_succ_matched_list;
+static thread_local std::vector<AppealNode*> patching_list;
 
 // Find the nodes which are SuccWasSucc
 void Parser::FindWasSucc(AppealNode *root) {
@@ -1913,8 +1504,7 @@ void Parser::FindWasSucc(AppealNode *root) {
     working_list.pop_front();
     if (node->mAfter == SuccWasSucc) {
       was_succ_list.push_back(node);
-      if (mTracePatchWasSucc)
-        std::cout << "Find WasSucc " << node << std::endl;
+      PARSE_EVENT(mObserver, FoundWasSucc(node));
     } else {
       std::vector<AppealNode*>::iterator it = node->mSortedChildren.begin();
       for (; it != node->mSortedChildren.end(); it++)
@@ -1958,8 +1548,7 @@ void Parser::FindPatchingNodes() {
     }
     MASSERT(youngest && "succ matching node is missing?");
 
-    if (mTracePatchWasSucc)
-      std::cout << "Find one match " << youngest << std::endl;
+    PARSE_EVENT(mObserver, FoundPatch(youngest));
 
     was_succ_matched_list.push_back(was_succ);
     patching_list.push_back(youngest);
@@ -1991,8 +1580,7 @@ void Parser::SupplementalSortOut(AppealNode *root, AppealNode *reference) {
     SortOutNode(node);
   }
 
-  if (mTraceSortOut)
-    DumpSortOut(root, "supplemental sortout");
+  PARSE_EVENT(mObserver, SortOut(root, "supplemental sortout"));
 }
 
 // In the tree after SortOut, some nodes could be SuccWasSucc and we didn't build
@@ -2000,8 +1588,7 @@ void Parser::SupplementalSortOut(AppealNode *root, AppealNode *reference) {
 void Parser::PatchWasSucc(AppealNode *root) {
   while(1) {
     mRoundsOfPatching++;
-    if (mTracePatchWasSucc)
-      std::cout << "=== In round " << mRoundsOfPatching << std::endl;
+    PARSE_EVENT(mObserver, PatchRound(mRoundsOfPatching));
 
     // step 1. Traverse the sorted tree, find the target node which is SuccWasSucc
     was_succ_list.clear();
@@ -2034,8 +1621,7 @@ void Parser::PatchWasSucc(AppealNode *root) {
     }
   }
 
-  if (mTraceSortOut)
-    DumpSortOut(root, "patch-was-succ");
+  PARSE_EVENT(mObserver, SortOut(root, "patch-was-succ"));
 }
 
 // The idea is to make the Sorted tree simplest. After PatchWasSucc(), there are many
@@ -2068,8 +1654,7 @@ void Parser::SimplifySortedTree() {
     }
   }
 
-  if (mTraceSortOut)
-    DumpSortOut(mRootNode->mSortedChildren[0], "Simplify AppealNode Trees");
+  PARSE_EVENT(mObserver, SortOut(mRootNode->mSortedChildren[0], "Simplify AppealNode Trees"));
 }
 
 // Reduce an edge is (1) Pred has only one succ
@@ -2107,7 +1692,7 @@ AppealNode* Parser::SimplifyShrinkEdges(AppealNode *node) {
       RuleTable *rt_p = node->GetTable();
       RuleTable *rt_c = child->GetTable();
       MASSERT((rt_p == rt_c));
-      MASSERT(mRecursionAll.IsLeadNode(rt_p));
+      MASSERT(mRecursionAll->IsLeadNode(rt_p));
     } else {
       // step 3. check condition (3)
       //         [NOTE] in RuleAction, element index starts from 1.
@@ -2169,7 +1754,10 @@ ASTTree* Parser::BuildAST() {
       MASSERT(!appeal_node->GetAstTreeNode());
       TreeNode *sub_tree = tree->NewTreeNode(appeal_node);
       if (sub_tree) {
+        if (mLazy)
+          SetLazyBody(appeal_node, sub_tree);
         appeal_node->SetAstTreeNode(sub_tree);
+        PARSE_EVENT(mObserver, AstNodeBuilt(appeal_node, sub_tree));
         // mRootNode is overwritten each time until the last one which is
         // the real root node.
         tree->mRootNode = sub_tree;
@@ -2194,7 +1782,7 @@ ASTTree* Parser::BuildAST() {
 ////////////////////////////////////////////////////////////////////////////
 
 void Parser::InitRecursion() {
-  mRecursionAll.Init();
+  mRecursionAll = RecursionAll::GetShared();
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -2296,6 +1884,23 @@ bool SuccMatch::IsDone() {
 //            AppealNode function
 ///////////////////////////////////////////////////////////////
 
+void AppealNode::Reset() {
+  mData.mTable = NULL;
+  mParent = NULL;
+  mSecondParents.Clear();
+  mAfter = AppealStatus_NA;
+  mSimplifiedIndex = 0;
+  mIsTable = true;
+  mStartIndex = 0;
+  mSorted = false;
+  mFinalMatch = 0;
+  mIsPseudo = false;
+  mAstTreeNode = NULL;
+  mMatches.Clear();
+  mChildren.clear();
+  mSortedChildren.clear();
+}
+
 void AppealNode::AddParent(AppealNode *p) {
   if (!mParent || mParent->IsPseudo())
     mParent = p;
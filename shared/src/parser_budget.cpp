@@ -0,0 +1,170 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the budgets of parsing a top level construct.
+//
+// The traversal tries all the matchings of each rule table, and the number
+// of them could explode on a pathological input. The budgets bound the work
+// of one construct, so a batch job has a predictable worst case.
+//
+// 1. AppealNodes. mNumAppealNodes counts the nodes of the construct, also
+//    those a validating parser reuses or doesn't allocate. The
+//    memo lookups of a table and the search of the recursion traversals
+//    don't grow with the depth of nesting, so the time goes along with the
+//    nodes. Still only the time budget is a hard bound.
+// 2. Waves. Each instance of a RecursionTraversal is a wave.
+// 3. Matches. The matchings of a rule table at a token are saved in fixed
+//    arrays of MAX_SUCC_TOKENS. This budget is always on, with the array size
+//    as the default, so a big match set is a diagnostic instead of a smashed
+//    stack.
+// 4. Time. The clock is read every BUDGET_TICKS rule tables.
+//
+// Once a budget is exceeded, TraverseRuleTable() fails right away. The
+// traversal unwinds quickly since every table fails, and TraverseStmt()
+// reports the construct as illegal. The tables are checked only at the entry
+// of TraverseRuleTable(), the other budgets are checked where the number
+// grows.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <sstream>
+
+#include "parser.h"
+#include "massert.h"
+
+#define BUDGET_TICKS 1024
+
+static const char* BudgetName(BudgetKind k) {
+  switch (k) {
+  case BK_AppealNodes: return "AppealNodes";
+  case BK_Waves:       return "waves";
+  case BK_Matches:     return "matches";
+  case BK_Time:        return "ms";
+  default:             return "none";
+  }
+}
+
+void Parser::InitBudget() {
+  mBudget = ParseBudget();
+  mBudgetOn = false;
+  mMatchLimit = MAX_SUCC_TOKENS;
+  mBudgetHit = BK_None;
+  mBudgetTable = NULL;
+  mBudgetToken = 0;
+  mBudgetStartToken = 0;
+  mWaves = 0;
+  mBudgetTicks = 0;
+}
+
+void Parser::SetBudget(const ParseBudget &b) {
+  mBudget = b;
+  mMatchLimit = MAX_SUCC_TOKENS;
+  if (b.mMatches && b.mMatches < MAX_SUCC_TOKENS)
+    mMatchLimit = b.mMatches;
+}
+
+// Called before the traversal of each top level construct.
+void Parser::StartBudget() {
+  mBudgetOn = mBudget.mAppealNodes || mBudget.mWaves || mBudget.mMillis;
+  mBudgetHit = BK_None;
+  mBudgetTable = NULL;
+  mBudgetStartToken = mCurToken;
+  mWaves = 0;
+  mBudgetTicks = 0;
+  mBudgetError.clear();
+  if (mBudget.mMillis)
+    mBudgetStart = std::chrono::steady_clock::now();
+}
+
+void Parser::ExceedBudget(BudgetKind k, RuleTable *t) {
+  if (mBudgetHit != BK_None)
+    return;
+  mBudgetHit = k;
+  mBudgetTable = t;
+  mBudgetToken = mCurToken;
+  // Every table fails from now on.
+  mBudgetOn = true;
+}
+
+// Returns true if the traversal of 't' should fail because of the budgets.
+bool Parser::CheckBudget(RuleTable *t) {
+  if (mBudgetHit != BK_None)
+    return true;
+
+  if (mBudget.mAppealNodes && mNumAppealNodes >= mBudget.mAppealNodes) {
+    ExceedBudget(BK_AppealNodes, t);
+    return true;
+  }
+
+  if (mBudget.mMillis && ++mBudgetTicks >= BUDGET_TICKS) {
+    mBudgetTicks = 0;
+    std::chrono::steady_clock::duration d = std::chrono::steady_clock::now() - mBudgetStart;
+    if (std::chrono::duration_cast<std::chrono::milliseconds>(d).count() >= mBudget.mMillis) {
+      ExceedBudget(BK_Time, t);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Returns true if a match set of 'num' of 't' is too big. The caller must
+// not save it.
+bool Parser::OverMatchBudget(unsigned num, RuleTable *t) {
+  if (num <= mMatchLimit)
+    return false;
+  ExceedBudget(BK_Matches, t);
+  return true;
+}
+
+// A new wave of the recursion traversal of 't'. Returns false if it's
+// over the budget.
+bool Parser::AddWave(RuleTable *t) {
+  if (mBudgetHit != BK_None)
+    return false;
+  mWaves++;
+  if (mBudget.mWaves && mWaves > mBudget.mWaves) {
+    ExceedBudget(BK_Waves, t);
+    return false;
+  }
+  return true;
+}
+
+void Parser::ReportBudget() {
+  MASSERT(mBudgetHit != BK_None);
+  unsigned limit = 0;
+  switch (mBudgetHit) {
+  case BK_AppealNodes: limit = mBudget.mAppealNodes; break;
+  case BK_Waves:       limit = mBudget.mWaves; break;
+  case BK_Matches:     limit = mMatchLimit; break;
+  case BK_Time:        limit = mBudget.mMillis; break;
+  default: break;
+  }
+
+  std::ostringstream os;
+  os << "Budget exceeded: " << limit << " " << BudgetName(mBudgetHit);
+  if (mBudgetTable)
+    os << " in rule " << GetRuleTableName(mBudgetTable);
+  os << " at token " << mBudgetToken;
+  if (mBudgetToken < mActiveTokens.size())
+    os << " '" << mActiveTokens[mBudgetToken]->GetName() << "'";
+  os << ", construct from token " << mBudgetStartToken;
+  if (mBudgetStartToken < mActiveTokens.size())
+    os << " '" << mActiveTokens[mBudgetStartToken]->GetName() << "'";
+  mBudgetError = os.str();
+
+  if (!mQuiet)
+    std::cout << mBudgetError << std::endl;
+}
@@ -0,0 +1,1051 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the traversal engine of rule tables.
+//
+// The traversal goes down one rule table for each level of the grammar. A
+// deep input, like a long chain of 'else if' or nested array initializers,
+// could go down thousands of levels. Instead of recursive calls on the native
+// stack, each rule table being traversed is a TravFrame in Parser::mFrames,
+// and the engine runs the top frame until mFrames is back to where it started.
+//
+// There are three kinds of frames.
+// 1. TF_Table is TraverseRuleTable(). It checks the memo by
+//    TraverseRuleTablePre(), and handles the appearances of LeadNodes.
+// 2. TF_LeadNode is the Wavefront traversal of a recursion group, from the
+//    first time a LeadNode is hit. Each instance is a TF_Regular frame of the
+//    LeadNode. See RecursionTraversal.
+// 3. TF_Regular traverses a rule table by its EntryType. The loops of Oneof,
+//    Zeroormore and Concatenate are kept in the frame. A token is matched in
+//    place, and a sub table pushes a TF_Table frame. A rule table of tokens
+//    only is done by its compiled function if there is one.
+//
+// A frame is suspended when it pushes a child frame, with mState telling
+// where to resume. The child pops itself and leaves its result in
+// mFrameResult.
+//
+// The matchings a frame collects are not arrays of MAX_SUCC_TOKENS in the
+// frame, but in Parser::mMatchStack. The sets of a frame start at mBase, and
+// the one growing is always at the top, since the frames above are popped
+// before it grows. So a frame is small and the match sets take only what
+// they hold.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <algorithm>
+
+#include "parser.h"
+#include "parser_rec.h"
+#include "massert.h"
+#include "token.h"
+#include "common_header_autogen.h"
+#include "ruletable_util.h"
+#include "gen_summary.h"
+#include "gen_token.h"
+#include "parse_observer.h"
+
+// Where a frame resumes.
+enum TableState {
+  TS_Enter,
+  TS_AfterLeadNode,
+  TS_AfterRegular
+};
+
+enum LeadNodeState {
+  LS_Enter,
+  LS_OtherLeadNode,   // A LeadNode other than the one starting the traversal.
+  LS_FirstInstance,
+  LS_RestInstance
+};
+
+enum RegularState {
+  RS_Enter,
+  RS_Data,
+  RS_Zeroorone,
+  RS_Oneof,
+  RS_Zeroormore,
+  RS_Concatenate
+};
+
+void Parser::PushFrame(TravFrameKind kind, RuleTable *t, AppealNode *node, AppealNode *parent) {
+  mFrames.push_back(TravFrame());
+  TravFrame &f = mFrames.back();
+  f.mKind = kind;
+  f.mState = 0;
+  f.mTable = t;
+  f.mNode = node;
+  f.mParent = parent;
+  f.mRecTra = NULL;
+  f.mToken = mCurToken;
+  f.mBase = mMatchStack.size();
+}
+
+// [NOTE] A failed rule table restores mCurToken. This is what the caller of
+//        TraverseRuleTable() expects.
+void Parser::PopFrame(bool result) {
+  TravFrame &f = mFrames.back();
+  if (f.mKind == TF_Table && !result)
+    mCurToken = f.mToken;
+  if (f.mKind == TF_Table && f.mNode && f.mParent != mRootNode && RecycleNodes())
+    FreeNode(f.mNode, f.mFlag);
+  mMatchStack.resize(f.mBase);
+  mFrames.pop_back();
+  mFrameResult = result;
+}
+
+// return true : if the rule_table is matched
+//       false : if faled.
+//
+// [NOTE] About how to move mCurToken
+//        1. TraverseRuleTable will restore the mCurToken if it fails.
+//        2. TraverseRuleTable will let the children's traverse to move mCurToken
+//           if they succeeded.
+//        3. Oneof, Zeroxxxx, Concatenate follow rule 1&2.
+//        4. TraverseRuleTablePre and the LeadNode both exit early, so they
+//           need follow the rule 1&2 also.
+//        5. TraverseRuleTablePre move mCurToken is succ, and actually it doesn't
+//           touch mCurToken when fail.
+//        6. The LeadNode also follows the rule 1&2. It moves mCurToken
+//           when succ and restore it when fail.
+bool Parser::TraverseRuleTable(RuleTable *rule_table, AppealNode *parent) {
+  unsigned bottom = mFrames.size();
+  PushFrame(TF_Table, rule_table, NULL, parent);
+
+  while (mFrames.size() > bottom) {
+    unsigned top = mFrames.size() - 1;
+    switch (mFrames[top].mKind) {
+    case TF_Table:
+      StepTable(top);
+      break;
+    case TF_LeadNode:
+      StepLeadNode(top);
+      break;
+    case TF_Regular:
+      StepRegular(top);
+      break;
+    default:
+      MASSERT(0 && "Unknown frame kind.");
+      break;
+    }
+  }
+
+  return mFrameResult;
+}
+
+// The TraverseTableData() of the engine. Returns true if 'data' is done, and
+// the result is in 'found'. Otherwise the frame of its rule table is pushed,
+// and the result comes back in mFrameResult.
+//
+// The mCurToken moves if found target, or restore the original location.
+bool Parser::CallTableData(TableData *data, AppealNode *parent, bool &found) {
+  found = false;
+  if (mEndOfFile)
+    return true;
+
+  gSuccTokensNum = 0;
+
+  switch (data->mType) {
+  // separator, operator, keywords are generated as DT_Token.
+  // just need check the pointer of token
+  case DT_Token:
+    found = TraverseToken(&gSystemTokens[data->mData.mTokenId], parent);
+    return true;
+  case DT_Subtable: {
+    // A subtable whose lookahead fails is not entered. StepTable() would fail
+    // it the same way, after an AppealNode and a failed memo entry. See
+    // 'Compiled Rule Tables' below.
+    RuleTable *t = data->mData.mEntry;
+    if (!mInterpret && t->mType != ET_Zeroormore && t->mType != ET_Zeroorone &&
+        LookAheadFail(t, mCurToken))
+      return true;
+    PushFrame(TF_Table, data->mData.mEntry, NULL, parent);
+    return false;
+  }
+  // TODO: Need compare literal for DT_Char and DT_String. But so far looks like
+  //       it's impossible to have a literal token able to match a string/char
+  //       in rules.
+  case DT_Char:
+  case DT_String:
+  case DT_Type:
+  case DT_Null:
+  default:
+    return true;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                       Compiled Rule Tables
+// The functions in gen_match.cpp do the regular traversal of a rule table
+// of tokens only, with the elements unrolled and a Oneof as a switch. They
+// match the tokens by the same TraverseToken(), so the AppealNodes and the
+// matchings are the same as interpreted. The only difference is a token
+// which can't match is not tried, so there is no event of it.
+//
+// A rule table with subtables is not compiled. Its elements are frames of
+// the traversal, which keeps the memo, the recursion groups and the budget
+// out of the native stack, so a compiled one would be the Step functions
+// again. What is compiled in for them is the lookahead of a subtable, which
+// CallTableData() checks before pushing its frame. The Zeroormore and
+// Zeroorone are always entered, as StepTable() doesn't check theirs.
+// Neither is done if mInterpret, and --interpret gives the same output.
+//////////////////////////////////////////////////////////////////////////////
+
+// The same as CallTableData() of a DT_Token.
+bool Parser::MatchToken(unsigned id, AppealNode *parent) {
+  if (mEndOfFile)
+    return false;
+  gSuccTokensNum = 0;
+  return TraverseToken(&gSystemTokens[id], parent);
+}
+
+// The index in gSystemTokens of the current token, or gSystemTokensNum if
+// it's not a system token.
+unsigned Parser::GetCurTokenId() {
+  if (mEndOfFile)
+    return gSystemTokensNum;
+  Token *token = GetActiveToken(mCurToken);
+  if (token < gSystemTokens || token >= gSystemTokens + gSystemTokensNum)
+    return gSystemTokensNum;
+  return token - gSystemTokens;
+}
+
+// The matchings are the 'num' tokens from 'start', as a Zeroormore of a token.
+void Parser::SetMatches(unsigned start, unsigned num) {
+  gSuccTokensNum = num;
+  for (unsigned i = 0; i < num; i++)
+    gSuccTokens[i] = start + i;
+  mCurToken = start + num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                              TF_Table
+//////////////////////////////////////////////////////////////////////////////
+
+void Parser::StepTable(unsigned idx) {
+  TravFrame *f = &mFrames[idx];
+  RuleTable *rule_table = f->mTable;
+  AppealNode *appeal = f->mNode;
+
+  if (f->mState == TS_AfterLeadNode) {
+    bool found = mFrameResult;
+    if (found && OverMatchBudget(appeal->GetMatchNum(), rule_table))
+      found = false;
+    if (!found) {
+      appeal->mAfter = FailChildrenFailed;
+      gSuccTokensNum = 0;
+    } else {
+      gSuccTokensNum = appeal->GetMatchNum();
+      for (unsigned i = 0; i < gSuccTokensNum; i++)
+        gSuccTokens[i] = appeal->GetMatch(i);
+    }
+    PARSE_EVENT(mObserver, ExitTable(rule_table, mCurToken, found, appeal->mAfter));
+    PARSE_EVENT(mObserver, LeaveTable(rule_table));
+    PopFrame(found);
+    return;
+  }
+
+  if (f->mState == TS_AfterRegular) {
+    bool matched = mFrameResult;
+    if (f->mRecTra)
+      f->mRecTra->AddVisitedRecursionNode(rule_table);
+
+    if (!f->mFlag && matched)
+      SetIsDone(rule_table, f->mToken);
+
+    PARSE_EVENT(mObserver, ExitTable(rule_table, mCurToken, matched, appeal->mAfter));
+    PARSE_EVENT(mObserver, LeaveTable(rule_table));
+    PopFrame(matched);
+    return;
+  }
+
+  if (mEndOfFile) {
+    PopFrame(false);
+    return;
+  }
+
+  if (mBudgetOn && CheckBudget(rule_table)) {
+    PopFrame(false);
+    return;
+  }
+
+  PARSE_EVENT(mObserver, EnterTable(rule_table, mCurToken));
+
+  // set the apppeal node
+  AppealNode *parent = f->mParent;
+  appeal = NewAppealNode();
+  appeal->SetTable(rule_table);
+  appeal->SetStartIndex(mCurToken);
+  appeal->SetParent(parent);
+  PARSE_EVENT(mObserver, NewAppealNode(appeal));
+  // The children are used by SortOut only, except those of the root.
+  if (!mValidateOnly || parent == mRootNode)
+    parent->AddChild(appeal);
+  f->mNode = appeal;
+
+  unsigned saved_mCurToken = mCurToken;
+  bool is_done = TraverseRuleTablePre(appeal);
+
+  unsigned group_id;
+  bool in_group = FindRecursionGroup(rule_table, group_id);
+  f->mFlag = in_group;
+
+  // 1. In a recursion, a rule could fail in the first a few instances,
+  //    but could match in a later instance. So I need check is_done.
+  // 2. For A not-in-group rule, a WasFailed is a real fail.
+  if (appeal->IsFail() && (!in_group || is_done)) {
+    PARSE_EVENT(mObserver, LeaveTable(rule_table));
+    PopFrame(false);
+    return;
+  }
+
+  if (LookAheadFail(rule_table, saved_mCurToken) &&
+      (rule_table->mType != ET_Zeroormore) &&
+      (rule_table->mType != ET_Zeroorone)) {
+    appeal->mAfter = FailLookAhead;
+    AddFailed(rule_table, saved_mCurToken);
+    PARSE_EVENT(mObserver, ExitTable(rule_table, mCurToken, false, appeal->mAfter));
+    PARSE_EVENT(mObserver, LeaveTable(rule_table));
+    PopFrame(false);
+    return;
+  }
+
+  // If the rule is NOT in any recursion group, we simply return the result.
+  // If the rule is done, we also simply return the result.
+  if (appeal->IsSucc()) {
+    if (!in_group || is_done) {
+      PARSE_EVENT(mObserver, ExitTable(rule_table, mCurToken, true, appeal->mAfter));
+      PARSE_EVENT(mObserver, LeaveTable(rule_table));
+      PopFrame(true);
+      return;
+    } else {
+      PARSE_EVENT(mObserver, RetryWasSucc(rule_table, mCurToken));
+    }
+  }
+
+  RecursionTraversal *rec_tra = FindRecStack(group_id, appeal->GetStartIndex());
+
+  // group_id is 0 which is the default value if rule_table is not in a group
+  // Need to reset rec_tra;
+  if (!in_group)
+    rec_tra = NULL;
+  f->mRecTra = rec_tra;
+
+  // If the rule is already traversed in this iteration(instance), we return the result.
+  if (rec_tra && rec_tra->RecursionNodeVisited(rule_table)) {
+    PARSE_EVENT(mObserver, ExitTable(rule_table, mCurToken, true, appeal->mAfter));
+    PARSE_EVENT(mObserver, LeaveTable(rule_table));
+    PopFrame(true);
+    return;
+  }
+
+  // This part is to handle the 2nd appearance of the Rest Instances
+  //
+  // IsSucc() assures it's not 2nd appearance of 1st Instance?
+  // Because the 1st instantce is not done yet and cannot be IsSucc().
+  if (appeal->IsSucc() && mRecursionAll->IsLeadNode(rule_table)) {
+    // If we are entering a lead node which already succssfully matched some
+    // tokens and not IsDone yet, it means we are in second or later instances.
+    // We should find RecursionTraversal for it.
+    MASSERT(rec_tra);
+
+    // Check if it's visited, assure it's 2nd appearance.
+    // There are only two appearances of the Leading rule tables in one single
+    // wave (instance) of the Wavefront traversal, the 1st is not visited, the
+    // 2nd is visited.
+
+    if (rec_tra->LeadNodeVisited(rule_table)) {
+      PARSE_EVENT(mObserver, ConnectPrevious(rule_table, appeal));
+      // It will be connect to the previous instance, which have full appeal tree.
+      // WasSucc node is used for succ node which has no full appeal tree. So better
+      // change the status to Succ.
+      appeal->mAfter = Succ;
+      PARSE_EVENT(mObserver, ExitTable(rule_table, mCurToken, true, Succ));
+      PARSE_EVENT(mObserver, LeaveTable(rule_table));
+      PopFrame(rec_tra->ConnectPrevious(appeal));
+      return;
+    }
+  }
+
+  // This part is to handle a special case: The second appearance in the first instance
+  // (wave) in the Wavefront algorithm. At this moment, the first appearance in this
+  // instance hasn't finished its traversal, so there is no previous succ or fail case.
+  //
+  // We need to simply return false, but we cannot add them to the Fail mapping.
+  if (rec_tra &&
+      rec_tra->GetInstance() == InstanceFirst &&
+      rec_tra->LeadNodeVisited(rule_table)) {
+    rec_tra->AddAppealPoint(appeal);
+    PARSE_EVENT(mObserver, ExitTable(rule_table, mCurToken, false, Fail2ndOf1st));
+    PARSE_EVENT(mObserver, LeaveTable(rule_table));
+    PopFrame(false);
+    return;
+  }
+
+  // Restore the mCurToken since TraverseRuleTablePre() update the mCurToken
+  // if succ. And we need use the old mCurToken.
+  mCurToken = saved_mCurToken;
+
+  // Now it's time to do regular traversal on a LeadNode.
+  // The scenarios of LeadNode is one of the below.
+  // 1. The first time we hit the LeadNode
+  // 2. The first time in an instance we hit the LeadNode. It WasSucc, but
+  //    we have to do re-traversal.
+  //
+  // The match info of 'appeal' and its SuccMatch will be updated
+  // inside the TF_LeadNode frame.
+
+  if (mRecursionAll->IsLeadNode(rule_table)) {
+    f->mState = TS_AfterLeadNode;
+    PushFrame(TF_LeadNode, rule_table, appeal, parent);
+    return;
+  }
+
+  // It's a regular (non leadnode) table, either inside or outside of a
+  // recursion, we just need do the regular traversal.
+  // If it's inside a Left Recursion, it will finally goes to that
+  // recursion. I don't need take care here.
+  f->mState = TS_AfterRegular;
+  PushFrame(TF_Regular, rule_table, appeal, NULL);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                              TF_LeadNode
+//
+// We arrive here only when the first time we hit this RecursionGroup because
+// 1. All the 2nd appearance (of all LeadNodes) of all instance is caught by
+//    TF_Table before entering this frame.
+// 2. All the 1st appearance (of the mast LeadNode) of all instances is done by
+//    the instances of this frame.
+//                       --- OR ---
+// we arrive here because it's the first time we hit 'other' LeadNodes
+// of this group.
+//////////////////////////////////////////////////////////////////////////////
+
+void Parser::StepLeadNode(unsigned idx) {
+  TravFrame *f = &mFrames[idx];
+  RuleTable *rt = f->mTable;
+  AppealNode *appeal = f->mNode;
+
+  switch (f->mState) {
+  case LS_OtherLeadNode:
+    // The exit of table is reported in TF_Table.
+    PARSE_EVENT(mObserver, ExitOtherLeadNode(rt));
+    PopFrame(mFrameResult);
+    return;
+
+  case LS_FirstInstance:
+    f->mFound = f->mRecTra->EndFirstInstance(mFrameResult);
+    if (!f->mFound) {
+      FinishLeadNode(idx);
+      return;
+    }
+    break;
+
+  case LS_RestInstance:
+    if (!f->mRecTra->EndRestInstance(mFrameResult)) {
+      FinishLeadNode(idx);
+      return;
+    }
+    break;
+
+  case LS_Enter:
+  default: {
+    unsigned group_id;
+    bool found_group = FindRecursionGroup(rt, group_id);
+    MASSERT(found_group);
+
+    PARSE_EVENT(mObserver, EnterLeadNode(rt, appeal, group_id));
+
+    RecursionTraversal *rec_tra = FindRecStack(group_id, mCurToken);
+
+    // A recurion group could have multiple recursions or multiple LeadNodes.
+    // We could have already rec_tra. In this case, it should be done through
+    // regular traversal
+    if (rec_tra) {
+      MASSERT(rt != rec_tra->GetRuleTable());
+      rec_tra->AddVisitedLeadNode(rt);
+      rec_tra->AddLeadNode(appeal);
+      f->mState = LS_OtherLeadNode;
+      PushFrame(TF_Regular, rt, appeal, NULL);
+      return;
+    }
+
+    rec_tra = new RecursionTraversal(appeal, f->mParent, this);
+    PushRecStack(group_id, rec_tra, mCurToken);
+    f->mRecTra = rec_tra;
+    f->mI = group_id;
+
+    f->mFound = false;
+    if (!AddWave(rt)) {
+      FinishLeadNode(idx);
+      return;
+    }
+    f->mState = LS_FirstInstance;
+    PushFrame(TF_Regular, rt, rec_tra->StartFirstInstance(), NULL);
+    return;
+  }
+  }
+
+  // The last instance is succ, go for the next one.
+  f->mRecTra->NextInstance();
+  if (!AddWave(rt)) {
+    FinishLeadNode(idx);
+    return;
+  }
+  mCurToken = f->mToken;
+  f->mState = LS_RestInstance;
+  PushFrame(TF_Regular, rt, f->mRecTra->StartRestInstance(), NULL);
+}
+
+void Parser::FinishLeadNode(unsigned idx) {
+  TravFrame *f = &mFrames[idx];
+  RecursionTraversal *rec_tra = f->mRecTra;
+  rec_tra->Finish(f->mFound);
+
+  // We only update the mCurToken when succeeds. The restore of mCurToken
+  // when fail is handled by TF_Table.
+  // We pick the longest match rec_tra.
+  bool found = false;
+  if (rec_tra->IsSucc()) {
+    found = true;
+    mCurToken = rec_tra->LongestMatch();
+    MoveCurToken();
+  }
+
+  // The gSuccTokens/Num will be updated in TF_Table.
+  // We don't handle over here.
+
+  PARSE_EVENT(mObserver, ExitLeadNode(f->mTable, f->mNode));
+
+  PopRecStack(f->mI, f->mToken);
+
+  delete rec_tra;
+  if (!mRecStack.GetNum() && RecycleNodes())
+    FreeKeptNodes();
+
+  PopFrame(found);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//                              TF_Regular
+//////////////////////////////////////////////////////////////////////////////
+
+void Parser::StepRegular(unsigned idx) {
+  TravFrame *f = &mFrames[idx];
+  RuleTable *rule_table = f->mTable;
+  AppealNode *parent = f->mNode;
+  bool found;
+
+  switch (f->mState) {
+  case RS_Data:
+    FinishRegular(idx, mFrameResult);
+    return;
+  // Zeroorone always returns true.
+  case RS_Zeroorone:
+    FinishRegular(idx, true);
+    return;
+  case RS_Oneof:
+    StepOneof(idx);
+    return;
+  case RS_Zeroormore:
+    StepZeroormore(idx);
+    return;
+  case RS_Concatenate:
+    StepConcatenate(idx);
+    return;
+  default:
+    break;
+  }
+
+  gSuccTokensNum = 0;
+
+  f->mFlag = (parent->mAfter == SuccWasSucc) || (parent->mAfter == SuccStillWasSucc);
+  f->mLongest = 0;
+  if (f->mFlag)
+    f->mLongest = parent->LongestMatch();
+
+  // [NOTE] TblLiteral and TblIdentifier don't use the SuccMatch info,
+  //        since it's quite simple, we don't need SuccMatch to reduce
+  //        the traversal time.
+  if ((rule_table == &TblIdentifier)) {
+    PopFrame(TraverseIdentifier(rule_table, parent));
+    return;
+  }
+
+  if ((rule_table == &TblLiteral)) {
+    PopFrame(TraverseLiteral(rule_table, parent));
+    return;
+  }
+
+  MatchFunc func = gMatchFuncs[rule_table->mIndex];
+  if (func && !mInterpret) {
+    found = func(this, parent);
+    if (!found)
+      gSuccTokensNum = 0;
+    FinishRegular(idx, found);
+    return;
+  }
+
+  EntryType type = rule_table->mType;
+  switch(type) {
+  case ET_Oneof:
+    StepOneof(idx);
+    break;
+  case ET_Zeroormore:
+    StepZeroormore(idx);
+    break;
+  // For Zeroorone node it's easier to handle gSuccTokens(Num). Just let the elements
+  // handle themselves.
+  case ET_Zeroorone:
+    MASSERT((rule_table->mNum == 1) && "zeroormore node has more than one elements?");
+    f->mState = RS_Zeroorone;
+    if (CallTableData(rule_table->mData, parent, found))
+      FinishRegular(idx, true);
+    break;
+  case ET_Concatenate:
+    StepConcatenate(idx);
+    break;
+  case ET_Data:
+    f->mState = RS_Data;
+    if (CallTableData(rule_table->mData, parent, found))
+      FinishRegular(idx, found);
+    break;
+  case ET_Null:
+  default:
+    FinishRegular(idx, false);
+    break;
+  }
+}
+
+void Parser::FinishRegular(unsigned idx, bool matched) {
+  TravFrame *f = &mFrames[idx];
+  RuleTable *rule_table = f->mTable;
+  AppealNode *parent = f->mNode;
+  unsigned old_pos = f->mToken;
+
+  if(matched) {
+
+    // If parent WasSucc before entering this function, and have the same
+    // or bigger longest match, it's StillWasSucc. Don't need update succinfo.
+
+    unsigned longest = 0;
+    for (unsigned i = 0; i < gSuccTokensNum; i++) {
+      unsigned m = gSuccTokens[i];
+      longest = m > longest ? m : longest;
+    }
+
+    // The shorter matchings of a single match table can't go on.
+    if (gSingleMatch[rule_table->mIndex] && gSuccTokensNum > 1) {
+      gSuccTokens[0] = longest;
+      gSuccTokensNum = 1;
+    }
+
+    if (!f->mFlag || (longest > f->mLongest)) {
+      UpdateSuccInfo(old_pos, parent);
+      parent->mAfter = Succ;
+    } else {
+      parent->mAfter = SuccStillWasSucc;
+    }
+
+    ResetFailed(rule_table, old_pos);
+    PopFrame(true);
+  } else {
+    parent->mAfter = FailChildrenFailed;
+    mCurToken = old_pos;
+    AddFailed(rule_table, mCurToken);
+    PopFrame(false);
+  }
+}
+
+// 1. Save all the possible matchings from children.
+// 2. As return value we choose the longest matching.
+//
+// The matchings are the only set of the frame.
+void Parser::StepOneof(unsigned idx) {
+  TravFrame *f = &mFrames[idx];
+  RuleTable *rule_table = f->mTable;
+
+  bool resumed = (f->mState == RS_Oneof);
+  if (!resumed) {
+    f->mState = RS_Oneof;
+    f->mFound = false;
+    f->mSubNum = 0;
+    f->mNewToken = mCurToken;  // position after most tokens eaten
+    f->mI = 0;
+    gSuccTokensNum = 0;
+  }
+
+  for (; f->mI < rule_table->mNum; f->mI++) {
+    bool temp_found;
+    if (resumed) {
+      temp_found = mFrameResult;
+      resumed = false;
+    } else if (!CallTableData(rule_table->mData + f->mI, f->mNode, temp_found)) {
+      return;
+    }
+
+    f->mFound = f->mFound | temp_found;
+    if (temp_found) {
+      // 1. Save the possilbe matchings
+      // 2. Remove be duplicated matchings
+      for (unsigned j = 0; j < gSuccTokensNum; j++) {
+        unsigned *succ_tokens = mMatchStack.data() + f->mBase;
+        bool duplicated = false;
+        for (unsigned k = 0; k < f->mSubNum; k++) {
+          if (succ_tokens[k] == gSuccTokens[j]) {
+            duplicated = true;
+            break;
+          }
+        }
+        if (!duplicated) {
+          if (OverMatchBudget(f->mSubNum + 1, rule_table))
+            break;
+          mMatchStack.push_back(gSuccTokens[j]);
+          f->mSubNum++;
+        }
+      }
+
+      if (mCurToken > f->mNewToken)
+        f->mNewToken = mCurToken;
+      // Restore the position of original mCurToken.
+      mCurToken = f->mToken;
+
+      // Some ONEOF rules can have only children matching current token seq.
+      if (rule_table->mProperties & RP_Single)
+        break;
+    }
+  }
+
+  gSuccTokensNum = f->mSubNum;
+  for (unsigned k = 0; k < f->mSubNum; k++)
+    gSuccTokens[k] = mMatchStack[f->mBase + k];
+
+  // move position according to the longest matching
+  mCurToken = f->mNewToken;
+  FinishRegular(idx, f->mFound);
+}
+
+// It always return true.
+// Moves until hit a NON-target data
+// [Note]
+//   1. Every iteration we go through all table data, and pick the one matching the most tokens.
+//   2. If noone of table data can match, it quit.
+//   3. gSuccTokens and gSuccTokensNum are a little bit complicated. Since Zeroormore can match
+//      any number of tokens it can, the number of matchings will grow each time one instance
+//      is matched.
+//   4. We don't count the 'mCurToken' as a succ matching to return. It means catch 'zero'.
+//      Although 'zero' is a correct matching, it's left to the final parent which should be a
+//      Concatenate node. It's handled in StepConcatenate().
+//
+// The sets of the frame are the visited matchings, the final matchings, the
+// matchings of previous instance, and those of current instance.
+//
+// Need to avoid duplicated mCurToken. Look at the rule
+// rule SwitchBlock : '{' + ZEROORMORE(ZEROORMORE(SwitchBlockStatementGroup) + ZEROORMORE(SwitchLabel)) + '}'
+// The inner "ZEROORMORE(SwitchBlockStatementGroup) + ZEROORMORE(SwitchLabel)" could return multiple
+// succ matches including the 'zero' match. The next time we go through the outer ZEROORMORE(...) it
+// could traverse the same mCurToken again, at least 'zero' is always duplicated. This will be
+// an endless loop. So the previous matchings already tried are saved as visited.
+void Parser::StepZeroormore(unsigned idx) {
+  TravFrame *f = &mFrames[idx];
+  RuleTable *rule_table = f->mTable;
+  MASSERT((rule_table->mNum == 1) && "zeroormore node has more than one elements?");
+  TableData *data = rule_table->mData;
+  bool single = gSingleMatch[rule_table->mIndex] &&
+                (data->mType != DT_Subtable || gSingleMatch[data->mData.mEntry->mIndex]);
+
+  bool resumed = (f->mState == RS_Zeroormore);
+  if (!resumed) {
+    f->mState = RS_Zeroormore;
+    gSuccTokensNum = 0;
+    // prepare the previous matchings for the 1st iteration.
+    mMatchStack.push_back(mCurToken - 1);
+    f->mVisitedNum = 0;
+    f->mFinalNum = 0;
+    f->mPrevNum = 1;
+    f->mSubNum = 0;
+    f->mJ = 0;
+    f->mFound = false;
+  }
+
+  while(1) {
+    // Like Concatenate, we will try all good matchings of previous instance.
+    for (; f->mJ < f->mPrevNum; f->mJ++) {
+      bool temp_found;
+      if (resumed) {
+        temp_found = mFrameResult;
+        resumed = false;
+      } else {
+        mCurToken = mMatchStack[f->mBase + f->mVisitedNum + f->mFinalNum + f->mJ] + 1;
+        if (!CallTableData(data, f->mNode, temp_found))
+          return;
+      }
+
+      f->mFound |= temp_found;
+
+      if (temp_found && OverMatchBudget(f->mSubNum + gSuccTokensNum, rule_table)) {
+        f->mFound = false;
+        break;
+      }
+
+      if (temp_found) {
+        for (unsigned id = 0; id < gSuccTokensNum; id++)
+          mMatchStack.push_back(gSuccTokens[id]);
+        f->mSubNum += gSuccTokensNum;
+      }
+    }
+
+    // It's possible that sub-table is also a ZEROORxxx, and is succ without
+    // real matching. This will be considered as a STOP.
+    if (!f->mFound || (f->mSubNum == 0))
+      break;
+
+    // A single match Zeroormore of a single match element goes on from the
+    // end of the last instance only, which is also the only final matching.
+    // Its element always moves, so nothing is visited twice.
+    if (single) {
+      unsigned *sub = mMatchStack.data() + f->mBase + f->mVisitedNum + f->mFinalNum + f->mPrevNum;
+      unsigned last = sub[0];
+      for (unsigned id = 1; id < f->mSubNum; id++)
+        last = sub[id] > last ? sub[id] : last;
+      if (f->mFinalNum && last <= mMatchStack[f->mBase + f->mVisitedNum])
+        break;
+      mMatchStack.resize(f->mBase);
+      mMatchStack.push_back(last);
+      mMatchStack.push_back(last);
+      f->mVisitedNum = 0;
+      f->mFinalNum = 1;
+      f->mPrevNum = 1;
+      f->mSubNum = 0;
+      f->mJ = 0;
+      f->mFound = false;
+      continue;
+    }
+
+    // The new sets are built in mMatchScratch.
+    // 1. The previous matchings are visited.
+    // 2. Add the matchings of this instance to final.
+    // 3. Those not visited are the previous matchings of next instance.
+    unsigned *sets = mMatchStack.data() + f->mBase;
+    unsigned visited_num = f->mVisitedNum + f->mPrevNum;
+    unsigned *sub = sets + visited_num + f->mFinalNum;
+    mMatchScratch.assign(sets, sets + f->mVisitedNum);
+    mMatchScratch.insert(mMatchScratch.end(), sets + f->mVisitedNum + f->mFinalNum,
+                         sets + f->mVisitedNum + f->mFinalNum + f->mPrevNum);
+    mMatchScratch.insert(mMatchScratch.end(), sets + f->mVisitedNum,
+                         sets + f->mVisitedNum + f->mFinalNum);
+    unsigned *visited = mMatchScratch.data();
+    for (unsigned id = 0; id < f->mSubNum; id++) {
+      unsigned token = sub[id];
+      unsigned *final = mMatchScratch.data() + visited_num;
+      unsigned final_num = mMatchScratch.size() - visited_num;
+      if (std::find(final, final + final_num, token) == final + final_num)
+        mMatchScratch.push_back(token);
+    }
+    unsigned final_num = mMatchScratch.size() - visited_num;
+    if (OverMatchBudget(final_num, rule_table)) {
+      f->mFinalNum = 0;
+      break;
+    }
+    unsigned prev_num = 0;
+    for (unsigned id = 0; id < f->mSubNum; id++) {
+      unsigned t = sub[id];
+      visited = mMatchScratch.data();
+      if (std::find(visited, visited + visited_num, t) == visited + visited_num) {
+        mMatchScratch.push_back(t);
+        prev_num++;
+      }
+    }
+
+    mMatchStack.resize(f->mBase);
+    mMatchStack.insert(mMatchStack.end(), mMatchScratch.begin(), mMatchScratch.end());
+    f->mVisitedNum = visited_num;
+    f->mFinalNum = final_num;
+    f->mPrevNum = prev_num;
+    f->mSubNum = 0;
+    f->mJ = 0;
+    f->mFound = false;
+  }
+
+  gSuccTokensNum = f->mFinalNum;
+  for (unsigned id = 0; id < f->mFinalNum; id++) {
+    unsigned token = mMatchStack[f->mBase + f->mVisitedNum + id];
+    gSuccTokens[id] = token;
+    // Actually we don't transfer mCurToken to the caller.
+    // We are look into the succ info instead. However, we update mCurToken
+    // here for easy dump info.
+    if (token + 1 > mCurToken)
+      mCurToken = token + 1;
+  }
+
+  if (!gSuccTokensNum)
+    mCurToken = f->mToken;
+
+  FinishRegular(idx, true);
+}
+
+//
+// [NOTE] 1. There could be an issue of matching number explosion. Each node could have
+//           multiple matchings, and when they are concatenated the number would be
+//           matchings_1 * matchings_2 * ... This needs to be taken care of since we need
+//           all the possible matches so that later nodes can still have opportunity.
+//        2. Each node will try all starting tokens which are the ending token of previous
+//           node.
+//        3. We need take care of the gSuccTokensNum and gSuccTokens carefully. Eg.
+//           The gSuccTokensNum/gSuccTokens need be taken care in a rule like below
+//              rule AA : BB + CC + ZEROORONE(xxx)
+//           If ZEROORONE(xxx) doesn't match anything, it sets gSuccTokensNum to 0. However
+//           rule AA matches multiple tokens. So gSuccTokensNum needs to be recalculated.
+//        4. We are going to take succ match info from SuccMatch, not from a specific
+//           AppealNode. SuccMatch has the complete info.
+//
+// The sets of the frame are the matchings of previous element, and those of
+// current element. The final matchings are always the same as the previous
+// ones once an element matches some tokens, so mFinalNum is either 0 or
+// mPrevNum.
+void Parser::StepConcatenate(unsigned idx) {
+  TravFrame *f = &mFrames[idx];
+  RuleTable *rule_table = f->mTable;
+
+  // Init found to true.
+  bool found = true;
+
+  bool resumed = (f->mState == RS_Concatenate);
+  if (!resumed) {
+    f->mState = RS_Concatenate;
+    // Make sure it's 0 when fail.
+    gSuccTokensNum = 0;
+    // prepare the previous matchings for the 1st element.
+    mMatchStack.push_back(mCurToken - 1);
+    f->mPrevNum = 1;
+    f->mFinalNum = 0;
+    f->mI = 0;
+  }
+
+  for (; f->mI < rule_table->mNum; f->mI++) {
+    TableData *data = rule_table->mData + f->mI;
+
+    // If the element is ZEROORxxx. It's not kept in mFlag, which tells if
+    // the table was succ.
+    bool is_zeroxxx = false;
+    if (data->mType == DT_Subtable) {
+      RuleTable *zero_rt = data->mData.mEntry;
+      if (zero_rt->mType == ET_Zeroormore || zero_rt->mType == ET_Zeroorone)
+        is_zeroxxx = true;
+    }
+
+    // A set of results of current subtable
+    if (!resumed) {
+      f->mFound = false;
+      f->mSubNum = 0;
+      f->mJ = 0;
+    }
+
+    // We will iterate on all previous succ matches.
+    for (; f->mJ < f->mPrevNum; f->mJ++) {
+      bool temp_found;
+      if (resumed) {
+        temp_found = mFrameResult;
+        resumed = false;
+      } else {
+        mCurToken = mMatchStack[f->mBase + f->mJ] + 1;
+        if (!CallTableData(data, f->mNode, temp_found))
+          return;
+      }
+      unsigned prev = mMatchStack[f->mBase + f->mJ];
+
+      f->mFound |= temp_found;
+
+      // One more for the 'zero' matching.
+      if (temp_found &&
+          OverMatchBudget(f->mSubNum + gSuccTokensNum + 1, rule_table)) {
+        f->mFound = false;
+        break;
+      }
+
+      if (temp_found) {
+        bool duplicated_with_prev = false;
+        for (unsigned id = 0; id < gSuccTokensNum; id++) {
+          mMatchStack.push_back(gSuccTokens[id]);
+          if (gSuccTokens[id] == prev)
+            duplicated_with_prev = true;
+        }
+        f->mSubNum += gSuccTokensNum;
+
+        // for Zeroorone/Zeroormore node it always returns true. NO matter how
+        // many tokens it really matches, 'zero' is also a correct match. we
+        // need take it into account. [Except it's a duplication, or the node
+        // is single match and matches some tokens.]
+        bool single = is_zeroxxx && gSuccTokensNum &&
+                      gSingleMatch[data->mData.mEntry->mIndex];
+        if (is_zeroxxx && !duplicated_with_prev && !single) {
+          mMatchStack.push_back(prev);
+          f->mSubNum++;
+        }
+      }
+    }
+
+    if (f->mFound) {
+      // ZEROORXXX subtable may match nothing. Although it doesn't move mCurToken,
+      // it does move the rule. It's still a good succ.
+      if (f->mSubNum > 0) {
+        // The matchings of this element become both final and previous.
+        unsigned *sets = mMatchStack.data() + f->mBase;
+        memmove(sets, sets + f->mPrevNum, f->mSubNum * sizeof(unsigned));
+        mMatchStack.resize(f->mBase + f->mSubNum);
+        f->mPrevNum = f->mSubNum;
+        f->mFinalNum = f->mSubNum;
+      }
+    } else {
+      found = false;
+      break;
+    }
+  }
+
+  // Look at this special case, where all children are ZEROORxxx
+  //   rule DimExpr : ZEROORMORE(Annotation) + ZEROORONE(Expression)
+  // It's possible it actually matches nothing, but we fake it as 1 matching
+  // with 'zero' token. This need be adjusted at the end of traversal.
+  // It's possible last_matched become -1.
+  if (f->mFinalNum == 1) {
+    int compare = mMatchStack[f->mBase];
+    int last_matched = f->mToken - 1;
+    if (compare == last_matched)
+      found = false;
+  }
+
+  if (found) {
+     // mCurToken doesn't have much meaning in current algorithm when
+     // transfer to the next rule table, because the next rule will take
+     // the succ info and get all matching token of prev, and set them
+     // as the starting mCurToken.
+     //
+     // However, we do set mCurToken to the biggest matching.
+     gSuccTokensNum = f->mFinalNum;
+     for (unsigned id = 0; id < f->mFinalNum; id++) {
+       unsigned token = mMatchStack[f->mBase + id];
+       if (token + 1 > mCurToken)
+         mCurToken = token + 1;
+       gSuccTokens[id] = token;
+     }
+  } else {
+    // Need reset gSuccTokensNum and mCurToken;
+    gSuccTokensNum = 0;
+    mCurToken = f->mToken;
+  }
+
+  FinishRegular(idx, found);
+}
@@ -0,0 +1,673 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the incremental reparsing of an edited file.
+//
+// ParseIncremental() takes the whole content of the file each time. The first
+// call parses all of it and remembers the tokens, the line of each token and
+// the top level constructs with their trees. A later call finds out what
+// has been changed, and does only the following.
+//
+// 1. The changed bytes are found by comparing the common prefix and suffix
+//    with the last content, and are extended to whole lines.
+// 2. The top level constructs covering the changed lines are the affected
+//    ones. The affected range is extended until it starts and ends at
+//    lines which the lexer starts fresh, ie. not inside a comment, and no
+//    unaffected construct shares a line with it. The lines in between are
+//    lexed again with a new lexer, and the new tokens replace the old ones.
+//    If the new tokens leave a comment open, the range is extended further.
+// 3. ParseStmt() is run from the first new token until it stops exactly at
+//    the start of an unaffected construct. A construct which is run over
+//    by the new ones is dropped. ParseStmt() clears all the memo tables
+//    before a construct, so the result is the same as a full parse.
+// 4. The new trees replace the old ones in gModule.mTrees. The following
+//    constructs only have their token indices and lines shifted.
+//
+// If a construct fails to parse, the trees from there on are dropped just
+// like Parse() does, and the next call starts over with a full parse.
+//
+// A class is usually the only construct of a file, so the members of a class
+// are the units of reparsing too. ParseStmt() keeps the range of each member
+// of the class body, and the nodes it adds to the body. If the changed lines
+// are all in a class body, the steps above are done to its members instead,
+// ie. the affected members are relexed, then parsed as a ClassBody with a
+// new parser, like parser_lazy.cpp does a Block. The new nodes replace those
+// of the affected members in the body, and ClassNode::Construct() collects
+// the members again. If the edit touches the lines of the braces, or the
+// members fail to parse, the whole construct is reparsed as above.
+//
+// The tokens of a construct are owned by the lexer which lexed them. Each
+// construct keeps its lexers alive, so a lexer is freed once all of its
+// constructs are gone.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <algorithm>
+
+#include "parser.h"
+#include "ast.h"
+#include "ast_builder.h"
+#include "common_header_autogen.h"
+#include "massert.h"
+
+// The start of each line, mimicing getline(). There is no line after the
+// last '\n'.
+void Parser::IncSplitLines(const std::string &src, std::vector<size_t> &starts) {
+  starts.clear();
+  size_t size = src.size();
+  const char *buf = src.data();
+  size_t pos = 0;
+  while (pos < size) {
+    starts.push_back(pos);
+    const char *nl = (const char*)memchr(buf + pos, '\n', size - pos);
+    if (!nl)
+      break;
+    pos = nl - buf + 1;
+  }
+}
+
+// Lex lines [first, end) of 'src' with a new lexer. 'starts' are the line
+// starts of 'src'. The tokens and their lines are appended to 'tokens' and
+// 'lines'. 'clean' tells for each line if it's started fresh. Returns false
+// if a comment is left open at the end.
+bool Parser::IncLexLines(const std::string &src, const std::vector<size_t> &starts,
+                         unsigned first, unsigned end, std::shared_ptr<Lexer> &lexer,
+                         std::vector<Token*> &tokens, std::vector<unsigned> &lines,
+                         std::vector<char> &clean) {
+  size_t base = first < starts.size() ? starts[first] : src.size();
+  size_t stop = end < starts.size() ? starts[end] : src.size();
+
+  lexer.reset(new Lexer());
+  lexer->PrepareForBuffer(src.data() + base, stop - base);
+  clean.assign(end - first, 0);
+
+  unsigned line = first;
+  if (first < end)
+    clean[0] = 1;
+  while (1) {
+    while (!lexer->EndOfLine() && !lexer->EndOfFile()) {
+      Token *t = lexer->LexToken();
+      MASSERT(t && "Non token got? Problem here!");
+      // The same filtering as LexOneLine().
+      if (t->IsComment() || (t->IsSeparator() && t->IsWhiteSpace()))
+        continue;
+      // A comment could take the lexer to later lines.
+      size_t offset = base + lexer->GetLineOffset();
+      while (line + 1 < end && starts[line + 1] <= offset)
+        line++;
+      tokens.push_back(t);
+      lines.push_back(line);
+    }
+    if (lexer->EndOfFile())
+      break;
+    lexer->ReadALine();
+    if (lexer->EndOfFile())
+      break;
+    size_t offset = base + lexer->GetLineOffset();
+    while (line + 1 < end && starts[line + 1] <= offset)
+      line++;
+    clean[line - first] = 1;
+  }
+
+  return !lexer->CommentOpen();
+}
+
+// The package node belongs to the tree of the package declaration.
+void Parser::IncDeleteTree(ASTTree *tree) {
+  if (tree && tree->mRootNode == gModule.mPackage)
+    gModule.mPackage = NULL;
+  delete tree;
+}
+
+// Keep the members of the class body parsed by ParseStmt(), ie. the
+// ClassBodyDeclaration nodes of its sorted tree, before they are simplified
+// away. The root is a ClassDeclaration, or a ClassBody for the members
+// reparsed alone.
+void Parser::IncFindMembers() {
+  mIncBodyFound = false;
+  mIncMemberNodes.clear();
+
+  AppealNode *node = mRootNode->mSortedChildren[0];
+  if (node->IsTable() && node->GetTable() == &TblClassDeclaration &&
+      node->mSortedChildren.size() == 1)
+    node = node->mSortedChildren[0];
+  if (node->IsTable() && node->GetTable() == &TblNormalClassDeclaration) {
+    AppealNode *class_body = NULL;
+    std::vector<AppealNode*>::iterator it = node->mSortedChildren.begin();
+    for (; it != node->mSortedChildren.end(); it++) {
+      if ((*it)->IsTable() && (*it)->GetTable() == &TblClassBody)
+        class_body = *it;
+    }
+    if (!class_body)
+      return;
+    node = class_body;
+  }
+  if (!node->IsTable() || node->GetTable() != &TblClassBody)
+    return;
+
+  // '{', the ZEROORMORE of members and '}'. The members must cover all the
+  // tokens in between.
+  unsigned next = node->GetStartIndex() + 1;
+  std::vector<AppealNode*>::iterator it = node->mSortedChildren.begin();
+  for (; it != node->mSortedChildren.end(); it++) {
+    if ((*it)->IsToken())
+      continue;
+    std::vector<AppealNode*> &members = (*it)->mSortedChildren;
+    for (unsigned i = 0; i < members.size(); i++) {
+      AppealNode *m = members[i];
+      if (!m->IsTable() || m->GetTable() != &TblClassBodyDeclaration ||
+          m->GetStartIndex() != next) {
+        mIncMemberNodes.clear();
+        return;
+      }
+      mIncMemberNodes.push_back(m);
+      next = m->GetFinalMatch() + 1;
+    }
+  }
+  if (next != node->GetFinalMatch()) {
+    mIncMemberNodes.clear();
+    return;
+  }
+
+  mIncLbrace = node->GetStartIndex();
+  mIncRbrace = node->GetFinalMatch();
+  mIncBodyFound = true;
+}
+
+// Find the nodes each member of mIncMemberNodes added to 'body', after the
+// AST is built. Returns false if they are not exactly the children of 'body'.
+bool Parser::IncGetMembers(BlockNode *body, std::vector<IncMember> &members) {
+  members.clear();
+  unsigned child = 0;
+  unsigned num = body->GetChildrenNum();
+  for (unsigned i = 0; i < mIncMemberNodes.size(); i++) {
+    IncMember m;
+    m.mStart = mIncMemberNodes[i]->GetStartIndex();
+    m.mEnd = mIncMemberNodes[i]->GetFinalMatch();
+    m.mFirstLine = 0;
+    m.mLastLine = 0;
+    m.mNodes = 0;
+
+    // The node is simplified down to the one with the tree.
+    AppealNode *node = mIncMemberNodes[i];
+    while (!node->GetAstTreeNode() && node->mSortedChildren.size() == 1)
+      node = node->mSortedChildren[0];
+    TreeNode *tree = node->GetAstTreeNode();
+    if (tree && tree->IsPass()) {
+      PassNode *pass = (PassNode*)tree;
+      for (; m.mNodes < pass->GetChildrenNum(); m.mNodes++) {
+        if (child + m.mNodes >= num ||
+            body->GetChildAtIndex(child + m.mNodes) != pass->GetChild(m.mNodes))
+          return false;
+      }
+    } else if (tree) {
+      if (child >= num || body->GetChildAtIndex(child) != tree)
+        return false;
+      m.mNodes = 1;
+    }
+
+    child += m.mNodes;
+    members.push_back(m);
+  }
+  return child == num;
+}
+
+// Keep the members of 'con' if it's a class, just parsed by ParseStmt().
+void Parser::IncSetMembers(IncConstruct &con) {
+  con.mHasMembers = false;
+  con.mLbrace = 0;
+  con.mRbrace = 0;
+  con.mMembers.clear();
+  TreeNode *root = con.mTree->mRootNode;
+  if (!mIncBodyFound || !root->IsClass() || !((ClassNode*)root)->GetBody())
+    return;
+  if (!IncGetMembers(((ClassNode*)root)->GetBody(), con.mMembers)) {
+    con.mMembers.clear();
+    return;
+  }
+  for (unsigned i = 0; i < con.mMembers.size(); i++) {
+    IncMember &m = con.mMembers[i];
+    m.mFirstLine = mIncTokenLines[m.mStart];
+    m.mLastLine = mIncTokenLines[m.mEnd];
+  }
+  con.mLbrace = mIncLbrace;
+  con.mRbrace = mIncRbrace;
+  con.mHasMembers = true;
+}
+
+// Move 'con' by 'tokens' tokens and 'lines' lines.
+void Parser::IncShift(IncConstruct &con, int tokens, int lines) {
+  con.mStart += tokens;
+  con.mFirstLine += lines;
+  con.mLastLine += lines;
+  con.mLbrace += tokens;
+  con.mRbrace += tokens;
+  for (unsigned i = 0; i < con.mMembers.size(); i++) {
+    IncMember &m = con.mMembers[i];
+    m.mStart += tokens;
+    m.mEnd += tokens;
+    m.mFirstLine += lines;
+    m.mLastLine += lines;
+  }
+}
+
+// Parse from mCurToken until it reaches the start of construct 'b'. The new
+// constructs are inserted in front of 'b', and the constructs run over are
+// removed. 'lexer' owns the new tokens. Returns false if illegal syntax is met.
+bool Parser::IncParse(unsigned a, unsigned b, std::shared_ptr<Lexer> &lexer) {
+  std::vector<IncConstruct> news;
+  unsigned target = b < mIncConstructs.size() ? mIncConstructs[b].mStart
+                                              : mActiveTokens.size();
+  bool succ = true;
+  mIncFindMembers = true;
+  while (mCurToken < target) {
+    IncConstruct con;
+    con.mStart = mCurToken;
+    con.mFirstLine = mIncTokenLines[mCurToken];
+    con.mLexers.push_back(lexer);
+
+    unsigned trees = gModule.mTrees.size();
+    if (!ParseStmt()) {
+      succ = false;
+      break;
+    }
+    MASSERT(gModule.mTrees.size() == trees + 1);
+    con.mTree = gModule.mTrees.back();
+    gModule.mTrees.pop_back();
+    con.mLastLine = mIncTokenLines[mCurToken - 1];
+    IncSetMembers(con);
+
+    // Run over the following constructs.
+    while (mCurToken > target) {
+      IncConstruct *over = &mIncConstructs[b];
+      con.mLexers.insert(con.mLexers.end(), over->mLexers.begin(), over->mLexers.end());
+      for (unsigned i = 0; i < over->mMembers.size(); i++) {
+        if (over->mMembers[i].mLexer)
+          con.mLexers.push_back(over->mMembers[i].mLexer);
+      }
+      IncDeleteTree(over->mTree);
+      over->mTree = NULL;
+      b++;
+      target = b < mIncConstructs.size() ? mIncConstructs[b].mStart
+                                         : mActiveTokens.size();
+    }
+
+    mIncReparsedTokens += mCurToken - con.mStart;
+    news.push_back(con);
+  }
+  mIncFindMembers = false;
+
+  // The constructs from the illegal syntax on are dropped, just like Parse().
+  if (!succ) {
+    for (unsigned i = b; i < mIncConstructs.size(); i++)
+      IncDeleteTree(mIncConstructs[i].mTree);
+    b = mIncConstructs.size();
+  }
+
+  mIncReparsed = news.size();
+  mIncReparsedMembers = 0;
+  mIncConstructs.erase(mIncConstructs.begin() + a, mIncConstructs.begin() + b);
+  mIncConstructs.insert(mIncConstructs.begin() + a, news.begin(), news.end());
+
+  gModule.mTrees.clear();
+  for (unsigned i = 0; i < mIncConstructs.size(); i++)
+    gModule.mTrees.push_back(mIncConstructs[i].mTree);
+
+  return succ;
+}
+
+void Parser::IncClear() {
+  const char *name = gModule.mFileName;
+  for (unsigned i = 0; i < mIncConstructs.size(); i++)
+    mIncConstructs[i].mTree = NULL;
+  mIncConstructs.clear();
+  gModule.Clear();
+  gModule.SetFileName(name);
+
+  mActiveTokens.clear();
+  mIncTokenLines.clear();
+  mIncCleanLines.clear();
+  mIncValid = false;
+}
+
+bool Parser::IncFullParse(const std::string &src) {
+  IncClear();
+  mIncSource = src;
+  IncSplitLines(mIncSource, mIncLineStarts);
+
+  std::shared_ptr<Lexer> lexer;
+  unsigned lines = mIncLineStarts.size();
+  IncLexLines(mIncSource, mIncLineStarts, 0, lines, lexer,
+              mActiveTokens, mIncTokenLines, mIncCleanLines);
+  mIncRelexedLines = lines;
+  mIncReparsedTokens = 0;
+
+  mCurToken = 0;
+  mEndOfFile = false;
+  mIllegalSyntax = false;
+  mIncValid = IncParse(0, 0, lexer);
+  return mIncValid;
+}
+
+// Parse 'src' as the new content of the file. Returns false if there is
+// illegal syntax.
+bool Parser::ParseIncremental(const std::string &src) {
+  // All tokens come from the lexers created here.
+  if (mLexer) {
+    delete mLexer;
+    mLexer = NULL;
+  }
+  gASTBuilder.SetTrace(mTraceAstBuild);
+
+  if (!mIncValid)
+    return IncFullParse(src);
+
+  // Find the changed bytes, [head, old_size - tail) of the old content and
+  // [head, new_size - tail) of the new content.
+  size_t old_size = mIncSource.size();
+  size_t new_size = src.size();
+  size_t min_size = std::min(old_size, new_size);
+  size_t head = 0;
+  while (head < min_size && mIncSource[head] == src[head])
+    head++;
+  if (head == old_size && head == new_size) {
+    mIncRelexedLines = 0;
+    mIncReparsedTokens = 0;
+    mIncReparsed = 0;
+    mIncReparsedMembers = 0;
+    return true;
+  }
+  size_t tail = 0;
+  while (tail < min_size - head &&
+         mIncSource[old_size - 1 - tail] == src[new_size - 1 - tail])
+    tail++;
+
+  std::vector<size_t> new_starts;
+  IncSplitLines(src, new_starts);
+  std::vector<size_t> &old_starts = mIncLineStarts;
+  unsigned old_lines = old_starts.size();
+  unsigned new_lines = new_starts.size();
+
+  // The first changed line. The lines before it are the same.
+  unsigned changed = std::upper_bound(old_starts.begin(), old_starts.end(), head)
+                     - old_starts.begin();
+  changed = changed ? changed - 1 : 0;
+
+  // The number of lines at the end which are entirely in the common suffix.
+  unsigned old_same = old_starts.end() -
+    std::lower_bound(old_starts.begin(), old_starts.end(), old_size - tail);
+  unsigned new_same = new_starts.end() -
+    std::lower_bound(new_starts.begin(), new_starts.end(), new_size - tail);
+  unsigned same = std::min(old_same, new_same);
+  same = std::min(same, std::min(old_lines - changed, new_lines - changed));
+  unsigned old_end = old_lines - same;   // the old changed lines are [changed, old_end)
+  int delta = (int)new_lines - (int)old_lines;
+
+  if (IncReparseMembers(src, new_starts, changed, old_end, delta))
+    return true;
+
+  // The affected constructs [a, b), and the old lines [first, end) to relex.
+  unsigned num = mIncConstructs.size();
+  unsigned a = 0;
+  while (a < num && mIncConstructs[a].mLastLine < changed)
+    a++;
+  unsigned first = changed;
+  if (a < num)
+    first = std::min(first, mIncConstructs[a].mFirstLine);
+  while (first > 0 && (!mIncCleanLines[first] ||
+                       (a > 0 && mIncConstructs[a - 1].mLastLine >= first))) {
+    if (a > 0 && mIncConstructs[a - 1].mLastLine >= first) {
+      a--;
+      first = std::min(first, mIncConstructs[a].mFirstLine);
+    } else {
+      first--;
+    }
+  }
+
+  unsigned b = a;
+  while (b < num && mIncConstructs[b].mFirstLine < old_end)
+    b++;
+
+  std::shared_ptr<Lexer> lexer;
+  std::vector<Token*> tokens;
+  std::vector<unsigned> lines;
+  std::vector<char> clean;
+  unsigned end = 0;
+  while (1) {
+    // The region must stop at a fresh line not shared with construct b-1.
+    while (b < num && (!mIncCleanLines[mIncConstructs[b].mFirstLine] ||
+                       (b > a && mIncConstructs[b - 1].mLastLine >= mIncConstructs[b].mFirstLine)))
+      b++;
+    end = b < num ? mIncConstructs[b].mFirstLine : old_lines;
+    // The lines between the last affected construct and construct b have
+    // no tokens. Stop right after the changed lines if possible.
+    if (old_end < end && mIncCleanLines[old_end] &&
+        (b == a || mIncConstructs[b - 1].mLastLine < old_end))
+      end = old_end;
+
+    // Lex the new lines, with the new line starts.
+    tokens.clear();
+    lines.clear();
+    bool closed = IncLexLines(src, new_starts, first, end + delta, lexer,
+                              tokens, lines, clean);
+    if (closed || b == num)
+      break;
+    b++;
+  }
+  mIncRelexedLines = end + delta - first;
+
+  // Now switch to the new content.
+  mIncSource = src;
+  mIncLineStarts.swap(new_starts);
+
+  unsigned tok_a = a < num ? mIncConstructs[a].mStart : mActiveTokens.size();
+  unsigned tok_b = b < num ? mIncConstructs[b].mStart : mActiveTokens.size();
+  int tok_delta = (int)tokens.size() - (int)(tok_b - tok_a);
+
+  mActiveTokens.erase(mActiveTokens.begin() + tok_a, mActiveTokens.begin() + tok_b);
+  mActiveTokens.insert(mActiveTokens.begin() + tok_a, tokens.begin(), tokens.end());
+  mIncTokenLines.erase(mIncTokenLines.begin() + tok_a, mIncTokenLines.begin() + tok_b);
+  mIncTokenLines.insert(mIncTokenLines.begin() + tok_a, lines.begin(), lines.end());
+  for (unsigned i = tok_a + tokens.size(); i < mIncTokenLines.size(); i++)
+    mIncTokenLines[i] += delta;
+
+  mIncCleanLines.erase(mIncCleanLines.begin() + first, mIncCleanLines.begin() + end);
+  mIncCleanLines.insert(mIncCleanLines.begin() + first, clean.begin(), clean.end());
+  MASSERT(mIncCleanLines.size() == mIncLineStarts.size());
+
+  for (unsigned i = b; i < num; i++)
+    IncShift(mIncConstructs[i], tok_delta, delta);
+
+  // The old trees of the affected constructs are gone.
+  for (unsigned i = a; i < b; i++) {
+    IncDeleteTree(mIncConstructs[i].mTree);
+    mIncConstructs[i].mTree = NULL;
+  }
+
+  mCurToken = tok_a;
+  mEndOfFile = false;
+  mIllegalSyntax = false;
+  mIncReparsedTokens = 0;
+  mIncValid = IncParse(a, b, lexer);
+  return mIncValid;
+}
+
+// Reparse the members of a class touched by the changed old lines
+// [changed, old_end), if they are all inside the class body. 'src' is the
+// new content, 'new_starts' its line starts and 'delta' the lines added.
+// Returns false if they can't be reparsed alone, and nothing is changed.
+bool Parser::IncReparseMembers(const std::string &src, std::vector<size_t> &new_starts,
+                               unsigned changed, unsigned old_end, int delta) {
+  unsigned num = mIncConstructs.size();
+  unsigned c = 0;
+  while (c < num && mIncConstructs[c].mLastLine < changed)
+    c++;
+  if (c == num || !mIncConstructs[c].mHasMembers)
+    return false;
+  IncConstruct *con = &mIncConstructs[c];
+  std::vector<IncMember> &members = con->mMembers;
+  unsigned lbrace_line = mIncTokenLines[con->mLbrace];
+  unsigned rbrace_line = mIncTokenLines[con->mRbrace];
+
+  // The affected members [a, b), and the old lines [first, end) to relex,
+  // which share no line with the braces or the other members.
+  unsigned num_members = members.size();
+  unsigned a = 0;
+  while (a < num_members && members[a].mLastLine < changed)
+    a++;
+  unsigned first = changed;
+  if (a < num_members)
+    first = std::min(first, members[a].mFirstLine);
+  while (first > lbrace_line && (!mIncCleanLines[first] ||
+                                 (a > 0 && members[a - 1].mLastLine >= first))) {
+    if (a > 0 && members[a - 1].mLastLine >= first) {
+      a--;
+      first = std::min(first, members[a].mFirstLine);
+    } else {
+      first--;
+    }
+  }
+  if (first <= lbrace_line)
+    return false;
+
+  unsigned b = a;
+  unsigned end = old_end;
+  while (end <= rbrace_line) {
+    if (b < num_members && members[b].mFirstLine < end)
+      end = std::max(end, members[b++].mLastLine + 1);
+    else if (!mIncCleanLines[end])
+      end++;
+    else
+      break;
+  }
+  if (end > rbrace_line)
+    return false;
+
+  std::shared_ptr<Lexer> lexer;
+  std::vector<Token*> tokens;
+  std::vector<unsigned> lines;
+  std::vector<char> clean;
+  if (!IncLexLines(src, new_starts, first, end + delta, lexer, tokens, lines, clean))
+    return false;
+
+  // Parse the new tokens between the braces of the class body.
+  std::vector<Token*> body;
+  body.push_back(mActiveTokens[con->mLbrace]);
+  body.insert(body.end(), tokens.begin(), tokens.end());
+  body.push_back(mActiveTokens[con->mRbrace]);
+
+  Parser *parser = new Parser(filename, body, &TblClassBody);
+  parser->SetQuiet();
+  parser->SetBudget(mBudget);
+  if (mInterpret)
+    parser->SetInterpret();
+  parser->InitRecursion();
+  parser->mIncFindMembers = true;
+  bool succ = parser->ParseStmt() && (parser->mCurToken == body.size()) &&
+              parser->mIncBodyFound;
+
+  ASTTree *tree = NULL;
+  std::vector<IncMember> news;
+  std::vector<ASTTree*> &trees = parser->mSubTrees;
+  if (succ) {
+    tree = trees.back();
+    trees.pop_back();
+    succ = tree->mRootNode->IsBlock() &&
+           parser->IncGetMembers((BlockNode*)tree->mRootNode, news);
+  }
+  for (unsigned i = 0; i < trees.size(); i++)
+    delete trees[i];
+  delete parser;
+  if (!succ) {
+    delete tree;
+    return false;
+  }
+
+  // Now switch to the new content, as ParseIncremental() does.
+  mIncRelexedLines = end + delta - first;
+  mIncSource = src;
+  mIncLineStarts.swap(new_starts);
+
+  unsigned tok_a = a < b ? members[a].mStart
+                         : (a < num_members ? members[a].mStart : con->mRbrace);
+  unsigned tok_b = a < b ? members[b - 1].mEnd + 1 : tok_a;
+  int tok_delta = (int)tokens.size() - (int)(tok_b - tok_a);
+
+  mActiveTokens.erase(mActiveTokens.begin() + tok_a, mActiveTokens.begin() + tok_b);
+  mActiveTokens.insert(mActiveTokens.begin() + tok_a, tokens.begin(), tokens.end());
+  mIncTokenLines.erase(mIncTokenLines.begin() + tok_a, mIncTokenLines.begin() + tok_b);
+  mIncTokenLines.insert(mIncTokenLines.begin() + tok_a, lines.begin(), lines.end());
+  for (unsigned i = tok_a + tokens.size(); i < mIncTokenLines.size(); i++)
+    mIncTokenLines[i] += delta;
+
+  mIncCleanLines.erase(mIncCleanLines.begin() + first, mIncCleanLines.begin() + end);
+  mIncCleanLines.insert(mIncCleanLines.begin() + first, clean.begin(), clean.end());
+  MASSERT(mIncCleanLines.size() == mIncLineStarts.size());
+
+  // The new members. Their tokens are counted from the '{'.
+  std::shared_ptr<ASTTree> owner(tree);
+  for (unsigned i = 0; i < news.size(); i++) {
+    IncMember &m = news[i];
+    m.mStart += tok_a - 1;
+    m.mEnd += tok_a - 1;
+    m.mFirstLine = mIncTokenLines[m.mStart];
+    m.mLastLine = mIncTokenLines[m.mEnd];
+    m.mTree = owner;
+    m.mLexer = lexer;
+  }
+
+  // Replace the nodes of the affected members in the class body.
+  ClassNode *klass = (ClassNode*)con->mTree->mRootNode;
+  BlockNode *block = klass->GetBody();
+  BlockNode *parsed = (BlockNode*)tree->mRootNode;
+  unsigned node_a = 0;
+  for (unsigned i = 0; i < a; i++)
+    node_a += members[i].mNodes;
+  unsigned node_b = node_a;
+  for (unsigned i = a; i < b; i++)
+    node_b += members[i].mNodes;
+  std::vector<TreeNode*> children;
+  for (unsigned i = 0; i < block->GetChildrenNum(); i++)
+    children.push_back(block->GetChildAtIndex(i));
+  block->ClearChildren();
+  for (unsigned i = 0; i < node_a; i++)
+    block->AddChild(children[i]);
+  for (unsigned i = 0; i < parsed->GetChildrenNum(); i++)
+    block->AddChild(parsed->GetChildAtIndex(i));
+  for (unsigned i = node_b; i < children.size(); i++)
+    block->AddChild(children[i]);
+  klass->ClearMembers();
+  klass->Construct();
+
+  for (unsigned i = b; i < num_members; i++) {
+    IncMember &m = members[i];
+    m.mStart += tok_delta;
+    m.mEnd += tok_delta;
+    m.mFirstLine += delta;
+    m.mLastLine += delta;
+  }
+  members.erase(members.begin() + a, members.begin() + b);
+  members.insert(members.begin() + a, news.begin(), news.end());
+  con->mRbrace += tok_delta;
+  con->mLastLine += delta;
+  for (unsigned i = c + 1; i < num; i++)
+    IncShift(mIncConstructs[i], tok_delta, delta);
+
+  mIncReparsedTokens = tokens.size();
+  mIncReparsed = 0;
+  mIncReparsedMembers = news.size();
+  return true;
+}
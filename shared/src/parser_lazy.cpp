@@ -0,0 +1,308 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the lazy parsing of method bodies and instance
+// initializers.
+//
+// Tools like symbol indexers need only the declarations of classes, fields
+// and methods, while the bodies take most of the tokens. In lazy mode, the
+// statements of a body are skipped, and parsed the first time they are asked
+// for through FunctionNode::ParseBody() or BlockNode::ParseLazy().
+//
+// 1. The whole file is lexed, and a quick scan of the tokens finds the bodies
+//    by matching braces. A '{' at the level of a class body starts a method
+//    or constructor body if the member so far ends with ')' or has 'throws',
+//    and starts an initializer if there is nothing or only 'static' before
+//    it. Nested classes are scanned the same way. Anything else, like an
+//    array initializer or an anonymous class in a field initializer, is left
+//    as is.
+// 2. The tokens between the braces of a body are removed, so the parser sees
+//    an empty block "{ }". Each body is kept in a LazyBlock.
+// 3. When BuildAST() creates the BlockNode of a Block or ConstructorBody at
+//    the '{' of a skipped body, the LazyBlock is attached to it.
+// 4. LazyBlock::Parse() parses the saved tokens with a new parser whose only
+//    top rule is the same Block or ConstructorBody, and moves the statements
+//    into the lazy BlockNode.
+//
+// The LazyBlock-s are owned by the module. They share a LazyContext, which
+// takes over the lexer owning the tokens when the parser finishes.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include "parser.h"
+#include "ast.h"
+#include "parallel_lexer.h"
+#include "common_header_autogen.h"
+#include "massert.h"
+
+// What the skipped bodies of a file share.
+struct LazyContext {
+  const char            *mFileName;
+  Lexer                 *mLexer;          // The owner of the tokens.
+  ParallelLexer         *mParallelLexer;  // or this one.
+  std::vector<ASTTree*>  mTrees;          // The trees of the parsed bodies.
+  bool                   mQuiet;          // The bodies are parsed quietly too.
+  ParseBudget            mBudget;         // and with the same budgets.
+  bool                   mInterpret;
+
+  LazyContext(const char *f, bool quiet)
+    : mFileName(f), mLexer(NULL), mParallelLexer(NULL), mQuiet(quiet),
+      mInterpret(false) {}
+  ~LazyContext() {
+    for (unsigned i = 0; i < mTrees.size(); i++)
+      delete mTrees[i];
+    delete mLexer;
+    delete mParallelLexer;
+  }
+};
+
+class LazyBlock : public LazyBody {
+public:
+  std::shared_ptr<LazyContext> mContext;
+  std::vector<Token*>          mTokens;  // From '{' to '}'.
+  RuleTable                   *mTable;   // TblBlock or TblConstructorBody.
+
+  LazyBlock() : mTable(NULL) {}
+  bool Parse(BlockNode*);
+};
+
+bool LazyBlock::Parse(BlockNode *block) {
+  if (!mTable)
+    return false;
+
+  Parser *parser = new Parser(mContext->mFileName, mTokens, mTable);
+  if (mContext->mQuiet)
+    parser->SetQuiet();
+  parser->SetBudget(mContext->mBudget);
+  if (mContext->mInterpret)
+    parser->SetInterpret();
+  parser->InitRecursion();
+  bool succ = parser->ParseStmt() && (parser->mCurToken == mTokens.size());
+  parser->ClearAppealNodes();
+
+  std::vector<ASTTree*> &trees = parser->mSubTrees;
+  mContext->mTrees.insert(mContext->mTrees.end(), trees.begin(), trees.end());
+  if (succ) {
+    TreeNode *root = trees.back()->mRootNode;
+    MASSERT(root->IsBlock() && "Body is not a BlockNode?");
+    BlockNode *parsed = (BlockNode*)root;
+    for (unsigned i = 0; i < parsed->GetChildrenNum(); i++)
+      block->AddChild(parsed->GetChildAtIndex(i));
+  }
+
+  delete parser;
+  return succ;
+}
+
+// A parser of the tokens of a body, with 'top' the only top rule.
+Parser::Parser(const char *name, std::vector<Token*> &tokens, RuleTable *top)
+  : filename(name), mActiveTokens(tokens) {
+  mLexer = NULL;
+  Init();
+  mTopTable = top;
+}
+
+// The member being scanned in a class body, or at the top level of file.
+struct LazyScope {
+  bool     mTop;        // The top level of file.
+  bool     mEnumConsts; // In the constants of an enum body.
+  unsigned mNum;        // Tokens of the member so far.
+  unsigned mParens;     // Depth of parentheses and brackets.
+  bool     mClass;      // 'class', 'interface' or 'enum' is seen.
+  bool     mEnum;       // 'enum' is seen.
+  bool     mAssign;     // '=' is seen.
+  bool     mThrows;     // 'throws' is seen.
+  bool     mStatic;     // The only token is 'static'.
+  Token   *mLast;
+
+  void Reset() {
+    mNum = 0;
+    mParens = 0;
+    mClass = false;
+    mEnum = false;
+    mAssign = false;
+    mThrows = false;
+    mStatic = false;
+    mLast = NULL;
+  }
+};
+
+static bool IsKeyword(Token *t, const char *name) {
+  return t->IsKeyword() && !strcmp(t->GetName(), name);
+}
+
+static bool IsSeparator(Token *t, SepId id) {
+  return t->IsSeparator() && t->GetSepId() == id;
+}
+
+// Find the '}' matching the '{' at 'start'. Returns 0 if there is none.
+static unsigned FindRbrace(std::vector<Token*> &tokens, unsigned start) {
+  int braces = 0;
+  for (unsigned i = start; i < tokens.size(); i++) {
+    if (IsSeparator(tokens[i], SEP_Lbrace))
+      braces++;
+    else if (IsSeparator(tokens[i], SEP_Rbrace) && !--braces)
+      return i;
+  }
+  return 0;
+}
+
+// Remove the statements of the bodies from mActiveTokens, starting from
+// mCurToken.
+void Parser::CollapseBodies() {
+  mLazyContext.reset(new LazyContext(filename, mQuiet));
+  mLazyContext->mBudget = mBudget;
+  mLazyContext->mInterpret = mInterpret;
+
+  std::vector<Token*> tokens(mActiveTokens.begin(), mActiveTokens.begin() + mCurToken);
+  std::vector<LazyScope> scopes(1);
+  scopes[0].mTop = true;
+  scopes[0].mEnumConsts = false;
+  scopes[0].Reset();
+
+  unsigned i = mCurToken;
+  for (; i < mActiveTokens.size(); i++) {
+    Token *t = mActiveTokens[i];
+    LazyScope *scope = &scopes.back();
+
+    if (IsSeparator(t, SEP_Lbrace)) {
+      bool class_body = !scope->mParens && (scope->mClass || scope->mEnumConsts);
+      bool body = false;
+      if (!class_body && !scope->mParens && !scope->mTop && !scope->mAssign) {
+        if (!scope->mNum || (scope->mNum == 1 && scope->mStatic))
+          body = true;
+        else if (IsSeparator(scope->mLast, SEP_Rparen) || scope->mThrows)
+          body = true;
+      }
+
+      if (class_body) {
+        LazyScope inner;
+        inner.mTop = false;
+        inner.mEnumConsts = scope->mEnum;
+        inner.Reset();
+        scopes.push_back(inner);
+        tokens.push_back(t);
+        continue;
+      }
+
+      unsigned end = FindRbrace(mActiveTokens, i);
+      if (!end) {
+        tokens.insert(tokens.end(), mActiveTokens.begin() + i, mActiveTokens.end());
+        break;
+      }
+      if (body && end > i + 1) {
+        LazyBlock *block = new LazyBlock();
+        block->mContext = mLazyContext;
+        block->mTokens.assign(mActiveTokens.begin() + i, mActiveTokens.begin() + end + 1);
+        mLazyBlocks[tokens.size()] = block;
+        tokens.push_back(t);
+        tokens.push_back(mActiveTokens[end]);
+      } else {
+        tokens.insert(tokens.end(), mActiveTokens.begin() + i, mActiveTokens.begin() + end + 1);
+      }
+      i = end;
+
+      // A body ends the member. Anything else is a part of it.
+      if (body) {
+        scope->Reset();
+      } else {
+        scope->mNum++;
+        scope->mLast = mActiveTokens[end];
+      }
+      continue;
+    }
+
+    tokens.push_back(t);
+
+    // The end of a class body ends the member in the outer scope.
+    if (IsSeparator(t, SEP_Rbrace)) {
+      if (scopes.size() == 1)
+        break;
+      scopes.pop_back();
+      scopes.back().Reset();
+      continue;
+    }
+
+    if (!scope->mParens && (IsSeparator(t, SEP_Semicolon) ||
+                            (scope->mEnumConsts && IsSeparator(t, SEP_Comma)))) {
+      if (IsSeparator(t, SEP_Semicolon))
+        scope->mEnumConsts = false;
+      scope->Reset();
+      continue;
+    }
+
+    if (IsSeparator(t, SEP_Lparen) || IsSeparator(t, SEP_Lbrack)) {
+      scope->mParens++;
+    } else if (IsSeparator(t, SEP_Rparen) || IsSeparator(t, SEP_Rbrack)) {
+      if (scope->mParens)
+        scope->mParens--;
+    } else if (!scope->mParens) {
+      if (IsKeyword(t, "class") || IsKeyword(t, "interface"))
+        scope->mClass = true;
+      else if (IsKeyword(t, "enum"))
+        scope->mClass = scope->mEnum = true;
+      else if (IsKeyword(t, "throws"))
+        scope->mThrows = true;
+      else if (t->IsOperator() && t->GetOprId() == OPR_Assign)
+        scope->mAssign = true;
+    }
+    scope->mStatic = !scope->mNum && IsKeyword(t, "static");
+    scope->mNum++;
+    scope->mLast = t;
+  }
+
+  // The rest is left as is when the braces don't match.
+  if (i < mActiveTokens.size() && IsSeparator(mActiveTokens[i], SEP_Rbrace))
+    tokens.insert(tokens.end(), mActiveTokens.begin() + i + 1, mActiveTokens.end());
+  mActiveTokens.swap(tokens);
+}
+
+// Attach the skipped body to the BlockNode built at its '{'.
+void Parser::SetLazyBody(AppealNode *appeal, TreeNode *tree) {
+  if (!tree->IsBlock() || !appeal->IsTable())
+    return;
+  RuleTable *table = appeal->GetTable();
+  if (table != &TblBlock && table != &TblConstructorBody)
+    return;
+
+  // A sub parser uses the bodies of its parent.
+  Parser *owner = mParent ? mParent : this;
+  std::map<unsigned, LazyBlock*>::iterator it =
+    owner->mLazyBlocks.find(appeal->GetStartIndex());
+  if (it == owner->mLazyBlocks.end())
+    return;
+
+  it->second->mTable = table;
+  ((BlockNode*)tree)->SetLazy(it->second);
+}
+
+// The module takes the bodies, which keep the lexer owning the tokens.
+void Parser::FinishLazy() {
+  if (mLazyBlocks.empty())
+    return;
+
+  StopLexThread();
+  mLazyContext->mLexer = mLexer;
+  mLexer = NULL;
+  mLazyContext->mParallelLexer = mParallelLexer;
+  mParallelLexer = NULL;
+
+  std::map<unsigned, LazyBlock*>::iterator it = mLazyBlocks.begin();
+  for (; it != mLazyBlocks.end(); it++)
+    gModule.AddLazyBody(it->second);
+  mLazyBlocks.clear();
+}
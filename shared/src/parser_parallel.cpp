@@ -0,0 +1,255 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the parallel parsing of the top level constructs in a
+// file.
+//
+// Top level constructs (package, import, class, interface, ...) are parsed
+// independently. ParseStmt() clears all the memo tables before it starts a
+// construct, so the parsing of a construct depends only on its starting token.
+// We take advantage of this to parse the constructs in different threads.
+//
+// 1. The whole file is lexed at once. Strings and comments are taken care by
+//    the lexer, so the boundaries can be found by looking at the tokens.
+// 2. A quick scan of the tokens finds the boundaries by matching braces and
+//    parentheses. A construct ends at a ';' or a '}' of the outermost level.
+// 3. The constructs are grouped into chunks of similar size. Each chunk is
+//    a task in the work pool, and is parsed by a sub parser. A sub parser
+//    shares the tokens of its parent, and has its own memo tables since they
+//    are thread_local.
+// 4. The parent merges the results in the source order. The boundaries are
+//    just a guess. If a chunk doesn't start where the previous one stopped,
+//    the results from there on are dropped and the rest of the file is
+//    parsed sequentially. So the result is always the same as sequential
+//    parsing. The package and imports, which the ASTBuilder puts in the
+//    gModule of the worker, are moved to the module of the parent.
+//////////////////////////////////////////////////////////////////////////////
+
+#include "parser.h"
+#include "ast_builder.h"
+#include "thread_out.h"
+#include "work_pool.h"
+#include "parallel_lexer.h"
+#include "parse_observer.h"
+#include "timeline.h"
+#include "massert.h"
+
+// A sub parser works on the tokens of 'parent', and never lexes.
+Parser::Parser(Parser *parent) : filename(parent->filename),
+                                 mActiveTokens(parent->mActiveTokens) {
+  mLexer = NULL;
+  Init();
+  mParent = parent;
+
+  mTraceTiming = parent->mTraceTiming;
+  mTraceAstBuild = parent->mTraceAstBuild;
+  mTraceWarning = parent->mTraceWarning;
+  mObserver = parent->mObserver ? parent->mObserver->Clone() : NULL;
+  mLazy = parent->mLazy;
+  mValidateOnly = parent->mValidateOnly;
+  mQuiet = parent->mQuiet;
+  SetBudget(parent->mBudget);
+  mInterpret = parent->mInterpret;
+}
+
+// Lex all the remaining tokens of the file into mActiveTokens.
+void Parser::LexAll() {
+  if (!mLexer)
+    return;
+  TimeSpan span("Lex");
+  if (mParallelLex && mActiveTokens.empty() && !mLexThread && LexAllParallel())
+    return;
+
+  unsigned saved = mCurToken;
+  mCurToken = mActiveTokens.size();
+  while (LexOneLine())
+    mCurToken = mActiveTokens.size();
+  mCurToken = saved;
+}
+
+// Lex the whole file with the parallel lexer. See parallel_lexer.h
+// Returns false if it cannot lex, and the file is left to mLexer.
+bool Parser::LexAllParallel() {
+  mParallelLexer = new ParallelLexer();
+  if (!mParallelLexer->LexFile(filename, mWorkPool)) {
+    delete mParallelLexer;
+    mParallelLexer = NULL;
+    return false;
+  }
+
+  // The same filtering as LexOneLine().
+  std::vector<Token*> &tokens = mParallelLexer->GetTokens();
+  for (unsigned i = 0; i < tokens.size(); i++) {
+    Token *t = tokens[i];
+    if (t->IsComment() || (t->IsSeparator() && t->IsWhiteSpace()))
+      continue;
+    mActiveTokens.push_back(t);
+  }
+
+  // The tokens stay in mParallelLexer. mLexer is not needed any more.
+  delete mLexer;
+  mLexer = NULL;
+  return true;
+}
+
+// Find the starting token of each top level construct from mCurToken.
+// Unbalanced braces or parentheses make the rest of file one construct.
+void Parser::FindTopBoundaries(std::vector<unsigned> &starts) {
+  int braces = 0;
+  int parens = 0;
+  starts.push_back(mCurToken);
+
+  for (unsigned i = mCurToken; i < mActiveTokens.size(); i++) {
+    Token *token = mActiveTokens[i];
+    if (!token->IsSeparator())
+      continue;
+
+    bool end = false;
+    switch (token->GetSepId()) {
+    case SEP_Lbrace:
+      braces++;
+      break;
+    case SEP_Rbrace:
+      braces--;
+      end = !braces && !parens;
+      break;
+    case SEP_Lparen:
+    case SEP_Lbrack:
+      parens++;
+      break;
+    case SEP_Rparen:
+    case SEP_Rbrack:
+      parens--;
+      break;
+    case SEP_Semicolon:
+      end = !braces && !parens;
+      break;
+    default:
+      break;
+    }
+
+    if (braces < 0 || parens < 0)
+      return;
+    if (end && (i + 1 < mActiveTokens.size()))
+      starts.push_back(i + 1);
+  }
+}
+
+struct ParseChunk {
+  unsigned              mStart;    // the first token.
+  unsigned              mEnd;      // the token after the last construct.
+  unsigned              mStop;     // where the sub parser stopped.
+  unsigned              mFurthest; // the furthest token the sub parser reached.
+  bool                  mIllegal;  // the sub parser met illegal syntax.
+  std::vector<ASTTree*> mTrees;
+  PackageNode          *mPackage;  // the package and imports built by the sub
+  std::vector<ImportNode*> mImports; // parser, which are in the worker's gModule.
+  std::string           mOutput;   // what the sub parser printed.
+};
+
+void Parser::ParseParallel() {
+  LexAll();
+
+  std::vector<unsigned> starts;
+  FindTopBoundaries(starts);
+  if (starts.size() < 2)
+    return;
+
+  // Group the constructs into chunks. Several chunks per thread gives the
+  // work stealing a chance to balance constructs of very different sizes.
+  unsigned total = mActiveTokens.size() - mCurToken;
+  unsigned target = total / (mWorkPool->GetThreadsNum() * 4) + 1;
+
+  std::vector<ParseChunk> chunks;
+  for (unsigned i = 0; i < starts.size(); ) {
+    ParseChunk chunk;
+    chunk.mStart = starts[i];
+    chunk.mStop = starts[i];
+    chunk.mFurthest = starts[i];
+    chunk.mIllegal = false;
+    chunk.mPackage = NULL;
+    while (++i < starts.size() && (starts[i] - chunk.mStart < target))
+      ;
+    chunk.mEnd = i < starts.size() ? starts[i] : mActiveTokens.size();
+    chunks.push_back(chunk);
+  }
+
+  bool trace_ast = mTraceAstBuild;
+  for (unsigned i = 0; i < chunks.size(); i++) {
+    ParseChunk *chunk = &chunks[i];
+    mWorkPool->Submit([this, chunk, trace_ast]() {
+      OutCapture capture(&chunk->mOutput);
+      gASTBuilder.SetTrace(trace_ast);
+
+      Parser *sub = new Parser(this);
+      sub->InitRecursion();
+      sub->mCurToken = chunk->mStart;
+      while (sub->mCurToken < chunk->mEnd && sub->ParseStmt())
+        ;
+
+      chunk->mStop = sub->mCurToken;
+      chunk->mFurthest = sub->mFurthestToken;
+      chunk->mIllegal = sub->mIllegalSyntax;
+      chunk->mTrees = sub->mSubTrees;
+      sub->ClearAppealNodes();
+      delete sub;
+
+      // The package and imports go to the module of this parser. The worker's
+      // module is reset for the next task, whose file could have a package too.
+      chunk->mPackage = gModule.mPackage;
+      for (unsigned k = 0; k < gModule.mImports.GetNum(); k++)
+        chunk->mImports.push_back(gModule.mImports.ValueAtIndex(k));
+      gModule.Clear();
+    });
+  }
+  mWorkPool->Wait();
+
+  // Merge the chunks in order, until the first one which doesn't follow
+  // its previous one.
+  unsigned next = mCurToken;
+  unsigned i = 0;
+  for (; i < chunks.size(); i++) {
+    ParseChunk *chunk = &chunks[i];
+    if (chunk->mStart != next)
+      break;
+
+    std::cout << chunk->mOutput;
+    for (unsigned k = 0; k < chunk->mTrees.size(); k++)
+      gModule.AddTree(chunk->mTrees[k]);
+    chunk->mTrees.clear();
+    if (chunk->mPackage)
+      gModule.SetPackage(chunk->mPackage);
+    for (unsigned k = 0; k < chunk->mImports.size(); k++)
+      gModule.AddImport(chunk->mImports[k]);
+
+    next = chunk->mStop;
+    if (chunk->mFurthest > mFurthestToken)
+      mFurthestToken = chunk->mFurthest;
+    if (chunk->mIllegal) {
+      mIllegalSyntax = true;
+      i++;
+      break;
+    }
+  }
+
+  // Drop the results which are not merged.
+  for (; i < chunks.size(); i++) {
+    for (unsigned k = 0; k < chunks[i].mTrees.size(); k++)
+      delete chunks[i].mTrees[k];
+  }
+
+  mCurToken = next;
+}
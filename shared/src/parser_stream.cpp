@@ -0,0 +1,161 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// This file contains the parsing in push mode, where the caller feeds the
+// source in chunks of any size, eg. from a pipe or a decompressor.
+//
+// 1. The complete lines of the chunks so far are appended to the lexer, and
+//    lexed. The incomplete last line waits for the next chunk.
+// 2. The new tokens are scanned for the boundaries of top level constructs,
+//    the same way as FindTopBoundaries() does, but incrementally.
+// 3. The constructs are parsed as long as one is complete, and there is a
+//    token after it. A parser running into the end of the tokens thinks it's
+//    the end of file, so the construct is undone and parsed again with more
+//    tokens. The result is always the same as parsing the whole file.
+// 4. The trees are passed to the callback as soon as they are built. They
+//    are in gModule as usual.
+//
+// Lazy bodies and parallel parsing need all the tokens, so they are not
+// done in push mode.
+//////////////////////////////////////////////////////////////////////////////
+
+#include "parser.h"
+#include "ast_builder.h"
+#include "thread_out.h"
+#include "massert.h"
+
+// The parser must be created with an empty string as the source.
+void Parser::StartStream(const std::function<void(ASTTree*)> &callback) {
+  MASSERT(mLexer && mActiveTokens.empty() && "Stream started after lexing.");
+  mStreaming = true;
+  mStreamCallback = callback;
+  mStreamEmitted = gModule.mTrees.size();
+  mLazy = false;
+  mWorkPool = NULL;
+}
+
+// Returns false once illegal syntax is met. The rest of the source is
+// ignored then.
+bool Parser::FeedStream(const char *data, size_t size) {
+  MASSERT(mStreaming && !mStreamEnd);
+  if (mIllegalSyntax)
+    return false;
+
+  mStreamPartial.append(data, size);
+  size_t nl = mStreamPartial.rfind('\n');
+  if (nl == std::string::npos)
+    return true;
+  mLexer->AppendLines(mStreamPartial.data(), nl + 1);
+  mStreamPartial.erase(0, nl + 1);
+
+  LexAll();
+  StreamScan();
+  while (mCurToken < mStreamReady && mStreamReady < mActiveTokens.size()) {
+    if (!StreamParseStmt())
+      break;
+  }
+  return !mIllegalSyntax;
+}
+
+// Parse the rest, and dump the module like Parse() does.
+bool Parser::FinishStream() {
+  MASSERT(mStreaming && !mStreamEnd);
+  mStreamEnd = true;
+  if (!mIllegalSyntax) {
+    if (!mStreamPartial.empty())
+      mLexer->AppendLines(mStreamPartial.data(), mStreamPartial.size());
+    mStreamPartial.clear();
+    while (StreamParseStmt())
+      ;
+  }
+
+  if (!mValidateOnly && !mQuiet)
+    gModule.Dump();
+  return !mIllegalSyntax;
+}
+
+// Unbalanced braces or parentheses leave the rest to FinishStream().
+void Parser::StreamScan() {
+  for (; mStreamScanned < mActiveTokens.size(); mStreamScanned++) {
+    if (mStreamBraces < 0 || mStreamParens < 0)
+      return;
+    Token *token = mActiveTokens[mStreamScanned];
+    if (!token->IsSeparator())
+      continue;
+
+    bool end = false;
+    switch (token->GetSepId()) {
+    case SEP_Lbrace:
+      mStreamBraces++;
+      break;
+    case SEP_Rbrace:
+      mStreamBraces--;
+      end = !mStreamBraces && !mStreamParens;
+      break;
+    case SEP_Lparen:
+    case SEP_Lbrack:
+      mStreamParens++;
+      break;
+    case SEP_Rparen:
+    case SEP_Rbrack:
+      mStreamParens--;
+      break;
+    case SEP_Semicolon:
+      end = !mStreamBraces && !mStreamParens;
+      break;
+    default:
+      break;
+    }
+    if (end)
+      mStreamReady = mStreamScanned + 1;
+  }
+}
+
+// Parse one top level construct, and pass the new tree to the callback.
+// Returns false at illegal syntax, at the end of file, or if the construct
+// is undone because it runs into the end of the tokens so far.
+bool Parser::StreamParseStmt() {
+  unsigned start = mCurToken;
+  unsigned furthest = mFurthestToken;
+  unsigned trees = gModule.mTrees.size();
+
+  // What's printed is held until the construct is sure.
+  std::string output;
+  bool succ;
+  {
+    OutCapture capture(&output);
+    succ = ParseStmt();
+  }
+
+  if (mEndOfFile && !mStreamEnd) {
+    while (gModule.mTrees.size() > trees) {
+      IncDeleteTree(gModule.mTrees.back());
+      gModule.mTrees.pop_back();
+    }
+    mCurToken = start;
+    mFurthestToken = furthest;
+    mEndOfFile = false;
+    mIllegalSyntax = false;
+    return false;
+  }
+
+  std::cout << output;
+  for (; mStreamEmitted < gModule.mTrees.size(); mStreamEmitted++) {
+    if (mStreamCallback)
+      mStreamCallback(gModule.mTrees[mStreamEmitted]);
+  }
+  return succ;
+}
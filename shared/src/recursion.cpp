@@ -19,6 +19,8 @@
 // LeadFronNode, FronNode. It also provides some query functions useful.
 /////////////////////////////////////////////////////////////////////////////////////
 
+#include <mutex>
+
 #include "recursion.h"
 #include "gen_summary.h"
 #include "gen_token.h"
@@ -524,6 +526,16 @@ void RecursionAll::Release() {
   mRecursions.Release();
 }
 
+RecursionAll* RecursionAll::GetShared() {
+  static RecursionAll *shared = NULL;
+  static std::once_flag once;
+  std::call_once(once, []() {
+    shared = new RecursionAll();
+    shared->Init();
+  });
+  return shared;
+}
+
 // Find the LeftRecursion with 'rt' the LeadNode.
 Recursion* RecursionAll::FindRecursion(RuleTable *rt) {
   for (unsigned i = 0; i < mRecursions.GetNum(); i++) {
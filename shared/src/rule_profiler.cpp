@@ -0,0 +1,224 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+#include <chrono>
+#include <algorithm>
+#include <iomanip>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "rule_profiler.h"
+#include "ruletable.h"
+#include "gen_summary.h"
+#include "massert.h"
+
+// TSC on x86, nanoseconds elsewhere.
+static inline uint64_t ReadTicks() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+static inline uint64_t ReadNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// The name of rule table of 'index'.
+static const char* RuleName(unsigned index) {
+  static std::vector<const char*> names;
+  static std::once_flag once;
+  std::call_once(once, []() {
+    names.resize(RuleTableNum, "");
+    for (unsigned i = 0; i < RuleTableNum; i++)
+      names[gRuleTableSummarys[i].mIndex] = gRuleTableSummarys[i].mName;
+  });
+  return names[index];
+}
+
+RuleProfiler::RuleProfiler(RuleProfiler *target) : mTarget(target) {
+  RuleProfile zero;
+  memset(&zero, 0, sizeof(zero));
+  mRules.resize(RuleTableNum, zero);
+  mActive.resize(RuleTableNum, 0);
+  mStartTicks = ReadTicks();
+  mStartNanos = ReadNanos();
+}
+
+RuleProfiler::~RuleProfiler() {
+  if (mTarget)
+    mTarget->Merge(mRules);
+}
+
+void RuleProfiler::Merge(const std::vector<RuleProfile> &rules) {
+  std::lock_guard<std::mutex> guard(mLock);
+  for (unsigned i = 0; i < rules.size(); i++) {
+    RuleProfile &r = mRules[i];
+    const RuleProfile &o = rules[i];
+    r.mEntries += o.mEntries;
+    r.mMemoSucc += o.mMemoSucc;
+    r.mMemoFail += o.mMemoFail;
+    r.mLookAhead += o.mLookAhead;
+    r.mAppealNodes += o.mAppealNodes;
+    r.mWaves += o.mWaves;
+    r.mInclusive += o.mInclusive;
+    r.mExclusive += o.mExclusive;
+  }
+}
+
+void RuleProfiler::EnterTable(RuleTable *t, unsigned token) {
+  RuleProfile &r = mRules[t->mIndex];
+  r.mEntries++;
+  mActive[t->mIndex]++;
+  Frame f = {t->mIndex, ReadTicks(), 0};
+  mStack.push_back(f);
+}
+
+void RuleProfiler::ExitTable(RuleTable *t, unsigned token, bool succ, AppealStatus reason) {
+  if (reason == FailLookAhead)
+    mRules[t->mIndex].mLookAhead++;
+}
+
+void RuleProfiler::LeaveTable(RuleTable *t) {
+  MASSERT(!mStack.empty() && mStack.back().mIndex == t->mIndex);
+  Frame f = mStack.back();
+  mStack.pop_back();
+  uint64_t elapsed = ReadTicks() - f.mStart;
+
+  RuleProfile &r = mRules[f.mIndex];
+  r.mExclusive += elapsed - f.mChildren;
+  // A table nested in itself is counted by the outermost entry.
+  if (--mActive[f.mIndex] == 0)
+    r.mInclusive += elapsed;
+  if (!mStack.empty())
+    mStack.back().mChildren += elapsed;
+}
+
+void RuleProfiler::MemoHit(RuleTable *t, unsigned token, bool succ) {
+  if (succ)
+    mRules[t->mIndex].mMemoSucc++;
+  else
+    mRules[t->mIndex].mMemoFail++;
+}
+
+void RuleProfiler::WaveInstance(AppealNode *lead, bool first) {
+  mRules[lead->GetTable()->mIndex].mWaves++;
+}
+
+void RuleProfiler::NewAppealNode(AppealNode *n) {
+  mRules[n->GetTable()->mIndex].mAppealNodes++;
+}
+
+double RuleProfiler::TicksPerMs() {
+  uint64_t ticks = ReadTicks() - mStartTicks;
+  uint64_t nanos = ReadNanos() - mStartNanos;
+  if (!nanos)
+    return 1000000.0;
+  return (double)ticks * 1000000.0 / nanos;
+}
+
+// Rules which are entered, the hottest first.
+void RuleProfiler::SortedRules(std::vector<unsigned> &order) {
+  for (unsigned i = 0; i < mRules.size(); i++) {
+    if (mRules[i].mEntries || mRules[i].mWaves)
+      order.push_back(i);
+  }
+  std::sort(order.begin(), order.end(), [this](unsigned a, unsigned b) {
+    if (mRules[a].mExclusive != mRules[b].mExclusive)
+      return mRules[a].mExclusive > mRules[b].mExclusive;
+    return strcmp(RuleName(a), RuleName(b)) < 0;
+  });
+}
+
+void RuleProfiler::Report(std::ostream &os, unsigned top) {
+  std::vector<unsigned> order;
+  SortedRules(order);
+  double per_ms = TicksPerMs();
+  uint64_t total = 0;
+  for (unsigned i = 0; i < order.size(); i++)
+    total += mRules[order[i]].mExclusive;
+
+  os << "================ Rule Profile ================" << std::endl;
+  os << std::left << std::setw(40) << "Rule" << std::right
+     << std::setw(10) << "Entries" << std::setw(10) << "MemoSucc"
+     << std::setw(10) << "MemoFail" << std::setw(10) << "LookAhead"
+     << std::setw(10) << "Appeals" << std::setw(8) << "Waves"
+     << std::setw(11) << "Incl(ms)" << std::setw(11) << "Excl(ms)"
+     << std::setw(8) << "Excl%" << std::endl;
+
+  unsigned num = (top && top < order.size()) ? top : order.size();
+  os << std::fixed;
+  for (unsigned i = 0; i < num; i++) {
+    const RuleProfile &r = mRules[order[i]];
+    os << std::left << std::setw(40) << RuleName(order[i]) << std::right
+       << std::setw(10) << r.mEntries << std::setw(10) << r.mMemoSucc
+       << std::setw(10) << r.mMemoFail << std::setw(10) << r.mLookAhead
+       << std::setw(10) << r.mAppealNodes << std::setw(8) << r.mWaves
+       << std::setprecision(3)
+       << std::setw(11) << r.mInclusive / per_ms
+       << std::setw(11) << r.mExclusive / per_ms
+       << std::setprecision(1)
+       << std::setw(8) << (total ? 100.0 * r.mExclusive / total : 0.0) << std::endl;
+  }
+  if (num < order.size())
+    os << "... " << order.size() - num << " more rules" << std::endl;
+  os << "Total: " << order.size() << " rules, "
+     << std::setprecision(3) << total / per_ms << " ms" << std::endl;
+  os.unsetf(std::ios::floatfield);
+}
+
+void RuleProfiler::WriteCSV(std::ostream &os) {
+  std::vector<unsigned> order;
+  SortedRules(order);
+  double per_ms = TicksPerMs();
+  os << "rule,entries,memo_succ,memo_fail,lookahead_reject,appeal_nodes,waves,"
+     << "inclusive_ticks,exclusive_ticks,inclusive_ms,exclusive_ms" << std::endl;
+  for (unsigned i = 0; i < order.size(); i++) {
+    const RuleProfile &r = mRules[order[i]];
+    os << RuleName(order[i]) << "," << r.mEntries << "," << r.mMemoSucc << ","
+       << r.mMemoFail << "," << r.mLookAhead << "," << r.mAppealNodes << ","
+       << r.mWaves << "," << r.mInclusive << "," << r.mExclusive << ","
+       << r.mInclusive / per_ms << "," << r.mExclusive / per_ms << std::endl;
+  }
+}
+
+void RuleProfiler::WriteJSON(std::ostream &os) {
+  std::vector<unsigned> order;
+  SortedRules(order);
+  double per_ms = TicksPerMs();
+  os << std::fixed << std::setprecision(1);
+  os << "{\n  \"ticks_per_ms\": " << per_ms << ",\n  \"rules\": [";
+  os.unsetf(std::ios::floatfield);
+  for (unsigned i = 0; i < order.size(); i++) {
+    const RuleProfile &r = mRules[order[i]];
+    os << (i ? ",\n" : "\n");
+    os << "    {\"rule\": \"" << RuleName(order[i]) << "\""
+       << ", \"entries\": " << r.mEntries
+       << ", \"memo_succ\": " << r.mMemoSucc
+       << ", \"memo_fail\": " << r.mMemoFail
+       << ", \"lookahead_reject\": " << r.mLookAhead
+       << ", \"appeal_nodes\": " << r.mAppealNodes
+       << ", \"waves\": " << r.mWaves
+       << ", \"inclusive_ticks\": " << r.mInclusive
+       << ", \"exclusive_ticks\": " << r.mExclusive << "}";
+  }
+  os << "\n  ]\n}" << std::endl;
+}
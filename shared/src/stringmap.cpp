@@ -29,82 +29,93 @@ StringMap::StringMap() {
 }
 
 StringMap::~StringMap() {
-  StringMapEntry *E = mBuckets;
-  for (unsigned i = 0; i < mNumBuckets; i++, E++) {
-    // iterate to delete all entries.
-    StringMapEntry *entry = E->Next;
-    StringMapEntry *temp = NULL;
-    while(entry) {
-      temp = entry->Next;
-      delete entry;
-      entry = temp;
-    } 
+  // Each table has its own entries.
+  for (unsigned t = 0; t < mTables.size(); t++) {
+    StringMapTable *table = mTables[t];
+    for (unsigned i = 0; i < table->mNumBuckets; i++) {
+      StringMapEntry *entry = table->mBuckets[i].load(std::memory_order_relaxed);
+      while(entry) {
+        StringMapEntry *temp = entry->Next;
+        delete entry;
+        entry = temp;
+      }
+    }
+    delete [] table->mBuckets;
+    delete table;
   }
-
-  delete [] mBuckets;
 }
 
 void StringMap::Init(unsigned Num) {
   MASSERT((Num & (Num-1)) == 0 && 
         "Init Size must be a power of 2 or zero!"); 
-  mNumBuckets = Num ? Num : DEFAULT_BUCKETS_NUM; 
-   
-  mBuckets = new StringMapEntry[mNumBuckets];
-  StringMapEntry *E = mBuckets;
-  for (unsigned i = 0; i < mNumBuckets; i++, E++) {
-    E->Addr = NULL;
-    E->Next = NULL;
-  }
+  StringMapTable *table = new StringMapTable;
+  table->mNumBuckets = Num ? Num : DEFAULT_BUCKETS_NUM; 
+  table->mBuckets = new std::atomic<StringMapEntry*>[table->mNumBuckets];
+  for (unsigned i = 0; i < table->mNumBuckets; i++)
+    table->mBuckets[i].store(NULL, std::memory_order_relaxed);
+  mTables.push_back(table);
+  mTable.store(table, std::memory_order_release);
+  mNumEntries = 0;
 }
 
-// Get the bucket no for 'S'.
-unsigned StringMap::BucketNoFor(const std::string &S) { 
-  unsigned HTSize = mNumBuckets; 
-  if (HTSize == 0) {  // Hash table unallocated so far? 
-    Init(DEFAULT_BUCKETS_NUM); 
-    HTSize = mNumBuckets; 
-  } 
-  unsigned FullHashValue = HashString(S); 
-  unsigned BucketNo = FullHashValue & (HTSize-1); 
-  return BucketNo;  
-} 
-
 // Look up to find the address in the string pool of 'S'.
 // If 'S' is not in the string pool, insert it.
 char* StringMap::LookupAddrFor(const std::string &S) { 
-  unsigned BucketNo = BucketNoFor(S);
-  StringMapEntry *E = &mBuckets[BucketNo];
+  char *Addr = FindAddrFor(S);
+  if (Addr)
+    return Addr;
 
-  // Since we add an empty StringMapEntry as the first entry of this
-  // bucket, we can use it at the first time.
-  if (E && !E->Addr && !E->Next) {
-    char *addr = mPool->Alloc(S);
-    E->Addr = addr;
-    return addr;
-  }
-  
-  while (E && E->Addr) {
-    if (S.compare(E->Addr) == 0)
-      return E->Addr;
-    E = E->Next;
-  }
-   
   // We cannot find an existing string for 'S'. Need to allocate
-  char *Addr = mPool->Alloc(S);
-  InsertEntry(Addr, BucketNo);
-
+  Addr = mPool->Alloc(S);
+  InsertEntry(Addr, HashString(S));
   return Addr;
 } 
 
-// Add a new entry in 'bucket'.
-// 'addr' is the address in the string pool
-void StringMap::InsertEntry(char *addr, unsigned bucket) {
-  StringMapEntry *E = &mBuckets[bucket];
-  while (E->Next) {
+// Look up to find the address in the string pool of 'S', without
+// inserting it.
+char* StringMap::FindAddrFor(const std::string &S) {
+  unsigned Hash = HashString(S);
+  StringMapTable *table = mTable.load(std::memory_order_acquire);
+  StringMapEntry *E = table->mBuckets[Hash & (table->mNumBuckets - 1)].load(std::memory_order_acquire);
+  while (E) {
+    if (E->Hash == Hash && S.compare(E->Addr) == 0)
+      return E->Addr;
     E = E->Next;
   }
+  return NULL;
+}
 
-  StringMapEntry *NewEnt = new StringMapEntry(addr);
-  E->Next = NewEnt;
+// Add a new entry at the head of its bucket. The entry is filled before it's
+// seen by FindAddrFor().
+// 'addr' is the address in the string pool
+void StringMap::InsertEntry(char *addr, unsigned hash) {
+  if (++mNumEntries > 2 * mTables.back()->mNumBuckets)
+    Grow();
+  StringMapTable *table = mTables.back();
+  std::atomic<StringMapEntry*> &bucket = table->mBuckets[hash & (table->mNumBuckets - 1)];
+  StringMapEntry *NewEnt = new StringMapEntry(addr, hash, bucket.load(std::memory_order_relaxed));
+  bucket.store(NewEnt, std::memory_order_release);
 }
 
+// A table twice as big gets its own copies of the entries, since the old one
+// may still be walked.
+void StringMap::Grow() {
+  StringMapTable *old = mTables.back();
+  StringMapTable *table = new StringMapTable;
+  table->mNumBuckets = old->mNumBuckets * 2;
+  table->mBuckets = new std::atomic<StringMapEntry*>[table->mNumBuckets];
+  for (unsigned i = 0; i < table->mNumBuckets; i++)
+    table->mBuckets[i].store(NULL, std::memory_order_relaxed);
+
+  for (unsigned i = 0; i < old->mNumBuckets; i++) {
+    StringMapEntry *E = old->mBuckets[i].load(std::memory_order_relaxed);
+    for (; E; E = E->Next) {
+      std::atomic<StringMapEntry*> &bucket = table->mBuckets[E->Hash & (table->mNumBuckets - 1)];
+      bucket.store(new StringMapEntry(E->Addr, E->Hash, bucket.load(std::memory_order_relaxed)),
+                   std::memory_order_relaxed);
+    }
+  }
+
+  mTables.push_back(table);
+  mTable.store(table, std::memory_order_release);
+}
@@ -24,25 +24,45 @@
 #include "stringpool.h"
 #include "stringmap.h"
 #include "massert.h"
+#include "mem_stats.h"
 
 // The global string pool for lexing, parsing, ast building and ir building
 // for the symbols, etc.
 StringPool gStringPool;
 
+// The local pool of this thread, see LocalStringPool.
+static thread_local StringPool *tLocalPool = NULL;
+
+LocalStringPool::LocalStringPool() {
+  mSaved = tLocalPool;
+  tLocalPool = &mPool;
+}
+
+LocalStringPool::~LocalStringPool() {
+  tLocalPool = mSaved;
+}
+
 StringPool::StringPool() {
   mMap = new StringMap();
   mMap->SetPool(this);
   mFirstAvail = -1;
+  mObjects = 0;
 }
 
 StringPool::~StringPool() {
   // Release the mBlocks
+  long long used = 0;
+  long long wasted = 0;
   std::vector<SPBlock>::iterator it;
   for (it = mBlocks.begin(); it != mBlocks.end(); it++) {
     SPBlock block = *it;
     char *addr = block.Addr;
+    used += block.Used;
+    if (it - mBlocks.begin() < mFirstAvail)
+      wasted += BLOCK_SIZE - block.Used;
     free(addr);
   }
+  MemAccount(MS_String, -(long long)mBlocks.size() * BLOCK_SIZE, -used, -wasted, -mObjects);
   
   // Release the StringMap
   delete mMap;
@@ -89,6 +109,7 @@ char* StringPool::Alloc(const size_t size) {
   int avail = BLOCK_SIZE - mBlocks[mFirstAvail].Used;
 
   if (avail < size) {
+    MemAccount(MS_String, 0, 0, avail, 0);
     mFirstAvail++;
     if (mFirstAvail >= mBlocks.size()) {
       addr = AllocBlock();
@@ -100,35 +121,47 @@ char* StringPool::Alloc(const size_t size) {
   SPBlock *b = &mBlocks[mFirstAvail];
   addr = b->Addr + b->Used;
   b->Used += size;
+  mObjects++;
+  MemAccount(MS_String, 0, size, 0, 1);
 
   return addr;
 }
 
 char* StringPool::AllocBlock() {
   char *addr = (char*)malloc(BLOCK_SIZE);
+  MemAccount(MS_String, BLOCK_SIZE, 0, 0, 0);
   SPBlock block = {addr, 0};
   mBlocks.push_back(block);
   return addr;
 }
 
+// A string already in the pool is found without the lock, see StringMap.
+// A string not in gStringPool goes to the local pool of this thread if
+// there is one.
+char* StringPool::FindOrAdd(const std::string &s) {
+  char *addr = mMap->FindAddrFor(s);
+  if (addr)
+    return addr;
+  if (tLocalPool && this == &gStringPool)
+    return tLocalPool->FindOrAdd(s);
+  std::lock_guard<std::mutex> lock(mLock);
+  return mMap->LookupAddrFor(s);
+}
+
 // This is the public interface to find a string in the pool.
 // If not found, add it.
 char* StringPool::FindString(const std::string &s) {
-  return mMap->LookupAddrFor(s);
+  return FindOrAdd(s);
 }
 
 // This is the public interface to find a string in the pool.
 // If not found, add it.
 char* StringPool::FindString(const char *str) {
-  std::string s(str);
-  return mMap->LookupAddrFor(s);
+  return FindOrAdd(std::string(str));
 }
 
 // This is the public interface to find a string in the pool.
 // If not found, add it.
 char* StringPool::FindString(const char *str, size_t len) {
-  std::string s;
-  s.assign(str, len);
-  return mMap->LookupAddrFor(s);
+  return FindOrAdd(std::string(str, len));
 }
-
@@ -0,0 +1,80 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+#include <iostream>
+#include <streambuf>
+#include <mutex>
+
+#include "thread_out.h"
+
+// The string the current thread is writing to. NULL means the original stdout.
+static thread_local std::string *tCapture = NULL;
+
+// ThreadOutBuf replaces the buffer of std::cout. It dispatches each write to
+// tCapture of the writing thread, or to the original stdout buffer.
+class ThreadOutBuf : public std::streambuf {
+private:
+  std::streambuf *mOrig;
+  std::mutex      mOrigLock;  // protect mOrig from concurrent writers.
+public:
+  ThreadOutBuf(std::streambuf *orig) : mOrig(orig) {}
+
+protected:
+  int overflow(int c) {
+    if (c == traits_type::eof())
+      return traits_type::not_eof(c);
+    if (tCapture) {
+      tCapture->push_back((char)c);
+      return c;
+    }
+    std::lock_guard<std::mutex> lock(mOrigLock);
+    return mOrig->sputc((char)c);
+  }
+
+  std::streamsize xsputn(const char *s, std::streamsize n) {
+    if (tCapture) {
+      tCapture->append(s, n);
+      return n;
+    }
+    std::lock_guard<std::mutex> lock(mOrigLock);
+    return mOrig->sputn(s, n);
+  }
+
+  int sync() {
+    if (tCapture)
+      return 0;
+    std::lock_guard<std::mutex> lock(mOrigLock);
+    return mOrig->pubsync();
+  }
+};
+
+static std::once_flag sInstallFlag;
+
+// std::cout gets the dispatching buffer at the first capture. The buffer lives
+// until the end of the process, since std::cout is flushed at exit.
+static void InstallThreadOutBuf() {
+  ThreadOutBuf *buf = new ThreadOutBuf(std::cout.rdbuf());
+  std::cout.rdbuf(buf);
+}
+
+OutCapture::OutCapture(std::string *dest) {
+  std::call_once(sInstallFlag, InstallThreadOutBuf);
+  mPrev = tCapture;
+  tCapture = dest;
+}
+
+OutCapture::~OutCapture() {
+  tCapture = mPrev;
+}
@@ -0,0 +1,152 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+#include <chrono>
+#include <map>
+#include <algorithm>
+#include <iomanip>
+
+#include "timeline.h"
+
+Timeline gTimeline;
+
+static thread_local void *tl_buffer = NULL;
+
+Timeline::Timeline() : mEnabled(false), mOrigin(0) {}
+
+Timeline::~Timeline() {
+  for (unsigned i = 0; i < mBuffers.size(); i++)
+    delete mBuffers[i];
+}
+
+void Timeline::Enable() {
+  mOrigin = 0;
+  mOrigin = Now();
+  mEnabled = true;
+}
+
+uint64_t Timeline::Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count() - mOrigin;
+}
+
+Timeline::Buffer* Timeline::GetBuffer() {
+  if (!tl_buffer) {
+    Buffer *b = new Buffer();
+    std::lock_guard<std::mutex> guard(mLock);
+    b->mTid = mBuffers.size() + 1;
+    mBuffers.push_back(b);
+    tl_buffer = b;
+  }
+  return (Buffer*)tl_buffer;
+}
+
+void Timeline::Add(const char *name, const std::string &detail, uint64_t start, uint64_t end) {
+  Span s;
+  s.mName = name;
+  s.mDetail = detail;
+  s.mStart = start;
+  s.mDur = end - start;
+  GetBuffer()->mSpans.push_back(s);
+}
+
+static void WriteJsonString(std::ostream &os, const std::string &s) {
+  os << '"';
+  for (unsigned i = 0; i < s.size(); i++) {
+    char c = s[i];
+    if (c == '"' || c == '\\')
+      os << '\\' << c;
+    else if ((unsigned char)c < 0x20)
+      os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)c
+         << std::dec << std::setfill(' ');
+    else
+      os << c;
+  }
+  os << '"';
+}
+
+// Complete events ("ph":"X") in microseconds, with a name for each thread.
+void Timeline::WriteChromeTrace(std::ostream &os) {
+  os << "{\"traceEvents\":[";
+  bool first = true;
+  os << std::fixed << std::setprecision(3);
+  for (unsigned i = 0; i < mBuffers.size(); i++) {
+    Buffer *b = mBuffers[i];
+    os << (first ? "\n" : ",\n");
+    first = false;
+    os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << b->mTid
+       << ",\"args\":{\"name\":\"thread " << b->mTid << "\"}}";
+    for (unsigned j = 0; j < b->mSpans.size(); j++) {
+      const Span &s = b->mSpans[j];
+      os << ",\n{\"name\":\"" << s.mName << "\",\"cat\":\"parse\",\"ph\":\"X\""
+         << ",\"pid\":1,\"tid\":" << b->mTid
+         << ",\"ts\":" << s.mStart / 1000.0 << ",\"dur\":" << s.mDur / 1000.0;
+      if (!s.mDetail.empty()) {
+        os << ",\"args\":{\"detail\":";
+        WriteJsonString(os, s.mDetail);
+        os << "}";
+      }
+      os << "}";
+    }
+  }
+  os << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+  os.unsetf(std::ios::floatfield);
+}
+
+struct PhaseSum {
+  uint64_t mCount;
+  uint64_t mTotal;
+  uint64_t mMax;
+};
+
+// The spans of the same name are summed up. Nested phases, eg. lexing inside
+// the traversal, are counted in both.
+void Timeline::Summary(std::ostream &os) {
+  std::map<std::string, PhaseSum> sums;
+  for (unsigned i = 0; i < mBuffers.size(); i++) {
+    Buffer *b = mBuffers[i];
+    for (unsigned j = 0; j < b->mSpans.size(); j++) {
+      const Span &s = b->mSpans[j];
+      PhaseSum &sum = sums[s.mName];
+      sum.mCount++;
+      sum.mTotal += s.mDur;
+      if (s.mDur > sum.mMax)
+        sum.mMax = s.mDur;
+    }
+  }
+
+  std::vector<std::pair<std::string, PhaseSum> > order(sums.begin(), sums.end());
+  std::sort(order.begin(), order.end(),
+            [](const std::pair<std::string, PhaseSum> &a,
+               const std::pair<std::string, PhaseSum> &b) {
+    return a.second.mTotal > b.second.mTotal;
+  });
+
+  os << "================ Phase Timing ================" << std::endl;
+  os << std::left << std::setw(20) << "Phase" << std::right << std::setw(10) << "Count"
+     << std::setw(14) << "Total(ms)" << std::setw(12) << "Avg(us)"
+     << std::setw(12) << "Max(us)" << std::endl;
+  os << std::fixed << std::setprecision(3);
+  for (unsigned i = 0; i < order.size(); i++) {
+    const PhaseSum &s = order[i].second;
+    os << std::left << std::setw(20) << order[i].first << std::right
+       << std::setw(10) << s.mCount
+       << std::setw(14) << s.mTotal / 1000000.0
+       << std::setw(12) << s.mTotal / 1000.0 / s.mCount
+       << std::setw(12) << s.mMax / 1000.0 << std::endl;
+  }
+  os << "Threads: " << mBuffers.size() << std::endl;
+  os.unsetf(std::ios::floatfield);
+}
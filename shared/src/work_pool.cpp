@@ -0,0 +1,148 @@
+/*
+* Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+*
+* OpenArkFE is licensed under the Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*  http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+* FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+*/
+
+#include "work_pool.h"
+#include "massert.h"
+
+// The id of the worker in the pool it belongs to. -1 for non-worker threads.
+static thread_local int tWorkerId = -1;
+static thread_local WorkPool *tWorkerPool = NULL;
+
+unsigned WorkPool::DefaultThreadsNum() {
+  unsigned num = std::thread::hardware_concurrency();
+  return num ? num : 1;
+}
+
+WorkPool::WorkPool(unsigned threads_num) {
+  if (!threads_num)
+    threads_num = DefaultThreadsNum();
+
+  mNextQueue = 0;
+  mPending = 0;
+  mQueued = 0;
+  mStop = false;
+
+  for (unsigned i = 0; i < threads_num; i++)
+    mQueues.push_back(new WorkQueue());
+  for (unsigned i = 0; i < threads_num; i++)
+    mThreads.push_back(std::thread(&WorkPool::WorkerLoop, this, i));
+}
+
+WorkPool::~WorkPool() {
+  {
+    std::lock_guard<std::mutex> lock(mLock);
+    mStop = true;
+  }
+  mWorkCond.notify_all();
+
+  for (unsigned i = 0; i < mThreads.size(); i++)
+    mThreads[i].join();
+  for (unsigned i = 0; i < mQueues.size(); i++)
+    delete mQueues[i];
+}
+
+void WorkPool::Submit(const WorkTask &task) {
+  unsigned id;
+  if (tWorkerPool == this) {
+    id = tWorkerId;
+  } else {
+    std::lock_guard<std::mutex> lock(mLock);
+    id = mNextQueue;
+    mNextQueue = (mNextQueue + 1) % mQueues.size();
+  }
+
+  // The counters are updated before the task is visible in a queue, so that
+  // a fast worker never sees a negative count.
+  {
+    std::lock_guard<std::mutex> lock(mLock);
+    mPending++;
+    mQueued++;
+  }
+
+  WorkQueue *q = mQueues[id];
+  {
+    std::lock_guard<std::mutex> lock(q->mLock);
+    q->mTasks.push_back(task);
+  }
+  mWorkCond.notify_one();
+}
+
+// Take a task from the back of its own queue, or steal one from the front
+// of another queue. Returns false if all queues are empty.
+bool WorkPool::TakeTask(unsigned id, WorkTask &task) {
+  WorkQueue *own = mQueues[id];
+  {
+    std::lock_guard<std::mutex> lock(own->mLock);
+    if (!own->mTasks.empty()) {
+      task = own->mTasks.back();
+      own->mTasks.pop_back();
+      return true;
+    }
+  }
+
+  unsigned num = mQueues.size();
+  for (unsigned i = 1; i < num; i++) {
+    WorkQueue *victim = mQueues[(id + i) % num];
+    std::lock_guard<std::mutex> lock(victim->mLock);
+    if (!victim->mTasks.empty()) {
+      task = victim->mTasks.front();
+      victim->mTasks.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void WorkPool::WorkerLoop(unsigned id) {
+  tWorkerId = id;
+  tWorkerPool = this;
+
+  while (1) {
+    {
+      std::unique_lock<std::mutex> lock(mLock);
+      while (!mStop && !mQueued)
+        mWorkCond.wait(lock);
+      if (mStop && !mQueued)
+        break;
+    }
+
+    WorkTask task;
+    if (!TakeTask(id, task))
+      continue;
+
+    {
+      std::lock_guard<std::mutex> lock(mLock);
+      mQueued--;
+    }
+
+    task();
+
+    std::lock_guard<std::mutex> lock(mLock);
+    mPending--;
+    if (!mPending)
+      mDoneCond.notify_all();
+  }
+
+  tWorkerId = -1;
+  tWorkerPool = NULL;
+}
+
+void WorkPool::Wait() {
+  MASSERT(tWorkerPool != this && "A worker cannot wait for its own pool.");
+  std::unique_lock<std::mutex> lock(mLock);
+  while (mPending)
+    mDoneCond.wait(lock);
+}
@@ -0,0 +1,261 @@
+#!/usr/bin/perl -w
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+#
+# OpenArkFE is licensed under the Mulan PSL v2.
+# You can use this software according to the terms and conditions of the Mulan PSL v2.
+# You may obtain a copy of Mulan PSL v2 at:
+#
+#  http://license.coscl.org.cn/MulanPSL2
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+# FIT FOR A PARTICULAR PURPOSE.
+# See the Mulan PSL v2 for more details.
+#
+# The benchmark of java2mpl over the test corpora.
+#
+# Each file is parsed N times with --timeline, and the fastest run is taken.
+# One more run with --mem-stats gets the AST nodes and the peak RSS. The time
+# of a file is the 'File' phase inside java2mpl, so the process startup is not
+# counted. The results are compared with the baseline, and a file or the total
+# slower than the baseline by more than the threshold is a regression.
+#
+# usage: bench.pl [options] [dir|file ...]
+#   --iterations=N  : runs per file, default 3
+#   --threshold=PCT : allowed slowdown in percent, default 5
+#   --min-ms=MS     : files faster than MS in the baseline are not checked one
+#                     by one, they are too noisy. Default 5
+#   --baseline=FILE : default bench_baseline.json. It's created if missing
+#   --update        : write the results as the new baseline
+#   --output=FILE   : write the results to FILE as well
+#   --verbose       : print the result of each file
+# The default dirs are java2mpl, openjdk and others.
+#
+# Exits with 1 if there is a regression.
+
+use strict;
+use Cwd;
+use JSON::PP;
+use Time::HiRes qw(time);
+
+my $pwd = getcwd;
+my $java2mpl = "$pwd/../build64/java/java2mpl";
+
+my $iterations = 3;
+my $threshold = 5;
+my $min_ms = 5;
+my $baseline_file = "bench_baseline.json";
+my $update = 0;
+my $output_file;
+my $verbose = 0;
+my @inputs;
+
+foreach my $arg (@ARGV) {
+  if ($arg =~ /^--iterations=(\d+)$/) {
+    $iterations = $1 > 0 ? $1 : 1;
+  } elsif ($arg =~ /^--threshold=([\d.]+)$/) {
+    $threshold = $1;
+  } elsif ($arg =~ /^--min-ms=([\d.]+)$/) {
+    $min_ms = $1;
+  } elsif ($arg =~ /^--baseline=(.+)$/) {
+    $baseline_file = $1;
+  } elsif ($arg eq "--update") {
+    $update = 1;
+  } elsif ($arg =~ /^--output=(.+)$/) {
+    $output_file = $1;
+  } elsif ($arg eq "--verbose") {
+    $verbose = 1;
+  } elsif ($arg =~ /^--/) {
+    die "unknown option $arg\n";
+  } else {
+    push(@inputs, $arg);
+  }
+}
+@inputs = ("java2mpl", "openjdk", "others") if (!@inputs);
+
+if (!(-x $java2mpl)) {
+  die "$java2mpl is not built, run make first\n";
+}
+
+sub collect {
+  my ($path, $files) = @_;
+  if (-d $path) {
+    opendir(my $dh, $path) || die "Error in opening dir $path\n";
+    my @entries = sort grep { $_ ne "." && $_ ne ".." } readdir($dh);
+    closedir($dh);
+    foreach my $entry (@entries) {
+      collect("$path/$entry", $files);
+    }
+  } elsif ($path =~ /\.java$/) {
+    push(@$files, $path);
+  }
+}
+
+my @files;
+foreach my $input (@inputs) {
+  collect($input, \@files);
+}
+
+sub count_lines {
+  my ($file) = @_;
+  open(my $fh, "<", $file) || return 0;
+  my $lines = 0;
+  $lines++ while (<$fh>);
+  close($fh);
+  return $lines;
+}
+
+# Run java2mpl on 'file' with 'opts', returns the output and the wall time in ms.
+sub run {
+  my ($file, $opts) = @_;
+  my $start = time();
+  my $output = `$java2mpl $file $opts 2>&1`;
+  my $wall = (time() - $start) * 1000;
+  return ($output, $wall);
+}
+
+sub parse_phases {
+  my ($output) = @_;
+  my %phases;
+  my $in_timing = 0;
+  foreach my $line (split(/\n/, $output)) {
+    if ($line =~ /^=+ Phase Timing =+$/) {
+      $in_timing = 1;
+    } elsif ($in_timing && $line =~ /^(\w+)\s+(\d+)\s+([\d.]+)\s/) {
+      $phases{$1} = $3;
+    } elsif ($in_timing && $line =~ /^Threads:/) {
+      $in_timing = 0;
+    }
+  }
+  return \%phases;
+}
+
+sub rate {
+  my ($num, $ms) = @_;
+  return $ms > 0 ? int($num * 1000 / $ms) : 0;
+}
+
+print("\n====================== run benchmark: @inputs =====================\n");
+print(scalar(@files) . " files, $iterations iterations\n");
+
+my %results;
+my %total = (files => 0, failed => 0, tokens => 0, lines => 0, nodes => 0,
+             time_ms => 0, wall_ms => 0, peak_rss_kb => 0);
+my %total_phases;
+
+foreach my $file (@files) {
+  my $best;
+  my $best_wall;
+  my $tokens = 0;
+  my $ok = 1;
+  for (my $i = 0; $i < $iterations; $i++) {
+    my ($output, $wall) = run($file, "--timeline");
+    $ok = 0 if ($output =~ /Illegal syntax detected!/ || $? != 0);
+    $tokens = $1 while ($output =~ /^Matched (\d+) tokens\./mg);
+    my $phases = parse_phases($output);
+    if (!defined $best || (defined $phases->{"File"} && $phases->{"File"} < $best->{"File"})) {
+      $best = $phases;
+    }
+    $best_wall = $wall if (!defined $best_wall || $wall < $best_wall);
+  }
+
+  my ($output) = run($file, "--mem-stats");
+  my $nodes = 0;
+  my $rss = 0;
+  # Subsystem Reserved Used Wasted Objects PeakRes PeakUsed PeakWst PeakObjs
+  $nodes = $1 if ($output =~ /^Tree\s+\S+\s+\S+\s+\S+\s+\S+\s+\S+\s+\S+\s+\S+\s+(\d+)$/m);
+  $rss = $1 if ($output =~ /^Peak RSS\(KB\): (\d+)$/m);
+
+  my $time = defined $best->{"File"} ? $best->{"File"} : 0;
+  my %r = (ok => $ok, tokens => $tokens + 0, lines => count_lines($file),
+           nodes => $nodes + 0, time_ms => $time + 0, wall_ms => sprintf("%.3f", $best_wall) + 0,
+           peak_rss_kb => $rss + 0, phases => $best);
+  $results{$file} = \%r;
+
+  $total{files}++;
+  $total{failed}++ if (!$ok);
+  $total{$_} += $r{$_} foreach ("tokens", "lines", "nodes", "time_ms", "wall_ms");
+  $total{peak_rss_kb} = $rss if ($rss > $total{peak_rss_kb});
+  $total_phases{$_} += $best->{$_} foreach (keys %$best);
+
+  if ($verbose) {
+    printf("%-60s %s %8.3f ms %8d tok/s %8d lines/s %8d nodes/s %8d KB\n", $file,
+           $ok ? "OK  " : "FAIL", $time, rate($tokens, $time), rate($r{lines}, $time),
+           rate($nodes, $time), $rss);
+  } else {
+    print ".";
+    print " $total{files}\n" if ($total{files} % 50 == 0);
+  }
+}
+print "\n";
+
+$total{tokens_per_sec} = rate($total{tokens}, $total{time_ms});
+$total{lines_per_sec} = rate($total{lines}, $total{time_ms});
+$total{nodes_per_sec} = rate($total{nodes}, $total{time_ms});
+$total{phases} = \%total_phases;
+
+my %report = (iterations => $iterations, total => \%total, files => \%results);
+my $json = JSON::PP->new->pretty->canonical;
+
+print "================ Benchmark Summary ================\n";
+printf("Files: %d  Failed: %d  Lines: %d  Tokens: %d  AST nodes: %d\n",
+       $total{files}, $total{failed}, $total{lines}, $total{tokens}, $total{nodes});
+printf("Parse time: %.3f ms  Wall time: %.3f ms  Peak RSS: %d KB\n",
+       $total{time_ms}, $total{wall_ms}, $total{peak_rss_kb});
+printf("%d tokens/s  %d lines/s  %d nodes/s\n",
+       $total{tokens_per_sec}, $total{lines_per_sec}, $total{nodes_per_sec});
+print "Phase                  Total(ms)\n";
+foreach my $phase (sort { $total_phases{$b} <=> $total_phases{$a} } keys %total_phases) {
+  printf("%-20s %11.3f\n", $phase, $total_phases{$phase});
+}
+
+if ($output_file) {
+  open(my $fh, ">", $output_file) || die "cannot write $output_file\n";
+  print $fh $json->encode(\%report);
+  close($fh);
+}
+
+if ($update || !(-e $baseline_file)) {
+  open(my $fh, ">", $baseline_file) || die "cannot write $baseline_file\n";
+  print $fh $json->encode(\%report);
+  close($fh);
+  print "Baseline is written to $baseline_file\n";
+  exit 0;
+}
+
+open(my $bh, "<", $baseline_file) || die "cannot read $baseline_file\n";
+my $baseline = $json->decode(join("", <$bh>));
+close($bh);
+
+my $limit = 1 + $threshold / 100;
+my @regressions;
+my $base_total = 0;
+my $curr_total = 0;
+foreach my $file (@files) {
+  my $base = $baseline->{files}->{$file};
+  next if (!defined $base);
+  my $time = $results{$file}->{time_ms};
+  # Only the files in both are compared in total.
+  $base_total += $base->{time_ms};
+  $curr_total += $time;
+  next if ($base->{time_ms} < $min_ms);
+  if ($time > $base->{time_ms} * $limit) {
+    push(@regressions, sprintf("%-60s %8.3f ms -> %8.3f ms (+%.1f%%)", $file,
+                               $base->{time_ms}, $time, ($time / $base->{time_ms} - 1) * 100));
+  }
+}
+if ($base_total > 0 && $curr_total > $base_total * $limit) {
+  push(@regressions, sprintf("%-60s %8.3f ms -> %8.3f ms (+%.1f%%)", "Total",
+                             $base_total, $curr_total, ($curr_total / $base_total - 1) * 100));
+}
+
+print "================ Compared with $baseline_file ================\n";
+printf("Total of the files in baseline: %.3f ms -> %.3f ms\n", $base_total, $curr_total);
+if (@regressions) {
+  print scalar(@regressions) . " regressions beyond $threshold%:\n";
+  print "$_\n" foreach (@regressions);
+  exit 1;
+}
+print "No regression beyond $threshold%\n";
+exit 0;
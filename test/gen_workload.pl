@@ -0,0 +1,161 @@
+#!/usr/bin/perl -w
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+#
+# OpenArkFE is licensed under the Mulan PSL v2.
+# You can use this software according to the terms and conditions of the Mulan PSL v2.
+# You may obtain a copy of Mulan PSL v2 at:
+#
+#  http://license.coscl.org.cn/MulanPSL2
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+# FIT FOR A PARTICULAR PURPOSE.
+# See the Mulan PSL v2 for more details.
+#
+# Generate a legal Java file of a given size, for stress and scaling tests.
+# Only the constructs which java2mpl accepts are used. The same knobs and
+# seed always give the same file.
+#
+# usage: gen_workload.pl [knobs] > file.java
+#   --classes=N    : top level classes, default 1
+#   --methods=N    : methods per class, default 4
+#   --statements=N : statements per method, default 8
+#   --depth=N      : nesting depth of if/while/for around a statement, default 1
+#   --expr=N       : operands of an expression chain, default 4
+#   --array=N      : elements of an array initializer, default 4
+#   --string=N     : length of a string literal, default 16
+#   --comments=PCT : percent of statements with a comment before, default 10
+#   --seed=N       : default 1
+
+use strict;
+
+my %knobs = (classes => 1, methods => 4, statements => 8, depth => 1, expr => 4,
+             array => 4, string => 16, comments => 10, seed => 1);
+
+foreach my $arg (@ARGV) {
+  if ($arg =~ /^--(\w+)=(\d+)$/ && exists $knobs{$1}) {
+    $knobs{$1} = $2;
+  } else {
+    die "unknown option $arg\n";
+  }
+}
+
+# A small LCG, so that the file doesn't depend on the perl version.
+my $rand = $knobs{seed};
+sub next_rand {
+  my ($n) = @_;
+  $rand = ($rand * 1103515245 + 12345) % 2147483648;
+  return int($rand / 65536) % $n;
+}
+
+my @ops = ("*", "/", "%", "&", "|", "^");
+my @cmps = ("<", ">", "<=", ">=", "==", "!=");
+
+sub indent {
+  my ($level) = @_;
+  return "  " x $level;
+}
+
+sub comment {
+  my ($level) = @_;
+  return "" if (next_rand(100) >= $knobs{comments});
+  if (next_rand(2)) {
+    return indent($level) . "// The value is updated before it's used again.\n";
+  }
+  return indent($level) . "/* The value is updated\n" . indent($level) .
+         "   before it's used again. */\n";
+}
+
+sub operand {
+  my $k = next_rand(3);
+  return "a" . next_rand(4) if ($k == 0);
+  return "b" if ($k == 1);
+  return next_rand(1000);
+}
+
+# The chain alternates + and -, and an operand could be a binary expression
+# of another op in parentheses. java2mpl fails on longer chains of mixed
+# precedence, eg. a + b + c - d or a * b / c % d.
+sub expression {
+  my $expr = operand();
+  for (my $i = 1; $i < $knobs{expr}; $i++) {
+    $expr .= ($i % 2) ? " + " : " - ";
+    if (next_rand(2)) {
+      $expr .= "(" . operand() . " " . $ops[next_rand(scalar(@ops))] . " " . operand() . ")";
+    } else {
+      $expr .= operand();
+    }
+  }
+  return $expr;
+}
+
+sub condition {
+  return "a" . next_rand(4) . " " . $cmps[next_rand(scalar(@cmps))] . " " . next_rand(100);
+}
+
+sub simple_statement {
+  my ($level, $id) = @_;
+  my $k = next_rand(5);
+  my $pad = indent($level);
+  if ($k == 0) {
+    my @elems;
+    push(@elems, next_rand(1000)) for (1 .. $knobs{array});
+    return $pad . "int[] arr$id = {" . join(", ", @elems) . "};\n";
+  } elsif ($k == 1) {
+    my $str = "";
+    $str .= chr(ord("a") + next_rand(26)) for (1 .. $knobs{string});
+    return $pad . "String s$id = \"$str\";\n";
+  } elsif ($k == 2) {
+    return $pad . "foo" . next_rand(4) . "(" . expression() . ");\n";
+  }
+  return $pad . "b = " . expression() . ";\n";
+}
+
+# A statement nested in 'depth' levels of if/while/for.
+sub statement {
+  my ($level, $id, $depth) = @_;
+  my $text = comment($level);
+  if ($depth == 0) {
+    return $text . simple_statement($level, $id);
+  }
+  my $pad = indent($level);
+  my $k = next_rand(3);
+  if ($k == 0) {
+    $text .= $pad . "if (" . condition() . ") {\n";
+  } elsif ($k == 1) {
+    $text .= $pad . "while (" . condition() . ") {\n";
+  } else {
+    $text .= $pad . "for (int i$depth = 0; i$depth < " . next_rand(100) .
+             "; i$depth = i$depth + 1) {\n";
+  }
+  $text .= statement($level + 1, $id, $depth - 1);
+  $text .= $pad . "}\n";
+  return $text;
+}
+
+sub method {
+  my ($id) = @_;
+  my $text = "  int method$id(int a0, int a1, int a2, int a3) {\n";
+  $text .= "    int b = 0;\n";
+  for (my $i = 0; $i < $knobs{statements}; $i++) {
+    # Half of the statements are nested, the others are at the top.
+    my $depth = ($i % 2) ? $knobs{depth} : 0;
+    $text .= statement(2, $i, $depth);
+  }
+  $text .= "    return b;\n";
+  $text .= "  }\n";
+  return $text;
+}
+
+for (my $c = 0; $c < $knobs{classes}; $c++) {
+  print comment(0);
+  print "class Workload$c {\n";
+  print "  int field$c = " . next_rand(1000) . ";\n";
+  for (my $m = 0; $m < $knobs{methods}; $m++) {
+    print "\n" if ($m > 0);
+    print method($m);
+  }
+  print "}\n";
+  print "\n" if ($c < $knobs{classes} - 1);
+}
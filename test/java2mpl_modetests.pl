@@ -0,0 +1,583 @@
+#!/usr/bin/perl -w
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+#
+# OpenArkFE is licensed under the Mulan PSL v2.
+# You can use this software according to the terms and conditions of the Mulan PSL v2.
+# You may obtain a copy of Mulan PSL v2 at:
+#
+#  http://license.coscl.org.cn/MulanPSL2
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+# FIT FOR A PARTICULAR PURPOSE.
+# See the Mulan PSL v2 for more details.
+#
+# The tests of java2mpl options, which java2mpl_runtests.pl can't cover since
+# it compares the output of plain runs only. Each test runs java2mpl on files
+# of ./java2mpl or generated ones, and checks the output, exit code or the
+# files written.
+#
+# usage: java2mpl_modetests.pl [name ...]
+#   name : only run the tests whose names start with one of them
+#
+# $JAVA2MPL is the java2mpl to test if set, eg. one built with PARSE_EVENTS.
+
+use strict;
+use warnings;
+use Cwd;
+
+my $pwd = getcwd;
+my $java2mpl = $ENV{JAVA2MPL} || "$pwd/../build64/java/java2mpl";
+my $tmpdir = "$pwd/java2mpl_modetests_output";
+
+system("rm -rf $tmpdir");
+system("mkdir -p $tmpdir");
+
+my @failed;
+my $count = 0;
+
+# Runs java2mpl with 'args', returns (exit code, stdout and stderr). A run
+# which hangs is killed after 300 seconds, and exits with 124.
+sub run {
+  my ($args) = @_;
+  my $out = `timeout 300 $java2mpl $args 2>&1`;
+  my $rc = $? >> 8;
+  $rc = 128 + ($? & 127) if ($? & 127);
+  return ($rc, $out);
+}
+
+sub write_file {
+  my ($name, $text) = @_;
+  open(my $fh, '>', $name) or die "Could not open file '$name' $!";
+  print $fh $text;
+  close $fh;
+}
+
+sub check {
+  my ($name, $ok, $msg) = @_;
+  $count++;
+  if ($ok) {
+    print "  pass $name\n";
+  } else {
+    print "  FAIL $name: $msg\n";
+    push(@failed, $name);
+  }
+}
+
+#############################################################################
+#                                 Tests
+#############################################################################
+
+# A /* comment crossing the chunks of the parallel lexer, with quotes in it.
+# The speculative lexing of a chunk starting in the comment can't lex it.
+sub test_parallel_lex_comment {
+  my $file = "$tmpdir/ParallelLexComment.java";
+  # A class body has at most 256 members, see MAX_SUCC_TOKENS.
+  my $text = "";
+  for (my $i = 0; $i < 2000; $i++) {
+    $text .= "class F$i {\n" if ($i % 10 == 0);
+    $text .= "  int f$i = $i;\n";
+    $text .= "}\n" if ($i % 10 == 9);
+  }
+  $text .= "/*\n";
+  for (my $i = 0; $i < 4000; $i++) {
+    $text .= " don't say \"this or 'that $i\n";
+  }
+  $text .= "*/\n";
+  for (my $i = 0; $i < 2000; $i++) {
+    $text .= "class G$i {\n" if ($i % 10 == 0);
+    $text .= "  int g$i = '\\'';\n";
+    $text .= "}\n" if ($i % 10 == 9);
+  }
+  write_file($file, $text);
+
+  my ($rc0, $serial) = run("$file");
+  check("parallel-lex-comment-serial", $rc0 == 0, "exit code $rc0");
+  foreach my $jobs (2, 4) {
+    my ($rc, $out) = run("$file --jobs=$jobs --parallel-lex");
+    check("parallel-lex-comment-jobs$jobs", ($rc == 0) && ($out eq $serial),
+          "exit code $rc, or output differs from the serial one");
+  }
+}
+
+sub read_file {
+  my ($name) = @_;
+  open(my $fh, '<', $name) or return undef;
+  binmode $fh;
+  local $/;
+  my $text = <$fh>;
+  close $fh;
+  return $text;
+}
+
+# A hit of the parse cache writes the AST of --emit-ast as a miss does, even
+# if the entry was stored by a run without --emit-ast.
+sub test_cache_emit_ast {
+  my $file = "$pwd/java2mpl/AbstractStringBuilder.java";
+  my $ast = "$tmpdir/nocache.ast";
+  my ($rc, $out) = run("$file --emit-ast=$ast");
+  my $expected = read_file($ast);
+  check("cache-emit-ast-nocache", $rc == 0 && defined $expected, "exit code $rc");
+
+  foreach my $first ("", "--emit-ast=$tmpdir/first.ast") {
+    my $cache = "$tmpdir/cache" . ($first ? "-emit" : "");
+    my $name = "cache-emit-ast" . ($first ? "-twice" : "-after-plain");
+    run("$file --cache-dir=$cache $first");
+    unlink("$tmpdir/second.ast");
+    ($rc, $out) = run("$file --cache-dir=$cache --emit-ast=$tmpdir/second.ast");
+    my $got = read_file("$tmpdir/second.ast");
+    check($name, $rc == 0 && defined $got && $got eq $expected,
+          "exit code $rc, or the AST differs from the one without cache");
+    if ($first) {
+      my $hit = ($out =~ /Parse cache: 1 hits/) ? 1 : 0;
+      check("$name-hit", $hit, "no cache hit:\n$out");
+    }
+  }
+
+  # Without --emit-ast nobody reads the AST, and it's not stored.
+  my %size;
+  foreach my $opt ("", "--emit-ast=$tmpdir/third.ast") {
+    my $cache = "$tmpdir/cache-size" . ($opt ? "-emit" : "");
+    run("$file --cache-dir=$cache $opt");
+    $size{$opt ? "emit" : "plain"} += -s $_ foreach glob("$cache/*.pc");
+  }
+  check("cache-emit-ast-plain-size", $size{plain} + length($expected) <= $size{emit},
+        "the entry of a plain run is $size{plain} bytes, with the AST $size{emit}");
+}
+
+# A file of illegal syntax exits with 1, from a path, stdin or --reparse.
+sub test_exit_code {
+  my $good = "$tmpdir/Good.java";
+  my $bad = "$tmpdir/Bad.java";
+  write_file($good, "class Good { int f; }\n");
+  write_file($bad, "class Bad { int f = ; }\n");
+
+  foreach my $case (["path", "%s"], ["stdin", "- < %s"], ["reparse", "$good --reparse=%s"]) {
+    my ($name, $args) = @$case;
+    my ($rc, $out) = run(sprintf($args, $good));
+    check("exit-code-$name-good", $rc == 0, "exit code $rc:\n$out");
+    ($rc, $out) = run(sprintf($args, $bad));
+    check("exit-code-$name-bad", $rc == 1, "exit code $rc:\n$out");
+  }
+}
+
+# --reparse splices the reparsed members, or constructs, into the trees of
+# the last parse. The module is the same as a full parse of the edited file.
+sub test_reparse {
+  # Returns the exit code and the output of reparsing 'file' as 'edited',
+  # and the same of parsing 'edited', without the statistics.
+  my $reparse = sub {
+    my ($file, $edited) = @_;
+    my ($rc, $out) = run("$file --reparse=$edited");
+    my ($full_rc, $full) = run($edited);
+    $full =~ s/\Q$edited\E/$file/g;
+    my ($stat) = $out =~ /^Reparsed (.*)$/m;
+    s/^(Matched|Reparsed) .*\n//mg foreach ($out, $full);
+    return ($rc, $out, $full_rc, $full, $stat || "");
+  };
+
+  my $file = "$tmpdir/Reparse.java";
+  my @lines = ("class A {\n", "  int x = 1;\n", "  int y, z;\n", "\n",
+               "  void f() {\n", "    x = x + 2;\n", "  }\n", "  ;\n",
+               "  static { y = 3; }\n", "  A() { z = 4; }\n", "  class B { int q; }\n",
+               "}\n", "class C {\n", "  int w;\n", "}\n");
+  write_file($file, join("", @lines));
+  my @edits = (["body", 5, 1, "    x = x * 5;\n    y = 7;\n", "0 constructs, 1 members"],
+               ["insert", 3, 0, "  int g(int a) { return a; }\n", "0 constructs, 1 members"],
+               ["delete", 2, 1, "", "0 constructs, 0 members"],
+               ["nested", 10, 1, "  class B { int q, r; }\n", "0 constructs, 1 members"],
+               ["second", 13, 1, "  int w, v;\n", "0 constructs, 1 members"],
+               ["header", 0, 1, "class A extends C {\n", "1 constructs, 0 members"],
+               ["illegal", 5, 1, "    x = ;\n", "0 constructs, 0 members"]);
+  foreach my $edit (@edits) {
+    my ($name, $at, $num, $text, $expected) = @$edit;
+    my @new = @lines;
+    splice(@new, $at, $num, $text);
+    my $edited = "$tmpdir/Reparse_$name.java";
+    write_file($edited, join("", @new));
+    my ($rc, $out, $full_rc, $full, $stat) = $reparse->($file, $edited);
+    check("reparse-$name", $rc == $full_rc && $out eq $full && index($stat, $expected) == 0,
+          "exit code $rc, $full_rc, reparsed $stat, or the output differs:\n$out");
+  }
+
+  # An edit of the middle line of each legal file, deleted or doubled.
+  my @diff;
+  foreach my $file (sort glob("$pwd/java2mpl/*.java")) {
+    my @src = split(/^/m, read_file($file));
+    my ($rc) = run($file);
+    next if (@src < 3 || $rc);
+    my $mid = int(@src / 2);
+    foreach my $case (["deleted", ""], ["doubled", $src[$mid] x 2]) {
+      my ($name, $text) = @$case;
+      my @new = @src;
+      splice(@new, $mid, 1, $text);
+      my $edited = "$tmpdir/Reparse_$name.java";
+      write_file($edited, join("", @new));
+      my ($rc, $out, $full_rc, $full) = $reparse->($file, $edited);
+      push(@diff, "$file($name)") if ($rc != $full_rc || $out ne $full);
+    }
+  }
+  check("reparse-agrees", !@diff, "the output differs from parsing on @diff");
+}
+
+# --profile-rules reports the rules only with PARSE_EVENTS, and is rejected
+# by a build without them instead of printing nothing.
+sub test_profile_rules {
+  my $file = "$tmpdir/Profile.java";
+  write_file($file, "class Profile { int f() { return 1 + 2; } }\n");
+  my ($rc, $out) = run("$file --profile-rules");
+  if ($out =~ /needs the parser built with 'make PARSE_EVENTS=1'/) {
+    check("profile-rules-rejected", $rc != 0, "exit code $rc");
+  } else {
+    my $report = ($out =~ /^Total: [1-9]\d* rules/m) ? 1 : 0;
+    check("profile-rules-report", $rc == 0 && $report,
+          "exit code $rc, or no report:\n$out");
+  }
+}
+
+# The lexer thread blocks on a full ring. It must be woken up to go on, or
+# to quit when the parser stops early at illegal syntax.
+sub test_lex_thread {
+  my $text = "";
+  for (my $i = 0; $i < 300; $i++) {
+    $text .= "class F$i {\n";
+    for (my $k = 0; $k < 10; $k++) {
+      $text .= "  int f${i}_$k = $k;\n";
+    }
+    $text .= "}\n";
+  }
+  my $good = "$tmpdir/LexThread.java";
+  my $bad = "$tmpdir/LexThreadBad.java";
+  write_file($good, $text);
+  write_file($bad, "class Bad { int f = ; }\n" . $text);
+
+  my ($rc0, $serial) = run("$good");
+  my ($rc, $out) = run("$good --lex-thread");
+  check("lex-thread-good", $rc0 == 0 && $rc == 0 && $out eq $serial,
+        "exit code $rc, or output differs from the one without --lex-thread");
+  ($rc, $out) = run("$bad --lex-thread");
+  check("lex-thread-stop", $rc == 1, "exit code $rc");
+}
+
+# The module read back from the binary AST of --emit-ast dumps and verifies
+# the same as the one parsed.
+sub test_read_ast {
+  my $pkg = "$tmpdir/Pkg.java";
+  write_file($pkg, "package a.b;\nimport java.util.List;\nimport java.io.*;\n" .
+                   "class Pkg { List<String> l; int f(int x) { return x > 0 ? x : -x; } }\n");
+  my @files = ($pkg);
+  foreach my $name ("annotation-useage", "array-2d", "cast-1", "class-anonymous",
+                    "doloop-1", "enum-1", "forloop-1", "if-else-1", "interface-field",
+                    "label-stmt", "lambda-2", "literal-float-double", "literal-string",
+                    "local-class", "new-stmt-1", "switch-1", "throw-1", "whileloop-1") {
+    push(@files, "$pwd/java2mpl/$name.java");
+  }
+
+  foreach my $file (@files) {
+    my ($name) = $file =~ m|([^/]+)\.java$|;
+    my $ast = "$tmpdir/$name.mast";
+    my ($rc, $direct) = run("$file --emit-ast=$ast");
+    $direct =~ s/^Matched \d+ tokens\.\n//mg;
+    my ($rc2, $read) = run("--read-ast $ast");
+    check("read-ast-$name", $rc == 0 && $rc2 == 0 && $read eq $direct,
+          "exit code $rc and $rc2, or the module differs from the parsed one:\n$read");
+  }
+}
+
+# Batch mode prints the output of each file as a run on the file alone, in
+# the order of the inputs whatever the jobs, then the summary. It exits with
+# 1 if any file fails or is missing.
+sub test_batch {
+  my $bad = "$tmpdir/BatchBad.java";
+  my $missing = "$tmpdir/Missing.java";
+  write_file($bad, "class Bad { int f = ; }\n");
+  my @good;
+  foreach my $name ("class-nested", "enum-1", "lambda-2", "switch-1", "forloop-1", "t1") {
+    push(@good, "$pwd/java2mpl/$name.java");
+  }
+  my @all = (@good[0..2], $bad, @good[3..5], $missing);
+
+  my %single;
+  foreach my $file (@good, $bad) {
+    my ($rc, $out) = run($file);
+    $single{$file} = $out;
+  }
+
+  foreach my $jobs (1, 4) {
+    my ($rc, $out) = run("--batch --jobs=$jobs @good");
+    my $expected = join("", map { $single{$_} } @good);
+    $expected .= "================ Batch Summary ================\n";
+    $expected .= "OK   $_\n" foreach (@good);
+    $expected .= "Total: 6  OK: 6  Failed: 0\n";
+    check("batch-good-jobs$jobs", $rc == 0 && $out eq $expected,
+          "exit code $rc, or the output differs:\n$out");
+
+    ($rc, $out) = run("--batch --jobs=$jobs @all");
+    $expected = join("", map { $_ eq $missing ? "" : $single{$_} } @all);
+    $expected .= "================ Batch Summary ================\n";
+    foreach my $file (@all) {
+      my $status = $file eq $bad ? "FAIL" : ($file eq $missing ? "MISS" : "OK  ");
+      $expected .= "$status $file\n";
+    }
+    $expected .= "Total: 8  OK: 6  Failed: 2\n";
+    check("batch-bad-jobs$jobs", $rc == 1 && $out eq $expected,
+          "exit code $rc, or the output differs:\n$out");
+  }
+}
+
+# Splits the output of --server into [status, payload] frames.
+sub read_frames {
+  my ($out) = @_;
+  my @frames;
+  while ($out =~ /\G(\w+) (\d+)\n/gc) {
+    my ($status, $size) = ($1, $2);
+    my $pos = pos($out);
+    push(@frames, [$status, substr($out, $pos, $size)]);
+    pos($out) = $pos + $size;
+  }
+  my $rest = substr($out, pos($out) || 0);
+  push(@frames, ["junk", $rest]) if ($rest ne "");
+  return @frames;
+}
+
+# The server doesn't run the verifier, so the files are ones it has nothing
+# to say about.
+sub test_server {
+  my @files;
+  foreach my $name ("t1", "class-nested", "call-3", "forloop-1") {
+    push(@files, "$pwd/java2mpl/$name.java");
+  }
+  my %dump;
+  foreach my $file (@files) {
+    my ($rc, $out) = run($file);
+    $out =~ s/^Matched \d+ tokens\.\n//mg;
+    $dump{$file} = $out;
+  }
+  my $ast_file = "$tmpdir/server.ast";
+  run("$files[0] --emit-ast=$ast_file");
+  my $ast = read_file($ast_file);
+
+  my $bad = "class Bad { int f = ; }\n";
+  my $good = "class A { }\n";
+  my $script = "$tmpdir/server.in";
+  my $text = "";
+  $text .= "parse dump $_\n" foreach (@files);
+  $text .= "parse ast $files[0]\n";
+  $text .= "buffer validate " . length($bad) . " Bad.java\n$bad";
+  $text .= "buffer validate " . length($good) . " A.java\n$good";
+  $text .= "parse dump $tmpdir/Missing.java\n";
+  $text .= "bogus request\n";
+  $text .= "parse dump $files[1]\n";
+  $text .= "quit\n";
+  $text .= "parse dump $files[2]\n";
+  write_file($script, $text);
+
+  my @expected;
+  push(@expected, ["ok", $dump{$_}]) foreach (@files);
+  push(@expected, ["ok", $ast]);
+  push(@expected, ["fail", "at token 6 'Semicolon'"]);
+  push(@expected, ["ok", ""]);
+  push(@expected, ["error", "cannot read $tmpdir/Missing.java"]);
+  push(@expected, ["error", "bad request: bogus request"]);
+  push(@expected, ["ok", $dump{$files[1]}]);
+
+  # A queue of 1 makes the reader wait for the writer on every request.
+  foreach my $opts ("--jobs=1", "--jobs=4", "--jobs=4 --queue=1") {
+    my ($rc, $out) = run("--server $opts < $script");
+    my @frames = read_frames($out);
+    my $ok = $rc == 0 && @frames == @expected;
+    for (my $i = 0; $ok && $i < @frames; $i++) {
+      $ok = $frames[$i][0] eq $expected[$i][0] && $frames[$i][1] eq $expected[$i][1];
+    }
+    check("server $opts", $ok, "exit code $rc, or the responses differ:\n$out");
+  }
+
+  # 'shutdown' ends the stream like 'quit', and the end of input ends it too.
+  write_file($script, "buffer dump " . length($good) . " A.java\n${good}shutdown\nparse dump $files[0]\n");
+  my ($rc, $out) = run("--server < $script");
+  my @frames = read_frames($out);
+  check("server-shutdown", $rc == 0 && @frames == 1 && $frames[0][0] eq "ok",
+        "exit code $rc, or the responses differ:\n$out");
+  write_file($script, "parse validate $files[0]\n");
+  ($rc, $out) = run("--server < $script");
+  check("server-eof", $rc == 0 && $out eq "ok 0\n", "exit code $rc, or the response differs:\n$out");
+}
+
+# The single match flags of ladetect only drop matchings which can't be part
+# of a successful parsing, so the output is the same without them.
+sub test_single_match {
+  my $gen = read_file("$pwd/../java/src/gen_lookahead.cpp");
+  my %flags;
+  $flags{$2} = $1 while ($gen =~ /^\s*(true|false), \/\/ (Tbl\w+)$/mg);
+  # Block's ZEROORONE(BlockStatements) is followed by '}' and balanced in
+  # braces. ClassBody, Block and SwitchBlock are delimited by their braces.
+  # Expression and Primary have matchings of many lengths at a token.
+  my %known = ("TblIdentifier" => "true", "TblLiteral" => "true",
+               "TblBlock" => "true", "TblBlock_sub1" => "true",
+               "TblClassBody" => "true", "TblSwitchBlock" => "true",
+               "TblExpression" => "false", "TblPrimary" => "false",
+               "TblArgumentList" => "false");
+  my @wrong = grep { !defined $flags{$_} || $flags{$_} ne $known{$_} } sort keys %known;
+  check("single-match-flags", !@wrong, "wrong flags of @wrong");
+
+  my @files = sort glob("$pwd/java2mpl/*.java");
+  foreach my $opts ("", "--validate", "--lazy-bodies") {
+    my @diff;
+    foreach my $file (@files) {
+      my ($rc, $out) = run("$file $opts");
+      my ($all_rc, $all_out) = run("$file $opts --all-matches");
+      push(@diff, $file) if ($rc != $all_rc || $out ne $all_out);
+    }
+    check("all-matches" . ($opts ? " $opts" : ""), !@diff, "the output differs on @diff");
+  }
+}
+
+# An entry stored by a build of other frontend sources, or other grammar, has
+# another stamp or grammar hash in its name, and is never used.
+sub test_cache_stamp {
+  my $file = "$pwd/java2mpl/t1.java";
+  my $cache = "$tmpdir/cache-stamp";
+  my ($rc, $expected) = run($file);
+  run("$file --cache-dir=$cache");
+  my @entries = glob("$cache/*.pc");
+  my $named = (@entries == 1 && $entries[0] =~ /-[0-9a-f]{16}-[0-9a-f]{16}\.pc$/) ? 1 : 0;
+  check("cache-stamp-name", $named, "the entries are @entries");
+  return if (!$named);
+
+  my ($out, $hit);
+  foreach my $part ("stamp", "grammar") {
+    (my $other = $entries[0]) =~ s/-([0-9a-f]{16})-([0-9a-f]{16})\.pc$/
+      $part eq "stamp" ? "-$1-0000000000000000.pc" : "-0000000000000000-$2.pc"/e;
+    rename($entries[0], $other);
+    ($rc, $out) = run("$file --cache-dir=$cache");
+    $hit = ($out =~ /Parse cache: 0 hits, 1 misses/) ? 1 : 0;
+    $out =~ s/^Parse cache: .*\n//m;
+    check("cache-$part-miss", $hit && $out eq $expected && -e $entries[0],
+          "the entry of another $part is used, or not stored again:\n$out");
+    unlink($other);
+  }
+  ($rc, $out) = run("$file --cache-dir=$cache");
+  $hit = ($out =~ /Parse cache: 1 hits/) ? 1 : 0;
+  check("cache-stamp-hit", $hit, "no cache hit:\n$out");
+}
+
+# Each budget stops the deeply nested expression with its diagnostic, and
+# the file is illegal. A budget big enough changes nothing.
+sub test_budget {
+  my $deep = "$tmpdir/Deep.java";
+  write_file($deep, "class Deep { int f() { return " . ("(" x 200) . "1" . (")" x 200) . "; } }\n");
+  my ($rc, $expected) = run($deep);
+  check("budget-none", $rc == 0, "exit code $rc");
+
+  foreach my $case (["nodes=1000", "1000 AppealNodes"], ["waves=10", "10 waves"],
+                    ["matches=1", "1 matches"], ["ms=1", "1 ms"]) {
+    my ($opt, $what) = @$case;
+    my ($rc, $out) = run("$deep --budget-$opt");
+    my $diag = ($out =~ /^Budget exceeded: $what in rule Tbl\w+ at token \d+ '[^']*', construct from token 0 'class'$/m) ? 1 : 0;
+    check("budget-$opt", $rc == 1 && $diag && $out =~ /Illegal syntax detected/,
+          "exit code $rc, or no diagnostic:\n$out");
+  }
+
+  my ($big_rc, $out) = run("$deep --budget-nodes=10000000 --budget-waves=1000000 --budget-ms=600000");
+  check("budget-big", $big_rc == 0 && $out eq $expected, "exit code $big_rc, or the output differs");
+
+  # The work of a node doesn't grow with the depth, so a node budget stops
+  # deep nesting quickly too.
+  write_file($deep, "class Deep { int f() { return " . ("(" x 3000) . "1" . (")" x 3000) . "; } }\n");
+  my $start = time();
+  ($rc, $out) = run("$deep --budget-nodes=100000");
+  my $secs = time() - $start;
+  check("budget-nodes-deep", $rc == 1 && $secs < 60, "exit code $rc after $secs seconds");
+}
+
+# --validate prints PASS, or the furthest token reached by the traversal,
+# counted from the start of the file. It agrees with the exit code of a full
+# parsing, also when the parsing is in parallel.
+sub test_validate {
+  my $good = "$tmpdir/ValGood.java";
+  write_file($good, "class A {\n  int x = 1;\n  void f() { x = x + 2; }\n}\n");
+  my ($rc, $out) = run("$good --validate");
+  check("validate-pass", $rc == 0 && $out eq "$good: PASS\n", "exit code $rc:\n$out");
+
+  my @bad = (["init", "class A {\n  int x = ;\n}\n", "6 'Semicolon'"],
+             ["expr", "class A {\n  void f() {\n    int y = 1 +* 2;\n  }\n}\n", "13 'Mul'"],
+             ["second", "class A {\n  int x;\n}\nclass B {\n  int y = )\n}\n", "13 'Rparen'"]);
+  foreach my $case (@bad) {
+    my ($name, $text, $token) = @$case;
+    my $file = "$tmpdir/ValBad_$name.java";
+    write_file($file, $text);
+    foreach my $opts ("", " --jobs=4") {
+      ($rc, $out) = run("$file --validate$opts");
+      check("validate-fail-$name$opts", $rc == 1 && $out eq "$file: FAIL at token $token\n",
+            "exit code $rc:\n$out");
+    }
+  }
+
+  my @diff;
+  foreach my $file (sort glob("$pwd/java2mpl/*.java")) {
+    my ($full_rc) = run($file);
+    ($rc, $out) = run("$file --validate");
+    my $line = $full_rc == 0 ? qr/^\Q$file\E: PASS\n\z/ : qr/^\Q$file\E: FAIL at token \d+ '\w+'\n\z/;
+    push(@diff, $file) if ($rc != $full_rc || $out !~ $line);
+  }
+  check("validate-agrees", !@diff, "the result differs from parsing on @diff");
+}
+
+# The compiled rule tables and the lookahead of subtables change nothing but
+# the traversal, so --interpret gives the same output, also of the files in
+# error and of --validate.
+sub test_interpret {
+  my @files = (sort(glob("$pwd/java2mpl/*.java")), sort(glob("$pwd/openjdk/*.java")),
+               sort(glob("$pwd/errtest/*.java")));
+  foreach my $opts ("", "--validate") {
+    my @diff;
+    foreach my $file (@files) {
+      my ($rc, $out) = run("$file $opts");
+      my ($int_rc, $int_out) = run("$file $opts --interpret");
+      push(@diff, $file) if ($rc != $int_rc || $out ne $int_out);
+    }
+    check("interpret" . ($opts ? " $opts" : ""), !@diff, "the output differs on @diff");
+  }
+}
+
+my @tests = (
+  ["parallel-lex", \&test_parallel_lex_comment],
+  ["cache-emit-ast", \&test_cache_emit_ast],
+  ["cache-stamp", \&test_cache_stamp],
+  ["exit-code", \&test_exit_code],
+  ["reparse", \&test_reparse],
+  ["validate", \&test_validate],
+  ["budget", \&test_budget],
+  ["profile-rules", \&test_profile_rules],
+  ["lex-thread", \&test_lex_thread],
+  ["read-ast", \&test_read_ast],
+  ["batch", \&test_batch],
+  ["server", \&test_server],
+  ["single-match", \&test_single_match],
+  ["interpret", \&test_interpret],
+);
+
+print("\n====================== run mode tests =====================\n");
+foreach my $test (@tests) {
+  my ($name, $func) = @$test;
+  if (@ARGV) {
+    next unless grep { index($name, $_) == 0 } @ARGV;
+  }
+  print "$name\n";
+  $func->();
+}
+
+if (!@failed) {
+  print("\n all $count mode tests passed\n");
+  print("======================================================\n");
+  system("rm -rf $tmpdir");
+  exit 0;
+}
+
+print "\n=========================\nfailed ".scalar(@failed)." of $count mode tests:\n\n";
+foreach my $f (@failed) {
+  print "$f\n";
+}
+print "=========================\n";
+exit 1;
@@ -0,0 +1,21 @@
+//
+//Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+//
+//OpenArkFE is licensed under the Mulan PSL v2.
+//You can use this software according to the terms and conditions of the Mulan PSL v2.
+//You may obtain a copy of Mulan PSL v2 at:
+//
+// http://license.coscl.org.cn/MulanPSL2
+//
+//THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+//EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+//FIT FOR A PARTICULAR PURPOSE.
+//See the Mulan PSL v2 for more details.
+//
+public class A {
+    public int foo() {
+        int[] ba = new boolean[] {1};
+        int array[] = { 1, 2, 3, 4, 5 };
+        String array[] = new String[] {"Toyota", "Mercedes", "BMW", "Volkswagen", "Skoda" };
+    }
+}
@@ -0,0 +1,5 @@
+class A {
+    void replace() {
+        return count + len - end;
+    }
+}
@@ -0,0 +1,6 @@
+class A {
+   void foo() {
+     Arrays.fill(value, count, newLength, '\0');
+   }
+}
+
@@ -76,7 +76,8 @@ while( ($srcdir = readdir(DIR))){
 
       system("cp $src_file $outdir/$src_file");
       $res = system("cd $pwd/..; build64/java/java2mpl $outdir/$src_file > $outdir/$java2mpl_result_file");
-      if ($res > 0) {
+      # Exit code 1 is illegal syntax, whose output is compared as well.
+      if ($res > 0 && $res != 256) {
         print "\ngdb --args ../build64/java/java2mpl $outdir/$src_file\n";
         print " ==java2mpl===> $file\n\n";
         $countJAVA2MPL ++;
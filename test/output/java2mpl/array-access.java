@@ -0,0 +1,5 @@
+class AbstractStringBuilder {
+    char charAt() {
+        return value[index];
+    }
+}
@@ -0,0 +1,115 @@
+#!/usr/bin/perl -w
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+#
+# OpenArkFE is licensed under the Mulan PSL v2.
+# You can use this software according to the terms and conditions of the Mulan PSL v2.
+# You may obtain a copy of Mulan PSL v2 at:
+#
+#  http://license.coscl.org.cn/MulanPSL2
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+# FIT FOR A PARTICULAR PURPOSE.
+# See the Mulan PSL v2 for more details.
+#
+# Check the rule optimizer of autogen against the unoptimized rules.
+#
+# java2mpl is built again in a copy of the tree for each variant, with the
+# rules optimized by none or one of the passes of RuleOptimizer, see
+# 'autogen -opt='. The output of every file of java2mpl and openjdk is
+# compared with the output of build64/java/java2mpl, which has all the passes.
+#
+# usage: rule_opt.pl [options] [variant ...]
+#   --jobs=N : make jobs, default 8
+#   --keep   : keep the copies in rule_opt_output
+# The variants are none, inline, flatten, factor and share. All of them by
+# default.
+
+use strict;
+use Cwd;
+
+my $pwd = getcwd;
+my $rootdir = "$pwd/..";
+my $java2mpl = "$rootdir/build64/java/java2mpl";
+my $outdir = "$pwd/rule_opt_output";
+
+my %flags = (none => "-no-opt", inline => "-opt=inline", flatten => "-opt=flatten",
+             factor => "-opt=factor", share => "-opt=share");
+my @all_variants = ("none", "inline", "flatten", "factor", "share");
+
+my $jobs = 8;
+my $keep = 0;
+my @variants;
+
+foreach my $arg (@ARGV) {
+  if ($arg =~ /^--jobs=(\d+)$/) {
+    $jobs = $1 > 0 ? $1 : 1;
+  } elsif ($arg eq "--keep") {
+    $keep = 1;
+  } elsif ($arg =~ /^--/) {
+    die "unknown option $arg\n";
+  } elsif (exists $flags{$arg}) {
+    push(@variants, $arg);
+  } else {
+    die "unknown variant $arg\n";
+  }
+}
+@variants = @all_variants if (!@variants);
+
+if (!(-x $java2mpl)) {
+  die "$java2mpl is not built\n";
+}
+
+my @files = (sort(glob("$pwd/java2mpl/*.java")), sort(glob("$pwd/openjdk/*.java")));
+
+# Returns the exit code and the output of 'binary' on 'file'.
+sub run {
+  my ($binary, $file) = @_;
+  my $out = `timeout 300 $binary $file 2>&1`;
+  return ($? >> 8, $out);
+}
+
+my %expected;
+foreach my $file (@files) {
+  my ($rc, $out) = run($java2mpl, $file);
+  $expected{$file} = "$rc\n$out";
+}
+
+system("rm -rf $outdir");
+my @failed;
+foreach my $variant (@variants) {
+  my $dir = "$outdir/$variant";
+  system("mkdir -p $dir");
+  foreach my $src ("Makefile", "Makefile.in", "autogen", "shared", "java", "recdetect", "ladetect") {
+    system("cp -r $rootdir/$src $dir/");
+  }
+
+  print("$variant: building with 'autogen $flags{$variant}'\n");
+  my $log = "$outdir/$variant.log";
+  if (system("make -C $dir ROOTDIR=$dir AUTOGENFLAGS=$flags{$variant} -j$jobs java2mpl > $log 2>&1")) {
+    print("  build failed, see $log\n");
+    push(@failed, $variant);
+    next;
+  }
+
+  my @diff;
+  foreach my $file (@files) {
+    my ($rc, $out) = run("$dir/build64/java/java2mpl", $file);
+    push(@diff, $file) if ("$rc\n$out" ne $expected{$file});
+  }
+  if (@diff) {
+    print("  output differs on:\n");
+    print("    $_\n") foreach (@diff);
+    push(@failed, $variant);
+  } else {
+    print("  same output on " . scalar(@files) . " files\n");
+  }
+}
+
+if (@failed) {
+  print("\nfailed: @failed\n");
+  exit 1;
+}
+system("rm -rf $outdir") if (!$keep);
+print("\nall " . scalar(@variants) . " variants passed\n");
@@ -109,7 +109,8 @@ foreach my $dir (@dirname) {
           $res = system("cd $pwd/..; build64/java/java2mpl $outdir/$src_file > $outdir/$result_file");
         }
         
-        if ($res > 0) {
+        # Exit code 1 is illegal syntax, whose output is compared as well.
+        if ($res > 0 && $res != 256) {
 #print "over here1...\n";
           if ($dir eq "java2mpl") { 
             print "$pwd/../build64/java/java2mpl $outdir/$src_file\n";
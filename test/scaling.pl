@@ -0,0 +1,181 @@
+#!/usr/bin/perl -w
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc. All rights reverved.
+#
+# OpenArkFE is licensed under the Mulan PSL v2.
+# You can use this software according to the terms and conditions of the Mulan PSL v2.
+# You may obtain a copy of Mulan PSL v2 at:
+#
+#  http://license.coscl.org.cn/MulanPSL2
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+# FIT FOR A PARTICULAR PURPOSE.
+# See the Mulan PSL v2 for more details.
+#
+# Chart the parse time and memory of java2mpl against each knob of
+# gen_workload.pl.
+#
+# One knob is doubled at a time from its start value, the others keep their
+# defaults. The growth of a step is the log-log slope of the parse time over
+# the tokens. 1.0 is linear, and a step above --limit is marked super-linear.
+# It's not given if the tokens grow less than 10%, eg. for comments.
+# A sweep stops at the first failure or timeout.
+#
+# usage: scaling.pl [options] [knob ...]
+#   --steps=N      : points of each sweep, default 6
+#   --iterations=N : runs of each point, the fastest is taken. Default 1
+#   --timeout=SEC  : limit of a run, default 60
+#   --limit=SLOPE  : default 1.3
+#   --csv=FILE     : write all the points to FILE
+#   --keep         : keep the generated files in scaling_output
+# The knobs are classes, methods, statements, depth, expr, array, string and
+# comments. All of them by default.
+
+use strict;
+use Cwd;
+
+my $pwd = getcwd;
+my $java2mpl = "$pwd/../build64/java/java2mpl";
+my $generator = "$pwd/gen_workload.pl";
+my $outdir = "$pwd/scaling_output";
+
+# The start value of each knob. comments goes up linearly to 100.
+my %start = (classes => 1, methods => 1, statements => 8, depth => 1, expr => 4,
+             array => 4, string => 16, comments => 0);
+my @all_knobs = ("classes", "methods", "statements", "depth", "expr", "array",
+                 "string", "comments");
+
+my $steps = 6;
+my $iterations = 1;
+my $timeout = 60;
+my $limit = 1.3;
+my $csv_file;
+my $keep = 0;
+my @knobs;
+
+foreach my $arg (@ARGV) {
+  if ($arg =~ /^--steps=(\d+)$/) {
+    $steps = $1 > 1 ? $1 : 2;
+  } elsif ($arg =~ /^--iterations=(\d+)$/) {
+    $iterations = $1 > 0 ? $1 : 1;
+  } elsif ($arg =~ /^--timeout=(\d+)$/) {
+    $timeout = $1;
+  } elsif ($arg =~ /^--limit=([\d.]+)$/) {
+    $limit = $1;
+  } elsif ($arg =~ /^--csv=(.+)$/) {
+    $csv_file = $1;
+  } elsif ($arg eq "--keep") {
+    $keep = 1;
+  } elsif ($arg =~ /^--/) {
+    die "unknown option $arg\n";
+  } elsif (exists $start{$arg}) {
+    push(@knobs, $arg);
+  } else {
+    die "unknown knob $arg\n";
+  }
+}
+@knobs = @all_knobs if (!@knobs);
+
+if (!(-x $java2mpl)) {
+  die "$java2mpl is not built, run make first\n";
+}
+system("mkdir -p $outdir");
+
+# Parse 'file' and return (status, tokens, time_ms, peak_used_kb, rss_kb).
+# The status is OK, FAIL or TIMEOUT.
+sub measure {
+  my ($file) = @_;
+  my $best;
+  my $tokens = 0;
+  for (my $i = 0; $i < $iterations; $i++) {
+    my $output = `timeout $timeout $java2mpl $file --timeline 2>&1`;
+    my $code = $? >> 8;
+    return ("TIMEOUT", 0, 0, 0, 0) if ($code == 124);
+    return ("FAIL", 0, 0, 0, 0) if ($? != 0 || $output =~ /Illegal syntax detected!/);
+    $tokens = $1 while ($output =~ /^Matched (\d+) tokens\./mg);
+    if ($output =~ /^File\s+\d+\s+([\d.]+)\s/m) {
+      $best = $1 if (!defined $best || $1 < $best);
+    }
+  }
+
+  my $output = `timeout $timeout $java2mpl $file --mem-stats 2>&1`;
+  return ("TIMEOUT", 0, 0, 0, 0) if (($? >> 8) == 124);
+  my $used = 0;
+  my $rss = 0;
+  # Subsystem Reserved Used Wasted Objects PeakRes PeakUsed PeakWst PeakObjs
+  $used = $1 if ($output =~ /^Total\s+\S+\s+\S+\s+\S+\s+\S+\s+\S+\s+(\S+)\s/m);
+  $rss = $1 if ($output =~ /^Peak RSS\(KB\): (\d+)$/m);
+  return ("OK", $tokens, $best, $used, $rss);
+}
+
+sub knob_value {
+  my ($knob, $step) = @_;
+  if ($knob eq "comments") {
+    return int(100 * $step / ($steps - 1));
+  }
+  return $start{$knob} * (2 ** $step);
+}
+
+my @csv = ("knob,value,status,tokens,time_ms,peak_used_kb,peak_rss_kb");
+my @superlinear;
+
+foreach my $knob (@knobs) {
+  print "================ $knob ================\n";
+  printf("%10s %10s %12s %10s %12s %10s %7s\n", "Value", "Tokens", "Time(ms)",
+         "us/token", "PeakUsed(KB)", "RSS(KB)", "Slope");
+  my @points;
+  for (my $step = 0; $step < $steps; $step++) {
+    my $value = knob_value($knob, $step);
+    my $file = "$outdir/$knob-$value.java";
+    system("$generator --$knob=$value > $file") == 0 || die "cannot run $generator\n";
+    my ($status, $tokens, $ms, $used, $rss) = measure($file);
+    unlink($file) if (!$keep);
+    push(@csv, "$knob,$value,$status,$tokens,$ms,$used,$rss");
+    if ($status ne "OK") {
+      printf("%10d %10s\n", $value, $status);
+      last;
+    }
+
+    my $slope = "";
+    if (@points) {
+      my $prev = $points[-1];
+      # The slope means nothing if the knob hardly changes the tokens.
+      if ($tokens > $prev->{tokens} * 1.1 && $prev->{ms} > 0 && $ms > 0) {
+        $slope = log($ms / $prev->{ms}) / log($tokens / $prev->{tokens});
+        push(@superlinear, sprintf("%s %d -> %d: slope %.2f", $knob, $prev->{value},
+                                   $value, $slope)) if ($slope > $limit);
+        $slope = sprintf("%.2f", $slope);
+      }
+    }
+    printf("%10d %10d %12.3f %10.3f %12s %10d %7s\n", $value, $tokens, $ms,
+           $tokens ? $ms * 1000 / $tokens : 0, $used, $rss, $slope);
+    push(@points, {value => $value, tokens => $tokens, ms => $ms});
+  }
+
+  # The chart of the time, scaled to the slowest point.
+  my $max = 0;
+  foreach my $p (@points) {
+    $max = $p->{ms} if ($p->{ms} > $max);
+  }
+  foreach my $p (@points) {
+    my $bar = $max > 0 ? int(50 * $p->{ms} / $max + 0.5) : 0;
+    printf("%10d |%s\n", $p->{value}, "#" x $bar);
+  }
+}
+
+if ($csv_file) {
+  open(my $fh, ">", $csv_file) || die "cannot write $csv_file\n";
+  print $fh "$_\n" foreach (@csv);
+  close($fh);
+}
+system("rmdir $outdir 2>/dev/null") if (!$keep);
+
+print "================ Scaling Summary ================\n";
+if (@superlinear) {
+  print "Super-linear steps, slope above $limit:\n";
+  print "$_\n" foreach (@superlinear);
+} else {
+  print "No step above slope $limit\n";
+}
+exit 0;